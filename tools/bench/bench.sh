@@ -0,0 +1,183 @@
+#!/bin/bash
+# Generate a synthetic CSDB and time a set of s1kd-tools over it.
+#
+# The report lists the wall-clock time in seconds and the exit status of each
+# tool, one per line, so reports from different builds or machines can be
+# compared with diff(1) or join(1).
+
+set -e -o pipefail
+
+dms=1000
+refs=5
+seed=1
+icns=
+parts=100
+paras=10
+repeat=1
+workdir=work
+report=
+stats=0
+
+usage()
+{
+	echo "Usage: bench.sh [-hS] [-c <n>] [-i <n>] [-n <n>] [-o <file>] [-p <n>] [-r <n>] [-R <n>] [-s <seed>] [-w <dir>]"
+	echo
+	echo "Options:"
+	echo "  -c <n>     Number of parts in the parts CIR (default 100)."
+	echo "  -h         Show help/usage message."
+	echo "  -i <n>     Number of ICNs (default one for every ten DMs)."
+	echo "  -n <n>     Number of data modules (default 1000)."
+	echo "  -o <file>  Write the report to <file> as well as stdout."
+	echo "  -p <n>     Number of paragraphs or steps in each DM (default 10)."
+	echo "  -R <n>     Run each tool <n> times and report the fastest (default 1)."
+	echo "  -r <n>     Number of references in each DM (default 5)."
+	echo "  -S         Collect per-phase statistics (S1KD_STATS) in <dir>/stats."
+	echo "  -s <seed>  Seed for the random content (default 1)."
+	echo "  -w <dir>   Working directory (default work)."
+	echo
+	echo "Environment:"
+	echo "  S1KD_BENCH_SCHEMAS  Directory of S1000D 4.2 schemas for s1kd-validate."
+}
+
+while getopts "c:hi:n:o:p:R:r:Ss:w:" opt
+do
+	case "$opt" in
+		c) parts="$OPTARG";;
+		h) usage; exit 0;;
+		i) icns="$OPTARG";;
+		n) dms="$OPTARG";;
+		o) report="$OPTARG";;
+		p) paras="$OPTARG";;
+		R) repeat="$OPTARG";;
+		r) refs="$OPTARG";;
+		S) stats=1;;
+		s) seed="$OPTARG";;
+		w) workdir="$OPTARG";;
+		*) usage >&2; exit 1;;
+	esac
+done
+
+here=$(cd "$(dirname "$0")" && pwd)
+
+# Use the tools built in this tree where available, otherwise those on PATH.
+tool()
+{
+	if test -x "$here/../$1/$1"
+	then
+		echo "$here/../$1/$1"
+	else
+		command -v "$1"
+	fi
+}
+
+# Tools which run other tools (s1kd-appcheck) should also use the ones in this
+# tree.
+for dir in "$here"/../s1kd-*
+do
+	if test -x "$dir/$(basename "$dir")"
+	then
+		PATH="$dir:$PATH"
+	fi
+done
+export PATH
+
+if ! test -x "$here/gencsdb"
+then
+	make -s -C "$here" gencsdb
+fi
+
+mkdir -p "$workdir"
+workdir=$(cd "$workdir" && pwd)
+csdb="$workdir/csdb"
+out="$workdir/out"
+
+rm -rf "$csdb" "$out" "$workdir/stats"
+mkdir -p "$out"
+
+"$here/gencsdb" -d "$csdb" -n "$dms" -r "$refs" -s "$seed" -c "$parts" -p "$paras" ${icns:+-i "$icns"}
+
+cd "$csdb"
+
+cir=$(echo DMC-*-00GA-D_*.XML)
+
+# The objects queried with s1kd-refs -w: ten DMs spread across the CSDB.
+targets=$(ls DMC-*-040A-D_*.XML | awk -v n="$dms" 'NR % int(n / 10 + 1) == 1' | head -n 10)
+
+# s1kd-appcheck validates each instance with s1kd-validate by default, which
+# needs the schemas. Without them, check each instance against the BREX.
+if test -n "$S1KD_BENCH_SCHEMAS"
+then
+	validator="s1kd-validate -e -q -d '$S1KD_BENCH_SCHEMAS'"
+else
+	validator="s1kd-brexcheck -cel -q"
+fi
+
+# Time a command, printing the fastest of $repeat runs and the exit status of
+# the command. Many of the tools exit with a non-zero status when they find
+# errors in the CSDB, so that alone does not fail the benchmark, but a tool
+# killed by a signal does, after the rest of the tools have been timed.
+crashed=0
+
+run()
+{
+	local name="$1"
+	local best=
+	local status=
+	local i t s
+	shift
+
+	for ((i = 0; i < repeat; ++i))
+	do
+		if test "$stats" -eq 1
+		then
+			export S1KD_STATS=json
+			export S1KD_STATS_FILE="$workdir/stats/$name.json"
+			mkdir -p "$workdir/stats"
+		fi
+
+		t=$( { TIMEFORMAT=%R; time "$@" > /dev/null 2> "$out/$name.err"; } 2>&1 ) && s=0 || s=$?
+
+		if test "$s" -gt 128
+		then
+			crashed=1
+		fi
+
+		# A status which differs between runs is reported as all of them.
+		if test -z "$status"
+		then
+			status="$s"
+		elif test "$s" != "${status##*,}"
+		then
+			status="$status,$s"
+		fi
+
+		if test -z "$best" || awk -v a="$t" -v b="$best" 'BEGIN { exit !(a < b) }'
+		then
+			best="$t"
+		fi
+	done
+
+	printf "%s\t%s\t%s\n" "$name" "$best" "$status"
+}
+
+{
+	echo "# s1kd-tools benchmark"
+	echo "# dms=$dms refs=$refs paras=$paras parts=$parts icns=${icns:-$((dms / 10))} seed=$seed repeat=$repeat"
+	echo "# objects=$(ls | wc -l) size=$(du -sk . | cut -f1)K"
+	echo "# host=$(uname -srm) cpus=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)"
+
+	run s1kd-refs "$(tool s1kd-refs)" -w $targets
+	run s1kd-brexcheck "$(tool s1kd-brexcheck)" DMC-*.XML PMC-*.XML
+
+	if test -n "$S1KD_BENCH_SCHEMAS"
+	then
+		run s1kd-validate "$(tool s1kd-validate)" -d "$S1KD_BENCH_SCHEMAS" DMC-*.XML PMC-*.XML
+	fi
+
+	run s1kd-instance "$(tool s1kd-instance)" -f -s version:prodattr=A -R "$cir" -O "$out/instance" DMC-*-040A-D_*.XML DMC-*-520A-D_*.XML
+	run s1kd-flatten "$(tool s1kd-flatten)" PMC-*.XML
+	run s1kd-appcheck "$(tool s1kd-appcheck)" -a -e "$validator" DMC-*-040A-D_*.XML DMC-*-520A-D_*.XML
+	run s1kd-acronyms "$(tool s1kd-acronyms)" -m DMC-*-040A-D_*.XML DMC-*-520A-D_*.XML
+
+	exit "$crashed"
+} | tee ${report:+"$report"}
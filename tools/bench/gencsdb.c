@@ -0,0 +1,706 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <getopt.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#define PROG_NAME "gencsdb"
+#define VERSION "1.0.0"
+
+#define ERR_PREFIX PROG_NAME ": ERROR: "
+
+#define E_BAD_NUMBER ERR_PREFIX "Bad number for -%c: %s\n"
+#define E_MKDIR ERR_PREFIX "Could not create directory %s: %s\n"
+#define E_WRITE ERR_PREFIX "Could not write %s: %s\n"
+
+#define EXIT_BAD_NUMBER 1
+#define EXIT_OS_ERROR 2
+
+/* Codes shared by all generated objects. */
+#define MODEL_IDENT_CODE "BENCH"
+#define SYSTEM_DIFF_CODE "A"
+#define CAGE_CODE "00000"
+#define SCHEMA_URL "http://www.s1000d.org/S1000D_4-2/xml_schema_flat/"
+
+/* One in this many references is to an object which is not in the CSDB. */
+#define UNMATCHED_REF_RATE 20
+
+/* One in this many data modules is procedural, the rest are descriptive. */
+#define PROCEDURAL_RATE 4
+
+/* One in this many data modules contains a figure. */
+#define FIGURE_RATE 2
+
+/* One in this many paragraphs and steps has its own applicability. */
+#define APPLIC_RATE 3
+
+/* Values of the product attribute and condition used for applicability. */
+static const char *versions[] = {"A", "B", "C"};
+#define VERSION_COUNT (sizeof(versions) / sizeof(versions[0]))
+static const char *ice_values[] = {"icy", "dry"};
+#define ICE_VALUE_COUNT (sizeof(ice_values) / sizeof(ice_values[0]))
+
+/* Acronyms defined in the .acronyms file and used in the text of DMs. */
+static const char *acronyms[][2] = {
+	{"BREX", "Business Rules Exchange"},
+	{"CSDB", "Common Source Database"},
+	{"ICN", "Information Control Number"},
+	{"SNS", "Standard Numbering System"},
+	{"CIR", "Common Information Repository"}
+};
+#define ACRONYM_COUNT (sizeof(acronyms) / sizeof(acronyms[0]))
+
+/* Minimal 1x1 PNG used as the content of every ICN. */
+static const unsigned char png[] = {
+	0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
+	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+	0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0x15, 0xc4, 0x89, 0x00, 0x00, 0x00,
+	0x0d, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0x63, 0xf8, 0xff, 0xff, 0x3f,
+	0x00, 0x05, 0xfe, 0x02, 0xfe, 0xa7, 0x35, 0x81, 0x84, 0x00, 0x00, 0x00,
+	0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+
+/* Size of the CSDB to generate. */
+static int ndms = 1000;
+static int nrefs = 5;
+static int nicns = -1;
+static int nparts = 100;
+static int nparas = 10;
+
+/* Output directory. */
+static const char *outdir = "csdb";
+
+/* State of the pseudo-random number generator (xorshift32), so that the same
+ * CSDB is generated on every platform for a given seed. */
+static unsigned int rng = 1;
+
+static unsigned int next_rand(void)
+{
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/* Return a number from 0 to n - 1. */
+static int rand_below(int n)
+{
+	return n > 0 ? (int) (next_rand() % n) : 0;
+}
+
+/* Open a file in the output directory to write a generated object to. */
+static FILE *open_object(const char *fname, const char *mode)
+{
+	char path[PATH_MAX];
+	FILE *f;
+
+	snprintf(path, PATH_MAX, "%s/%s", outdir, fname);
+
+	if (!(f = fopen(path, mode))) {
+		fprintf(stderr, E_WRITE, path, strerror(errno));
+		exit(EXIT_OS_ERROR);
+	}
+
+	return f;
+}
+
+/* The SNS of the i'th data module. */
+static void dm_sns(int i, char *sys, char *sub, char *subsub, char *assy)
+{
+	sprintf(sys, "%02d", (i / 10000) % 100);
+	sprintf(sub, "%d", (i / 1000) % 10);
+	sprintf(subsub, "%d", (i / 100) % 10);
+	sprintf(assy, "%02d", i % 100);
+}
+
+static int is_procedural(int i)
+{
+	return i % PROCEDURAL_RATE == PROCEDURAL_RATE - 1;
+}
+
+static const char *dm_info_code(int i)
+{
+	return is_procedural(i) ? "520" : "040";
+}
+
+static void dm_fname(char *dst, const char *sys, const char *sub, const char *subsub, const char *assy, const char *info)
+{
+	sprintf(dst, "DMC-%s-%s-%s-%s%s-%s-00A-%sA-D_001-00_EN-US.XML",
+		MODEL_IDENT_CODE, SYSTEM_DIFF_CODE, sys, sub, subsub, assy, info);
+}
+
+static void icn_ident(char *dst, int i)
+{
+	sprintf(dst, "ICN-%s-%s-000000-A-%s-%05d-A-001-01", MODEL_IDENT_CODE, SYSTEM_DIFF_CODE, CAGE_CODE, i + 1);
+}
+
+static void print_dm_code(FILE *f, const char *sys, const char *sub, const char *subsub, const char *assy, const char *info)
+{
+	fprintf(f, "<dmCode modelIdentCode=\"%s\" systemDiffCode=\"%s\" systemCode=\"%s\" subSystemCode=\"%s\" subSubSystemCode=\"%s\" assyCode=\"%s\" disassyCode=\"00\" disassyCodeVariant=\"A\" infoCode=\"%s\" infoCodeVariant=\"A\" itemLocationCode=\"D\"/>",
+		MODEL_IDENT_CODE, SYSTEM_DIFF_CODE, sys, sub, subsub, assy, info);
+}
+
+/* Print a reference to one of the fixed data modules (ACT, CCT, PCT, CIR). */
+static void print_fixed_ref(FILE *f, const char *info)
+{
+	fprintf(f, "<dmRef><dmRefIdent>");
+	print_dm_code(f, "00", "0", "0", "00", info);
+	fprintf(f, "</dmRefIdent></dmRef>");
+}
+
+/* Print a reference to the i'th data module, or to one which is not in the
+ * CSDB if i is negative. */
+static void print_dm_ref(FILE *f, int i)
+{
+	char sys[8], sub[8], subsub[8], assy[8];
+
+	if (i < 0) {
+		strcpy(sys, "99");
+		strcpy(sub, "9");
+		strcpy(subsub, "9");
+		sprintf(assy, "%02d", -i % 100);
+	} else {
+		dm_sns(i, sys, sub, subsub, assy);
+	}
+
+	fprintf(f, "<dmRef><dmRefIdent>");
+	print_dm_code(f, sys, sub, subsub, assy, i < 0 ? "040" : dm_info_code(i));
+	fprintf(f, "</dmRefIdent></dmRef>");
+}
+
+/* Print a random cross-reference from the i'th data module. */
+static void print_random_ref(FILE *f, int i)
+{
+	int j;
+
+	if (rand_below(UNMATCHED_REF_RATE) == 0) {
+		j = -1 - rand_below(100);
+	} else if ((j = rand_below(ndms)) == i) {
+		j = (j + 1) % ndms;
+	}
+
+	print_dm_ref(f, j);
+}
+
+/* Print the start of a data module, up to and including <content>. */
+static void print_dm_start(FILE *f, const char *sys, const char *sub, const char *subsub, const char *assy, const char *info, const char *schema, const char *tech_name, const char *info_name, int icn)
+{
+	fputs("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n", f);
+
+	if (icn < 0) {
+		fputs("<!DOCTYPE dmodule>\n", f);
+	} else {
+		char ident[64];
+
+		icn_ident(ident, icn);
+
+		fputs("<!DOCTYPE dmodule [\n", f);
+		fputs("<!NOTATION PNG PUBLIC \"-//W3C//NOTATION Portable Network Graphics//EN\">\n", f);
+		fprintf(f, "<!ENTITY %s SYSTEM \"%s.PNG\" NDATA PNG>\n", ident, ident);
+		fputs("]>\n", f);
+	}
+
+	fprintf(f, "<dmodule xmlns:dc=\"http://www.purl.org/dc/elements/1.1/\" xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xsi:noNamespaceSchemaLocation=\"" SCHEMA_URL "%s.xsd\">\n", schema);
+	fputs("<identAndStatusSection>\n", f);
+	fputs("<dmAddress>\n", f);
+	fputs("<dmIdent>\n", f);
+	print_dm_code(f, sys, sub, subsub, assy, info);
+	fputs("\n<language languageIsoCode=\"en\" countryIsoCode=\"US\"/>\n", f);
+	fputs("<issueInfo issueNumber=\"001\" inWork=\"00\"/>\n", f);
+	fputs("</dmIdent>\n", f);
+	fputs("<dmAddressItems>\n", f);
+	fputs("<issueDate year=\"2020\" month=\"01\" day=\"01\"/>\n", f);
+	fprintf(f, "<dmTitle><techName>%s</techName><infoName>%s</infoName></dmTitle>\n", tech_name, info_name);
+	fputs("</dmAddressItems>\n", f);
+	fputs("</dmAddress>\n", f);
+	fputs("<dmStatus issueType=\"new\">\n", f);
+	fputs("<security securityClassification=\"01\"/>\n", f);
+	fprintf(f, "<responsiblePartnerCompany enterpriseCode=\"%s\"><enterpriseName>Benchmark</enterpriseName></responsiblePartnerCompany>\n", CAGE_CODE);
+	fprintf(f, "<originator enterpriseCode=\"%s\"><enterpriseName>Benchmark</enterpriseName></originator>\n", CAGE_CODE);
+	fputs("<applicCrossRefTableRef>", f);
+	print_fixed_ref(f, "00W");
+	fputs("</applicCrossRefTableRef>\n", f);
+	fputs("<applic><displayText><simplePara>All</simplePara></displayText></applic>\n", f);
+	fputs("<brexDmRef><dmRef><dmRefIdent><dmCode modelIdentCode=\"S1000D\" systemDiffCode=\"F\" systemCode=\"04\" subSystemCode=\"1\" subSubSystemCode=\"0\" assyCode=\"0301\" disassyCode=\"00\" disassyCodeVariant=\"A\" infoCode=\"022\" infoCodeVariant=\"A\" itemLocationCode=\"D\"/></dmRefIdent></dmRef></brexDmRef>\n", f);
+	fputs("<qualityAssurance><unverified/></qualityAssurance>\n", f);
+	fputs("</dmStatus>\n", f);
+	fputs("</identAndStatusSection>\n", f);
+	fputs("<content>\n", f);
+}
+
+static void print_dm_end(FILE *f)
+{
+	fputs("</content>\n", f);
+	fputs("</dmodule>\n", f);
+}
+
+/* Generate the applicability cross-reference table. */
+static void gen_act(void)
+{
+	char fname[PATH_MAX];
+	FILE *f;
+	unsigned i;
+
+	dm_fname(fname, "00", "0", "0", "00", "00W");
+	f = open_object(fname, "w");
+
+	print_dm_start(f, "00", "0", "0", "00", "00W", "appliccrossreftable", "Benchmark", "Applicability cross-reference table", -1);
+	fputs("<applicCrossRefTable>\n", f);
+	fputs("<productAttributeList>\n", f);
+	fputs("<productAttribute id=\"version\"><name>Version</name><descr>The version of the product.</descr>", f);
+	for (i = 0; i < VERSION_COUNT; ++i) {
+		fprintf(f, "<enumeration applicPropertyValues=\"%s\"/>", versions[i]);
+	}
+	fputs("</productAttribute>\n", f);
+	fputs("</productAttributeList>\n", f);
+	fputs("<condCrossRefTableRef>", f);
+	print_fixed_ref(f, "00Q");
+	fputs("</condCrossRefTableRef>\n", f);
+	fputs("<productCrossRefTableRef>", f);
+	print_fixed_ref(f, "00P");
+	fputs("</productCrossRefTableRef>\n", f);
+	fputs("</applicCrossRefTable>\n", f);
+	print_dm_end(f);
+
+	fclose(f);
+}
+
+/* Generate the conditions cross-reference table. */
+static void gen_cct(void)
+{
+	char fname[PATH_MAX];
+	FILE *f;
+	unsigned i;
+
+	dm_fname(fname, "00", "0", "0", "00", "00Q");
+	f = open_object(fname, "w");
+
+	print_dm_start(f, "00", "0", "0", "00", "00Q", "condcrossreftable", "Benchmark", "Conditions cross-reference table", -1);
+	fputs("<condCrossRefTable>\n", f);
+	fputs("<condTypeList>\n", f);
+	fputs("<condType id=\"ct-ice\"><name>Ice</name><descr>Ice conditions.</descr>", f);
+	for (i = 0; i < ICE_VALUE_COUNT; ++i) {
+		fprintf(f, "<enumeration applicPropertyValues=\"%s\"/>", ice_values[i]);
+	}
+	fputs("</condType>\n", f);
+	fputs("</condTypeList>\n", f);
+	fputs("<condList>\n", f);
+	fputs("<cond id=\"ice\" condTypeRefId=\"ct-ice\"><name>Ice</name><descr>Whether the product is covered in ice.</descr></cond>\n", f);
+	fputs("</condList>\n", f);
+	fputs("</condCrossRefTable>\n", f);
+	print_dm_end(f);
+
+	fclose(f);
+}
+
+/* Generate the products cross-reference table. */
+static void gen_pct(void)
+{
+	char fname[PATH_MAX];
+	FILE *f;
+	unsigned i, j;
+
+	dm_fname(fname, "00", "0", "0", "00", "00P");
+	f = open_object(fname, "w");
+
+	print_dm_start(f, "00", "0", "0", "00", "00P", "prdcrossreftable", "Benchmark", "Products cross-reference table", -1);
+	fputs("<productCrossRefTable>\n", f);
+	for (i = 0; i < VERSION_COUNT; ++i) {
+		for (j = 0; j < ICE_VALUE_COUNT; ++j) {
+			fprintf(f, "<product id=\"version-%s-%s\">", versions[i], ice_values[j]);
+			fprintf(f, "<assign applicPropertyIdent=\"version\" applicPropertyType=\"prodattr\" applicPropertyValue=\"%s\"/>", versions[i]);
+			fprintf(f, "<assign applicPropertyIdent=\"ice\" applicPropertyType=\"condition\" applicPropertyValue=\"%s\"/>", ice_values[j]);
+			fputs("</product>\n", f);
+		}
+	}
+	fputs("</productCrossRefTable>\n", f);
+	print_dm_end(f);
+
+	fclose(f);
+}
+
+/* Generate the parts common information repository. */
+static void gen_cir(void)
+{
+	char fname[PATH_MAX];
+	FILE *f;
+	int i;
+
+	dm_fname(fname, "00", "0", "0", "00", "00G");
+	f = open_object(fname, "w");
+
+	print_dm_start(f, "00", "0", "0", "00", "00G", "comrep", "Benchmark", "Parts repository", -1);
+	fputs("<commonRepository>\n", f);
+	fputs("<partRepository>\n", f);
+	for (i = 0; i < nparts; ++i) {
+		fprintf(f, "<partSpec><partIdent manufacturerCodeValue=\"%s\" partNumberValue=\"P-%05d\"/><itemIdentData><descrForPart>Part %d</descrForPart></itemIdentData></partSpec>\n", CAGE_CODE, i + 1, i + 1);
+	}
+	fputs("</partRepository>\n", f);
+	fputs("</commonRepository>\n", f);
+	print_dm_end(f);
+
+	fclose(f);
+}
+
+/* Print the applicability annotations referenced by paragraphs and steps. */
+static void print_applic_group(FILE *f)
+{
+	unsigned i;
+
+	fputs("<referencedApplicGroup>\n", f);
+	for (i = 0; i < VERSION_COUNT; ++i) {
+		fprintf(f, "<applic id=\"app-%s\"><assert applicPropertyIdent=\"version\" applicPropertyType=\"prodattr\" applicPropertyValues=\"%s\"/></applic>\n", versions[i], versions[i]);
+	}
+	for (i = 0; i < ICE_VALUE_COUNT; ++i) {
+		fprintf(f, "<applic id=\"app-%s\"><assert applicPropertyIdent=\"ice\" applicPropertyType=\"condition\" applicPropertyValues=\"%s\"/></applic>\n", ice_values[i], ice_values[i]);
+	}
+	fputs("</referencedApplicGroup>\n", f);
+}
+
+/* Print a random applicRefId attribute on some paragraphs and steps. */
+static void print_random_applic(FILE *f)
+{
+	int i;
+
+	if (rand_below(APPLIC_RATE) != 0) {
+		return;
+	}
+
+	i = rand_below(VERSION_COUNT + ICE_VALUE_COUNT);
+
+	if (i < (int) VERSION_COUNT) {
+		fprintf(f, " applicRefId=\"app-%s\"", versions[i]);
+	} else {
+		fprintf(f, " applicRefId=\"app-%s\"", ice_values[i - VERSION_COUNT]);
+	}
+}
+
+/* Print the text of the k'th paragraph or step of the i'th data module,
+ * including its share of the data module's cross-references. */
+static void print_para(FILE *f, int i, int k, int has_figure)
+{
+	int r;
+
+	fprintf(f, "<para>Check the %s before using the %s.", acronyms[rand_below(ACRONYM_COUNT)][0], acronyms[rand_below(ACRONYM_COUNT)][0]);
+
+	if (k == 0 && has_figure) {
+		fputs(" Refer to <internalRef internalRefId=\"fig-0001\" internalRefTargetType=\"irtt01\"/>.", f);
+	}
+
+	for (r = k; r < nrefs; r += nparas) {
+		fputs(" Refer to ", f);
+		print_random_ref(f, i);
+		fputs(".", f);
+	}
+
+	fputs("</para>\n", f);
+}
+
+static void print_figure(FILE *f, int icn)
+{
+	char ident[64];
+
+	icn_ident(ident, icn);
+
+	fprintf(f, "<figure id=\"fig-0001\"><title>Figure</title><graphic infoEntityIdent=\"%s\"/></figure>\n", ident);
+}
+
+/* Generate the i'th data module. */
+static void gen_dm(int i)
+{
+	char sys[8], sub[8], subsub[8], assy[8];
+	char fname[PATH_MAX];
+	char tech_name[64];
+	FILE *f;
+	int icn = -1;
+	int k;
+
+	if (nicns > 0 && i % FIGURE_RATE == 0) {
+		icn = rand_below(nicns);
+	}
+
+	dm_sns(i, sys, sub, subsub, assy);
+	dm_fname(fname, sys, sub, subsub, assy, dm_info_code(i));
+	sprintf(tech_name, "Component %d", i + 1);
+
+	f = open_object(fname, "w");
+
+	if (is_procedural(i)) {
+		print_dm_start(f, sys, sub, subsub, assy, "520", "proced", tech_name, "Remove procedure", icn);
+		print_applic_group(f);
+		fputs("<procedure>\n", f);
+		fputs("<preliminaryRqmts>\n", f);
+		fputs("<reqCondGroup><noConds/></reqCondGroup>\n", f);
+		fputs("<reqSupportEquips><noSupportEquips/></reqSupportEquips>\n", f);
+		fputs("<reqSupplies><noSupplies/></reqSupplies>\n", f);
+		if (nparts > 0) {
+			fputs("<reqSpares><spareDescrGroup>\n", f);
+			for (k = 0; k < 3; ++k) {
+				fprintf(f, "<spareDescr><partRef manufacturerCodeValue=\"%s\" partNumberValue=\"P-%05d\"/><reqQuantity>%d</reqQuantity></spareDescr>\n", CAGE_CODE, rand_below(nparts) + 1, k + 1);
+			}
+			fputs("</spareDescrGroup></reqSpares>\n", f);
+		} else {
+			fputs("<reqSpares><noSpares/></reqSpares>\n", f);
+		}
+		fputs("<reqSafety><noSafety/></reqSafety>\n", f);
+		fputs("</preliminaryRqmts>\n", f);
+		fputs("<mainProcedure>\n", f);
+		for (k = 0; k < nparas; ++k) {
+			fprintf(f, "<proceduralStep id=\"stp-%04d\"", k + 1);
+			print_random_applic(f);
+			fputs(">\n", f);
+			print_para(f, i, k, icn >= 0);
+			if (k == 0 && icn >= 0) {
+				print_figure(f, icn);
+			}
+			fputs("</proceduralStep>\n", f);
+		}
+		fputs("</mainProcedure>\n", f);
+		fputs("<closeRqmts><reqCondGroup><noConds/></reqCondGroup></closeRqmts>\n", f);
+		fputs("</procedure>\n", f);
+	} else {
+		print_dm_start(f, sys, sub, subsub, assy, "040", "descript", tech_name, "Description", icn);
+		print_applic_group(f);
+		fputs("<description>\n", f);
+		for (k = 0; k < nparas; ++k) {
+			fprintf(f, "<levelledPara id=\"par-%04d\"", k + 1);
+			print_random_applic(f);
+			fprintf(f, ">\n<title>Paragraph %d</title>\n", k + 1);
+			print_para(f, i, k, icn >= 0);
+			if (k == 0 && icn >= 0) {
+				print_figure(f, icn);
+			}
+			fputs("</levelledPara>\n", f);
+		}
+		fputs("</description>\n", f);
+	}
+
+	print_dm_end(f);
+
+	fclose(f);
+}
+
+/* Generate a publication module containing all the data modules. */
+static void gen_pm(void)
+{
+	char fname[PATH_MAX];
+	FILE *f;
+	int i;
+
+	sprintf(fname, "PMC-%s-%s-00001-00_001-00_EN-US.XML", MODEL_IDENT_CODE, CAGE_CODE);
+	f = open_object(fname, "w");
+
+	fputs("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n", f);
+	fputs("<!DOCTYPE pm>\n", f);
+	fputs("<pm xmlns:dc=\"http://www.purl.org/dc/elements/1.1/\" xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xsi:noNamespaceSchemaLocation=\"" SCHEMA_URL "pm.xsd\">\n", f);
+	fputs("<identAndStatusSection>\n", f);
+	fputs("<pmAddress>\n", f);
+	fputs("<pmIdent>\n", f);
+	fprintf(f, "<pmCode modelIdentCode=\"%s\" pmIssuer=\"%s\" pmNumber=\"00001\" pmVolume=\"00\"/>\n", MODEL_IDENT_CODE, CAGE_CODE);
+	fputs("<language languageIsoCode=\"en\" countryIsoCode=\"US\"/>\n", f);
+	fputs("<issueInfo issueNumber=\"001\" inWork=\"00\"/>\n", f);
+	fputs("</pmIdent>\n", f);
+	fputs("<pmAddressItems>\n", f);
+	fputs("<issueDate year=\"2020\" month=\"01\" day=\"01\"/>\n", f);
+	fputs("<pmTitle>Benchmark</pmTitle>\n", f);
+	fputs("</pmAddressItems>\n", f);
+	fputs("</pmAddress>\n", f);
+	fputs("<pmStatus issueType=\"new\">\n", f);
+	fputs("<security securityClassification=\"01\"/>\n", f);
+	fprintf(f, "<responsiblePartnerCompany enterpriseCode=\"%s\"><enterpriseName>Benchmark</enterpriseName></responsiblePartnerCompany>\n", CAGE_CODE);
+	fprintf(f, "<originator enterpriseCode=\"%s\"><enterpriseName>Benchmark</enterpriseName></originator>\n", CAGE_CODE);
+	fputs("<applicCrossRefTableRef>", f);
+	print_fixed_ref(f, "00W");
+	fputs("</applicCrossRefTableRef>\n", f);
+	fputs("<applic><displayText><simplePara>All</simplePara></displayText></applic>\n", f);
+	fputs("<brexDmRef><dmRef><dmRefIdent><dmCode modelIdentCode=\"S1000D\" systemDiffCode=\"F\" systemCode=\"04\" subSystemCode=\"1\" subSubSystemCode=\"0\" assyCode=\"0301\" disassyCode=\"00\" disassyCodeVariant=\"A\" infoCode=\"022\" infoCodeVariant=\"A\" itemLocationCode=\"D\"/></dmRefIdent></dmRef></brexDmRef>\n", f);
+	fputs("<qualityAssurance><unverified/></qualityAssurance>\n", f);
+	fputs("</pmStatus>\n", f);
+	fputs("</identAndStatusSection>\n", f);
+	fputs("<content>\n", f);
+
+	/* One entry for every hundred data modules (one subsubsystem). */
+	for (i = 0; i < ndms; ++i) {
+		if (i % 100 == 0) {
+			if (i > 0) {
+				fputs("</pmEntry>\n", f);
+			}
+			fprintf(f, "<pmEntry><pmEntryTitle>Components %d to %d</pmEntryTitle>\n", i + 1, i + 100 < ndms ? i + 100 : ndms);
+		}
+		print_dm_ref(f, i);
+		fputs("\n", f);
+	}
+	if (ndms > 0) {
+		fputs("</pmEntry>\n", f);
+	}
+
+	fputs("</content>\n", f);
+	fputs("</pm>\n", f);
+
+	fclose(f);
+}
+
+/* Generate the acronyms list used by s1kd-acronyms -m. */
+static void gen_acronyms(void)
+{
+	FILE *f;
+	unsigned i;
+
+	f = open_object(".acronyms", "w");
+
+	fputs("<?xml version=\"1.0\"?>\n", f);
+	fputs("<acronyms>\n", f);
+	for (i = 0; i < ACRONYM_COUNT; ++i) {
+		fprintf(f, "<acronym acronymType=\"at01\"><acronymTerm>%s</acronymTerm><acronymDefinition>%s</acronymDefinition></acronym>\n", acronyms[i][0], acronyms[i][1]);
+	}
+	fputs("</acronyms>\n", f);
+
+	fclose(f);
+}
+
+/* Generate the ICN files. */
+static void gen_icns(void)
+{
+	int i;
+
+	for (i = 0; i < nicns; ++i) {
+		char fname[PATH_MAX];
+		FILE *f;
+
+		icn_ident(fname, i);
+		strcat(fname, ".PNG");
+
+		f = open_object(fname, "wb");
+		fwrite(png, 1, sizeof(png), f);
+		fclose(f);
+	}
+}
+
+/* Parse a non-negative number given as the argument of an option. */
+static int parse_number(int opt, const char *arg)
+{
+	char *end;
+	long n;
+
+	errno = 0;
+	n = strtol(arg, &end, 10);
+
+	if (errno != 0 || *arg == '\0' || *end != '\0' || n < 0 || n > INT_MAX) {
+		fprintf(stderr, E_BAD_NUMBER, opt, arg);
+		exit(EXIT_BAD_NUMBER);
+	}
+
+	return n;
+}
+
+static void show_help(void)
+{
+	puts("Usage: " PROG_NAME " [-h?] [-c <n>] [-d <dir>] [-i <n>] [-n <n>] [-p <n>] [-r <n>] [-s <seed>]");
+	puts("");
+	puts("Options:");
+	puts("  -c, --parts <n>       Number of parts in the parts CIR (default 100).");
+	puts("  -d, --dir <dir>       Directory to generate the CSDB in (default csdb).");
+	puts("  -h, -?, --help        Show help/usage message.");
+	puts("  -i, --icns <n>        Number of ICNs (default one for every ten DMs).");
+	puts("  -n, --dms <n>         Number of data modules (default 1000).");
+	puts("  -p, --paras <n>       Number of paragraphs or steps in each DM (default 10).");
+	puts("  -r, --refs <n>        Number of references in each DM (default 5).");
+	puts("  -s, --seed <seed>     Seed for the random content (default 1).");
+	puts("  --version             Show version information.");
+}
+
+static void show_version(void)
+{
+	printf("%s (s1kd-tools) %s\n", PROG_NAME, VERSION);
+}
+
+int main(int argc, char **argv)
+{
+	int i;
+
+	const char *sopts = "c:d:i:n:p:r:s:h?";
+	struct option lopts[] = {
+		{"version", no_argument      , 0, 0},
+		{"help"   , no_argument      , 0, 'h'},
+		{"parts"  , required_argument, 0, 'c'},
+		{"dir"    , required_argument, 0, 'd'},
+		{"icns"   , required_argument, 0, 'i'},
+		{"dms"    , required_argument, 0, 'n'},
+		{"paras"  , required_argument, 0, 'p'},
+		{"refs"   , required_argument, 0, 'r'},
+		{"seed"   , required_argument, 0, 's'},
+		{0, 0, 0, 0}
+	};
+	int loptind = 0;
+
+	while ((i = getopt_long(argc, argv, sopts, lopts, &loptind)) != -1) {
+		switch (i) {
+			case 0:
+				if (strcmp(lopts[loptind].name, "version") == 0) {
+					show_version();
+					return 0;
+				}
+				break;
+			case 'c':
+				nparts = parse_number(i, optarg);
+				break;
+			case 'd':
+				outdir = optarg;
+				break;
+			case 'i':
+				nicns = parse_number(i, optarg);
+				break;
+			case 'n':
+				ndms = parse_number(i, optarg);
+				break;
+			case 'p':
+				nparas = parse_number(i, optarg);
+				break;
+			case 'r':
+				nrefs = parse_number(i, optarg);
+				break;
+			case 's':
+				/* A zero state would make xorshift only return 0. */
+				if ((rng = parse_number(i, optarg)) == 0) {
+					rng = 1;
+				}
+				break;
+			case 'h':
+			case '?':
+				show_help();
+				return 0;
+		}
+	}
+
+	if (nicns < 0) {
+		nicns = ndms / 10;
+	}
+
+	/* Every DM needs at least one paragraph or step to hold its text. */
+	if (nparas < 1) {
+		nparas = 1;
+	}
+
+	if (mkdir(outdir, S_IRWXU | S_IRWXG | S_IRWXO) != 0 && errno != EEXIST) {
+		fprintf(stderr, E_MKDIR, outdir, strerror(errno));
+		exit(EXIT_OS_ERROR);
+	}
+
+	gen_act();
+	gen_cct();
+	gen_pct();
+	gen_cir();
+
+	for (i = 0; i < ndms; ++i) {
+		gen_dm(i);
+	}
+
+	gen_pm();
+	gen_acronyms();
+	gen_icns();
+
+	return 0;
+}
@@ -0,0 +1,475 @@
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "s1kd_dirwalk.h"
+
+/* Number of entries read from a directory before they are passed on to the
+ * consumer, so it is not woken up for every file. */
+#define DIR_WALK_BATCH 64
+
+struct dir_walk_dir;
+
+/* An entry of a directory: either a file, or a subdirectory whose own entries
+ * come at this point in the walk. */
+struct dir_walk_entry {
+	char *path;
+	struct dir_walk_dir *dir;
+	struct dir_walk_entry *next;
+};
+
+struct dir_walk_queue {
+	struct dir_walk_entry *head;
+	struct dir_walk_entry *tail;
+};
+
+/* A directory in the walk.
+ *
+ * The entries found in a directory are kept in the order they are read, with
+ * its subdirectories in place, so that the files can be returned in the same
+ * order as a walk with a single thread, however the directories are divided
+ * among the threads. */
+struct dir_walk_dir {
+	char *path;
+	struct dir_walk_queue entries; /* Entries not yet returned. */
+	bool read;                     /* Whether all entries have been read. */
+	bool failed;                   /* Whether the directory could not be read. */
+	struct dir_walk_dir *parent;   /* Directory to return to afterwards. */
+	struct dir_walk_dir *next_dir; /* Next directory waiting to be read. */
+	struct dir_walk_dir *next;     /* Next directory of the walk, to free. */
+};
+
+struct dir_walk {
+	bool recursive;
+	bool (*is)(const char *, void *);
+	void *data;
+
+	pthread_mutex_t lock;
+	pthread_cond_t dirs_ready;  /* A directory was queued or the walk ended. */
+	pthread_cond_t files_ready; /* An entry was found or a directory was read. */
+
+	struct dir_walk_dir *top;   /* Directories added to the walk. */
+	struct dir_walk_dir *cur;   /* Directory files are being returned from. */
+	struct dir_walk_dir *all;   /* All directories of the walk. */
+
+	struct dir_walk_queue errors; /* Directories which could not be read. */
+
+	struct dir_walk_dir *dirs_head; /* Directories waiting to be read. */
+	struct dir_walk_dir *dirs_tail;
+
+	int busy;     /* Number of threads reading a directory. */
+	bool started; /* Whether the threads have been started. */
+	bool stop;    /* Whether the walk is being freed. */
+
+	pthread_t threads[DIR_WALK_THREADS];
+	int nthreads;
+};
+
+static void push_entry(struct dir_walk_queue *q, const char *path, struct dir_walk_dir *dir)
+{
+	struct dir_walk_entry *e;
+
+	e = malloc(sizeof(struct dir_walk_entry));
+	e->path = path ? strdup(path) : NULL;
+	e->dir = dir;
+	e->next = NULL;
+
+	if (q->tail) {
+		q->tail->next = e;
+	} else {
+		q->head = e;
+	}
+
+	q->tail = e;
+}
+
+static struct dir_walk_entry *pop_entry(struct dir_walk_queue *q)
+{
+	struct dir_walk_entry *e = q->head;
+
+	if (e && !(q->head = e->next)) {
+		q->tail = NULL;
+	}
+
+	return e;
+}
+
+/* Move all entries from one queue to the end of another. */
+static void move_entries(struct dir_walk_queue *to, struct dir_walk_queue *from)
+{
+	if (!from->head) {
+		return;
+	}
+
+	if (to->tail) {
+		to->tail->next = from->head;
+	} else {
+		to->head = from->head;
+	}
+
+	to->tail = from->tail;
+	from->head = from->tail = NULL;
+}
+
+static void free_entries(struct dir_walk_queue *q)
+{
+	struct dir_walk_entry *e;
+
+	while ((e = pop_entry(q))) {
+		free(e->path);
+		free(e);
+	}
+}
+
+/* Create a directory of the walk. Must be called with the walk locked. */
+static struct dir_walk_dir *new_dir(struct dir_walk *walk, const char *path, struct dir_walk_dir *parent)
+{
+	struct dir_walk_dir *dir;
+
+	dir = calloc(1, sizeof(struct dir_walk_dir));
+	dir->path = strdup(path);
+	dir->parent = parent;
+
+	dir->next = walk->all;
+	walk->all = dir;
+
+	return dir;
+}
+
+/* Queue a directory to be read. Must be called with the walk locked. */
+static void queue_dir(struct dir_walk *walk, struct dir_walk_dir *dir)
+{
+	if (walk->dirs_tail) {
+		walk->dirs_tail->next_dir = dir;
+	} else {
+		walk->dirs_head = dir;
+	}
+
+	walk->dirs_tail = dir;
+}
+
+/* Pass on the entries read so far from a directory, and queue the
+ * subdirectories among them to be read.
+ * Returns false if the walk is being stopped. */
+static bool flush_entries(struct dir_walk *walk, struct dir_walk_dir *dir, struct dir_walk_queue *entries, bool read)
+{
+	struct dir_walk_entry *e;
+	bool stop, dirs = false;
+
+	pthread_mutex_lock(&walk->lock);
+
+	for (e = entries->head; e; e = e->next) {
+		if (e->dir) {
+			queue_dir(walk, e->dir);
+			dirs = true;
+		}
+	}
+
+	move_entries(&dir->entries, entries);
+	dir->read = read;
+
+	pthread_cond_signal(&walk->files_ready);
+	if (dirs) {
+		pthread_cond_broadcast(&walk->dirs_ready);
+	}
+
+	stop = walk->stop;
+
+	pthread_mutex_unlock(&walk->lock);
+
+	return !stop;
+}
+
+/* Determine if a directory entry is itself a directory. The type given by
+ * readdir is used when the file system provides it, so that most entries do
+ * not need to be stat'd. Symbolic links are followed. */
+static bool is_subdir(DIR *dir, struct dirent *cur, const char *path)
+{
+	struct stat st;
+
+#ifdef _DIRENT_HAVE_D_TYPE
+	if (cur->d_type == DT_DIR) {
+		return true;
+	} else if (cur->d_type != DT_UNKNOWN && cur->d_type != DT_LNK) {
+		return false;
+	}
+#endif
+
+#ifdef _WIN32
+	if (stat(path, &st) != 0) {
+		return false;
+	}
+#else
+	if (fstatat(dirfd(dir), cur->d_name, &st, 0) != 0) {
+		return false;
+	}
+#endif
+
+	return S_ISDIR(st.st_mode);
+}
+
+/* Read one directory, passing on its entries and queueing its
+ * subdirectories. */
+static void read_dir(struct dir_walk *walk, struct dir_walk_dir *wdir)
+{
+	DIR *dir;
+	struct dirent *cur;
+	char fpath[PATH_MAX], cpath[PATH_MAX];
+	struct dir_walk_queue entries = {NULL, NULL};
+	int nentries = 0;
+	const char *path = wdir->path;
+	int len = strlen(path);
+
+	if (!(dir = opendir(path))) {
+		pthread_mutex_lock(&walk->lock);
+		wdir->failed = true;
+		pthread_mutex_unlock(&walk->lock);
+
+		flush_entries(walk, wdir, &entries, true);
+		return;
+	}
+
+	if (strcmp(path, ".") == 0) {
+		strcpy(fpath, "");
+	} else if (path[len - 1] != '/') {
+		strcpy(fpath, path);
+		strcat(fpath, "/");
+	} else {
+		strcpy(fpath, path);
+	}
+
+	while ((cur = readdir(dir))) {
+		if (strcmp(cur->d_name, ".") == 0 || strcmp(cur->d_name, "..") == 0) {
+			continue;
+		}
+
+		if (snprintf(cpath, PATH_MAX, "%s%s", fpath, cur->d_name) >= PATH_MAX) {
+			continue;
+		}
+
+		if (walk->recursive && is_subdir(dir, cur, cpath)) {
+			struct dir_walk_dir *sub;
+
+			pthread_mutex_lock(&walk->lock);
+			sub = new_dir(walk, cpath, wdir);
+			pthread_mutex_unlock(&walk->lock);
+
+			push_entry(&entries, NULL, sub);
+		} else if (!walk->is || walk->is(cur->d_name, walk->data)) {
+			push_entry(&entries, cpath, NULL);
+		} else {
+			continue;
+		}
+
+		if (++nentries == DIR_WALK_BATCH) {
+			if (!flush_entries(walk, wdir, &entries, false)) {
+				break;
+			}
+			nentries = 0;
+		}
+	}
+
+	closedir(dir);
+
+	flush_entries(walk, wdir, &entries, true);
+}
+
+/* Read directories from the queue until there are none left and no other
+ * thread is reading one that may add more. */
+static void *walk_dirs(void *arg)
+{
+	struct dir_walk *walk = arg;
+
+	pthread_mutex_lock(&walk->lock);
+
+	while (true) {
+		struct dir_walk_dir *dir;
+
+		while (!walk->dirs_head && walk->busy > 0 && !walk->stop) {
+			pthread_cond_wait(&walk->dirs_ready, &walk->lock);
+		}
+
+		if (walk->stop || !walk->dirs_head) {
+			break;
+		}
+
+		dir = walk->dirs_head;
+		if (!(walk->dirs_head = dir->next_dir)) {
+			walk->dirs_tail = NULL;
+		}
+		++walk->busy;
+
+		pthread_mutex_unlock(&walk->lock);
+		read_dir(walk, dir);
+		pthread_mutex_lock(&walk->lock);
+
+		--walk->busy;
+	}
+
+	pthread_cond_broadcast(&walk->dirs_ready);
+
+	pthread_mutex_unlock(&walk->lock);
+
+	return NULL;
+}
+
+struct dir_walk *dir_walk_new(bool recursive, bool (*is)(const char *, void *), void *data)
+{
+	struct dir_walk *walk;
+
+	walk = calloc(1, sizeof(struct dir_walk));
+
+	walk->recursive = recursive;
+	walk->is = is;
+	walk->data = data;
+
+	pthread_mutex_init(&walk->lock, NULL);
+	pthread_cond_init(&walk->dirs_ready, NULL);
+	pthread_cond_init(&walk->files_ready, NULL);
+
+	/* The directories added to the walk are entries of a directory which
+	 * is not itself read. */
+	walk->top = new_dir(walk, "", NULL);
+	walk->top->read = true;
+	walk->cur = walk->top;
+
+	return walk;
+}
+
+bool dir_walk_add(struct dir_walk *walk, const char *path)
+{
+	DIR *dir;
+	struct dir_walk_dir *wdir;
+
+	if (!(dir = opendir(path))) {
+		return false;
+	}
+
+	closedir(dir);
+
+	pthread_mutex_lock(&walk->lock);
+	wdir = new_dir(walk, path, walk->top);
+	push_entry(&walk->top->entries, NULL, wdir);
+	queue_dir(walk, wdir);
+	pthread_mutex_unlock(&walk->lock);
+
+	return true;
+}
+
+bool dir_walk_next(struct dir_walk *walk, char *dst)
+{
+	struct dir_walk_entry *e;
+	bool found = false;
+
+	if (!walk->started) {
+		int i;
+
+		walk->started = true;
+
+		for (i = 0; i < DIR_WALK_THREADS; ++i) {
+			if (pthread_create(&walk->threads[i], NULL, walk_dirs, walk) != 0) {
+				break;
+			}
+			++walk->nthreads;
+		}
+
+		/* If no threads could be started, walk all the directories
+		 * before returning the first file. */
+		if (walk->nthreads == 0) {
+			walk_dirs(walk);
+		}
+	}
+
+	pthread_mutex_lock(&walk->lock);
+
+	/* Return the entries of each directory in order, going into each
+	 * subdirectory where it was found and back out once all of its own
+	 * entries have been returned. */
+	while (walk->cur) {
+		if ((e = pop_entry(&walk->cur->entries))) {
+			if (e->dir) {
+				walk->cur = e->dir;
+			} else {
+				strcpy(dst, e->path);
+				found = true;
+			}
+
+			free(e->path);
+			free(e);
+
+			if (found) {
+				break;
+			}
+		} else if (walk->cur->read) {
+			/* Directories which could not be read are noted in the
+			 * same order, so they are reported consistently. */
+			if (walk->cur->failed) {
+				push_entry(&walk->errors, walk->cur->path, NULL);
+			}
+
+			walk->cur = walk->cur->parent;
+		} else {
+			pthread_cond_wait(&walk->files_ready, &walk->lock);
+		}
+	}
+
+	pthread_mutex_unlock(&walk->lock);
+
+	return found;
+}
+
+bool dir_walk_next_error(struct dir_walk *walk, char *dst)
+{
+	struct dir_walk_entry *e;
+
+	if (!(e = pop_entry(&walk->errors))) {
+		return false;
+	}
+
+	strcpy(dst, e->path);
+
+	free(e->path);
+	free(e);
+
+	return true;
+}
+
+void dir_walk_free(struct dir_walk *walk)
+{
+	int i;
+
+	pthread_mutex_lock(&walk->lock);
+	walk->stop = true;
+	pthread_cond_broadcast(&walk->dirs_ready);
+	pthread_mutex_unlock(&walk->lock);
+
+	for (i = 0; i < walk->nthreads; ++i) {
+		pthread_join(walk->threads[i], NULL);
+	}
+
+	free_entries(&walk->errors);
+
+	while (walk->all) {
+		struct dir_walk_dir *next = walk->all->next;
+
+		free_entries(&walk->all->entries);
+		free(walk->all->path);
+		free(walk->all);
+
+		walk->all = next;
+	}
+
+	pthread_cond_destroy(&walk->files_ready);
+	pthread_cond_destroy(&walk->dirs_ready);
+	pthread_mutex_destroy(&walk->lock);
+
+	free(walk);
+}
@@ -0,0 +1,41 @@
+#ifndef S1KD_DIRWALK_H
+#define S1KD_DIRWALK_H
+
+#include <stdbool.h>
+
+/* Number of threads used to walk directories. Reading directories is mostly
+ * waiting on the file system, so this may be more than the number of CPUs. */
+#define DIR_WALK_THREADS 8
+
+/* A walk over one or more directories. */
+struct dir_walk;
+
+/* Create a new walk. Only files for which is(name, data) returns true are
+ * found, or all files if is is NULL. The filter is called from the walking
+ * threads, so it must only use the file name and data. */
+struct dir_walk *dir_walk_new(bool recursive, bool (*is)(const char *, void *), void *data);
+
+/* Add a directory to a walk. Returns false if the directory cannot be read.
+ * Directories must be added before the first call to dir_walk_next. */
+bool dir_walk_add(struct dir_walk *walk, const char *path);
+
+/* Copy the path of the next file found by a walk to dst, waiting for one to
+ * be found if needed. Returns false when all directories have been walked.
+ *
+ * Files are returned as soon as they can be, so they can be processed while
+ * the rest of the directories are walked. They are returned in the same order
+ * as a walk by a single thread: the files in each directory in the order they
+ * are read, with the files in each subdirectory at the point where it is
+ * read. */
+bool dir_walk_next(struct dir_walk *walk, char *dst);
+
+/* Copy the path of the next subdirectory of a walk which could not be read to
+ * dst. Only directories reached by dir_walk_next are reported, in the same
+ * order, so this should be called once it has returned false. Returns false
+ * when there are no more. */
+bool dir_walk_next_error(struct dir_walk *walk, char *dst);
+
+/* Stop a walk and free it. */
+void dir_walk_free(struct dir_walk *walk);
+
+#endif
@@ -1,5 +1,34 @@
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <libxml/xmlreader.h>
 #include "s1kd_tools.h"
 
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <linux/fs.h>
+#endif
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+#ifdef LIBS1KD
+#include <pthread.h>
+#endif
+
 #define PROGRESS_BAR_WIDTH 60
 
 /* Default global XML parsing options.
@@ -134,14 +163,87 @@ xmlChar *xpath_of(xmlNodePtr node)
 	return dst;
 }
 
-/* Make a copy of a file. */
-int copy(const char *from, const char *to)
+/* Size of the buffer used to copy files when the kernel cannot copy them
+ * directly. */
+#define COPY_BUFFER_SIZE (1024 * 1024)
+
+/* Copy the contents of one open file to another with read/write. */
+static int copy_rw(int f1, int f2)
+{
+	char *buf;
+	ssize_t n;
+	int err = 0;
+
+	buf = malloc(COPY_BUFFER_SIZE);
+
+	while ((n = read(f1, buf, COPY_BUFFER_SIZE)) > 0) {
+		ssize_t w, off = 0;
+
+		while (off < n && (w = write(f2, buf + off, n - off)) > 0) {
+			off += w;
+		}
+
+		if (off < n) {
+			err = 1;
+			break;
+		}
+	}
+
+	if (n < 0) {
+		err = 1;
+	}
+
+	free(buf);
+
+	return err;
+}
+
+#ifdef __linux__
+/* Copy the contents of one open file to another in the kernel, without
+ * passing them through user space. The copy is shared copy-on-write if the
+ * file system supports it.
+ *
+ * Returns -1 if the kernel cannot copy the files and nothing was copied, so
+ * copy_rw can be used instead.
+ */
+static int copy_kernel(int f1, int f2, off_t size)
 {
+	off_t left = size;
+	ssize_t n = 0;
+
+	#ifdef FICLONE
+	if (ioctl(f2, FICLONE, f1) == 0) {
+		return 0;
+	}
+	#endif
+
+	while (left > 0 && (n = copy_file_range(f1, NULL, f2, NULL, left, 0)) > 0) {
+		left -= n;
+	}
+
+	/* copy_file_range is not supported between all file systems, so try
+	 * sendfile if it fails before copying anything. */
+	if (n < 0 && left == size) {
+		while (left > 0 && (n = sendfile(f2, f1, NULL, left)) > 0) {
+			left -= n;
+		}
+	}
+
+	if (n < 0) {
+		return left == size ? -1 : 1;
+	}
+
+	/* The file may have grown since it was stat'd. */
+	return copy_rw(f1, f2);
+}
+#endif
 
-	FILE *f1, *f2;
-	char buf[4096];
-	size_t n;
+/* Make a copy of a file, preserving its permissions. */
+int copy(const char *from, const char *to)
+{
+	int f1, f2;
 	struct stat sf, st;
+	int err = -1;
 
 	if (stat(from, &sf) == -1) {
 		return 1;
@@ -150,17 +252,34 @@ int copy(const char *from, const char *to)
 		return 1;
 	}
 
-	f1 = fopen(from, "rb");
-	f2 = fopen(to, "wb");
+	if ((f1 = open(from, O_RDONLY | O_BINARY)) == -1) {
+		return 1;
+	}
+	if ((f2 = open(to, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, sf.st_mode & 0777)) == -1) {
+		close(f1);
+		return 1;
+	}
+
+	#ifdef __linux__
+	err = copy_kernel(f1, f2, sf.st_size);
+	#endif
 
-	while ((n = fread(buf, 1, 4096, f1)) > 0) {
-		fwrite(buf, 1, n, f2);
+	if (err == -1) {
+		err = copy_rw(f1, f2);
 	}
 
-	fclose(f1);
-	fclose(f2);
+	#ifndef _WIN32
+	/* The mode given to open does not apply if the file already exists,
+	 * and is subject to the umask. */
+	fchmod(f2, sf.st_mode & 07777);
+	#endif
+
+	close(f1);
+	if (close(f2) != 0) {
+		err = 1;
+	}
 
-	return 0;
+	return err;
 }
 
 /* Determine if path is a directory. */
@@ -281,8 +400,7 @@ bool strnmatch(const char *p, const char *s, int n)
 	return true;
 }
 
-/* Find a CSDB object in a directory hierarchy based on its code. */
-bool find_csdb_object(char *dst, const char *path, const char *code, bool (*is)(const char *), bool recursive)
+static bool find_csdb_object_r(char *dst, const char *path, const char *code, bool (*is)(const char *), bool recursive)
 {
 	DIR *dir;
 	struct dirent *cur;
@@ -314,7 +432,7 @@ bool find_csdb_object(char *dst, const char *path, const char *code, bool (*is)(
 		if (recursive && isdir(cpath, true)) {
 			char tmp[PATH_MAX];
 
-			if (find_csdb_object(tmp, cpath, code, is, true) && (!found || codecmp(tmp, dst) > 0)) {
+			if (find_csdb_object_r(tmp, cpath, code, is, true) && (!found || codecmp(tmp, dst) > 0)) {
 				strcpy(dst, tmp);
 				found = true;
 			}
@@ -331,6 +449,15 @@ bool find_csdb_object(char *dst, const char *path, const char *code, bool (*is)(
 	return found;
 }
 
+/* Find a CSDB object in a directory hierarchy based on its code. */
+bool find_csdb_object(char *dst, const char *path, const char *code, bool (*is)(const char *), bool recursive)
+{
+	long long start = stat_start();
+	bool found = find_csdb_object_r(dst, path, code, is, recursive);
+	stat_end(S1KD_STAT_FIND, start, 0);
+	return found;
+}
+
 /* Find a CSDB object in a list of paths. */
 bool find_csdb_object_in_list(char *dst, char (*objects)[PATH_MAX], int n, const char *code)
 {
@@ -363,10 +490,15 @@ static bool strtodbl(double *d, const char *s)
 	return e != s && *e == 0;
 }
 
-/* Tests whether a value is in an S1000D range (a~c is equivalent to a|b|c) */
+/* Tests whether a value is in an S1000D range (a~c is equivalent to a|b|c)
+ *
+ * The range is split without strtok so that this (and is_in_set) can be
+ * called from several threads at once, and so that is_in_set can iterate over
+ * its own items while calling this function.
+ */
 bool is_in_range(const char *value, const char *range)
 {
-	char *ran, *first, *last;
+	char *ran, *first, *last, *end;
 	bool ret;
 	double f, l, v;
 
@@ -378,8 +510,14 @@ bool is_in_range(const char *value, const char *range)
 
 	strcpy(ran, range);
 
-	first = strtok(ran, "~");
-	last = strtok(NULL, "~");
+	first = ran;
+	last = strchr(ran, '~');
+	*last = '\0';
+	++last;
+
+	if ((end = strchr(last, '~'))) {
+		*end = '\0';
+	}
 
 	/* Attempt to compare the values numerically. If any of the values are
 	 * non-numeric, fall back to lexicographic comparison.
@@ -401,7 +539,7 @@ bool is_in_range(const char *value, const char *range)
 /* Tests whether a value is in an S1000D set (a|b|c) */
 bool is_in_set(const char *value, const char *set)
 {
-	char *s, *val = NULL;
+	char *s, *val, *next;
 	bool ret = false;
 
 	if (!strchr(set, '|')) {
@@ -412,7 +550,16 @@ bool is_in_set(const char *value, const char *set)
 
 	strcpy(s, set);
 
-	while ((val = strtok(val ? NULL : s, "|"))) {
+	for (val = s; val; val = next) {
+		if ((next = strchr(val, '|'))) {
+			*next = '\0';
+			++next;
+		}
+
+		if (*val == '\0') {
+			continue;
+		}
+
 		if (is_in_range(value, val)) {
 			ret = true;
 			break;
@@ -512,38 +659,416 @@ bool optset(int opts, int opt)
 	return ((opts & opt) == opt);
 }
 
+#ifndef _WIN32
+/* Files at least this large are mapped in to memory and parsed from the
+ * mapping, instead of being read through the parser's buffered I/O. */
+#define MMAP_THRESHOLD (8 * 1024 * 1024)
+
+/* Parse an XML document from a file mapped in to memory.
+ *
+ * Returns false if the file could not be mapped, in which case it should be
+ * read normally instead. */
+static bool read_xml_doc_mmap(const char *path, xmlDocPtr *doc)
+{
+	int fd;
+	struct stat st;
+	char *map;
+
+	/* "-" is read from stdin by libxml2. */
+	if (strcmp(path, "-") == 0 || (fd = open(path, O_RDONLY)) == -1) {
+		return false;
+	}
+
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < MMAP_THRESHOLD || st.st_size > INT_MAX) {
+		close(fd);
+		return false;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (map == MAP_FAILED) {
+		return false;
+	}
+
+	/* Compressed files are decompressed by libxml2's own I/O. */
+	if (map[0] == '\x1f' && map[1] == '\x8b') {
+		munmap(map, st.st_size);
+		return false;
+	}
+
+	#ifdef MADV_SEQUENTIAL
+	madvise(map, st.st_size, MADV_SEQUENTIAL);
+	#endif
+
+	*doc = xmlReadMemory(map, st.st_size, path, NULL, DEFAULT_PARSE_OPTS);
+
+	munmap(map, st.st_size);
+
+	return true;
+}
+#endif
+
 /* Read an XML document from a file. */
 xmlDocPtr read_xml_doc(const char *path)
 {
 	xmlDocPtr doc;
+	long long start = stat_start();
 
+	#ifdef _WIN32
 	doc = xmlReadFile(path, NULL, DEFAULT_PARSE_OPTS);
+	#else
+	if (!read_xml_doc_mmap(path, &doc)) {
+		doc = xmlReadFile(path, NULL, DEFAULT_PARSE_OPTS);
+	}
+	#endif
 
 	if (optset(DEFAULT_PARSE_OPTS, XML_PARSE_XINCLUDE)) {
 		xmlXIncludeProcessFlags(doc, DEFAULT_PARSE_OPTS);
 	}
 
+	if (start >= 0) {
+		struct stat st;
+		stat_end(S1KD_STAT_READ, start, stat(path, &st) == 0 ? st.st_size : 0);
+	}
+
 	return doc;
 }
 
 /* Read an XML document from memory. */
 xmlDocPtr read_xml_mem(const char *buffer, int size)
+{
+	return read_xml_mem_opts(buffer, size, DEFAULT_PARSE_OPTS);
+}
+
+/* Read an XML document from memory with specific parser options. */
+xmlDocPtr read_xml_mem_opts(const char *buffer, int size, int opts)
 {
 	xmlDocPtr doc;
 
-	doc = xmlReadMemory(buffer, size, NULL, NULL, DEFAULT_PARSE_OPTS);
+	doc = xmlReadMemory(buffer, size, NULL, NULL, opts);
 
-	if (optset(DEFAULT_PARSE_OPTS, XML_PARSE_XINCLUDE)) {
-		xmlXIncludeProcessFlags(doc, DEFAULT_PARSE_OPTS);
+	if (doc && optset(opts, XML_PARSE_XINCLUDE)) {
+		xmlXIncludeProcessFlags(doc, opts);
 	}
 
 	return doc;
 }
 
+/* Size of the buffer used when saving XML documents, so that large documents
+ * are written with few system calls. */
+#define SAVE_BUFFER_SIZE (1024 * 1024)
+
+/* When saved files are flushed to disk, set by the S1KD_FSYNC environment
+ * variable:
+ *
+ * none  Never (default).
+ * file  Flush each file before it replaces the previous version.
+ * full  Also flush the directory containing the file after it is replaced.
+ */
+enum save_sync { SAVE_SYNC_NONE, SAVE_SYNC_FILE, SAVE_SYNC_FULL };
+
+static enum save_sync get_save_sync(void)
+{
+	const char *env;
+
+	if (!(env = getenv("S1KD_FSYNC")) || strcmp(env, "") == 0 || strcmp(env, "none") == 0) {
+		return SAVE_SYNC_NONE;
+	} else if (strcmp(env, "full") == 0) {
+		return SAVE_SYNC_FULL;
+	} else {
+		return SAVE_SYNC_FILE;
+	}
+}
+
+/* Flush a file to disk. */
+static int sync_fd(int fd)
+{
+	#ifdef _WIN32
+	return 0;
+	#else
+	return fsync(fd);
+	#endif
+}
+
+/* Flush the directory containing a file to disk. */
+static void sync_dir(const char *path)
+{
+	#ifndef _WIN32
+	char s[PATH_MAX];
+	int fd;
+
+	strcpy(s, path);
+
+	if ((fd = open(dirname(s), O_RDONLY)) != -1) {
+		fsync(fd);
+		close(fd);
+	}
+	#endif
+}
+
+/* Write a whole buffer to a file. */
+static int write_all(int fd, const char *data, size_t len)
+{
+	while (len > 0) {
+		ssize_t n;
+
+		if ((n = write(fd, data, len)) == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return -1;
+		}
+
+		data += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+/* Buffer for writing a serialised XML document to a file. */
+struct save_buffer {
+	int fd;
+	char *data;
+	size_t len;
+};
+
+static int save_buffer_write(void *context, const char *data, int len)
+{
+	struct save_buffer *buf = context;
+
+	if (buf->len + len > SAVE_BUFFER_SIZE) {
+		if (write_all(buf->fd, buf->data, buf->len) != 0) {
+			return -1;
+		}
+		buf->len = 0;
+	}
+
+	if (len > SAVE_BUFFER_SIZE) {
+		if (write_all(buf->fd, data, len) != 0) {
+			return -1;
+		}
+	} else {
+		memcpy(buf->data + buf->len, data, len);
+		buf->len += len;
+	}
+
+	return len;
+}
+
+/* Serialise an XML document to an open file, in the same way as xmlSaveFile. */
+static int save_xml_doc_fd(xmlDocPtr doc, int fd)
+{
+	struct save_buffer buf;
+	xmlCharEncodingHandlerPtr enc = NULL;
+	xmlOutputBufferPtr out;
+	int n;
+
+	if (doc->encoding && !(enc = xmlFindCharEncodingHandler((char *) doc->encoding))) {
+		return -1;
+	}
+
+	buf.fd = fd;
+	buf.data = malloc(SAVE_BUFFER_SIZE);
+	buf.len = 0;
+
+	if (!(out = xmlOutputBufferCreateIO(save_buffer_write, NULL, &buf, enc))) {
+		free(buf.data);
+		return -1;
+	}
+
+	n = xmlSaveFileTo(out, doc, (char *) doc->encoding);
+
+	if (n != -1 && write_all(fd, buf.data, buf.len) != 0) {
+		n = -1;
+	}
+
+	free(buf.data);
+
+	return n;
+}
+
+/* Save an XML document to a temporary file next to a path, to be moved to
+ * that path with commit_tmp_file once it is completely written.
+ *
+ * If the temporary file cannot be created, tmp is set to an empty string. */
+int save_xml_doc_tmp(xmlDocPtr doc, const char *path, char *tmp)
+{
+	int fd = -1, n, i;
+
+	for (i = 0; fd == -1 && i < 100; ++i) {
+		if (snprintf(tmp, PATH_MAX, "%s.%ld.%d.tmp", path, (long) getpid(), i) >= PATH_MAX) {
+			break;
+		}
+
+		if ((fd = open(tmp, O_WRONLY | O_CREAT | O_EXCL | O_BINARY, 0666)) == -1 && errno != EEXIST) {
+			break;
+		}
+	}
+
+	if (fd == -1) {
+		tmp[0] = '\0';
+		return -1;
+	}
+
+	n = save_xml_doc_fd(doc, fd);
+
+	if (n != -1 && get_save_sync() != SAVE_SYNC_NONE && sync_fd(fd) != 0) {
+		n = -1;
+	}
+	if (close(fd) != 0) {
+		n = -1;
+	}
+
+	if (n == -1) {
+		remove(tmp);
+	}
+
+	return n;
+}
+
+/* Determine if an existing file must be overwritten in place rather than
+ * replaced, so that it remains what it is: symbolic links, files with more
+ * than one hard link, devices and pipes. */
+static bool must_write_in_place(const char *path)
+{
+	struct stat st;
+
+	#ifdef _WIN32
+	return stat(path, &st) == 0 && !S_ISREG(st.st_mode);
+	#else
+	return lstat(path, &st) == 0 && (!S_ISREG(st.st_mode) || st.st_nlink > 1);
+	#endif
+}
+
+/* Replace a file with a temporary file written next to it.
+ *
+ * An existing file keeps its permissions, and is not replaced if it is
+ * read-only. Symbolic links and files with more than one hard link are
+ * overwritten with the contents of the temporary file instead of being
+ * replaced, so the links are kept. The temporary file is removed once it is
+ * committed or if it cannot be. */
+int commit_tmp_file(const char *tmp, const char *path)
+{
+	struct stat st;
+
+	if (stat(path, &st) == 0) {
+		if (access(path, W_OK) != 0) {
+			remove(tmp);
+			return -1;
+		}
+		#ifndef _WIN32
+		chmod(tmp, st.st_mode & 07777);
+		#endif
+	}
+
+	if (must_write_in_place(path)) {
+		int err = copy(tmp, path);
+
+		if (err == 0 && get_save_sync() != SAVE_SYNC_NONE) {
+			int fd;
+
+			if ((fd = open(path, O_WRONLY | O_BINARY)) != -1) {
+				/* See save_xml_doc_in_place. */
+				if (sync_fd(fd) != 0 && errno != EINVAL) {
+					err = -1;
+				}
+				close(fd);
+			}
+		}
+
+		remove(tmp);
+
+		return err == 0 ? 0 : -1;
+	}
+
+	#ifdef _WIN32
+	if (!MoveFileEx(tmp, path, MOVEFILE_REPLACE_EXISTING)) {
+	#else
+	if (rename(tmp, path) != 0) {
+	#endif
+		remove(tmp);
+		return -1;
+	}
+
+	if (get_save_sync() == SAVE_SYNC_FULL) {
+		sync_dir(path);
+	}
+
+	return 0;
+}
+
+/* Save an XML document to a file by overwriting it. */
+static int save_xml_doc_in_place(xmlDocPtr doc, const char *path)
+{
+	int fd, n;
+
+	if ((fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0666)) == -1) {
+		return -1;
+	}
+
+	n = save_xml_doc_fd(doc, fd);
+
+	/* fsync fails with EINVAL for files such as pipes, which need not be
+	 * flushed. */
+	if (n != -1 && get_save_sync() != SAVE_SYNC_NONE && sync_fd(fd) != 0 && errno != EINVAL) {
+		n = -1;
+	}
+	if (close(fd) != 0) {
+		n = -1;
+	}
+
+	return n;
+}
+
+/* Save an XML document to a file, replacing it atomically when possible.
+ *
+ * The document is written to a temporary file which then replaces the file,
+ * so that a failed or interrupted save never leaves a partially written
+ * file. Files that are not plain regular files (symbolic links, files with
+ * more than one hard link, devices, pipes) are overwritten in place instead,
+ * so they remain what they are, as are files in a directory where the
+ * temporary file cannot be created.
+ *
+ * Returns the number of bytes written, or -1 on error. */
+static int save_xml_doc_file(xmlDocPtr doc, const char *path)
+{
+	char tmp[PATH_MAX];
+	int n;
+
+	/* libxml2 handles writing to stdout and compression. */
+	if (strcmp(path, "-") == 0 || xmlGetDocCompressMode(doc) > 0) {
+		return xmlSaveFile(path, doc);
+	}
+
+	/* These would be overwritten in place by commit_tmp_file anyway, so
+	 * there is no need for a temporary file. */
+	if (must_write_in_place(path)) {
+		return save_xml_doc_in_place(doc, path);
+	}
+
+	if ((n = save_xml_doc_tmp(doc, path, tmp)) == -1) {
+		if (tmp[0] == '\0') {
+			return save_xml_doc_in_place(doc, path);
+		}
+		return -1;
+	}
+
+	if (commit_tmp_file(tmp, path) != 0) {
+		return -1;
+	}
+
+	return n;
+}
+
 /* Save an XML document to a file. */
 int save_xml_doc(xmlDocPtr doc, const char *path)
 {
-	return xmlSaveFile(path, doc);
+	long long start = stat_start();
+	int n = save_xml_doc_file(doc, path);
+	stat_end(S1KD_STAT_SAVE, start, n > 0 ? n : 0);
+	return n;
 }
 
 /* Return the first node matching an XPath expression. */
@@ -800,25 +1325,353 @@ void add_cct_depends(xmlDocPtr doc, xmlDocPtr cct, xmlChar *id)
 	xmlXPathFreeContext(ctx);
 }
 
-/* Test whether an object value matches a regex pattern. */
-bool match_pattern(const xmlChar *value, const xmlChar *pattern)
-{
-	xmlRegexpPtr regex;
-	bool match;
-	regex = xmlRegexpCompile(BAD_CAST pattern);
-	match = xmlRegexpExec(regex, BAD_CAST value);
-	xmlRegFreeRegexp(regex);
-	return match;
-}
+/* Cache of cross-reference tables (ACT, CCT and PCT), keyed by path.
+ *
+ * Many objects usually share the same few tables, so each is read once and
+ * kept for the life of the process, along with an index of the definitions
+ * of its product attributes, conditions and condition types. An entry is
+ * read again if the size, modification time or inode of its file change.
+ *
+ * The cached document is shared by all callers and must not be modified or
+ * freed. Its _private field points back to the cache entry.
+ */
+#define XREF_TABLE_BUCKETS 61
 
-/* Display a progress bar. */
-void print_progress_bar(float cur, float total)
-{
-	float p;
-	int i, b;
+struct xref_table {
+	char *path;
+	off_t size;
+	time_t mtime;
+	ino_t ino;
+	xmlDocPtr doc;
+	xmlHashTablePtr prodattrs;
+	xmlHashTablePtr conds;
+	xmlHashTablePtr condtypes;
+	struct xref_table *next;
+};
 
-	p = cur / total;
-	b = PROGRESS_BAR_WIDTH * p;
+static struct xref_table *xref_tables[XREF_TABLE_BUCKETS];
+
+/* Add the definitions in a cross-reference table to its index. */
+static void index_xref_table(struct xref_table *t, xmlNodePtr node)
+{
+	xmlNodePtr cur;
+
+	for (cur = node; cur; cur = cur->next) {
+		xmlHashTablePtr h;
+		xmlChar *id;
+
+		if (cur->type != XML_ELEMENT_NODE) {
+			continue;
+		}
+
+		if (xmlStrcmp(cur->name, BAD_CAST "productAttribute") == 0 || xmlStrcmp(cur->name, BAD_CAST "prodattr") == 0) {
+			h = t->prodattrs;
+		} else if (xmlStrcmp(cur->name, BAD_CAST "cond") == 0 || xmlStrcmp(cur->name, BAD_CAST "condition") == 0) {
+			h = t->conds;
+		} else if (xmlStrcmp(cur->name, BAD_CAST "condType") == 0 || xmlStrcmp(cur->name, BAD_CAST "conditiontype") == 0) {
+			h = t->condtypes;
+		} else {
+			index_xref_table(t, cur->children);
+			continue;
+		}
+
+		/* The first definition of an id in document order is used. */
+		if ((id = xmlGetProp(cur, BAD_CAST "id"))) {
+			xmlHashAddEntry(h, id, cur);
+			xmlFree(id);
+		}
+	}
+}
+
+/* Free the document and index of a cached cross-reference table. */
+static void clear_xref_table(struct xref_table *t)
+{
+	xmlFreeDoc(t->doc);
+	xmlHashFree(t->prodattrs, NULL);
+	xmlHashFree(t->conds, NULL);
+	xmlHashFree(t->condtypes, NULL);
+	t->doc = NULL;
+	t->prodattrs = NULL;
+	t->conds = NULL;
+	t->condtypes = NULL;
+}
+
+/* Read a cross-reference table (ACT, CCT or PCT), using the cached copy if
+ * the file has not changed since it was last read. */
+xmlDocPtr read_xref_table(const char *path)
+{
+	struct stat st;
+	struct xref_table *t;
+	unsigned long h = 5381;
+	const char *c;
+
+	if (stat(path, &st) != 0) {
+		return NULL;
+	}
+
+	for (c = path; *c; ++c) {
+		h = h * 33 + *c;
+	}
+	h %= XREF_TABLE_BUCKETS;
+
+	for (t = xref_tables[h]; t; t = t->next) {
+		if (strcmp(t->path, path) == 0) {
+			break;
+		}
+	}
+
+	if (t && t->size == st.st_size && t->mtime == st.st_mtime && t->ino == st.st_ino) {
+		return t->doc;
+	}
+
+	/* A table that has changed is read again into a new entry, which hides
+	 * the old one. The old document is kept until the cache is freed, as a
+	 * caller may still be using it. */
+	t = calloc(1, sizeof(struct xref_table));
+	t->path = strdup(path);
+	t->next = xref_tables[h];
+	xref_tables[h] = t;
+
+	t->size = st.st_size;
+	t->mtime = st.st_mtime;
+	t->ino = st.st_ino;
+
+	if ((t->doc = read_xml_doc(path))) {
+		t->doc->_private = t;
+		t->prodattrs = xmlHashCreate(0);
+		t->conds = xmlHashCreate(0);
+		t->condtypes = xmlHashCreate(0);
+		index_xref_table(t, xmlDocGetRootElement(t->doc));
+	}
+
+	return t->doc;
+}
+
+/* Find the definition of a product attribute ("prodattr") or condition
+ * ("condition") in a table read by read_xref_table.
+ *
+ * For a condition, the definition of its condition type is returned, or the
+ * condition itself if it does not reference one.
+ */
+xmlNodePtr xref_table_property(xmlDocPtr ct, const xmlChar *type, const xmlChar *id)
+{
+	struct xref_table *t;
+
+	if (!ct || !(t = ct->_private)) {
+		return NULL;
+	}
+
+	if (xmlStrcmp(type, BAD_CAST "prodattr") == 0) {
+		return xmlHashLookup(t->prodattrs, id);
+	} else if (xmlStrcmp(type, BAD_CAST "condition") == 0) {
+		xmlNodePtr cond;
+		xmlChar *ref;
+
+		if (!(cond = xmlHashLookup(t->conds, id))) {
+			return NULL;
+		}
+
+		if (!(ref = xmlGetProp(cond, BAD_CAST "condTypeRefId"))) {
+			ref = xmlGetProp(cond, BAD_CAST "condtyperef");
+		}
+
+		if (ref) {
+			cond = xmlHashLookup(t->condtypes, ref);
+			xmlFree(ref);
+		}
+
+		return cond;
+	}
+
+	return NULL;
+}
+
+/* Find a definition in a table read by read_xref_table or indexed by
+ * index_xref_doc, by the kind of definition ("prodattr", "cond" or
+ * "condtype") and its id. */
+xmlNodePtr xref_table_definition(xmlDocPtr ct, const char *kind, const xmlChar *id)
+{
+	struct xref_table *t;
+
+	if (!ct || !(t = ct->_private) || !id) {
+		return NULL;
+	}
+
+	if (strcmp(kind, "prodattr") == 0) {
+		return xmlHashLookup(t->prodattrs, id);
+	} else if (strcmp(kind, "cond") == 0) {
+		return xmlHashLookup(t->conds, id);
+	} else if (strcmp(kind, "condtype") == 0) {
+		return xmlHashLookup(t->condtypes, id);
+	}
+
+	return NULL;
+}
+
+/* Index the definitions in a document that is not in the cache, such as an
+ * object which is being processed, so that it can be searched in the same way
+ * as a cached table.
+ *
+ * Returns false, and leaves the document unindexed, if it contains no
+ * definitions. The index must be freed with free_xref_index before the
+ * document is freed. */
+bool index_xref_doc(xmlDocPtr doc)
+{
+	struct xref_table *t;
+
+	t = calloc(1, sizeof(struct xref_table));
+	t->doc = doc;
+	t->prodattrs = xmlHashCreate(0);
+	t->conds = xmlHashCreate(0);
+	t->condtypes = xmlHashCreate(0);
+	index_xref_table(t, xmlDocGetRootElement(doc));
+
+	if (xmlHashSize(t->prodattrs) + xmlHashSize(t->conds) + xmlHashSize(t->condtypes) == 0) {
+		t->doc = NULL;
+		clear_xref_table(t);
+		free(t);
+		return false;
+	}
+
+	doc->_private = t;
+
+	return true;
+}
+
+/* Free the index of a document created by index_xref_doc. */
+void free_xref_index(xmlDocPtr doc)
+{
+	struct xref_table *t;
+
+	if (!(t = doc->_private)) {
+		return;
+	}
+
+	t->doc = NULL;
+	clear_xref_table(t);
+	free(t);
+	doc->_private = NULL;
+}
+
+/* Free the cache of cross-reference tables. */
+void free_xref_tables(void)
+{
+	int i;
+
+	for (i = 0; i < XREF_TABLE_BUCKETS; ++i) {
+		struct xref_table *t = xref_tables[i];
+
+		while (t) {
+			struct xref_table *next = t->next;
+			clear_xref_table(t);
+			free(t->path);
+			free(t);
+			t = next;
+		}
+
+		xref_tables[i] = NULL;
+	}
+}
+
+/* Cache of compiled regex patterns, keyed by the pattern string.
+ *
+ * A compiled regex is not modified when it is executed, so once added, an
+ * entry can be used by any number of threads. In libs1kd, the table itself is
+ * guarded by a lock, since calls may be made from several threads.
+ */
+#define PATTERN_BUCKETS 251
+
+struct pattern_entry {
+	xmlChar *pattern;
+	xmlRegexpPtr regex;
+	struct pattern_entry *next;
+};
+
+static struct pattern_entry *pattern_cache[PATTERN_BUCKETS];
+
+#ifdef LIBS1KD
+static pthread_mutex_t pattern_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* Return the compiled regex for a pattern, compiling it on first use. */
+static xmlRegexpPtr cached_regex(const xmlChar *pattern)
+{
+	struct pattern_entry *e;
+	unsigned long h = 5381;
+	const xmlChar *c;
+
+	for (c = pattern; *c; ++c) {
+		h = h * 33 + *c;
+	}
+	h %= PATTERN_BUCKETS;
+
+#ifdef LIBS1KD
+	pthread_mutex_lock(&pattern_cache_lock);
+#endif
+
+	for (e = pattern_cache[h]; e; e = e->next) {
+		if (xmlStrcmp(e->pattern, pattern) == 0) {
+			break;
+		}
+	}
+
+	if (!e) {
+		e = malloc(sizeof(struct pattern_entry));
+		e->pattern = xmlStrdup(pattern);
+		e->regex = xmlRegexpCompile(pattern);
+		e->next = pattern_cache[h];
+		pattern_cache[h] = e;
+	}
+
+#ifdef LIBS1KD
+	pthread_mutex_unlock(&pattern_cache_lock);
+#endif
+
+	return e->regex;
+}
+
+/* Test whether an object value matches a regex pattern. */
+bool match_pattern(const xmlChar *value, const xmlChar *pattern)
+{
+	return xmlRegexpExec(cached_regex(pattern), BAD_CAST value);
+}
+
+/* Free the cache of compiled regex patterns. */
+void free_pattern_cache(void)
+{
+	int i;
+
+#ifdef LIBS1KD
+	pthread_mutex_lock(&pattern_cache_lock);
+#endif
+
+	for (i = 0; i < PATTERN_BUCKETS; ++i) {
+		struct pattern_entry *e = pattern_cache[i];
+
+		while (e) {
+			struct pattern_entry *next = e->next;
+			xmlFree(e->pattern);
+			xmlRegFreeRegexp(e->regex);
+			free(e);
+			e = next;
+		}
+
+		pattern_cache[i] = NULL;
+	}
+
+#ifdef LIBS1KD
+	pthread_mutex_unlock(&pattern_cache_lock);
+#endif
+}
+
+/* Display a progress bar. */
+void print_progress_bar(float cur, float total)
+{
+	float p;
+	int i, b;
+
+	p = cur / total;
+	b = PROGRESS_BAR_WIDTH * p;
 
 	fprintf(stderr, "\r[");
 	for (i = 0; i < PROGRESS_BAR_WIDTH; ++i) {
@@ -895,6 +1748,32 @@ bool is_upf(const char *name)
 	return (strncmp(name, "UPF-", 4) == 0 || strncmp(name, "UPE-", 4) == 0) && is_xml(name);
 }
 
+/* Determine if the file is any kind of XML CSDB object. */
+bool is_xml_object(const char *name)
+{
+	return is_com(name) || is_ddn(name) || is_dm(name) || is_dml(name) || is_imf(name) || is_pm(name) || is_smc(name) || is_upf(name);
+}
+
+/* Filter for the XML CSDB objects found by a walk of a directory. */
+bool is_object_file(const char *name, void *data)
+{
+	return is_xml_object(name);
+}
+
+/* Determine if an argument is a directory to search for objects in. Arguments
+ * named like CSDB objects are taken to be files without checking, so that the
+ * usual case of many objects given as arguments does not need a stat each. */
+bool is_dir_arg(const char *path)
+{
+	char s[PATH_MAX];
+
+	if (snprintf(s, PATH_MAX, "%s", path) >= PATH_MAX) {
+		return false;
+	}
+
+	return !is_xml_object(basename(s)) && isdir(path, false);
+}
+
 /* Interpolate a command string with a file name and execute it. */
 int execfile(const char *execstr, const char *path)
 {
@@ -992,37 +1871,366 @@ int compare_basename(const void *a, const void *b)
 	return d;
 }
 
-/* Determine if a CSDB object is a CIR. */
-bool is_cir(const char *path, const bool ignore_del)
+/* Whether a schema URL names the schema of a CIR/TIR DM. */
+static bool is_cir_schema(const char *schema)
 {
-	xmlDocPtr doc;
-	xmlXPathContextPtr ctx;
-	xmlXPathObjectPtr obj;
-	bool is;
+	const char *base;
 
-	if (!(doc = read_xml_doc(path))) {
-		return false;
+	if ((base = strrchr(schema, '/'))) {
+		++base;
+	} else {
+		base = schema;
 	}
 
-	ctx = xmlXPathNewContext(doc);
+	return strcmp(base, "comrep.xsd") == 0 || strcmp(base, "techrep.xsd") == 0;
+}
 
-	/* Check that this is a CIR/TIR DM. */
-	obj = xmlXPathEvalExpression(BAD_CAST "//commonRepository|//techRepository|//techrep", ctx);
-	is = !xmlXPathNodeSetIsEmpty(obj->nodesetval);
-	xmlXPathFreeObject(obj);
+/* Copy the value of an attribute of the reader's current element. */
+static void reader_attr(xmlTextReaderPtr reader, const char *name, char *dst, int n)
+{
+	xmlChar *v;
 
-	/* Check that the DM is not "deleted" if ignore_del = true. */
-	if (is && ignore_del) {
-		obj = xmlXPathEvalExpression(BAD_CAST "//dmodule[identAndStatusSection/dmStatus/@issueType='deleted' or status/issno/@type='deleted']", ctx);
-		is = xmlXPathNodeSetIsEmpty(obj->nodesetval);
-		xmlXPathFreeObject(obj);
+	if ((v = xmlTextReaderGetAttribute(reader, BAD_CAST name))) {
+		strncpy(dst, (char *) v, n - 1);
+		dst[n - 1] = '\0';
+		xmlFree(v);
 	}
+}
 
-	xmlXPathFreeContext(ctx);
+/* Whether an element of the identification and status section is the ident
+ * of the object itself, as opposed to the ident of a referenced object (for
+ * example, a brexDmRef or sourceDmIdent). depth is relative to the section. */
+static bool is_own_ident(const char *name, int depth)
+{
+	if (depth == 2) {
+		return
+			strcmp(name, "dmIdent") == 0 ||
+			strcmp(name, "pmIdent") == 0 ||
+			strcmp(name, "commentIdent") == 0 ||
+			strcmp(name, "dmlIdent") == 0 ||
+			strcmp(name, "ddnIdent") == 0 ||
+			strcmp(name, "imfIdent") == 0 ||
+			strcmp(name, "scormContentPackageIdent") == 0;
+	} else if (depth == 1) {
+		return
+			strcmp(name, "dmaddres") == 0 ||
+			strcmp(name, "pmaddres") == 0;
+	}
+
+	return false;
+}
+
+/* Read the information about an object from its root element and
+ * identification and status section, stopping the parser at the end of the
+ * section.
+ *
+ * Codes and issue information are only taken from the object's own ident, and
+ * no more are read once it ends.
+ *
+ * Only when the object names no schema is the parser allowed to continue to
+ * the first element of the content, to tell whether it is a CIR/TIR.
+ */
+static int read_object_info(const char *path, struct object_info *info)
+{
+	xmlTextReaderPtr reader;
+	long long start = stat_start();
+	int depth = -1;
+	int ident_depth = -1;
+	bool ident_done = false;
+	bool in_content = false;
+	bool done = false;
+	int ret;
+
+	memset(info, 0, sizeof(struct object_info));
+
+	if (!(reader = xmlReaderForFile(path, NULL, DEFAULT_PARSE_OPTS & ~XML_PARSE_XINCLUDE))) {
+		stat_end(S1KD_STAT_INFO, start, 0);
+		return -1;
+	}
+
+	ret = xmlTextReaderRead(reader);
+
+	while (!done && ret == 1) {
+		const char *name;
+		int type;
+
+		type = xmlTextReaderNodeType(reader);
+		name = (const char *) xmlTextReaderConstLocalName(reader);
+
+		if (type == XML_READER_TYPE_END_ELEMENT) {
+			if (xmlTextReaderDepth(reader) == ident_depth) {
+				ident_depth = -1;
+				ident_done = true;
+			} else if (xmlTextReaderDepth(reader) == depth) {
+				/* End of the identification and status section. */
+				if (info->schema[0]) {
+					done = true;
+				}
+				depth = -1;
+			}
+		}
+
+		if (type != XML_READER_TYPE_ELEMENT) {
+			ret = xmlTextReaderRead(reader);
+			continue;
+		}
+
+		if (!info->type[0]) {
+			strncpy(info->type, name, sizeof(info->type) - 1);
+			reader_attr(reader, "xsi:noNamespaceSchemaLocation", info->schema, sizeof(info->schema));
+			info->cir = is_cir_schema(info->schema);
+
+			if (xmlTextReaderIsEmptyElement(reader)) {
+				done = true;
+			}
+		} else if (in_content) {
+			info->cir =
+				strcmp(name, "commonRepository") == 0 ||
+				strcmp(name, "techRepository") == 0 ||
+				strcmp(name, "techrep") == 0;
+			done = true;
+		} else if (depth == -1) {
+			if (strcmp(name, "identAndStatusSection") == 0 || strcmp(name, "idstatus") == 0) {
+				depth = xmlTextReaderDepth(reader);
+			} else if (strcmp(name, "content") == 0) {
+				in_content = true;
+			} else if (xmlTextReaderDepth(reader) == 1) {
+				/* Skip any other part of the object. */
+				ret = xmlTextReaderNext(reader);
+				continue;
+			}
+		} else if (ident_depth == -1) {
+			int d = xmlTextReaderDepth(reader);
+
+			if (!ident_done && is_own_ident(name, d - depth)) {
+				ident_depth = d;
+			} else if (d == depth + 1) {
+				char t[32] = "";
+				reader_attr(reader, "issueType", t, sizeof(t));
+				if (t[0]) {
+					info->deleted = strcmp(t, "deleted") == 0;
+				}
+
+				/* Only the address may contain the ident, so the
+				 * status and any other part is skipped, along with
+				 * the references in it. */
+				if (ident_done) {
+					ret = xmlTextReaderNext(reader);
+					continue;
+				}
+			} else {
+				/* Skip anything in the address besides the ident. */
+				ret = xmlTextReaderNext(reader);
+				continue;
+			}
+		} else if (strcmp(name, "dmCode") == 0) {
+			reader_attr(reader, "infoCode", info->info_code, sizeof(info->info_code));
+		} else if (strcmp(name, "incode") == 0) {
+			xmlChar *v;
+
+			if ((v = xmlTextReaderReadString(reader))) {
+				strncpy(info->info_code, (char *) v, sizeof(info->info_code) - 1);
+				xmlFree(v);
+			}
+		} else if (strcmp(name, "issueInfo") == 0) {
+			reader_attr(reader, "inWork", info->in_work, sizeof(info->in_work));
+		} else if (strcmp(name, "issno") == 0) {
+			char t[32] = "";
+			reader_attr(reader, "inwork", info->in_work, sizeof(info->in_work));
+			reader_attr(reader, "type", t, sizeof(t));
+			info->deleted = strcmp(t, "deleted") == 0;
+		}
+
+		ret = xmlTextReaderRead(reader);
+	}
+
+	stat_end(S1KD_STAT_INFO, start, xmlTextReaderByteConsumed(reader));
+
+	xmlFreeTextReader(reader);
+
+	return info->type[0] ? 0 : -1;
+}
+
+#ifndef LIBS1KD
+/* Cache of object information, keyed by path.
+ *
+ * Entries are checked against the size, modification time and inode of the
+ * file, so an object that changes while a tool is running is read again.
+ *
+ * The cache belongs to the process, so it is left out of libs1kd, which keeps
+ * no state of its own between calls.
+ *
+ * The cache is not locked, so get_object_info must only be called from one
+ * thread. Tools which walk directories with threads (s1kd_dirwalk.c) only
+ * filter files by name in the walking threads, and read the objects found
+ * from their main thread.
+ */
+#define OBJECT_INFO_BUCKETS 1021
+
+struct object_info_entry {
+	char *path;
+	off_t size;
+	time_t mtime;
+	ino_t ino;
+	int status;
+	struct object_info info;
+	struct object_info_entry *next;
+};
+
+static struct object_info_entry *object_info_cache[OBJECT_INFO_BUCKETS];
+
+static unsigned long hash_path(const char *path)
+{
+	unsigned long h = 5381;
+	int c;
+
+	while ((c = *path++)) {
+		h = h * 33 + c;
+	}
+
+	return h;
+}
+#endif
+
+/* Determine the type of a CSDB object without reading all of it. */
+int get_object_info(const char *path, struct object_info *info)
+{
+#ifdef LIBS1KD
+	return read_object_info(path, info);
+#else
+	struct stat st;
+	struct object_info_entry *e;
+	unsigned long h;
+
+	if (stat(path, &st) != 0) {
+		return -1;
+	}
+
+	h = hash_path(path) % OBJECT_INFO_BUCKETS;
+
+	for (e = object_info_cache[h]; e; e = e->next) {
+		if (strcmp(e->path, path) == 0) {
+			break;
+		}
+	}
+
+	if (!e) {
+		e = malloc(sizeof(struct object_info_entry));
+		e->path = strdup(path);
+		e->next = object_info_cache[h];
+		object_info_cache[h] = e;
+	} else if (e->size == st.st_size && e->mtime == st.st_mtime && e->ino == st.st_ino) {
+		memcpy(info, &e->info, sizeof(struct object_info));
+		return e->status;
+	}
+
+	e->size = st.st_size;
+	e->mtime = st.st_mtime;
+	e->ino = st.st_ino;
+	e->status = read_object_info(path, &e->info);
+
+	memcpy(info, &e->info, sizeof(struct object_info));
+
+	return e->status;
+#endif
+}
+
+/* Free the cache of object information. */
+void free_object_info_cache(void)
+{
+#ifndef LIBS1KD
+	int i;
+
+	for (i = 0; i < OBJECT_INFO_BUCKETS; ++i) {
+		struct object_info_entry *e = object_info_cache[i];
+
+		while (e) {
+			struct object_info_entry *next = e->next;
+			free(e->path);
+			free(e);
+			e = next;
+		}
+
+		object_info_cache[i] = NULL;
+	}
+#endif
+}
+
+/* Read only the root element and identification and status section of an
+ * object, stopping the parser at the end of the section.
+ *
+ * The internal DTD subset is copied as well, so that entities in the section
+ * can still be resolved. */
+xmlDocPtr read_ident_and_status(const char *path)
+{
+	xmlTextReaderPtr reader;
+	xmlDocPtr doc = NULL;
+	xmlNodePtr root = NULL;
+	int ret;
+
+	if (!(reader = xmlReaderForFile(path, NULL, DEFAULT_PARSE_OPTS & ~XML_PARSE_XINCLUDE))) {
+		return NULL;
+	}
+
+	ret = xmlTextReaderRead(reader);
+
+	while (ret == 1) {
+		const char *name;
+
+		if (xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT) {
+			ret = xmlTextReaderRead(reader);
+			continue;
+		}
+
+		name = (const char *) xmlTextReaderConstLocalName(reader);
+
+		if (!root) {
+			xmlDocPtr src = xmlTextReaderCurrentDoc(reader);
+
+			doc = xmlNewDoc(BAD_CAST "1.0");
+
+			if (src && src->intSubset) {
+				doc->intSubset = xmlCopyDtd(src->intSubset);
+				xmlAddChild((xmlNodePtr) doc, (xmlNodePtr) doc->intSubset);
+			}
 
-	xmlFreeDoc(doc);
+			root = xmlDocCopyNode(xmlTextReaderCurrentNode(reader), doc, 2);
+			xmlDocSetRootElement(doc, root);
 
-	return is;
+			if (xmlTextReaderIsEmptyElement(reader)) {
+				break;
+			}
+		} else if (strcmp(name, "identAndStatusSection") == 0 || strcmp(name, "idstatus") == 0) {
+			xmlNodePtr section;
+
+			if ((section = xmlTextReaderExpand(reader))) {
+				xmlAddChild(root, xmlDocCopyNode(section, doc, 1));
+			}
+
+			break;
+		} else if (xmlTextReaderDepth(reader) == 1) {
+			ret = xmlTextReaderNext(reader);
+			continue;
+		}
+
+		ret = xmlTextReaderRead(reader);
+	}
+
+	xmlFreeTextReader(reader);
+
+	return doc;
+}
+
+/* Determine if a CSDB object is a CIR. */
+bool is_cir(const char *path, const bool ignore_del)
+{
+	struct object_info info;
+
+	if (get_object_info(path, &info) != 0) {
+		return false;
+	}
+
+	return info.cir && !(ignore_del && info.deleted);
 }
 
 /* Recursively remove nodes marked as "delete". */
@@ -1060,3 +2268,352 @@ void rem_delete_elems(xmlDocPtr doc)
 {
 	rem_delete_nodes(xmlDocGetRootElement(doc));
 }
+
+/* Send a request to an s1kd-daemon listening on a Unix socket.
+ *
+ * The request is made of the working directory of the client and its XML
+ * parser options, followed by one argument per line, ending with an empty
+ * line. The daemon declines requests from clients whose parser options are
+ * not the same as its own.
+ * The daemon replies with the status of the request on the first line,
+ * followed by the body of the response.
+ *
+ * Returns the status, or -1 if the daemon could not be reached, in which
+ * case the caller should carry out the request itself.
+ */
+int daemon_request(const char *path, char * const args[], int nargs, char **body, int *size)
+{
+#ifdef _WIN32
+	return -1;
+#else
+	struct sockaddr_un addr;
+	int fd, i, status;
+	char cwd[PATH_MAX];
+	char opts[32];
+	char *buf = NULL, *s;
+	size_t len = 0, max = 0;
+	ssize_t n;
+
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		return -1;
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+
+	if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) == -1) {
+		return -1;
+	}
+
+	if (connect(fd, (struct sockaddr *) &addr, sizeof(addr)) == -1) {
+		close(fd);
+		return -1;
+	}
+
+	/* Relative paths in the request are relative to the working directory
+	 * of the client. */
+	if (!getcwd(cwd, PATH_MAX) || write(fd, cwd, strlen(cwd)) == -1 || write(fd, "\n", 1) == -1) {
+		close(fd);
+		return -1;
+	}
+
+	snprintf(opts, sizeof(opts), "%d\n", DEFAULT_PARSE_OPTS);
+	if (write(fd, opts, strlen(opts)) == -1) {
+		close(fd);
+		return -1;
+	}
+
+	for (i = 0; i < nargs; ++i) {
+		/* Arguments cannot be empty or contain the line separator. */
+		if (args[i][0] == '\0' || strchr(args[i], '\n') ||
+		    write(fd, args[i], strlen(args[i])) == -1 ||
+		    write(fd, "\n", 1) == -1) {
+			close(fd);
+			return -1;
+		}
+	}
+
+	if (write(fd, "\n", 1) == -1) {
+		close(fd);
+		return -1;
+	}
+
+	shutdown(fd, SHUT_WR);
+
+	while (1) {
+		if (len == max) {
+			max = max ? max * 2 : 4096;
+			buf = realloc(buf, max + 1);
+		}
+
+		if ((n = read(fd, buf + len, max - len)) <= 0) {
+			break;
+		}
+
+		len += n;
+	}
+
+	close(fd);
+
+	buf[len] = '\0';
+
+	if (n == -1 || !(s = strchr(buf, '\n'))) {
+		free(buf);
+		return -1;
+	}
+
+	status = atoi(buf);
+	++s;
+
+	if (body) {
+		*size = len - (s - buf);
+		*body = malloc(*size + 1);
+		memcpy(*body, s, *size + 1);
+	}
+
+	free(buf);
+
+	return status;
+#endif
+}
+
+/* Instrumentation.
+ *
+ * When the S1KD_STATS environment variable is set to "xml" or "json", the
+ * number of calls to each phase in enum s1kd_stat, the time spent in them and
+ * the bytes they read or wrote are recorded, and a summary is written in that
+ * format when the tool exits. The summary is written to stderr, or appended
+ * to the file named by S1KD_STATS_FILE. */
+#define STATS_DISABLED 0
+#define STATS_XML 1
+#define STATS_JSON 2
+#define STATS_UNKNOWN -1
+#define STATS_INITIALIZING -2
+
+static struct {
+	atomic_llong calls;
+	atomic_llong time;
+	atomic_llong bytes;
+} stats[S1KD_STAT_COUNT];
+
+static atomic_int stats_format = STATS_UNKNOWN;
+
+/* Current time in nanoseconds. */
+static long long stat_now(void)
+{
+	#ifdef _WIN32
+	LARGE_INTEGER count, freq;
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&freq);
+	return (long long) (count.QuadPart * (1e9 / freq.QuadPart));
+	#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+	#endif
+}
+
+#ifndef LIBS1KD
+static const char *stat_names[S1KD_STAT_COUNT] = {
+	"read_xml_doc",
+	"save_xml_doc",
+	"find_csdb_object",
+	"xsltApplyStylesheet",
+	"xmlSchemaValidateDoc",
+	"xpath",
+	"read_object_info"
+};
+
+/* Write the summary of the instrumentation. */
+static void print_stats(void)
+{
+	const char *tool = NULL;
+	const char *fname;
+	FILE *out;
+	double cpu = (double) clock() / CLOCKS_PER_SEC;
+	int i;
+
+	#ifdef __GLIBC__
+	tool = program_invocation_short_name;
+	#endif
+
+	if ((fname = getenv("S1KD_STATS_FILE")) && strcmp(fname, "") != 0) {
+		if (!(out = fopen(fname, "a"))) {
+			return;
+		}
+	} else {
+		out = stderr;
+	}
+
+	if (atomic_load(&stats_format) == STATS_JSON) {
+		fprintf(out, "{");
+		if (tool) {
+			fprintf(out, "\"tool\":\"%s\",", tool);
+		}
+		fprintf(out, "\"pid\":%ld,\"cpuTime\":%.6f,\"phases\":[", (long) getpid(), cpu);
+		for (i = 0; i < S1KD_STAT_COUNT; ++i) {
+			fprintf(out, "%s{\"name\":\"%s\",\"calls\":%lld,\"time\":%.6f,\"bytes\":%lld}",
+				i ? "," : "",
+				stat_names[i],
+				(long long) atomic_load(&stats[i].calls),
+				atomic_load(&stats[i].time) / 1e9,
+				(long long) atomic_load(&stats[i].bytes));
+		}
+		fprintf(out, "]}\n");
+	} else {
+		fprintf(out, "<?xml version=\"1.0\"?>\n<stats");
+		if (tool) {
+			fprintf(out, " tool=\"%s\"", tool);
+		}
+		fprintf(out, " pid=\"%ld\" cpuTime=\"%.6f\">\n", (long) getpid(), cpu);
+		for (i = 0; i < S1KD_STAT_COUNT; ++i) {
+			fprintf(out, "<phase name=\"%s\" calls=\"%lld\" time=\"%.6f\" bytes=\"%lld\"/>\n",
+				stat_names[i],
+				(long long) atomic_load(&stats[i].calls),
+				atomic_load(&stats[i].time) / 1e9,
+				(long long) atomic_load(&stats[i].bytes));
+		}
+		fprintf(out, "</stats>\n");
+	}
+
+	if (out != stderr) {
+		fclose(out);
+	}
+}
+#endif
+
+/* Read the instrumentation settings the first time a phase is timed, or when
+ * the tool starts (see start_stats). */
+static int init_stats(void)
+{
+	int format = STATS_UNKNOWN;
+
+	if (atomic_compare_exchange_strong(&stats_format, &format, STATS_INITIALIZING)) {
+		#ifdef LIBS1KD
+		/* The library never writes a summary. */
+		format = STATS_DISABLED;
+		#else
+		const char *env = getenv("S1KD_STATS");
+
+		if (!env || strcmp(env, "") == 0) {
+			format = STATS_DISABLED;
+		} else if (strcmp(env, "json") == 0) {
+			format = STATS_JSON;
+		} else {
+			format = STATS_XML;
+		}
+
+		if (format != STATS_DISABLED) {
+			atexit(print_stats);
+		}
+		#endif
+
+		atomic_store(&stats_format, format);
+	} else {
+		while ((format = atomic_load(&stats_format)) == STATS_INITIALIZING);
+	}
+
+	return format;
+}
+
+#if !defined(LIBS1KD) && defined(__GNUC__)
+/* Read the instrumentation settings when the tool starts, so that a summary
+ * is written even if the tool never times a phase (for example, when it is
+ * given no objects). */
+__attribute__((constructor)) static void start_stats(void)
+{
+	init_stats();
+}
+#endif
+
+/* Start timing a phase. */
+long long stat_start(void)
+{
+	int format = atomic_load_explicit(&stats_format, memory_order_relaxed);
+
+	if (format < 0) {
+		format = init_stats();
+	}
+
+	return format == STATS_DISABLED ? -1 : stat_now();
+}
+
+/* Record a call to a phase. */
+void stat_end(enum s1kd_stat stat, long long start, long bytes)
+{
+	if (start < 0) {
+		return;
+	}
+
+	atomic_fetch_add(&stats[stat].calls, 1);
+	atomic_fetch_add(&stats[stat].time, stat_now() - start);
+	atomic_fetch_add(&stats[stat].bytes, bytes);
+}
+
+#ifdef LIBS1KD
+s1kdContextPtr s1kdNewContext(void)
+{
+	s1kdContextPtr ctx;
+
+	/* Initializing the parser is not thread-safe, so do it here, before
+	 * the context is handed to any other thread. */
+	xmlInitParser();
+
+	if (!(ctx = malloc(sizeof(s1kdContext)))) {
+		return NULL;
+	}
+
+	ctx->parse_opts = DEFAULT_PARSE_OPTS;
+	ctx->filter_opts = 0;
+	ctx->date_format = NULL;
+
+	return ctx;
+}
+
+void s1kdFreeContext(s1kdContextPtr ctx)
+{
+	if (!ctx) {
+		return;
+	}
+
+	free(ctx->date_format);
+	free(ctx);
+}
+
+void s1kdContextSetParseOptions(s1kdContextPtr ctx, int options)
+{
+	ctx->parse_opts = options;
+}
+
+void s1kdContextSetFilterOptions(s1kdContextPtr ctx, int options)
+{
+	ctx->filter_opts = options;
+}
+
+int s1kdContextSetDateFormat(s1kdContextPtr ctx, const char *format)
+{
+	char *s = NULL;
+
+	if (format && !(s = strdup(format))) {
+		return 1;
+	}
+
+	free(ctx->date_format);
+	ctx->date_format = s;
+
+	return 0;
+}
+
+/* Read an XML document from memory using the options of a context. */
+xmlDocPtr read_xml_mem_ctx(const s1kdContext *ctx, const char *buffer, int size)
+{
+	return read_xml_mem_opts(buffer, size, ctx ? ctx->parse_opts : DEFAULT_PARSE_OPTS);
+}
+
+/* Return the filtering options of a context. */
+int ctx_filter_opts(const s1kdContext *ctx)
+{
+	return ctx ? ctx->filter_opts : 0;
+}
+#endif
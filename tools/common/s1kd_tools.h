@@ -87,7 +87,7 @@ bool find_config(char *dst, const char *name);
 /* Generate an XPath expression for a node. */
 xmlChar *xpath_of(xmlNodePtr node);
 
-/* Make a copy of a file. */
+/* Make a copy of a file, preserving its permissions. */
 int copy(const char *from, const char *to);
 
 /* Determine if a path is a directory. */
@@ -141,9 +141,18 @@ xmlDocPtr read_xml_doc(const char *path);
 /* Read an XML document from memory. */
 xmlDocPtr read_xml_mem(const char *buffer, int size);
 
+/* Read an XML document from memory with specific parser options. */
+xmlDocPtr read_xml_mem_opts(const char *buffer, int size, int opts);
+
 /* Save an XML document to a file. */
 int save_xml_doc(xmlDocPtr doc, const char *path);
 
+/* Save an XML document to a temporary file next to a path. */
+int save_xml_doc_tmp(xmlDocPtr doc, const char *path, char *tmp);
+
+/* Replace a file with a temporary file written next to it. */
+int commit_tmp_file(const char *tmp, const char *path);
+
 /* Return the first node matching an XPath expression. */
 xmlNodePtr xpath_first_node(xmlDocPtr doc, xmlNodePtr node, const xmlChar *path);
 
@@ -153,9 +162,34 @@ xmlChar *xpath_first_value(xmlDocPtr doc, xmlNodePtr node, const xmlChar *path);
 /* Add CCT dependencies to an object's annotations. */
 void add_cct_depends(xmlDocPtr doc, xmlDocPtr cct, xmlChar *id);
 
+/* Read a cross-reference table (ACT, CCT or PCT), using the cached copy if
+ * the file has not changed since it was last read. The document belongs to
+ * the cache and must not be modified or freed. */
+xmlDocPtr read_xref_table(const char *path);
+
+/* Find the definition of a product attribute or condition type in a table
+ * read by read_xref_table. */
+xmlNodePtr xref_table_property(xmlDocPtr ct, const xmlChar *type, const xmlChar *id);
+
+/* Find a definition ("prodattr", "cond" or "condtype") by its id in a table
+ * read by read_xref_table or indexed by index_xref_doc. */
+xmlNodePtr xref_table_definition(xmlDocPtr ct, const char *kind, const xmlChar *id);
+
+/* Index the definitions in a document that is not in the cache. */
+bool index_xref_doc(xmlDocPtr doc);
+
+/* Free the index of a document created by index_xref_doc. */
+void free_xref_index(xmlDocPtr doc);
+
+/* Free the cache of cross-reference tables. */
+void free_xref_tables(void);
+
 /* Test whether an object value matches a regex pattern. */
 bool match_pattern(const xmlChar *value, const xmlChar *pattern);
 
+/* Free the cache of compiled regex patterns used by match_pattern. */
+void free_pattern_cache(void);
+
 /* Display a progress bar. */
 void print_progress_bar(float cur, float total);
 
@@ -186,6 +220,15 @@ bool is_smc(const char *name);
 /* Determine if the file is a data update file. */
 bool is_upf(const char *name);
 
+/* Determine if the file is any kind of XML CSDB object. */
+bool is_xml_object(const char *name);
+
+/* Filter for the XML CSDB objects found by a walk of a directory. */
+bool is_object_file(const char *name, void *data);
+
+/* Determine if an argument is a directory to search for objects in. */
+bool is_dir_arg(const char *path);
+
 /* Interpolate a command string with a file name and execute it. */
 int execfile(const char *execstr, const char *path);
 
@@ -195,10 +238,115 @@ int extract_latest_csdb_objects(char (*latest)[PATH_MAX], char (*files)[PATH_MAX
 /* Compare the base names of two files. */
 int compare_basename(const void *a, const void *b);
 
+/* What the root element and identification of a CSDB object say about it. */
+struct object_info {
+	char type[64];         /* Name of the root element (dmodule, pm, ...). */
+	char schema[PATH_MAX]; /* The xsi:noNamespaceSchemaLocation, if any. */
+	char info_code[4];     /* Info code of a data module. */
+	char in_work[3];       /* Inwork issue number. */
+	bool deleted;          /* The issue type is "deleted". */
+	bool cir;              /* The object is a CIR/TIR data module. */
+};
+
+/* Determine the type of a CSDB object without reading all of it. */
+int get_object_info(const char *path, struct object_info *info);
+
+/* Free the cache of object information. */
+void free_object_info_cache(void);
+
+/* Read only the identification and status section of an object. */
+xmlDocPtr read_ident_and_status(const char *path);
+
 /* Determine if a CSDB object is a CIR. */
 bool is_cir(const char *path, const bool ignore_del);
 
 /* Remove elements marked as "delete". */
 void rem_delete_elems(xmlDocPtr doc);
 
+/* Send a request to an s1kd-daemon. */
+int daemon_request(const char *path, char * const args[], int nargs, char **body, int *size);
+
+/* Phases of the tools timed by the instrumentation (S1KD_STATS). */
+enum s1kd_stat {
+	S1KD_STAT_READ,   /* read_xml_doc */
+	S1KD_STAT_SAVE,   /* save_xml_doc */
+	S1KD_STAT_FIND,   /* find_csdb_object */
+	S1KD_STAT_XSLT,   /* xsltApplyStylesheet */
+	S1KD_STAT_SCHEMA, /* xmlSchemaValidateDoc */
+	S1KD_STAT_XPATH,  /* xmlXPathEvalExpression, xmlXPathCompiledEval */
+	S1KD_STAT_INFO,   /* get_object_info */
+	S1KD_STAT_COUNT
+};
+
+/* Start timing a phase. Returns a negative value if instrumentation is
+ * disabled. */
+long long stat_start(void);
+
+/* Record a call to a phase started with stat_start, and the number of bytes
+ * it read or wrote. */
+void stat_end(enum s1kd_stat stat, long long start, long bytes);
+
+/* Wrappers of library functions used by the tools, so that calls to them are
+ * recorded by the instrumentation. */
+static inline xmlXPathObjectPtr stat_xpath_eval_expression(const xmlChar *str, xmlXPathContextPtr ctxt)
+{
+	long long start = stat_start();
+	xmlXPathObjectPtr obj = xmlXPathEvalExpression(str, ctxt);
+	stat_end(S1KD_STAT_XPATH, start, 0);
+	return obj;
+}
+#define xmlXPathEvalExpression(str, ctxt) stat_xpath_eval_expression(str, ctxt)
+
+static inline xmlXPathObjectPtr stat_xpath_compiled_eval(xmlXPathCompExprPtr comp, xmlXPathContextPtr ctx)
+{
+	long long start = stat_start();
+	xmlXPathObjectPtr obj = xmlXPathCompiledEval(comp, ctx);
+	stat_end(S1KD_STAT_XPATH, start, 0);
+	return obj;
+}
+#define xmlXPathCompiledEval(comp, ctx) stat_xpath_compiled_eval(comp, ctx)
+
+#ifdef __XML_XSLT_TRANSFORM_H__
+static inline xmlDocPtr stat_xslt_apply_stylesheet(xsltStylesheetPtr style, xmlDocPtr doc, const char **params)
+{
+	long long start = stat_start();
+	xmlDocPtr res = xsltApplyStylesheet(style, doc, params);
+	stat_end(S1KD_STAT_XSLT, start, 0);
+	return res;
+}
+#define xsltApplyStylesheet(style, doc, params) stat_xslt_apply_stylesheet(style, doc, params)
+#endif
+
+#ifdef __XML_SCHEMA_H__
+static inline int stat_schema_validate_doc(xmlSchemaValidCtxtPtr ctxt, xmlDocPtr doc)
+{
+	long long start = stat_start();
+	int err = xmlSchemaValidateDoc(ctxt, doc);
+	stat_end(S1KD_STAT_SCHEMA, start, 0);
+	return err;
+}
+#define xmlSchemaValidateDoc(ctxt, doc) stat_schema_validate_doc(ctxt, doc)
+#endif
+
+#ifdef LIBS1KD
+/* Settings shared by calls to the libs1kd API.
+ *
+ * All state a library call needs is either passed to it or read from one of
+ * these, so separate threads may make calls at the same time. A NULL context
+ * means the defaults.
+ */
+typedef struct _s1kdContext {
+	int parse_opts;    /* libxml2 parser options used to read buffers. */
+	int filter_opts;   /* s1kdFilterOption flags. */
+	char *date_format; /* strftime format for dates, or NULL for the default. */
+} s1kdContext;
+typedef s1kdContext *s1kdContextPtr;
+
+/* Read an XML document from memory using the options of a context. */
+xmlDocPtr read_xml_mem_ctx(const s1kdContext *ctx, const char *buffer, int size);
+
+/* Return the filtering options of a context. */
+int ctx_filter_opts(const s1kdContext *ctx);
+#endif
+
 #endif
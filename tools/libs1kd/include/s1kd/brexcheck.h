@@ -6,6 +6,9 @@
 #ifndef S1KD_BREXCHECK
 #define S1KD_BREXCHECK
 
+#include <libxml/tree.h>
+#include <s1kd/context.h>
+
 /**
  * BREX check options.
  */
@@ -30,6 +33,18 @@ typedef enum {
  */
 int s1kdDocCheckDefaultBREX(xmlDocPtr doc, int options, xmlDocPtr *report);
 
+/**
+ * Check a CSDB object against the appropriate S1000D default BREX and generate
+ * a report of the results.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param doc The CSDB object
+ * @param options A combination of s1kdBREXCheckOption
+ * @param report XML report returned by the BREX check. The caller must free the report. If report is NULL, the report is discarded.
+ * @return 0 if there are no BREX errors, non-zero otherwise
+ */
+int s1kdCtxDocCheckDefaultBREX(const s1kdContext *ctx, xmlDocPtr doc, int options, xmlDocPtr *report);
+
 /**
  * Check a CSDB object against the appropriate S1000D default BREX and generate
  * a report of the results.
@@ -43,6 +58,20 @@ int s1kdDocCheckDefaultBREX(xmlDocPtr doc, int options, xmlDocPtr *report);
  */
 int s1kdCheckDefaultBREX(const char *object_xml, int object_size, int options, char **report, int *report_size);
 
+/**
+ * Check a CSDB object against the appropriate S1000D default BREX and generate
+ * a report of the results.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param object_xml Input buffer containing the XML of the CSDB object
+ * @param object_size Size of the object XML buffer
+ * @param options A combination of s1kdBREXCheckOption
+ * @param report_xml Output buffer for the XML of the BREX report. The caller must free the buffer. If report_xml is NULL, the report is discarded.
+ * @param report_size Size of the report XML buffer
+ * @return 0 if there are no BREX errors, non-zero otherwise
+ */
+int s1kdCtxCheckDefaultBREX(const s1kdContext *ctx, const char *object_xml, int object_size, int options, char **report, int *report_size);
+
 /**
  * Check a CSDB object against a BREX data module and generate a report of the
  * results.
@@ -55,6 +84,21 @@ int s1kdCheckDefaultBREX(const char *object_xml, int object_size, int options, c
  */
 int s1kdDocCheckBREX(xmlDocPtr doc, xmlDocPtr brex, int options, xmlDocPtr *report);
 
+/**
+ * Check a CSDB object against a BREX data module and generate a report of the
+ * results.
+ *
+ * A rule with an invalid object path is counted as an error.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param doc The CSDB object
+ * @param brex The BREX data module
+ * @param options A combination of s1kdBREXCheckOption
+ * @param report XML report returned by the BREX check. The caller must free the report. If report is NULL, the report is discarded.
+ * @return 0 if there are no BREX errors, non-zero otherwise
+ */
+int s1kdCtxDocCheckBREX(const s1kdContext *ctx, xmlDocPtr doc, xmlDocPtr brex, int options, xmlDocPtr *report);
+
 /** Check a CSDB object against a BREX data module and generate a report of the
  * results.
  *
@@ -69,4 +113,150 @@ int s1kdDocCheckBREX(xmlDocPtr doc, xmlDocPtr brex, int options, xmlDocPtr *repo
  */
 int s1kdCheckBREX(const char *object_xml, int object_size, const char *brex_xml, int brex_size, int options, char **report_xml, int *report_size);
 
+/** Check a CSDB object against a BREX data module and generate a report of the
+ * results.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param object_xml Input buffer containing the XML of the CSDB object
+ * @param object_size Size of the object XML buffer
+ * @param brex_xml Input buffer containing the XML of the BREX data module.
+ * @param brex_size Size of the BREX buffer
+ * @param options A combination of s1kdBREXCheckOption
+ * @param report_xml Output buffer for the XML of the BREX report. The caller must free the buffer. If report_xml is NULL, the report is discarded.
+ * @param report_size Size of the report XML buffer
+ * @return 0 if there are no BREX errors, non-zero otherwise.
+ */
+int s1kdCtxCheckBREX(const s1kdContext *ctx, const char *object_xml, int object_size, const char *brex_xml, int brex_size, int options, char **report_xml, int *report_size);
+
+/**
+ * A compiled BREX, made up of one or more BREX data modules (layers).
+ *
+ * The rules of each layer are compiled once, when the layer is added. A
+ * compiled BREX is only read when checking objects, so one can be used by
+ * several threads at the same time, as long as no layers are added to it
+ * while it is in use.
+ */
+typedef struct _s1kdBREX s1kdBREX;
+
+/**
+ * Pointer to a compiled BREX.
+ */
+typedef s1kdBREX *s1kdBREXPtr;
+
+/**
+ * Create a new compiled BREX with no layers.
+ *
+ * @return A pointer to a new compiled BREX, or NULL if it could not be allocated.
+ */
+s1kdBREXPtr s1kdNewBREX(void);
+
+/**
+ * Free a compiled BREX.
+ *
+ * @param brex The compiled BREX to free
+ */
+void s1kdFreeBREX(s1kdBREXPtr brex);
+
+/**
+ * Compile a BREX data module and add it as a layer of a compiled BREX.
+ *
+ * @param brex The compiled BREX
+ * @param doc The BREX data module, which is copied
+ * @return 0 if successful, non-zero otherwise
+ */
+int s1kdAddBREX(s1kdBREXPtr brex, xmlDocPtr doc);
+
+/**
+ * Compile a BREX data module and the chain of BREX data modules it references,
+ * and add them as layers of a compiled BREX.
+ *
+ * Referenced BREX data modules are searched for in a directory, and then in
+ * the built-in S1000D default BREX. The chain ends at a BREX data module which
+ * references no BREX, or one which is already a layer.
+ *
+ * @param brex The compiled BREX
+ * @param doc The BREX data module, which is copied
+ * @param search_dir Directory to search for referenced BREX data modules, or NULL to only use the built-in S1000D default BREX
+ * @return 0 if successful, non-zero if a referenced BREX could not be found (the layers found so far are kept)
+ */
+int s1kdAddLayeredBREX(s1kdBREXPtr brex, xmlDocPtr doc, const char *search_dir);
+
+/**
+ * Add one of the built-in S1000D default BREX data modules as a layer of a
+ * compiled BREX.
+ *
+ * @param brex The compiled BREX
+ * @param dmcode Data module code of the default BREX, for example DMC-S1000D-G-04-10-0301-00A-022A-D
+ * @return 0 if successful, non-zero if dmcode is not one of the built-in default BREX
+ */
+int s1kdAddDefaultBREX(s1kdBREXPtr brex, const char *dmcode);
+
+/**
+ * Get the data module code of the BREX data module referenced by a CSDB
+ * object.
+ *
+ * @param doc The CSDB object
+ * @param dmcode Output buffer for the data module code, for example DMC-S1000D-G-04-10-0301-00A-022A-D
+ * @param n Size of the output buffer
+ * @return 0 if the object references a BREX data module, non-zero otherwise
+ */
+int s1kdGetBREXRef(xmlDocPtr doc, char *dmcode, int n);
+
+/**
+ * Check a CSDB object against a compiled BREX and generate a report of the
+ * results.
+ *
+ * Unlike s1kdDocCheckBREX, context rules are only checked if their rules
+ * context matches the schema of the object, as with the s1kd-brexcheck tool.
+ *
+ * @param doc The CSDB object, which is not modified
+ * @param brex The compiled BREX
+ * @param options A combination of s1kdBREXCheckOption
+ * @param report XML report returned by the BREX check. The caller must free the report. If report is NULL, the report is discarded.
+ * @return 0 if there are no BREX errors, non-zero otherwise
+ */
+int s1kdDocCheckCompiledBREX(xmlDocPtr doc, s1kdBREXPtr brex, int options, xmlDocPtr *report);
+
+/**
+ * Check a CSDB object against a compiled BREX and generate a report of the
+ * results.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param doc The CSDB object, which is not modified
+ * @param brex The compiled BREX
+ * @param options A combination of s1kdBREXCheckOption
+ * @param report XML report returned by the BREX check. The caller must free the report. If report is NULL, the report is discarded.
+ * @return 0 if there are no BREX errors, non-zero otherwise
+ */
+int s1kdCtxDocCheckCompiledBREX(const s1kdContext *ctx, xmlDocPtr doc, s1kdBREXPtr brex, int options, xmlDocPtr *report);
+
+/**
+ * Check a CSDB object against a compiled BREX and generate a report of the
+ * results.
+ *
+ * @param object_xml Input buffer containing the XML of the CSDB object
+ * @param object_size Size of the object XML buffer
+ * @param brex The compiled BREX
+ * @param options A combination of s1kdBREXCheckOption
+ * @param report_xml Output buffer for the XML of the BREX report. The caller must free the buffer. If report_xml is NULL, the report is discarded.
+ * @param report_size Size of the report XML buffer
+ * @return 0 if there are no BREX errors, non-zero otherwise
+ */
+int s1kdCheckCompiledBREX(const char *object_xml, int object_size, s1kdBREXPtr brex, int options, char **report_xml, int *report_size);
+
+/**
+ * Check a CSDB object against a compiled BREX and generate a report of the
+ * results.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param object_xml Input buffer containing the XML of the CSDB object
+ * @param object_size Size of the object XML buffer
+ * @param brex The compiled BREX
+ * @param options A combination of s1kdBREXCheckOption
+ * @param report_xml Output buffer for the XML of the BREX report. The caller must free the buffer. If report_xml is NULL, the report is discarded.
+ * @param report_size Size of the report XML buffer
+ * @return 0 if there are no BREX errors, non-zero otherwise
+ */
+int s1kdCtxCheckCompiledBREX(const s1kdContext *ctx, const char *object_xml, int object_size, s1kdBREXPtr brex, int options, char **report_xml, int *report_size);
+
 #endif
@@ -0,0 +1,78 @@
+/**
+ * @file context.h
+ * @brief Settings shared by calls to the library
+ *
+ * Each function of the library has a variant taking an s1kdContext as its
+ * first argument. The variants without one behave as if passed a context
+ * with the default settings.
+ *
+ * Thread safety:
+ *
+ * - The library keeps no state of its own between calls, so calls may be made
+ *   from several threads at the same time.
+ * - A context may be shared by several threads, as long as it is not modified
+ *   or freed while a call using it is in progress. Otherwise, use one context
+ *   per thread.
+ * - A document may be passed to calls in several threads at the same time
+ *   when those calls only read it (for example, the object or BREX of a check,
+ *   or the input of a filter). Calls that modify a document, such as
+ *   s1kdCtxDocSetMetadata, must not run at the same time as any other call
+ *   using that document.
+ * - The first context must be created (or xmlInitParser called) by one
+ *   thread before any other thread uses the library.
+ */
+
+#ifndef S1KD_CONTEXT
+#define S1KD_CONTEXT
+
+/**
+ * Settings shared by calls to the library.
+ */
+typedef struct _s1kdContext s1kdContext;
+
+/**
+ * Pointer to a context.
+ */
+typedef s1kdContext *s1kdContextPtr;
+
+/**
+ * Create a new context with the default settings.
+ *
+ * @return A pointer to a new context, or NULL if it could not be allocated.
+ */
+s1kdContextPtr s1kdNewContext(void);
+
+/**
+ * Free a context.
+ *
+ * @param ctx The context to free
+ */
+void s1kdFreeContext(s1kdContextPtr ctx);
+
+/**
+ * Set the libxml2 parser options (XML_PARSE_*) used when reading objects from
+ * memory buffers.
+ *
+ * @param ctx The context
+ * @param options A combination of xmlParserOption values
+ */
+void s1kdContextSetParseOptions(s1kdContextPtr ctx, int options);
+
+/**
+ * Set the options used when filtering objects.
+ *
+ * @param ctx The context
+ * @param options A combination of s1kdFilterOption values
+ */
+void s1kdContextSetFilterOptions(s1kdContextPtr ctx, int options);
+
+/**
+ * Set the strftime format used when retrieving dates as metadata.
+ *
+ * @param ctx The context
+ * @param format The format, or NULL to use the default (%Y-%m-%d)
+ * @return 0 if successful, non-zero otherwise
+ */
+int s1kdContextSetDateFormat(s1kdContextPtr ctx, const char *format);
+
+#endif
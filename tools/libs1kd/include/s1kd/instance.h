@@ -8,6 +8,7 @@
 
 #include <stdbool.h>
 #include <libxml/tree.h>
+#include <s1kd/context.h>
 
 /**
  * A set of applicability definitions used to filter objects.
@@ -24,6 +25,14 @@ typedef enum {
 	S1KD_FILTER_PRUNE     /**< Only remove false parts of annotations */
 } s1kdFilterMode;
 
+/**
+ * Filtering options, set on a context with s1kdContextSetFilterOptions.
+ */
+typedef enum {
+	S1KD_FILTER_TAG_NON_APPLIC = 1,    /**< Tag non-applicable elements instead of removing them */
+	S1KD_FILTER_CLEAN_DISPLAY_TEXT = 2 /**< Remove display text from simplified annotations */
+} s1kdFilterOption;
+
 /**
  * Create a new set of applicability definitions.
  *
@@ -58,6 +67,17 @@ void s1kdAssign(s1kdApplicability app, const xmlChar *ident, const xmlChar *type
  */
 xmlDocPtr s1kdDocFilter(xmlDocPtr doc, s1kdApplicability app, s1kdFilterMode mode);
 
+/**
+ * Create a filtered instance based on user-defined applicability.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param doc The CSDB object, which is not modified
+ * @param app Applicability definitions to filter on
+ * @param mode Filtering mode
+ * @return A new XML document for the filtered instance
+ */
+xmlDocPtr s1kdCtxDocFilter(const s1kdContext *ctx, xmlDocPtr doc, s1kdApplicability app, s1kdFilterMode mode);
+
 /**
  * Create a filtered instance based on user-defined applicability.
  *
@@ -71,4 +91,18 @@ xmlDocPtr s1kdDocFilter(xmlDocPtr doc, s1kdApplicability app, s1kdFilterMode mod
  */
 int s1kdFilter(const char *object_xml, int object_size, s1kdApplicability app, s1kdFilterMode mode, char **result_xml, int *result_size);
 
+/**
+ * Create a filtered instance based on user-defined applicability.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param object_xml Input buffer containing the XML of the CSDB object to filter
+ * @param object_size Size of the object XML buffer
+ * @param app Applicability definitions to filter on
+ * @param mode Filtering mode
+ * @param result_xml Output buffer containing the XML of the resulting instance
+ * @param result_size Size of the result XML buffer
+ * @return 0 if filtering was successful, non-zero otherwise
+ */
+int s1kdCtxFilter(const s1kdContext *ctx, const char *object_xml, int object_size, s1kdApplicability app, s1kdFilterMode mode, char **result_xml, int *result_size);
+
 #endif
@@ -8,6 +8,7 @@
 
 #include <libxml/xmlstring.h>
 #include <libxml/tree.h>
+#include <s1kd/context.h>
 
 /**
  * Retrieve metadata from a CSDB object.
@@ -18,6 +19,16 @@
  */
 xmlChar *s1kdDocGetMetadata(xmlDocPtr doc, const xmlChar *name);
 
+/**
+ * Retrieve metadata from a CSDB object.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param doc The CSDB object
+ * @param name Name of the metadata
+ * @return A new xmlChar * containing the value of the metadata
+ */
+xmlChar *s1kdCtxDocGetMetadata(const s1kdContext *ctx, xmlDocPtr doc, const xmlChar *name);
+
 
 /**
  * Retrieve metadata from a CSDB object.
@@ -29,6 +40,17 @@ xmlChar *s1kdDocGetMetadata(xmlDocPtr doc, const xmlChar *name);
  */
 char *s1kdGetMetadata(const char *object_xml, int object_size, const char *name);
 
+/**
+ * Retrieve metadata from a CSDB object.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param object_xml Input buffer containing the XML of the object
+ * @param object_size Size of the object XML buffer
+ * @param name Name of the metadata
+ * @return A new char * containing the value of the metadata
+ */
+char *s1kdCtxGetMetadata(const s1kdContext *ctx, const char *object_xml, int object_size, const char *name);
+
 /**
  * Set metadata in a CSDB object.
  *
@@ -39,6 +61,17 @@ char *s1kdGetMetadata(const char *object_xml, int object_size, const char *name)
  */
 int s1kdDocSetMetadata(xmlDocPtr doc, const xmlChar *name, const xmlChar *value);
 
+/**
+ * Set metadata in a CSDB object.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param doc The CSDB object
+ * @param name Name of the metadata
+ * @param value New value of the metadata
+ * @return 0 if successful, non-zero otherwise
+ */
+int s1kdCtxDocSetMetadata(const s1kdContext *ctx, xmlDocPtr doc, const xmlChar *name, const xmlChar *value);
+
 /**
  * Set metadata in a CSDB object
  *
@@ -50,4 +83,16 @@ int s1kdDocSetMetadata(xmlDocPtr doc, const xmlChar *name, const xmlChar *value)
  */
 int s1kdSetMetadata(const char *object_xml, int object_size, const char *name, const char *value, char **result_xml, int *result_size);
 
+/**
+ * Set metadata in a CSDB object
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param object_xml Input buffer containing the XML of the object
+ * @param object_size Size of the object XML buffer
+ * @param name Name of the metadata
+ * @param value New value of the metadata
+ * @return 0 if successful, non-zero otherwise
+ */
+int s1kdCtxSetMetadata(const s1kdContext *ctx, const char *object_xml, int object_size, const char *name, const char *value, char **result_xml, int *result_size);
+
 #endif
@@ -0,0 +1,89 @@
+/**
+ * @file validate.h
+ * @brief Validate CSDB objects against their XML schemas
+ */
+
+#ifndef S1KD_VALIDATE
+#define S1KD_VALIDATE
+
+#include <libxml/tree.h>
+#include <s1kd/context.h>
+
+/**
+ * Validation options.
+ */
+typedef enum {
+	S1KD_VALIDATE_REMOVE_DELETED = 1, /**< Validate with elements marked as "delete" removed. */
+	S1KD_VALIDATE_NORMAL_LOG = 2 /**< Output errors to console. */
+} s1kdValidateOption;
+
+/**
+ * A compiled XML schema.
+ *
+ * A schema can be used to validate any number of objects, including from
+ * several threads at the same time.
+ */
+typedef struct _s1kdSchema s1kdSchema;
+
+/**
+ * Pointer to a compiled XML schema.
+ */
+typedef s1kdSchema *s1kdSchemaPtr;
+
+/**
+ * Compile an XML schema.
+ *
+ * @param url Path or URL of the schema
+ * @return A pointer to the compiled schema, or NULL if it could not be read.
+ */
+s1kdSchemaPtr s1kdNewSchema(const char *url);
+
+/**
+ * Free a compiled XML schema.
+ *
+ * @param schema The schema to free
+ */
+void s1kdFreeSchema(s1kdSchemaPtr schema);
+
+/**
+ * Validate a CSDB object against an XML schema and generate a report of the
+ * results.
+ *
+ * @param doc The CSDB object. A copy of it is validated, so it is not modified and may be validated by several threads at once.
+ * @param schema The schema to validate against. If schema is NULL, the schema named by the object's xsi:noNamespaceSchemaLocation is compiled for this call only.
+ * @param options A combination of s1kdValidateOption
+ * @param report XML report of the errors found. The caller must free the report. If report is NULL, the report is discarded.
+ * @return 0 if the object is valid, non-zero otherwise
+ */
+int s1kdDocValidate(xmlDocPtr doc, s1kdSchemaPtr schema, int options, xmlDocPtr *report);
+
+/**
+ * Validate a CSDB object against an XML schema and generate a report of the
+ * results.
+ *
+ * @param object_xml Input buffer containing the XML of the CSDB object
+ * @param object_size Size of the object XML buffer
+ * @param schema The schema to validate against, or NULL to use the object's xsi:noNamespaceSchemaLocation
+ * @param options A combination of s1kdValidateOption
+ * @param report_xml Output buffer for the XML of the report. The caller must free the buffer. If report_xml is NULL, the report is discarded.
+ * @param report_size Size of the report XML buffer
+ * @return 0 if the object is valid, non-zero otherwise
+ */
+int s1kdValidate(const char *object_xml, int object_size, s1kdSchemaPtr schema, int options, char **report_xml, int *report_size);
+
+/**
+ * Validate a CSDB object against an XML schema and generate a report of the
+ * results.
+ *
+ * @param ctx Context, or NULL for the default settings
+ * @param object_xml Input buffer containing the XML of the CSDB object
+ * @param object_size Size of the object XML buffer
+ * @param schema The schema to validate against, or NULL to use the object's xsi:noNamespaceSchemaLocation
+ * @param options A combination of s1kdValidateOption
+ * @param report_xml Output buffer for the XML of the report. The caller must free the buffer. If report_xml is NULL, the report is discarded.
+ * @param report_size Size of the report XML buffer
+ * @return 0 if the object is valid, non-zero otherwise
+ */
+int s1kdCtxValidate(const s1kdContext *ctx, const char *object_xml, int object_size, s1kdSchemaPtr schema, int options, char **report_xml, int *report_size);
+
+#endif
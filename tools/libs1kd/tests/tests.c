@@ -1,9 +1,19 @@
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
 #include <libxml/tree.h>
+#include <s1kd/context.h>
 #include <s1kd/brexcheck.h>
 #include <s1kd/instance.h>
 #include <s1kd/metadata.h>
+#include <s1kd/validate.h>
+#include "s1kd_dirwalk.h"
 
 void test_brexcheck(void)
 {
@@ -47,6 +57,58 @@ void test_brexcheck_2(void)
 	free(report);
 }
 
+void test_brexcheck_compiled(void)
+{
+	xmlDocPtr doc = xmlReadFile("test.xml", NULL, 0);
+	xmlDocPtr brex = xmlReadFile("brex.xml", NULL, 0);
+	xmlDocPtr report;
+	s1kdBREXPtr compiled;
+	xmlChar *a, *b;
+	char code[256];
+	int err1, err2, n;
+	int opts;
+
+	opts = S1KD_BREXCHECK_VALUES | S1KD_BREXCHECK_SNS | S1KD_BREXCHECK_NOTATIONS;
+
+	err1 = s1kdDocCheckBREX(doc, brex, opts, &report);
+	xmlDocDumpMemory(report, &a, &n);
+	xmlFreeDoc(report);
+
+	compiled = s1kdNewBREX();
+	s1kdAddBREX(compiled, brex);
+
+	err2 = s1kdDocCheckCompiledBREX(doc, compiled, opts, &report);
+	xmlDocDumpMemory(report, &b, &n);
+	xmlFreeDoc(report);
+
+	printf("Compiled BREX: %s\n", err1 == err2 && xmlStrcmp(a, b) == 0 ? "SAME" : "DIFFERENT");
+
+	xmlFree(a);
+	xmlFree(b);
+	s1kdFreeBREX(compiled);
+
+	compiled = s1kdNewBREX();
+	err1 = s1kdAddLayeredBREX(compiled, brex, NULL);
+	err2 = s1kdDocCheckCompiledBREX(doc, compiled, opts, &report);
+	n = xmlChildElementCount(xmlLastElementChild(xmlDocGetRootElement(report)));
+	printf("Layered BREX: %s, %s, %d results\n", err1 ? "NOT FOUND" : "FOUND", err2 ? "FAIL" : "PASS", n);
+	xmlFreeDoc(report);
+	s1kdFreeBREX(compiled);
+
+	if (s1kdGetBREXRef(doc, code, 256) == 0) {
+		printf("BREX reference: %s\n", code);
+	}
+
+	compiled = s1kdNewBREX();
+	err1 = s1kdAddDefaultBREX(compiled, code);
+	err2 = s1kdDocCheckCompiledBREX(doc, compiled, opts, NULL);
+	printf("Default BREX: %s, %s\n", err1 ? "NOT FOUND" : "FOUND", err2 ? "FAIL" : "PASS");
+	s1kdFreeBREX(compiled);
+
+	xmlFreeDoc(brex);
+	xmlFreeDoc(doc);
+}
+
 void test_metadata(void)
 {
 	xmlDocPtr doc = xmlReadFile("test.xml", NULL, 0);
@@ -143,14 +205,301 @@ void test_instance_2(void)
 	s1kdFreeApplicability(app);
 }
 
+void test_context(void)
+{
+	s1kdContextPtr ctx = s1kdNewContext();
+	xmlDocPtr doc = xmlReadFile("test.xml", NULL, 0);
+	xmlDocPtr out;
+	s1kdApplicability app = s1kdNewApplicability();
+	xmlChar *date;
+
+	s1kdAssign(app, BAD_CAST "version", BAD_CAST "prodattr", BAD_CAST "A");
+
+	s1kdContextSetFilterOptions(ctx, S1KD_FILTER_TAG_NON_APPLIC);
+	out = s1kdCtxDocFilter(ctx, doc, app, S1KD_FILTER_DEFAULT);
+	xmlSaveFile("-", out);
+	xmlFreeDoc(out);
+
+	s1kdContextSetDateFormat(ctx, "%d/%m/%Y");
+	date = s1kdCtxDocGetMetadata(ctx, doc, BAD_CAST "issueDate");
+	printf("DATE: %s\n", (char *) date);
+	xmlFree(date);
+
+	s1kdFreeApplicability(app);
+	xmlFreeDoc(doc);
+	s1kdFreeContext(ctx);
+}
+
+void test_validate(void)
+{
+	xmlDocPtr doc = xmlReadFile("test.xml", NULL, 0);
+	xmlDocPtr report;
+	s1kdSchemaPtr schema = s1kdNewSchema("test.xsd");
+	char *xml;
+	int size;
+	int err;
+
+	err = s1kdDocValidate(doc, schema, 0, &report);
+	printf("Validate: %s\n", err ? "FAIL" : "PASS");
+	xmlSaveFile("-", report);
+	xmlFreeDoc(report);
+
+	err = s1kdValidate("<dmodule><content/></dmodule>", 29, schema, 0, &xml, &size);
+	printf("Validate: %s\n", err ? "FAIL" : "PASS");
+	puts(xml);
+	free(xml);
+
+	s1kdFreeSchema(schema);
+	xmlFreeDoc(doc);
+}
+
+#define NTHREADS 4
+
+struct thread_data {
+	xmlDocPtr doc;
+	xmlDocPtr brex;
+	s1kdSchemaPtr schema;
+	s1kdSchemaPtr id_schema;
+	s1kdBREXPtr compiled;
+	s1kdApplicability app;
+	char *result;
+	int size;
+	int err;
+};
+
+void *filter_and_check(void *arg)
+{
+	struct thread_data *data = arg;
+	s1kdContextPtr ctx = s1kdNewContext();
+	xmlDocPtr out;
+	int i;
+
+	for (i = 0; i < 50; ++i) {
+		free(data->result);
+
+		out = s1kdCtxDocFilter(ctx, data->doc, data->app, S1KD_FILTER_SIMPLIFY);
+		xmlDocDumpMemory(out, (xmlChar **) &data->result, &data->size);
+		data->err = s1kdCtxDocCheckBREX(ctx, out, data->brex, S1KD_BREXCHECK_VALUES, NULL);
+		data->err += s1kdCtxDocCheckCompiledBREX(ctx, data->doc, data->compiled, S1KD_BREXCHECK_VALUES | S1KD_BREXCHECK_SNS, NULL);
+		data->err += s1kdDocValidate(data->doc, data->schema, S1KD_VALIDATE_REMOVE_DELETED, NULL);
+		/* Validating against a schema with xs:ID attributes registers
+		 * them in the document it validates. */
+		data->err += s1kdDocValidate(data->doc, data->id_schema, 0, NULL);
+		xmlFreeDoc(out);
+	}
+
+	s1kdFreeContext(ctx);
+
+	return NULL;
+}
+
+void test_threads(void)
+{
+	s1kdContextPtr ctx = s1kdNewContext();
+	xmlDocPtr doc = xmlReadFile("test.xml", NULL, 0);
+	xmlDocPtr brex = xmlReadFile("brex.xml", NULL, 0);
+	s1kdApplicability app = s1kdNewApplicability();
+	pthread_t threads[NTHREADS];
+	struct thread_data data[NTHREADS];
+	struct thread_data expected = {0};
+	bool pass = true;
+	int i;
+
+	s1kdAssign(app, BAD_CAST "version", BAD_CAST "prodattr", BAD_CAST "A");
+
+	expected.doc = doc;
+	expected.brex = brex;
+	expected.schema = s1kdNewSchema("test.xsd");
+	expected.id_schema = s1kdNewSchema("id.xsd");
+	expected.compiled = s1kdNewBREX();
+	s1kdAddLayeredBREX(expected.compiled, brex, NULL);
+	expected.app = app;
+	filter_and_check(&expected);
+
+	for (i = 0; i < NTHREADS; ++i) {
+		data[i] = expected;
+		data[i].result = NULL;
+		pthread_create(&threads[i], NULL, filter_and_check, &data[i]);
+	}
+
+	for (i = 0; i < NTHREADS; ++i) {
+		pthread_join(threads[i], NULL);
+
+		if (data[i].size != expected.size || memcmp(data[i].result, expected.result, expected.size) != 0 || data[i].err != expected.err) {
+			pass = false;
+		}
+
+		free(data[i].result);
+	}
+
+	/* The shared document is left as it was read. */
+	if (doc->ids) {
+		pass = false;
+	}
+
+	printf("Threads: %s\n", pass ? "PASS" : "FAIL");
+
+	free(expected.result);
+	s1kdFreeSchema(expected.schema);
+	s1kdFreeSchema(expected.id_schema);
+	s1kdFreeBREX(expected.compiled);
+	s1kdFreeApplicability(app);
+	xmlFreeDoc(brex);
+	xmlFreeDoc(doc);
+	s1kdFreeContext(ctx);
+}
+
+/* Walk a directory with a single thread, as the walker is expected to. */
+void walk_serial(const char *path, char (*files)[PATH_MAX], int *nfiles, char (*errors)[PATH_MAX], int *nerrors)
+{
+	DIR *dir;
+	struct dirent *cur;
+	char cpath[PATH_MAX];
+	struct stat st;
+
+	if (!(dir = opendir(path))) {
+		strcpy(errors[(*nerrors)++], path);
+		return;
+	}
+
+	while ((cur = readdir(dir))) {
+		if (strcmp(cur->d_name, ".") == 0 || strcmp(cur->d_name, "..") == 0) {
+			continue;
+		}
+
+		snprintf(cpath, PATH_MAX, "%s/%s", path, cur->d_name);
+
+		if (stat(cpath, &st) == 0 && S_ISDIR(st.st_mode)) {
+			walk_serial(cpath, files, nfiles, errors, nerrors);
+		} else {
+			strcpy(files[(*nfiles)++], cpath);
+		}
+	}
+
+	closedir(dir);
+}
+
+#define WALK_DIRS 20
+#define WALK_FILES 100
+
+void test_dir_walk(void)
+{
+	char top[] = "/tmp/s1kd-walk-XXXXXX";
+	char path[PATH_MAX];
+	char (*files)[PATH_MAX], (*errors)[PATH_MAX];
+	int nfiles = 0, nerrors = 0;
+	bool pass = true;
+	int i, j, n;
+
+	/* A tree of directories, some nested, with more files in each than
+	 * are passed on at once, and one directory that cannot be read. */
+	mkdtemp(top);
+
+	for (i = 0; i < WALK_DIRS; ++i) {
+		if (i % 4 == 0) {
+			snprintf(path, PATH_MAX, "%s/d%d", top, i);
+		} else {
+			snprintf(path, PATH_MAX, "%s/d%d/d%d", top, i - i % 4, i);
+		}
+		mkdir(path, 0755);
+
+		for (j = 0; j < WALK_FILES; ++j) {
+			char fpath[PATH_MAX];
+			FILE *f;
+
+			snprintf(fpath, PATH_MAX, "%s/f%d", path, j);
+			f = fopen(fpath, "w");
+			fclose(f);
+		}
+	}
+
+	snprintf(path, PATH_MAX, "%s/d4/locked", top);
+	mkdir(path, 0);
+
+	n = WALK_DIRS * WALK_FILES;
+	files = malloc(n * sizeof(char[PATH_MAX]));
+	errors = malloc(sizeof(char[PATH_MAX]));
+
+	/* An unreadable directory can still be read by root, so what is
+	 * expected is determined the same way. */
+	walk_serial(top, files, &nfiles, errors, &nerrors);
+
+	if (nfiles != n) {
+		pass = false;
+	}
+
+	/* Files must come out in the same order each time, however the
+	 * directories are divided among the threads. */
+	for (i = 0; i < 20 && pass; ++i) {
+		struct dir_walk *walk = dir_walk_new(true, NULL, NULL);
+
+		dir_walk_add(walk, top);
+
+		for (j = 0; dir_walk_next(walk, path); ++j) {
+			if (j >= nfiles || strcmp(path, files[j]) != 0) {
+				pass = false;
+			}
+		}
+
+		if (j != nfiles) {
+			pass = false;
+		}
+
+		for (j = 0; dir_walk_next_error(walk, path); ++j) {
+			if (j >= nerrors || strcmp(path, errors[j]) != 0) {
+				pass = false;
+			}
+		}
+
+		if (j != nerrors) {
+			pass = false;
+		}
+
+		dir_walk_free(walk);
+	}
+
+	/* A walk freed before it is done must stop its threads. */
+	for (i = 0; i < 20; ++i) {
+		struct dir_walk *walk = dir_walk_new(true, NULL, NULL);
+		dir_walk_add(walk, top);
+		dir_walk_next(walk, path);
+		dir_walk_free(walk);
+	}
+
+	printf("Directory walk: %s\n", pass ? "PASS" : "FAIL");
+
+	for (i = 0; i < nfiles; ++i) {
+		unlink(files[i]);
+	}
+	snprintf(path, PATH_MAX, "%s/d4/locked", top);
+	rmdir(path);
+	for (i = WALK_DIRS - 1; i >= 0; --i) {
+		if (i % 4 == 0) {
+			snprintf(path, PATH_MAX, "%s/d%d", top, i);
+		} else {
+			snprintf(path, PATH_MAX, "%s/d%d/d%d", top, i - i % 4, i);
+		}
+		rmdir(path);
+	}
+	rmdir(top);
+
+	free(files);
+	free(errors);
+}
+
 int main()
 {
 	test_brexcheck();
 	test_brexcheck_2();
+	test_brexcheck_compiled();
 	test_metadata();
 	test_metadata_2();
 	test_instance();
 	test_instance_2();
+	test_context();
+	test_validate();
+	test_threads();
+	test_dir_walk();
 
 	xmlCleanupParser();
 
@@ -0,0 +1,921 @@
+unsigned char stylesheets_acronyms_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f,
+  0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x2f, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61,
+  0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2f, 0x2f, 0x61, 0x63,
+  0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x73, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x61, 0x63, 0x72, 0x6f,
+  0x6e, 0x79, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x7c, 0x40, 0x61, 0x63, 0x72,
+  0x6f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f,
+  0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x7c, 0x61, 0x63, 0x72, 0x6f,
+  0x74, 0x65, 0x72, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x7c, 0x61, 0x63, 0x72, 0x6f, 0x64, 0x65, 0x66, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f,
+  0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40, 0x61,
+  0x63, 0x72, 0x6f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x61,
+  0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72,
+  0x6f, 0x74, 0x65, 0x72, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f,
+  0x64, 0x65, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61,
+  0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d,
+  0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e,
+  0x0a
+};
+unsigned int stylesheets_acronyms_xsl_len = 1057;
+unsigned char stylesheets_unique_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40,
+  0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x73, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x73, 0x6f, 0x72, 0x74, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73,
+  0x6f, 0x72, 0x74, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x40, 0x2a, 0x7c, 0x2a, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79,
+  0x6d, 0x5b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x20, 0x3d, 0x20, 0x70, 0x72, 0x65,
+  0x63, 0x65, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x3a, 0x61, 0x63, 0x72, 0x6f,
+  0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x20, 0x61, 0x6e, 0x64, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44,
+  0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20,
+  0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x3a, 0x61,
+  0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x28, 0x6e, 0x6f, 0x74, 0x28, 0x40, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x29, 0x20, 0x6f, 0x72, 0x20, 0x40,
+  0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x3d,
+  0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x3a, 0x61,
+  0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x2f, 0x40, 0x61, 0x63, 0x72, 0x6f,
+  0x6e, 0x79, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x5d,
+  0x22, 0x2f, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int stylesheets_unique_xsl_len = 899;
+unsigned char stylesheets_list_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61,
+  0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79,
+  0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x73,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72,
+  0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69,
+  0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x7c, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x73, 0x74,
+  0x49, 0x74, 0x65, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x73, 0x74, 0x49,
+  0x74, 0x65, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x73, 0x74,
+  0x49, 0x74, 0x65, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44,
+  0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65,
+  0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x61, 0x72, 0x61,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x70, 0x61, 0x72, 0x61, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65,
+  0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74,
+  0x3e, 0x0a
+};
+unsigned int stylesheets_list_xsl_len = 746;
+unsigned char stylesheets_table_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x73, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x62, 0x6f,
+  0x64, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x74, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63,
+  0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x72, 0x6f, 0x77, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d,
+  0x54, 0x65, 0x72, 0x6d, 0x7c, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d,
+  0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x72, 0x6f, 0x77, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x7c, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x65, 0x6e, 0x74, 0x72,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x61,
+  0x72, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x70, 0x61, 0x72, 0x61, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x65, 0x6e, 0x74, 0x72, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65,
+  0x74, 0x3e, 0x0a
+};
+unsigned int stylesheets_table_xsl_len = 639;
+unsigned char stylesheets_types_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x79, 0x70,
+  0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64,
+  0x65, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e,
+  0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2a, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61,
+  0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73,
+  0x74, 0x3d, 0x22, 0x6e, 0x6f, 0x74, 0x28, 0x24, 0x74, 0x79, 0x70, 0x65,
+  0x73, 0x29, 0x20, 0x6f, 0x72, 0x20, 0x28, 0x40, 0x61, 0x63, 0x72, 0x6f,
+  0x6e, 0x79, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x28, 0x24, 0x74, 0x79,
+  0x70, 0x65, 0x73, 0x2c, 0x20, 0x40, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79,
+  0x6d, 0x54, 0x79, 0x70, 0x65, 0x29, 0x29, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x2a, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int stylesheets_types_xsl_len = 658;
+unsigned char stylesheets_sort_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f,
+  0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x73, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f,
+  0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65,
+  0x6e, 0x67, 0x74, 0x68, 0x28, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d,
+  0x54, 0x65, 0x72, 0x6d, 0x29, 0x22, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74,
+  0x3e, 0x0a
+};
+unsigned int stylesheets_sort_xsl_len = 506;
+unsigned char stylesheets_term_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f,
+  0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72,
+  0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x74, 0x65, 0x72, 0x6d, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72,
+  0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x65, 0x66, 0x6e, 0x22, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x72,
+  0x65, 0x63, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x3a, 0x61,
+  0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x5b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72,
+  0x6d, 0x20, 0x3d, 0x20, 0x24, 0x74, 0x65, 0x72, 0x6d, 0x20, 0x61, 0x6e,
+  0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x72, 0x6f,
+  0x6e, 0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x3d, 0x20, 0x24, 0x64, 0x65, 0x66, 0x6e, 0x20, 0x61, 0x6e,
+  0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x40, 0x61, 0x63,
+  0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20,
+  0x24, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x74,
+  0x28, 0x40, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x79, 0x70,
+  0x65, 0x20, 0x6f, 0x72, 0x20, 0x24, 0x74, 0x79, 0x70, 0x65, 0x29, 0x29,
+  0x5d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65,
+  0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x70, 0x72, 0x65,
+  0x63, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69, 0x6e, 0x74,
+  0x65, 0x72, 0x6e, 0x61, 0x6c, 0x52, 0x65, 0x66, 0x49, 0x64, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65,
+  0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x70, 0x72, 0x65,
+  0x63, 0x5b, 0x31, 0x5d, 0x2f, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d,
+  0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x40,
+  0x69, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x70, 0x72, 0x65, 0x63,
+  0x5b, 0x31, 0x5d, 0x2f, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44,
+  0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x40, 0x69,
+  0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x2d,
+  0x69, 0x64, 0x28, 0x24, 0x70, 0x72, 0x65, 0x63, 0x5b, 0x31, 0x5d, 0x29,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x2f, 0x40, 0x2a, 0x7c, 0x61, 0x63,
+  0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x2f, 0x6e, 0x6f,
+  0x64, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79,
+  0x6d, 0x54, 0x65, 0x72, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x63, 0x72, 0x6f,
+  0x6e, 0x79, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x2a, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d,
+  0x54, 0x65, 0x72, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x49, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d,
+  0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x68,
+  0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x49, 0x44, 0x20, 0x69, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x2e, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d,
+  0x73, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x20, 0x6f, 0x6e, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x40, 0x6b,
+  0x65, 0x65, 0x70, 0x49, 0x64, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x74, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6f, 0x76, 0x65, 0x72,
+  0x72, 0x69, 0x64, 0x65, 0x20, 0x69, 0x74, 0x2e, 0x20, 0x2d, 0x2d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x2f, 0x40, 0x69, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69, 0x64, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d,
+  0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x40,
+  0x69, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x65, 0x65, 0x70, 0x49, 0x64, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68,
+  0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x49,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79,
+  0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x2e, 0x61, 0x63, 0x72, 0x6f,
+  0x6e, 0x79, 0x6d, 0x73, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x68, 0x61,
+  0x73, 0x20, 0x6e, 0x6f, 0x20, 0x49, 0x44, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x67, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x2c, 0x20, 0x77, 0x68,
+  0x69, 0x63, 0x68, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20,
+  0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x61, 0x6e, 0x20, 0x49, 0x44, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x63, 0x72, 0x2d, 0x78, 0x78,
+  0x78, 0x78, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65,
+  0x78, 0x74, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65,
+  0x74, 0x2e, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x69, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x67,
+  0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x2d, 0x69, 0x64, 0x28, 0x29,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44, 0x65,
+  0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6e, 0x6f, 0x64,
+  0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x69, 0x67, 0x6e, 0x6f,
+  0x72, 0x65, 0x64, 0x41, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70,
+  0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68,
+  0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int stylesheets_term_xsl_len = 2621;
+unsigned char stylesheets_id_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f,
+  0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44, 0x65, 0x66,
+  0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x6d, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x69, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x40,
+  0x6b, 0x65, 0x65, 0x70, 0x49, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x69, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68,
+  0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x61, 0x63, 0x72, 0x2d,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+  0x65, 0x22, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x3d, 0x22, 0x61, 0x6e,
+  0x79, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x30,
+  0x30, 0x30, 0x31, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79,
+  0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2f,
+  0x40, 0x69, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69, 0x64, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2e,
+  0x2e, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x69, 0x64, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79,
+  0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2f,
+  0x40, 0x6b, 0x65, 0x65, 0x70, 0x49, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61,
+  0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x2f, 0x40,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x52, 0x65, 0x66, 0x49,
+  0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x72, 0x65, 0x66, 0x22, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x65,
+  0x66, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2f,
+  0x2f, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44, 0x65, 0x66, 0x69,
+  0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5b, 0x40, 0x69, 0x64, 0x20, 0x3d,
+  0x20, 0x24, 0x72, 0x65, 0x66, 0x5d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69,
+  0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x52, 0x65, 0x66, 0x49, 0x64,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x64,
+  0x65, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x64, 0x65, 0x66,
+  0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x69, 0x64, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x72, 0x65, 0x66, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int stylesheets_id_xsl_len = 1329;
+unsigned char stylesheets_delete_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40,
+  0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x7c, 0x61, 0x63, 0x72, 0x6f, 0x74,
+  0x65, 0x72, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e,
+  0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d,
+  0x7c, 0x61, 0x63, 0x72, 0x6f, 0x74, 0x65, 0x72, 0x6d, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x63, 0x68, 0x6f,
+  0x6f, 0x73, 0x65, 0x41, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70,
+  0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63,
+  0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x5b, 0x31, 0x5d, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e,
+  0x0a
+};
+unsigned int stylesheets_delete_xsl_len = 577;
+unsigned char stylesheets_30_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f,
+  0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x40, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x79,
+  0x70, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x74, 0x79,
+  0x70, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e,
+  0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x40, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x52, 0x65,
+  0x66, 0x49, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x72, 0x65, 0x66, 0x69,
+  0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x63, 0x72, 0x6f, 0x74,
+  0x65, 0x72, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28,
+  0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x61,
+  0x63, 0x72, 0x6f, 0x74, 0x65, 0x72, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x44, 0x65,
+  0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x61, 0x63, 0x72, 0x6f, 0x64, 0x65, 0x66, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x61, 0x63, 0x72, 0x6f, 0x64,
+  0x65, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68,
+  0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int stylesheets_30_xsl_len = 833;
+unsigned char stylesheets_prefmt_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40,
+  0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x7c, 0x61, 0x63, 0x72, 0x6f, 0x64, 0x65, 0x66, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x20, 0x28, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d,
+  0x7c, 0x61, 0x63, 0x72, 0x6f, 0x74, 0x65, 0x72, 0x6d, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x29, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x63,
+  0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x7c, 0x61, 0x63,
+  0x72, 0x6f, 0x74, 0x65, 0x72, 0x6d, 0x7c, 0x61, 0x63, 0x72, 0x6f, 0x6e,
+  0x79, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x7c, 0x61, 0x63, 0x72, 0x6f, 0x64, 0x65, 0x66, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x63, 0x68, 0x6f, 0x6f,
+  0x73, 0x65, 0x41, 0x63, 0x72, 0x6f, 0x6e, 0x79, 0x6d, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x61, 0x63, 0x72,
+  0x6f, 0x6e, 0x79, 0x6d, 0x5b, 0x31, 0x5d, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int stylesheets_prefmt_xsl_len = 720;
@@ -11,7 +11,7 @@
 
 /* Program name and version information. */
 #define PROG_NAME "s1kd-appcheck"
-#define VERSION "5.7.1"
+#define VERSION "5.7.3"
 
 /* Message prefixes. */
 #define ERR_PREFIX PROG_NAME ": ERROR: "
@@ -745,8 +745,8 @@ static int check_val_against_prop(xmlNodePtr assert, const xmlChar *id, const xm
 /* Check whether a property is defined in the ACT/CCT. */
 static int check_prop_against_ct(xmlNodePtr assert, xmlDocPtr act, xmlDocPtr cct, const char *path, xmlNodePtr report)
 {
-	xmlChar *id, *type, *vals, *xpath = NULL;
-	int n, err = 0;
+	xmlChar *id, *type, *vals;
+	int err = 0;
 	xmlNodePtr prop;
 
 	if (!(id = first_xpath_value(NULL, assert, BAD_CAST "@applicPropertyIdent|@actidref"))) {
@@ -759,40 +759,14 @@ static int check_prop_against_ct(xmlNodePtr assert, xmlDocPtr act, xmlDocPtr cct
 		return 0;
 	}
 
-	if (xmlStrcmp(type, BAD_CAST "condition") == 0 && cct) {
-		/* For conditions, first get the condition itself. */
-		n = xmlStrlen(id) + 29;
-		xpath = malloc(n * sizeof(xmlChar));
-		xmlStrPrintf(xpath, n, "(//cond|//condition)[@id='%s']", id);
-		prop = first_xpath_node(cct, NULL, xpath);
-
-		/* Then get the condition type. */
-		if (prop) {
-			xmlChar *condtype;
-
-			condtype = first_xpath_value(cct, prop, BAD_CAST "@condTypeRefId|@condtyperef");
-
-			if (condtype) {
-				xmlFree(xpath);
-				n = xmlStrlen(condtype) + 37;
-				xpath = malloc(n * sizeof(xmlChar));
-				xmlStrPrintf(xpath, n, "(//condType|//conditiontype)[@id='%s']", condtype);
-				prop = first_xpath_node(cct, NULL, xpath);
-			}
-
-			xmlFree(condtype);
-		}
-	} else if (xmlStrcmp(type, BAD_CAST "prodattr") == 0 && act) {
-		n = xmlStrlen(id) + 40;
-		xpath = malloc(n * sizeof(xmlChar));
-		xmlStrPrintf(xpath, n, "(//productAttribute|//prodattr)[@id='%s']", id);
-		prop = first_xpath_node(act, NULL, xpath);
+	if (xmlStrcmp(type, BAD_CAST "condition") == 0) {
+		prop = xref_table_property(cct, type, id);
+	} else if (xmlStrcmp(type, BAD_CAST "prodattr") == 0) {
+		prop = xref_table_property(act, type, id);
 	} else {
 		prop = NULL;
 	}
 
-	xmlFree(xpath);
-
 	if (prop) {
 		xmlChar *v = NULL;
 		char *end = NULL;
@@ -1130,13 +1104,13 @@ static int custom_check(xmlDocPtr doc, const char *path, struct appcheckopts *op
 		char cctfname[PATH_MAX];
 
 		if (find_act_fname(actfname, opts->useract, doc)) {
-			if ((act = read_xml_doc(actfname))) {
+			if ((act = read_xref_table(actfname))) {
 				add_object_node(report, "act", actfname);
 			}
 		}
 
 		if (find_cct_fname(cctfname, opts->usercct, act)) {
-			if ((cct = read_xml_doc(cctfname))) {
+			if ((cct = read_xref_table(cctfname))) {
 				add_object_node(report, "cct", cctfname);
 
 				if (opts->add_deps) {
@@ -1154,9 +1128,6 @@ static int custom_check(xmlDocPtr doc, const char *path, struct appcheckopts *op
 		err += check_nested_applics(doc, path, report);
 	}
 
-	xmlFreeDoc(cct);
-	xmlFreeDoc(act);
-
 	return err;
 }
 
@@ -1176,7 +1147,7 @@ static int check_prods(xmlDocPtr doc, const char *path, xmlDocPtr all, xmlDocPtr
 			return 0;
 		}
 
-		pct = read_xml_doc(pctfname);
+		pct = read_xref_table(pctfname);
 
 		add_object_node(report, "pct", pctfname);
 	}
@@ -1231,10 +1202,6 @@ static int check_prods(xmlDocPtr doc, const char *path, xmlDocPtr all, xmlDocPtr
 	xmlXPathFreeObject(obj);
 	xmlXPathFreeContext(ctx);
 
-	if (!all) {
-		xmlFreeDoc(pct);
-	}
-
 	return err;
 }
 
@@ -1323,13 +1290,13 @@ static int check_object_props(xmlDocPtr doc, const char *path, struct appcheckop
 		xmlDocPtr cct = NULL;
 
 		if (find_act_fname(actfname, opts->useract, doc)) {
-			if ((act = read_xml_doc(actfname))) {
+			if ((act = read_xref_table(actfname))) {
 				add_object_node(report, "act", actfname);
 			}
 		}
 
 		if (find_cct_fname(cctfname, opts->usercct, act)) {
-			if ((cct = read_xml_doc(cctfname))) {
+			if ((cct = read_xref_table(cctfname))) {
 				add_object_node(report, "cct", cctfname);
 
 				if (opts->add_deps) {
@@ -1341,9 +1308,6 @@ static int check_object_props(xmlDocPtr doc, const char *path, struct appcheckop
 		if (opts->check_props) {
 			err += check_props_against_cts(doc, path, act, cct, report);
 		}
-
-		xmlFreeDoc(cct);
-		xmlFreeDoc(act);
 	}
 
 	if (opts->check_nested) {
@@ -1424,7 +1388,7 @@ static int check_all_props(xmlDocPtr doc, const char *path, xmlDocPtr act, struc
 	xmlDocSetRootElement(psdoc, propsets);
 
 	if (find_cct_fname(cctfname, opts->usercct, act)) {
-		if ((cct = read_xml_doc(cctfname))) {
+		if ((cct = read_xref_table(cctfname))) {
 			add_object_node(report, "cct", cctfname);
 
 			if (opts->add_deps) {
@@ -1505,7 +1469,6 @@ static int check_all_props(xmlDocPtr doc, const char *path, xmlDocPtr act, struc
 
 		xmlXPathFreeObject(obj);
 		xmlXPathFreeContext(ctx);
-		xmlFreeDoc(cct);
 	} else if (has_conds(doc)) {
 		fprintf(stderr, E_NO_CCT, path);
 		xmlNewChild(report, NULL, BAD_CAST "cctNotFound", NULL);
@@ -1533,7 +1496,7 @@ static int check_pct_instances(xmlDocPtr doc, const char *path, xmlDocPtr act, s
 		/* The ACT may or may not have already been read. */
 		if (act) {
 			if (find_cct_fname(cctfname, opts->usercct, act)) {
-				if ((cct = read_xml_doc(cctfname))) {
+				if ((cct = read_xref_table(cctfname))) {
 					add_object_node(report, "cct", cctfname);
 
 					if (opts->add_deps) {
@@ -1545,19 +1508,17 @@ static int check_pct_instances(xmlDocPtr doc, const char *path, xmlDocPtr act, s
 			if (opts->check_props) {
 				err += check_props_against_cts(doc, path, act, cct, report);
 			}
-
-			xmlFreeDoc(cct);
 		} else {
 			char actfname[PATH_MAX];
 
 			if (find_act_fname(actfname, opts->useract, doc)) {
-				if ((act = read_xml_doc(actfname))) {
+				if ((act = read_xref_table(actfname))) {
 					add_object_node(report, "act", cctfname);
 				}
 			}
 
 			if (find_cct_fname(cctfname, opts->usercct, act)) {
-				if ((cct = read_xml_doc(cctfname))) {
+				if ((cct = read_xref_table(cctfname))) {
 					add_object_node(report, "cct", cctfname);
 
 					if (opts->add_deps) {
@@ -1570,8 +1531,6 @@ static int check_pct_instances(xmlDocPtr doc, const char *path, xmlDocPtr act, s
 				err += check_props_against_cts(doc, path, act, cct, report);
 			}
 
-			xmlFreeDoc(cct);
-			xmlFreeDoc(act);
 			act = NULL;
 		}
 	}
@@ -1661,15 +1620,13 @@ static int check_applic_file(const char *path, struct appcheckopts *opts, xmlNod
 
 		add_object_node(report_node, "act", actfname);
 
-		act = read_xml_doc(actfname);
+		act = read_xref_table(actfname);
 
 		if (opts->mode == ALL) {
 			err += check_all_props(doc, path, act, opts, report_node);
 		} else {
 			err += check_pct_instances(doc, path, act, opts, report_node);
 		}
-
-		xmlFreeDoc(act);
 	} else if (has_applic(doc)) {
 		fprintf(stderr, E_NO_ACT, path);
 		xmlNewChild(report_node, NULL, BAD_CAST "actNotFound", NULL);
@@ -1982,6 +1939,8 @@ cleanup:
 	xmlFreeNode(opts.validators);
 	free(search_dir);
 	free(objects);
+	free_pattern_cache();
+	free_xref_tables();
 
 	xsltCleanupGlobals();
 	xmlCleanupParser();
@@ -0,0 +1,206 @@
+unsigned char combos_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65,
+  0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x73, 0x6c, 0x3d,
+  0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e,
+  0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f,
+  0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72,
+  0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22,
+  0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x6d, 0x65, 0x74, 0x68,
+  0x6f, 0x64, 0x3d, 0x22, 0x78, 0x6d, 0x6c, 0x22, 0x20, 0x69, 0x6e, 0x64,
+  0x65, 0x6e, 0x74, 0x3d, 0x22, 0x79, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40,
+  0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x70, 0x73, 0x65, 0x74, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x73, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x73, 0x5b, 0x31, 0x5d, 0x2f, 0x61,
+  0x73, 0x73, 0x69, 0x67, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x73, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74,
+  0x73, 0x5b, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x2d,
+  0x73, 0x69, 0x62, 0x6c, 0x69, 0x6e, 0x67, 0x3a, 0x3a, 0x2a, 0x5d, 0x2f,
+  0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f,
+  0x75, 0x73, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x2f, 0x2e, 0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x2e, 0x2e, 0x2f, 0x66, 0x6f, 0x6c, 0x6c, 0x6f,
+  0x77, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x69, 0x62, 0x6c, 0x69, 0x6e, 0x67,
+  0x3a, 0x3a, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x73, 0x5b, 0x31, 0x5d,
+  0x2f, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74,
+  0x68, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x22, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x70, 0x72, 0x65,
+  0x76, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x7c, 0x20, 0x2e, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x73, 0x73,
+  0x69, 0x67, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x6f, 0x64,
+  0x75, 0x63, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x70, 0x72, 0x65,
+  0x76, 0x69, 0x6f, 0x75, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x70,
+  0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int combos_xsl_len = 908;
+unsigned char stats_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c,
+  0x6e, 0x73, 0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70,
+  0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72,
+  0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54,
+  0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x0a, 0x20, 0x20,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30,
+  0x22, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64,
+  0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61,
+  0x70, 0x70, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x54, 0x79, 0x70, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x3a, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x53,
+  0x74, 0x72, 0x69, 0x63, 0x74, 0x3a, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x73, 0x74,
+  0x72, 0x69, 0x63, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x26, 0x23,
+  0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x6e,
+  0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
+  0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x3a, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x41,
+  0x70, 0x70, 0x6c, 0x69, 0x63, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x26,
+  0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x22, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x29, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x54, 0x6f, 0x74, 0x61, 0x6c, 0x20, 0x6f, 0x62, 0x6a, 0x65,
+  0x63, 0x74, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x3a,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x24, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x3d, 0x22, 0x24, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x20, 0x26, 0x67, 0x74,
+  0x3b, 0x20, 0x30, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x61, 0x69, 0x6c,
+  0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5b, 0x40,
+  0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x27, 0x6e, 0x6f, 0x27,
+  0x5d, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73,
+  0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x28, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5b, 0x40,
+  0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x27, 0x79, 0x65, 0x73,
+  0x27, 0x5d, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x54,
+  0x6f, 0x74, 0x61, 0x6c, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73,
+  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x24, 0x70, 0x61, 0x73, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x54, 0x6f, 0x74, 0x61, 0x6c, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x24, 0x66, 0x61, 0x69, 0x6c, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x65, 0x20,
+  0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x3a, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x24, 0x70, 0x61, 0x73, 0x73, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x24, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x20, 0x2a,
+  0x20, 0x31, 0x30, 0x30, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x25, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x50,
+  0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x65, 0x20, 0x66, 0x61,
+  0x69, 0x6c, 0x65, 0x64, 0x3a, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x63, 0x65,
+  0x69, 0x6c, 0x69, 0x6e, 0x67, 0x28, 0x24, 0x66, 0x61, 0x69, 0x6c, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x24, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x20, 0x2a,
+  0x20, 0x31, 0x30, 0x30, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x25, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int stats_xsl_len = 1486;
@@ -0,0 +1,1629 @@
+unsigned char elements_list[] = {
+  0x2e, 0x2f, 0x2f, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x79,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x50,
+  0x6f, 0x69, 0x6e, 0x74, 0x52, 0x65, 0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x61, 0x63, 0x63, 0x70, 0x6e, 0x6c, 0x61, 0x6c, 0x74, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x61, 0x66, 0x69, 0x2d, 0x70, 0x72, 0x6f, 0x63, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x4c,
+  0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x50, 0x61, 0x72, 0x61, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f,
+  0x6e, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x4c, 0x69, 0x73, 0x74, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f,
+  0x6e, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x4c, 0x69, 0x73, 0x74, 0x49,
+  0x74, 0x65, 0x6d, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x61, 0x74, 0x74, 0x65,
+  0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x53, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+  0x69, 0x61, 0x6c, 0x4c, 0x69, 0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x53, 0x65, 0x71,
+  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x4c, 0x69, 0x73, 0x74, 0x49,
+  0x74, 0x65, 0x6d, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x62, 0x66, 0x65, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x63, 0x61, 0x70, 0x62, 0x6f, 0x64, 0x79, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x63, 0x61, 0x70, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x61, 0x70, 0x67, 0x72, 0x70, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x63, 0x61, 0x70, 0x72, 0x6f, 0x77, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x63, 0x61, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x63, 0x61, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x42, 0x6f, 0x64,
+  0x79, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x61, 0x70, 0x74, 0x69, 0x6f,
+  0x6e, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63,
+  0x61, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x61, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x52,
+  0x6f, 0x77, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x61, 0x73, 0x65, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x61, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x62, 0x61, 0x6c, 0x74, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x63, 0x62, 0x64, 0x61, 0x74, 0x61, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x63, 0x62, 0x6c, 0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63,
+  0x62, 0x73, 0x75, 0x62, 0x6c, 0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x63, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63,
+  0x68, 0x61, 0x6c, 0x6c, 0x65, 0x6e, 0x67, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x63, 0x68, 0x61, 0x6c, 0x6c, 0x65, 0x6e, 0x67, 0x65, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x63, 0x69, 0x72, 0x63, 0x75, 0x69, 0x74, 0x42, 0x72, 0x65,
+  0x61, 0x6b, 0x65, 0x72, 0x44, 0x65, 0x73, 0x63, 0x72, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x63, 0x69, 0x72, 0x63, 0x75, 0x69, 0x74, 0x42, 0x72, 0x65,
+  0x61, 0x6b, 0x65, 0x72, 0x44, 0x65, 0x73, 0x63, 0x72, 0x47, 0x72, 0x6f,
+  0x75, 0x70, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x69, 0x72, 0x63, 0x75,
+  0x69, 0x74, 0x42, 0x72, 0x65, 0x61, 0x6b, 0x65, 0x72, 0x44, 0x65, 0x73,
+  0x63, 0x72, 0x53, 0x75, 0x62, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x49, 0x6e, 0x66,
+  0x6f, 0x44, 0x65, 0x73, 0x63, 0x72, 0x50, 0x61, 0x72, 0x61, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x64, 0x75, 0x69, 0x74, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x69, 0x74, 0x65, 0x6d, 0x61, 0x6c,
+  0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x6f, 0x70, 0x79,
+  0x72, 0x69, 0x67, 0x68, 0x74, 0x50, 0x61, 0x72, 0x61, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
+  0x46, 0x61, 0x75, 0x6c, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x72,
+  0x65, 0x77, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x72, 0x65, 0x77, 0x44,
+  0x72, 0x69, 0x6c, 0x6c, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x72, 0x65,
+  0x77, 0x44, 0x72, 0x69, 0x6c, 0x6c, 0x53, 0x74, 0x65, 0x70, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x63, 0x72, 0x65, 0x77, 0x6d, 0x65, 0x6d, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x63, 0x72, 0x65, 0x77, 0x4d, 0x65, 0x6d, 0x62, 0x65,
+  0x72, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x63, 0x72, 0x65, 0x77, 0x4d, 0x65,
+  0x6d, 0x62, 0x65, 0x72, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x63, 0x72, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x64, 0x61, 0x74, 0x61, 0x72, 0x65, 0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x64, 0x61, 0x74, 0x61, 0x52, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x64, 0x65,
+  0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x4c,
+  0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x64, 0x65, 0x66, 0x6c, 0x69, 0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x64, 0x65, 0x66, 0x74, 0x61, 0x73, 0x6b, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x46, 0x61, 0x75, 0x6c,
+  0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x64, 0x66, 0x61, 0x75, 0x6c, 0x74,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x64, 0x69, 0x61, 0x6c, 0x6f, 0x67, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x64, 0x6d, 0x2d, 0x6e, 0x6f, 0x64, 0x65, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x64, 0x6d, 0x52, 0x65, 0x66, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x64, 0x72, 0x69, 0x6c, 0x6c, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x65, 0x69, 0x6e, 0x61, 0x6c, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x65,
+  0x6c, 0x65, 0x63, 0x65, 0x71, 0x75, 0x69, 0x70, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x65, 0x6c, 0x73, 0x65, 0x49, 0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x65,
+  0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x53, 0x70, 0x61, 0x72, 0x65,
+  0x44, 0x65, 0x73, 0x63, 0x72, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x65, 0x6d,
+  0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x53, 0x75, 0x70, 0x70, 0x6c, 0x79,
+  0x44, 0x65, 0x73, 0x63, 0x72, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x65, 0x6d,
+  0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x53, 0x75, 0x70, 0x70, 0x6f, 0x72,
+  0x74, 0x45, 0x71, 0x75, 0x69, 0x70, 0x44, 0x65, 0x73, 0x63, 0x72, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x65, 0x6e, 0x64, 0x4d, 0x61, 0x74, 0x74, 0x65,
+  0x72, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x65, 0x6e, 0x64, 0x6d, 0x61, 0x74,
+  0x74, 0x72, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x65, 0x6e, 0x74, 0x72, 0x79,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x61,
+  0x6c, 0x50, 0x75, 0x62, 0x52, 0x65, 0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x49, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x66, 0x69, 0x6c, 0x6c, 0x69, 0x6e, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x66, 0x6f, 0x6f, 0x74, 0x6e, 0x6f, 0x74, 0x65, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x66, 0x6f, 0x6f, 0x74, 0x6e, 0x6f, 0x74, 0x65, 0x52,
+  0x65, 0x6d, 0x61, 0x72, 0x6b, 0x73, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x66,
+  0x74, 0x6e, 0x6f, 0x74, 0x65, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x49, 0x74, 0x65, 0x6d,
+  0x52, 0x65, 0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x69, 0x63, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x68, 0x61, 0x72, 0x6e,
+  0x65, 0x73, 0x73, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x68, 0x6f, 0x74, 0x73,
+  0x70, 0x6f, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x69, 0x63, 0x73, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x2d, 0x73, 0x6c,
+  0x65, 0x65, 0x76, 0x65, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x69, 0x66, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x69, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x52,
+  0x65, 0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x69, 0x73, 0x6f, 0x65, 0x6e,
+  0x64, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74,
+  0x65, 0x64, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x45, 0x6e, 0x64, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x53,
+  0x74, 0x65, 0x70, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x69, 0x73, 0x6f, 0x73,
+  0x74, 0x65, 0x70, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x69, 0x74, 0x65, 0x6d,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x6c, 0x65,
+  0x64, 0x50, 0x61, 0x72, 0x61, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6c, 0x69,
+  0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6c,
+  0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6c, 0x69,
+  0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x6c, 0x72, 0x75, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6d,
+  0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x53, 0x65, 0x74, 0x52, 0x65,
+  0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6d, 0x65, 0x6e, 0x75, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x6d, 0x65, 0x6e, 0x75, 0x63, 0x68, 0x6f, 0x69, 0x63,
+  0x65, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
+  0x65, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x6d,
+  0x65, 0x64, 0x69, 0x61, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6d, 0x75, 0x6c,
+  0x74, 0x69, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x4f, 0x62, 0x6a, 0x65, 0x63,
+  0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x6d,
+  0x65, 0x64, 0x69, 0x61, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x6e, 0x6f, 0x74, 0x65, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x6e, 0x6f, 0x74, 0x65, 0x50, 0x61, 0x72, 0x61, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x46, 0x61, 0x75,
+  0x6c, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6f, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x50,
+  0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x43, 0x61, 0x75, 0x73, 0x65,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x70, 0x61, 0x72, 0x61, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x70, 0x61, 0x72, 0x61, 0x30, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x70, 0x6d, 0x64, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x70, 0x6d, 0x52, 0x65,
+  0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x70, 0x72, 0x6f, 0x63, 0x64, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x61, 0x6c, 0x53, 0x74, 0x65, 0x70, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x70,
+  0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4d, 0x61, 0x69,
+  0x6e, 0x74, 0x44, 0x61, 0x74, 0x61, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x71,
+  0x61, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x71, 0x75, 0x61, 0x6c, 0x69, 0x74,
+  0x79, 0x41, 0x73, 0x73, 0x75, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x72, 0x61, 0x6e, 0x64, 0x6c, 0x69, 0x73, 0x74, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x4c, 0x69,
+  0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72, 0x65, 0x61, 0x73, 0x6f,
+  0x6e, 0x46, 0x6f, 0x72, 0x41, 0x6d, 0x65, 0x6e, 0x64, 0x6d, 0x65, 0x6e,
+  0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e,
+  0x46, 0x6f, 0x72, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x72, 0x65, 0x66, 0x64, 0x6d, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x72, 0x65, 0x66, 0x74, 0x70, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72, 0x65,
+  0x6d, 0x61, 0x72, 0x6b, 0x73, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72, 0x65,
+  0x71, 0x63, 0x62, 0x6c, 0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72,
+  0x65, 0x71, 0x43, 0x6f, 0x6e, 0x64, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72,
+  0x65, 0x71, 0x63, 0x6f, 0x6e, 0x64, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72,
+  0x65, 0x71, 0x43, 0x6f, 0x6e, 0x64, 0x43, 0x69, 0x72, 0x63, 0x75, 0x69,
+  0x74, 0x42, 0x72, 0x65, 0x61, 0x6b, 0x65, 0x72, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x72, 0x65, 0x71, 0x43, 0x6f, 0x6e, 0x64, 0x44, 0x6d, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x72, 0x65, 0x71, 0x43, 0x6f, 0x6e, 0x64, 0x45, 0x78,
+  0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x50, 0x75, 0x62, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x72, 0x65, 0x71, 0x63, 0x6f, 0x6e, 0x64, 0x6d, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x72, 0x65, 0x71, 0x43, 0x6f, 0x6e, 0x64, 0x4e, 0x6f,
+  0x52, 0x65, 0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72, 0x65, 0x71, 0x43,
+  0x6f, 0x6e, 0x64, 0x50, 0x6d, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72, 0x65,
+  0x71, 0x63, 0x6f, 0x6e, 0x74, 0x70, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72,
+  0x65, 0x71, 0x70, 0x65, 0x72, 0x73, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72,
+  0x65, 0x71, 0x50, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x73, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x72, 0x66, 0x61, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72,
+  0x66, 0x75, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x72, 0x6f, 0x77, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x72, 0x70, 0x6c, 0x62, 0x79, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x73, 0x65, 0x71, 0x6c, 0x69, 0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x4c,
+  0x69, 0x73, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x68, 0x72, 0x69,
+  0x6e, 0x6b, 0x2d, 0x73, 0x6c, 0x65, 0x65, 0x76, 0x65, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x73, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x2d, 0x73, 0x6c, 0x65,
+  0x65, 0x76, 0x65, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x70, 0x61, 0x72,
+  0x65, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x70, 0x61, 0x72, 0x65, 0x44,
+  0x65, 0x73, 0x63, 0x72, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x72, 0x75,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x31, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x73, 0x74, 0x65, 0x70, 0x32, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x74,
+  0x65, 0x70, 0x33, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x74, 0x65, 0x70,
+  0x34, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x35, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x36, 0x7c, 0x0a, 0x2e,
+  0x2f, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x37, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x73, 0x74, 0x65, 0x70, 0x38, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x74,
+  0x6f, 0x63, 0x6b, 0x6e, 0x62, 0x72, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73,
+  0x75, 0x62, 0x43, 0x72, 0x65, 0x77, 0x44, 0x72, 0x69, 0x6c, 0x6c, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x75, 0x62, 0x64, 0x72, 0x69, 0x6c, 0x6c,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x75, 0x62, 0x70, 0x61, 0x72, 0x61,
+  0x31, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x75, 0x62, 0x70, 0x61, 0x72,
+  0x61, 0x32, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x75, 0x62, 0x70, 0x61,
+  0x72, 0x61, 0x33, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x75, 0x62, 0x70,
+  0x61, 0x72, 0x61, 0x34, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x75, 0x62,
+  0x70, 0x61, 0x72, 0x61, 0x35, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73, 0x75,
+  0x62, 0x70, 0x61, 0x72, 0x61, 0x36, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73,
+  0x75, 0x62, 0x70, 0x61, 0x72, 0x61, 0x37, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x71, 0x75, 0x69, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x73, 0x75, 0x70, 0x70, 0x6c, 0x79, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x73,
+  0x75, 0x70, 0x70, 0x6c, 0x79, 0x44, 0x65, 0x73, 0x63, 0x72, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x45, 0x71,
+  0x75, 0x69, 0x70, 0x44, 0x65, 0x73, 0x63, 0x72, 0x7c, 0x0a, 0x2e, 0x2f,
+  0x2f, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x74, 0x61, 0x62, 0x6c, 0x65, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x74, 0x61,
+  0x73, 0x6b, 0x69, 0x74, 0x65, 0x6d, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x74,
+  0x65, 0x72, 0x6d, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x74, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x74, 0x69, 0x6d, 0x65, 0x6c,
+  0x69, 0x6d, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x74, 0x6f, 0x6f, 0x6c, 0x61,
+  0x6c, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x76, 0x70, 0x61, 0x72, 0x74,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67,
+  0x41, 0x6e, 0x64, 0x43, 0x61, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x61,
+  0x72, 0x61, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x77, 0x61, 0x72, 0x6e, 0x69,
+  0x6e, 0x67, 0x4d, 0x61, 0x6c, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x77, 0x69, 0x72, 0x65, 0x7c, 0x0a,
+  0x2e, 0x2f, 0x2f, 0x77, 0x69, 0x72, 0x65, 0x2d, 0x6d, 0x61, 0x74, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x77, 0x69, 0x72, 0x69, 0x6e, 0x67, 0x50, 0x6f,
+  0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x43, 0x61, 0x75, 0x73, 0x65, 0x7c,
+  0x0a, 0x2e, 0x2f, 0x2f, 0x77, 0x6d, 0x6c, 0x66, 0x64, 0x65, 0x73, 0x63,
+  0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x77, 0x6f, 0x72, 0x6b, 0x41, 0x72, 0x65,
+  0x61, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x47, 0x72, 0x6f,
+  0x75, 0x70, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x77, 0x6f, 0x72, 0x6b, 0x4c,
+  0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f,
+  0x78, 0x72, 0x65, 0x66, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x7a, 0x6f, 0x6e,
+  0x65, 0x61, 0x6c, 0x74, 0x7c, 0x0a, 0x2e, 0x2f, 0x2f, 0x7a, 0x6f, 0x6e,
+  0x65, 0x52, 0x65, 0x66, 0x0a
+};
+unsigned int elements_list_len = 2801;
+unsigned char disptext_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x72, 0x61, 0x6e,
+  0x73, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+  0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f,
+  0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31,
+  0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61, 0x6e,
+  0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x65, 0x78, 0x73, 0x6c, 0x74, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70,
+  0x3a, 0x2f, 0x2f, 0x65, 0x78, 0x73, 0x6c, 0x74, 0x2e, 0x6f, 0x72, 0x67,
+  0x2f, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x22, 0x20, 0x65, 0x78, 0x74,
+  0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x2d, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x2d, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x65, 0x73, 0x3d,
+  0x22, 0x65, 0x78, 0x73, 0x6c, 0x74, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x65, 0x78, 0x74,
+  0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x73,
+  0x70, 0x61, 0x63, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x73, 0x74, 0x72, 0x3a, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x78, 0x6d,
+  0x6c, 0x6e, 0x73, 0x3a, 0x73, 0x74, 0x72, 0x3d, 0x22, 0x68, 0x74, 0x74,
+  0x70, 0x3a, 0x2f, 0x2f, 0x65, 0x78, 0x73, 0x6c, 0x74, 0x2e, 0x6f, 0x72,
+  0x67, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72,
+  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22,
+  0x3e, 0x31, 0x2e, 0x30, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x65, 0x78, 0x73, 0x6c, 0x74, 0x3a, 0x6e, 0x6f, 0x64, 0x65, 0x2d, 0x73,
+  0x65, 0x74, 0x28, 0x24, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+  0x6e, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x73,
+  0x29, 0x2f, 0x2a, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61, 0x63,
+  0x65, 0x3a, 0x3a, 0x2a, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x65,
+  0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x2d, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x65,
+  0x73, 0x22, 0x3e, 0x73, 0x74, 0x72, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x6f,
+  0x76, 0x65, 0x72, 0x77, 0x72, 0x69, 0x74, 0x65, 0x2d, 0x64, 0x69, 0x73,
+  0x70, 0x6c, 0x61, 0x79, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x22, 0x3e, 0x74, 0x72, 0x75, 0x65, 0x28, 0x29, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+  0x22, 0x3e, 0x73, 0x65, 0x74, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74,
+  0x6f, 0x72, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x64, 0x69, 0x73, 0x70, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x6f, 0x70,
+  0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x2f, 0x73, 0x65, 0x74, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x2d, 0x6f, 0x70, 0x65,
+  0x72, 0x61, 0x74, 0x6f, 0x72, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x70, 0x74, 0x65, 0x78, 0x74,
+  0x2f, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x2f, 0x72,
+  0x61, 0x6e, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x70, 0x74, 0x65, 0x78, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x61, 0x73, 0x73, 0x65,
+  0x72, 0x74, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x5d, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65,
+  0x22, 0x3e, 0x74, 0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x22, 0x3e, 0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x65, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65,
+  0x22, 0x3e, 0x74, 0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x6f, 0x70, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x22, 0x3e, 0x40, 0x61, 0x6e, 0x64, 0x4f, 0x72, 0x7c, 0x40,
+  0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x66, 0x6f, 0x72, 0x2d, 0x65,
+  0x61, 0x63, 0x68, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x61, 0x73, 0x73,
+  0x65, 0x72, 0x74, 0x7c, 0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x65,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x69, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x65,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x28, 0x40, 0x61, 0x6e, 0x64, 0x4f, 0x72,
+  0x7c, 0x40, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x20,
+  0x21, 0x3d, 0x20, 0x24, 0x6f, 0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x70, 0x74, 0x65, 0x78,
+  0x74, 0x2f, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x2f,
+  0x6f, 0x70, 0x65, 0x6e, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22,
+  0x3e, 0x2e, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x74, 0x65,
+  0x78, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22,
+  0x3e, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x76, 0x61, 0x6c, 0x75,
+  0x61, 0x74, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x28, 0x40, 0x61, 0x6e,
+  0x64, 0x4f, 0x72, 0x7c, 0x40, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f,
+  0x72, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x24, 0x6f, 0x70, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x70,
+  0x74, 0x65, 0x78, 0x74, 0x2f, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f,
+  0x72, 0x73, 0x2f, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x47, 0x72, 0x6f, 0x75,
+  0x70, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74,
+  0x22, 0x3e, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29,
+  0x20, 0x21, 0x3d, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x28, 0x29, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74,
+  0x22, 0x3e, 0x24, 0x6f, 0x70, 0x20, 0x3d, 0x20, 0x27, 0x61, 0x6e, 0x64,
+  0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x70,
+  0x74, 0x65, 0x78, 0x74, 0x2f, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f,
+  0x72, 0x73, 0x2f, 0x61, 0x6e, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22,
+  0x3e, 0x24, 0x6f, 0x70, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x72, 0x27, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x70, 0x74, 0x65,
+  0x78, 0x74, 0x2f, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x73,
+  0x2f, 0x6f, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x40,
+  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72,
+  0x74, 0x79, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x7c, 0x40, 0x61, 0x63,
+  0x74, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x74,
+  0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x22, 0x3e, 0x73, 0x74, 0x72, 0x3a, 0x72, 0x65, 0x70,
+  0x6c, 0x61, 0x63, 0x65, 0x28, 0x73, 0x74, 0x72, 0x3a, 0x72, 0x65, 0x70,
+  0x6c, 0x61, 0x63, 0x65, 0x28, 0x2e, 0x2c, 0x20, 0x27, 0x7c, 0x27, 0x2c,
+  0x20, 0x24, 0x73, 0x65, 0x74, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74,
+  0x6f, 0x72, 0x29, 0x2c, 0x20, 0x27, 0x7e, 0x27, 0x2c, 0x20, 0x24, 0x72,
+  0x61, 0x6e, 0x67, 0x65, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f,
+  0x72, 0x29, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x61, 0x70, 0x70, 0x6c, 0x69,
+  0x63, 0x5b, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x7c, 0x65, 0x76, 0x61,
+  0x6c, 0x75, 0x61, 0x74, 0x65, 0x7c, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73,
+  0x73, 0x69, 0x6f, 0x6e, 0x5d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x64, 0x69, 0x73, 0x70, 0x2d, 0x6e, 0x61,
+  0x6d, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e,
+  0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x73, 0x74, 0x61, 0x74,
+  0x75, 0x73, 0x7c, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x69,
+  0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x73,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79,
+  0x74, 0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77,
+  0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+  0x79, 0x54, 0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x70, 0x61, 0x72, 0x61, 0x2d, 0x6e, 0x61, 0x6d, 0x65,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68,
+  0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x70, 0x61,
+  0x72, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+  0x20, 0x6f, 0x72, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x3a, 0x3a,
+  0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
+  0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x73, 0x69, 0x6d,
+  0x70, 0x6c, 0x65, 0x50, 0x61, 0x72, 0x61, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x64, 0x69, 0x73, 0x70, 0x2d, 0x65, 0x6c,
+  0x65, 0x6d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x64, 0x69,
+  0x73, 0x70, 0x6c, 0x61, 0x79, 0x54, 0x65, 0x78, 0x74, 0x7c, 0x64, 0x69,
+  0x73, 0x70, 0x6c, 0x61, 0x79, 0x74, 0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40,
+  0x2a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e,
+  0x24, 0x64, 0x69, 0x73, 0x70, 0x2d, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x28, 0x24, 0x6f, 0x76, 0x65,
+  0x72, 0x77, 0x72, 0x69, 0x74, 0x65, 0x2d, 0x64, 0x69, 0x73, 0x70, 0x6c,
+  0x61, 0x79, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x64, 0x69, 0x73, 0x70, 0x2d, 0x65,
+  0x6c, 0x65, 0x6d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x7b, 0x24, 0x64,
+  0x69, 0x73, 0x70, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x7d, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e,
+  0x7b, 0x24, 0x70, 0x61, 0x72, 0x61, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x7d,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70,
+  0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x22, 0x3e, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x7c,
+  0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x65, 0x7c, 0x65, 0x78, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x74,
+  0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x22, 0x3e, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x7c,
+  0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x65, 0x7c, 0x65, 0x78, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e,
+  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72,
+  0x74, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x69, 0x64, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22,
+  0x3e, 0x40, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72, 0x6f, 0x70,
+  0x65, 0x72, 0x74, 0x79, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x7c, 0x40, 0x61,
+  0x63, 0x74, 0x69, 0x64, 0x72, 0x65, 0x66, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x74, 0x79, 0x70, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x22, 0x3e, 0x40, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72,
+  0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x54, 0x79, 0x70, 0x65, 0x7c, 0x40,
+  0x61, 0x63, 0x74, 0x72, 0x65, 0x66, 0x74, 0x79, 0x70, 0x65, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72,
+  0x69, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x70, 0x72, 0x6f,
+  0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2f, 0x2f, 0x70,
+  0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x5b, 0x24, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x27, 0x70,
+  0x72, 0x6f, 0x64, 0x61, 0x74, 0x74, 0x72, 0x27, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x40, 0x69, 0x64, 0x3d, 0x24, 0x69, 0x64, 0x5d, 0x7c, 0x2f, 0x2f,
+  0x70, 0x72, 0x6f, 0x64, 0x61, 0x74, 0x74, 0x72, 0x5b, 0x24, 0x74, 0x79,
+  0x70, 0x65, 0x3d, 0x27, 0x70, 0x72, 0x6f, 0x64, 0x61, 0x74, 0x74, 0x72,
+  0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x40, 0x69, 0x64, 0x3d, 0x24, 0x69,
+  0x64, 0x5d, 0x7c, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x64, 0x5b, 0x24, 0x74,
+  0x79, 0x70, 0x65, 0x3d, 0x27, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x40, 0x69, 0x64, 0x3d,
+  0x24, 0x69, 0x64, 0x5d, 0x7c, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x64, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x5b, 0x24, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x27,
+  0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x27, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x40, 0x69, 0x64, 0x3d, 0x24, 0x69, 0x64, 0x5d, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x64, 0x69,
+  0x73, 0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x70,
+  0x72, 0x6f, 0x70, 0x2f, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x4e,
+  0x61, 0x6d, 0x65, 0x7c, 0x24, 0x70, 0x72, 0x6f, 0x70, 0x2f, 0x64, 0x69,
+  0x73, 0x70, 0x6c, 0x61, 0x79, 0x6e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69,
+  0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x6e, 0x61, 0x6d, 0x65,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x70, 0x72, 0x6f,
+  0x70, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x24, 0x64, 0x69,
+  0x73, 0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e,
+  0x24, 0x64, 0x69, 0x73, 0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x24, 0x6e, 0x61,
+  0x6d, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e,
+  0x24, 0x6e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x22, 0x3e, 0x24, 0x69, 0x64, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72, 0x6f,
+  0x70, 0x65, 0x72, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x69, 0x64, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x22, 0x3e, 0x40, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72,
+  0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x7c,
+  0x40, 0x61, 0x63, 0x74, 0x69, 0x64, 0x72, 0x65, 0x66, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x74, 0x79, 0x70, 0x65, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x22, 0x3e, 0x40, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
+  0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x54, 0x79, 0x70, 0x65,
+  0x7c, 0x40, 0x61, 0x63, 0x74, 0x72, 0x65, 0x66, 0x74, 0x79, 0x70, 0x65,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x70,
+  0x72, 0x6f, 0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2f,
+  0x2f, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x41, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x5b, 0x24, 0x74, 0x79, 0x70, 0x65, 0x3d,
+  0x27, 0x70, 0x72, 0x6f, 0x64, 0x61, 0x74, 0x74, 0x72, 0x27, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x40, 0x69, 0x64, 0x3d, 0x24, 0x69, 0x64, 0x5d, 0x7c,
+  0x2f, 0x2f, 0x70, 0x72, 0x6f, 0x64, 0x61, 0x74, 0x74, 0x72, 0x5b, 0x24,
+  0x74, 0x79, 0x70, 0x65, 0x3d, 0x27, 0x70, 0x72, 0x6f, 0x64, 0x61, 0x74,
+  0x74, 0x72, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x40, 0x69, 0x64, 0x3d,
+  0x24, 0x69, 0x64, 0x5d, 0x7c, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x64, 0x54,
+  0x79, 0x70, 0x65, 0x5b, 0x24, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x27, 0x63,
+  0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x27, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x40, 0x69, 0x64, 0x3d, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x64,
+  0x5b, 0x40, 0x69, 0x64, 0x3d, 0x24, 0x69, 0x64, 0x5d, 0x2f, 0x40, 0x63,
+  0x6f, 0x6e, 0x64, 0x54, 0x79, 0x70, 0x65, 0x52, 0x65, 0x66, 0x49, 0x64,
+  0x5d, 0x7c, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x5b, 0x24, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x27, 0x63, 0x6f, 0x6e,
+  0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x40, 0x69, 0x64, 0x3d, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x64, 0x5b, 0x40,
+  0x69, 0x64, 0x3d, 0x24, 0x69, 0x64, 0x5d, 0x2f, 0x40, 0x63, 0x6f, 0x6e,
+  0x64, 0x74, 0x79, 0x70, 0x65, 0x72, 0x65, 0x66, 0x5d, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69,
+  0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40, 0x61,
+  0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74,
+  0x79, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x7c, 0x40, 0x61, 0x63, 0x74,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x70, 0x72, 0x6f, 0x70, 0x2f,
+  0x65, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5b,
+  0x40, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72, 0x6f, 0x70, 0x65,
+  0x72, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x3d, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x73, 0x5d, 0x2f, 0x40, 0x65, 0x6e, 0x75, 0x6d,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x61, 0x62, 0x65, 0x6c,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73,
+  0x74, 0x22, 0x3e, 0x24, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x77, 0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x22, 0x3e,
+  0x74, 0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x64, 0x69, 0x73,
+  0x70, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x61, 0x73, 0x73, 0x65,
+  0x72, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f,
+  0x64, 0x65, 0x22, 0x3e, 0x74, 0x65, 0x78, 0x74, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61,
+  0x6d, 0x65, 0x22, 0x3e, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x22, 0x3e, 0x40, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72,
+  0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x7c,
+  0x40, 0x61, 0x63, 0x74, 0x69, 0x64, 0x72, 0x65, 0x66, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+  0x22, 0x3e, 0x74, 0x79, 0x70, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e,
+  0x40, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72, 0x6f, 0x70, 0x65,
+  0x72, 0x74, 0x79, 0x54, 0x79, 0x70, 0x65, 0x7c, 0x40, 0x61, 0x63, 0x74,
+  0x72, 0x65, 0x66, 0x74, 0x79, 0x70, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79,
+  0x70, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x64, 0x75,
+  0x63, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73,
+  0x7c, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x24, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x3d, 0x27, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x27, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x24, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x27, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x40, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x7c, 0x74, 0x65, 0x78,
+  0x74, 0x7c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x24, 0x74, 0x79, 0x70, 0x65, 0x3d,
+  0x27, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x27, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x28, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x64, 0x5b,
+  0x40, 0x69, 0x64, 0x3d, 0x24, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x5d, 0x2f,
+  0x40, 0x63, 0x6f, 0x6e, 0x64, 0x54, 0x79, 0x70, 0x65, 0x52, 0x65, 0x66,
+  0x49, 0x64, 0x7c, 0x2f, 0x2f, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x5b, 0x40, 0x69, 0x64, 0x3d, 0x24, 0x69, 0x64, 0x65, 0x6e,
+  0x74, 0x5d, 0x2f, 0x40, 0x63, 0x6f, 0x6e, 0x64, 0x74, 0x79, 0x70, 0x65,
+  0x72, 0x65, 0x66, 0x29, 0x3d, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x40, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x7c, 0x74, 0x65, 0x78, 0x74,
+  0x7c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x64,
+  0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65,
+  0x73, 0x74, 0x22, 0x3e, 0x74, 0x72, 0x75, 0x65, 0x28, 0x29, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x7c, 0x74, 0x65, 0x78, 0x74, 0x7c,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x64, 0x75, 0x63, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65,
+  0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22,
+  0x3e, 0x24, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x27, 0x70, 0x72, 0x6f, 0x64,
+  0x61, 0x74, 0x74, 0x72, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x7c, 0x74, 0x65, 0x78, 0x74, 0x7c, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65,
+  0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22,
+  0x3e, 0x24, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x27, 0x63, 0x6f, 0x6e, 0x64,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70,
+  0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x6e, 0x61,
+  0x6d, 0x65, 0x7c, 0x74, 0x65, 0x78, 0x74, 0x7c, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50,
+  0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f,
+  0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x3d, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61,
+  0x6c, 0x6c, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x61, 0x70, 0x70, 0x6c, 0x69,
+  0x63, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56, 0x61, 0x6c,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61, 0x6c, 0x6c, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e,
+  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72,
+  0x74, 0x79, 0x56, 0x61, 0x6c, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x40, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
+  0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x3d, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x27, 0x20, 0x6f, 0x72, 0x20, 0x40, 0x61, 0x63, 0x74, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x73, 0x3d, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f,
+  0x72, 0x6d, 0x3e, 0x0a
+};
+unsigned int disptext_xsl_len = 14608;
+unsigned char disptext_xml[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x64,
+  0x69, 0x73, 0x70, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x61, 0x6e, 0x64, 0x3e, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x3c, 0x2f, 0x61, 0x6e, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x6f, 0x72, 0x3e, 0x20, 0x6f, 0x72, 0x20, 0x3c, 0x2f, 0x6f, 0x72,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x65, 0x6e, 0x47,
+  0x72, 0x6f, 0x75, 0x70, 0x3e, 0x28, 0x3c, 0x2f, 0x6f, 0x70, 0x65, 0x6e,
+  0x47, 0x72, 0x6f, 0x75, 0x70, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x6c, 0x6f, 0x73, 0x65, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x3e, 0x29,
+  0x3c, 0x2f, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x47, 0x72, 0x6f, 0x75, 0x70,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x74, 0x3e, 0x2c,
+  0x20, 0x3c, 0x2f, 0x73, 0x65, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x2d, 0x3c, 0x2f, 0x72, 0x61,
+  0x6e, 0x67, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x6f, 0x70, 0x65,
+  0x72, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64,
+  0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x3a, 0x20, 0x3c, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x65,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x73,
+  0x70, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a
+};
+unsigned int disptext_xml_len = 283;
+unsigned char addTags_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x72, 0x61, 0x6e,
+  0x73, 0x66, 0x6f, 0x72, 0x6d, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+  0x73, 0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+  0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+  0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72,
+  0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x0a, 0x20, 0x20, 0x76,
+  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f,
+  0x64, 0x65, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x27, 0x70, 0x69, 0x27, 0x22, 0x2f, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e,
+  0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70,
+  0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x2a,
+  0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2a, 0x5b, 0x40,
+  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x52, 0x65, 0x66, 0x49, 0x64, 0x5d,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x52, 0x65, 0x66,
+  0x49, 0x64, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x40, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x52, 0x65, 0x66, 0x49, 0x64,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x22, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2f, 0x2f, 0x61, 0x70,
+  0x70, 0x6c, 0x69, 0x63, 0x5b, 0x40, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x24,
+  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x52, 0x65, 0x66, 0x49, 0x64, 0x5d,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x6d, 0x6f, 0x64, 0x65,
+  0x20, 0x3d, 0x20, 0x27, 0x70, 0x69, 0x27, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24,
+  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x70, 0x69, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22,
+  0x24, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x63, 0x6f, 0x6d,
+  0x6d, 0x65, 0x6e, 0x74, 0x27, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x61, 0x70,
+  0x70, 0x6c, 0x69, 0x63, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x70, 0x69, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x69,
+  0x6e, 0x67, 0x2d, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x31, 0x6b,
+  0x64, 0x2d, 0x61, 0x73, 0x70, 0x70, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x74, 0x6f, 0x3a, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x54, 0x65,
+  0x78, 0x74, 0x2f, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x50, 0x61, 0x72,
+  0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6e,
+  0x67, 0x2d, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x70, 0x70,
+  0x6c, 0x69, 0x63, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x63,
+  0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x41, 0x70, 0x70, 0x6c, 0x69,
+  0x63, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x3a, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x64, 0x69, 0x73,
+  0x70, 0x6c, 0x61, 0x79, 0x54, 0x65, 0x78, 0x74, 0x2f, 0x73, 0x69, 0x6d,
+  0x70, 0x6c, 0x65, 0x50, 0x61, 0x72, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x6d,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x69,
+  0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x27,
+  0x73, 0x31, 0x6b, 0x64, 0x2d, 0x61, 0x73, 0x70, 0x70, 0x27, 0x29, 0x22,
+  0x2f, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x72,
+  0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a
+};
+unsigned int addTags_xsl_len = 1377;
+unsigned char ___common_identity_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x20, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40,
+  0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73,
+  0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int ___common_identity_xsl_len = 270;
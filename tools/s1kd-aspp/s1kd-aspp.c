@@ -11,7 +11,7 @@
 #include "resources.h"
 
 #define PROG_NAME "s1kd-aspp"
-#define VERSION "4.4.0"
+#define VERSION "4.4.2"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 #define WRN_PREFIX PROG_NAME ": WARNING: "
@@ -51,6 +51,28 @@ static bool no_issue = false;
 /* Delimiter for format strings. */
 #define FMTSTR_DELIM '%'
 
+/* Settings for generating display text, read from the .disptext file. */
+static struct {
+	xmlChar *and_op;
+	xmlChar *or_op;
+	xmlChar *open_group;
+	xmlChar *close_group;
+	xmlChar *set_op;
+	xmlChar *range_op;
+
+	/* Element containing the rules for each assert. */
+	xmlNodePtr rules;
+
+	/* Rules generated from a format string. */
+	xmlDocPtr format;
+} dispText;
+
+/* The cross-reference tables used to generate display text for an object. */
+struct xref_tables {
+	xmlDocPtr *docs;
+	int count;
+};
+
 /* Return the first node matching an XPath expression. */
 static xmlNodePtr firstXPathNode(xmlDocPtr doc, xmlNodePtr node, const char *xpath)
 {
@@ -344,18 +366,16 @@ static void generateDisplayText(xmlDocPtr doc, xmlNodePtr acts, xmlNodePtr ccts,
 		xmlDocPtr act;
 		xmlChar *path;
 		path = xmlNodeGetContent(cur);
-		act = read_xml_doc((char *) path);
+		act = read_xref_table((char *) path);
 		xmlAddChild(muxacts, xmlCopyNode(xmlDocGetRootElement(act), 1));
-		xmlFreeDoc(act);
 		xmlFree(path);
 	}
 	for (cur = ccts->children; cur; cur = cur->next) {
 		xmlDocPtr cct;
 		xmlChar *path;
 		path = xmlNodeGetContent(cur);
-		cct = read_xml_doc((char *) path);
+		cct = read_xref_table((char *) path);
 		xmlAddChild(muxccts, xmlCopyNode(xmlDocGetRootElement(cct), 1));
-		xmlFreeDoc(cct);
 		xmlFree(path);
 	}
 
@@ -373,6 +393,768 @@ static void generateDisplayText(xmlDocPtr doc, xmlNodePtr acts, xmlNodePtr ccts,
 	xmlFreeDoc(muxdoc);
 }
 
+/* Test whether a node is an element with a given name. */
+static bool is_elem(xmlNodePtr node, const char *name)
+{
+	return node->type == XML_ELEMENT_NODE && xmlStrcmp(node->name, BAD_CAST name) == 0;
+}
+
+/* Return the value of one of two attributes (4.0+ or 3.0-). */
+static xmlChar *get_either_prop(xmlNodePtr node, const char *name, const char *alt)
+{
+	xmlChar *v;
+
+	if (!(v = xmlGetProp(node, BAD_CAST name))) {
+		v = xmlGetProp(node, BAD_CAST alt);
+	}
+
+	return v;
+}
+
+/* Return the string value of the first child element with a given name. */
+static xmlChar *first_child_value(xmlNodePtr node, const char *name)
+{
+	xmlNodePtr cur;
+
+	for (cur = node->children; cur; cur = cur->next) {
+		if (is_elem(cur, name)) {
+			return xmlNodeGetContent(cur);
+		}
+	}
+
+	return NULL;
+}
+
+/* Replace every occurrence of a character in a string. */
+static xmlChar *replace_char(const xmlChar *str, xmlChar c, const xmlChar *with)
+{
+	xmlChar *res;
+	const xmlChar *s, *e;
+
+	res = xmlStrdup(BAD_CAST "");
+
+	for (s = str; (e = xmlStrchr(s, c)); s = e + 1) {
+		res = xmlStrncat(res, s, e - s);
+		res = xmlStrcat(res, with);
+	}
+
+	return xmlStrcat(res, s);
+}
+
+/* Display the name of the property of an assert. */
+static void add_property_name(xmlNodePtr para, xmlNodePtr assert, const struct xref_tables *tables)
+{
+	xmlChar *id, *type;
+	const char *kind = NULL;
+	xmlNodePtr name = NULL;
+	int i;
+
+	id = get_either_prop(assert, "applicPropertyIdent", "actidref");
+	type = get_either_prop(assert, "applicPropertyType", "actreftype");
+
+	if (xmlStrcmp(type, BAD_CAST "prodattr") == 0) {
+		kind = "prodattr";
+	} else if (xmlStrcmp(type, BAD_CAST "condition") == 0) {
+		kind = "cond";
+	}
+
+	/* A display name in any table is used before a name. */
+	for (i = 0; kind && i < tables->count; ++i) {
+		xmlNodePtr def, cur;
+
+		if (!(def = xref_table_definition(tables->docs[i], kind, id))) {
+			continue;
+		}
+
+		for (cur = def->children; cur; cur = cur->next) {
+			if (is_elem(cur, "displayName") || is_elem(cur, "displayname")) {
+				xmlChar *s = xmlNodeGetContent(cur);
+				xmlNodeAddContent(para, s);
+				xmlFree(s);
+				xmlFree(id);
+				xmlFree(type);
+				return;
+			} else if (!name && is_elem(cur, "name")) {
+				name = cur;
+			}
+		}
+	}
+
+	if (name) {
+		xmlChar *s = xmlNodeGetContent(name);
+		xmlNodeAddContent(para, s);
+		xmlFree(s);
+	} else {
+		xmlNodeAddContent(para, id);
+	}
+
+	xmlFree(id);
+	xmlFree(type);
+}
+
+/* Return the label of an enumerated value of a property, if it has one. */
+static xmlChar *enumeration_label(xmlNodePtr prop, const xmlChar *values)
+{
+	xmlNodePtr cur;
+
+	for (cur = prop->children; cur; cur = cur->next) {
+		xmlChar *v;
+		bool match;
+
+		if (!is_elem(cur, "enumeration")) {
+			continue;
+		}
+
+		v = xmlGetProp(cur, BAD_CAST "applicPropertyValues");
+		match = xmlStrcmp(v, values) == 0;
+		xmlFree(v);
+
+		if (match) {
+			xmlChar *label;
+
+			if ((label = xmlGetProp(cur, BAD_CAST "enumerationLabel"))) {
+				return label;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the label of the values of a condition, which are defined by its
+ * condition type. */
+static xmlChar *condition_label(const xmlChar *id, const xmlChar *values, const struct xref_tables *tables)
+{
+	int i, j;
+
+	for (i = 0; i < tables->count; ++i) {
+		for (j = 0; j < tables->count; ++j) {
+			xmlNodePtr cond, prop;
+			xmlChar *ref, *label;
+
+			cond = xref_table_definition(tables->docs[j], "cond", id);
+
+			if (!cond || !is_elem(cond, "cond")) {
+				continue;
+			}
+
+			if ((ref = xmlGetProp(cond, BAD_CAST "condTypeRefId"))) {
+				prop = xref_table_definition(tables->docs[i], "condtype", ref);
+				xmlFree(ref);
+
+				if (prop && is_elem(prop, "condType") && (label = enumeration_label(prop, values))) {
+					return label;
+				}
+			}
+
+			if ((ref = xmlGetProp(cond, BAD_CAST "condtyperef"))) {
+				prop = xref_table_definition(tables->docs[i], "cond", ref);
+				xmlFree(ref);
+
+				if (prop && is_elem(prop, "condition") && (label = enumeration_label(prop, values))) {
+					return label;
+				}
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/* Display the values of an assert. */
+static void add_property_values(xmlNodePtr para, xmlNodePtr assert, const struct xref_tables *tables)
+{
+	xmlChar *id, *type, *values, *label = NULL;
+
+	if (!(values = get_either_prop(assert, "applicPropertyValues", "actvalues"))) {
+		return;
+	}
+
+	id = get_either_prop(assert, "applicPropertyIdent", "actidref");
+	type = get_either_prop(assert, "applicPropertyType", "actreftype");
+
+	if (xmlStrcmp(type, BAD_CAST "prodattr") == 0) {
+		int i;
+
+		for (i = 0; !label && i < tables->count; ++i) {
+			xmlNodePtr prop;
+
+			if ((prop = xref_table_definition(tables->docs[i], "prodattr", id))) {
+				label = enumeration_label(prop, values);
+			}
+		}
+	} else if (xmlStrcmp(type, BAD_CAST "condition") == 0) {
+		label = condition_label(id, values, tables);
+	}
+
+	if (label) {
+		xmlNodeAddContent(para, label);
+		xmlFree(label);
+	} else {
+		xmlChar *s1, *s2;
+
+		s1 = replace_char(values, '|', dispText.set_op);
+		s2 = replace_char(s1, '~', dispText.range_op);
+		xmlNodeAddContent(para, s2);
+		xmlFree(s1);
+		xmlFree(s2);
+	}
+
+	xmlFree(id);
+	xmlFree(type);
+	xmlFree(values);
+}
+
+/* Display the parts of a rule (name, text and values). */
+static void add_rule_parts(xmlNodePtr para, xmlNodePtr rule, xmlNodePtr assert, const struct xref_tables *tables, bool literal);
+
+/* Display the values of an assert, using the rule for a specific value if one
+ * matches. */
+static void add_rule_values(xmlNodePtr para, xmlNodePtr values, xmlNodePtr assert, const struct xref_tables *tables)
+{
+	xmlNodePtr cur;
+	xmlChar *v1, *v2;
+
+	v1 = xmlGetProp(assert, BAD_CAST "applicPropertyValues");
+	v2 = xmlGetProp(assert, BAD_CAST "actvalues");
+
+	for (cur = values->children; cur; cur = cur->next) {
+		xmlChar *match;
+		bool found;
+
+		if (!is_elem(cur, "value")) {
+			continue;
+		}
+
+		match = xmlGetProp(cur, BAD_CAST "match");
+		found = (v1 && xmlStrcmp(v1, match ? match : BAD_CAST "") == 0) || (v2 && xmlStrcmp(v2, match ? match : BAD_CAST "") == 0);
+		xmlFree(match);
+
+		if (found) {
+			break;
+		}
+	}
+
+	xmlFree(v1);
+	xmlFree(v2);
+
+	if (cur) {
+		add_rule_parts(para, cur, assert, tables, true);
+	} else {
+		add_property_values(para, assert, tables);
+	}
+}
+
+/* Display the parts of a rule (name, text and values).
+ *
+ * Within a value rule, other text is also displayed literally, as when it is
+ * used in a generated XSLT template. */
+static void add_rule_parts(xmlNodePtr para, xmlNodePtr rule, xmlNodePtr assert, const struct xref_tables *tables, bool literal)
+{
+	xmlNodePtr cur;
+
+	for (cur = rule->children; cur; cur = cur->next) {
+		if (is_elem(cur, "name")) {
+			add_property_name(para, assert, tables);
+		} else if (is_elem(cur, "text")) {
+			xmlChar *s = xmlNodeGetContent(cur);
+			xmlNodeAddContent(para, s);
+			xmlFree(s);
+		} else if (is_elem(cur, "values")) {
+			add_rule_values(para, cur, assert, tables);
+		} else if (!literal) {
+			continue;
+		} else if (cur->type == XML_TEXT_NODE || cur->type == XML_CDATA_SECTION_NODE) {
+			if (!xmlIsBlankNode(cur)) {
+				xmlNodeAddContent(para, cur->content);
+			}
+		} else if (cur->type == XML_ELEMENT_NODE &&
+		           !is_elem(cur, "value") &&
+		           !is_elem(cur, "property") &&
+		           !is_elem(cur, "conditionType") &&
+		           !is_elem(cur, "productAttributes") &&
+		           !is_elem(cur, "conditions") &&
+		           !is_elem(cur, "default")) {
+			add_rule_parts(para, cur, assert, tables, true);
+		}
+	}
+}
+
+/* Test whether a condition references a given condition type in any table. */
+static bool has_cond_type(const xmlChar *id, const xmlChar *ident, const struct xref_tables *tables)
+{
+	int i;
+
+	for (i = 0; i < tables->count; ++i) {
+		xmlNodePtr cond;
+		xmlChar *ref;
+		bool match;
+
+		if (!(cond = xref_table_definition(tables->docs[i], "cond", id))) {
+			continue;
+		}
+
+		if (is_elem(cond, "cond")) {
+			ref = xmlGetProp(cond, BAD_CAST "condTypeRefId");
+		} else {
+			ref = xmlGetProp(cond, BAD_CAST "condtyperef");
+		}
+
+		match = ref && xmlStrcmp(ref, ident) == 0;
+		xmlFree(ref);
+
+		if (match) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Test whether a rule applies to an assert. */
+static bool rule_matches(xmlNodePtr rule, const xmlChar *id, const xmlChar *type, const struct xref_tables *tables)
+{
+	xmlChar *ident, *t;
+	bool match;
+
+	if (is_elem(rule, "property")) {
+		ident = xmlGetProp(rule, BAD_CAST "ident");
+		t = xmlGetProp(rule, BAD_CAST "type");
+		match = id && type &&
+			xmlStrcmp(id, ident ? ident : BAD_CAST "") == 0 &&
+			xmlStrcmp(type, t ? t : BAD_CAST "") == 0;
+		xmlFree(ident);
+		xmlFree(t);
+	} else if (is_elem(rule, "conditionType")) {
+		ident = xmlGetProp(rule, BAD_CAST "ident");
+		match = xmlStrcmp(type, BAD_CAST "condition") == 0 && id &&
+			has_cond_type(id, ident ? ident : BAD_CAST "", tables);
+		xmlFree(ident);
+	} else if (is_elem(rule, "productAttributes")) {
+		match = xmlStrcmp(type, BAD_CAST "prodattr") == 0;
+	} else if (is_elem(rule, "conditions")) {
+		match = xmlStrcmp(type, BAD_CAST "condition") == 0;
+	} else {
+		match = is_elem(rule, "default");
+	}
+
+	return match;
+}
+
+/* Display an assert using the first rule that applies to it.
+ *
+ * Rules for specific properties are tried first, then condition types, then
+ * all product attributes or conditions, and finally the default rule. */
+static void add_assert_text(xmlNodePtr para, xmlNodePtr assert, const struct xref_tables *tables)
+{
+	const char *order[][2] = {
+		{"property", NULL},
+		{"conditionType", NULL},
+		{"productAttributes", "conditions"},
+		{"default", NULL}
+	};
+	xmlChar *id, *type;
+	xmlNodePtr rule = NULL;
+	int i;
+
+	id = get_either_prop(assert, "applicPropertyIdent", "actidref");
+	type = get_either_prop(assert, "applicPropertyType", "actreftype");
+
+	for (i = 0; !rule && i < 4; ++i) {
+		xmlNodePtr cur;
+
+		for (cur = dispText.rules->children; cur; cur = cur->next) {
+			if ((is_elem(cur, order[i][0]) || (order[i][1] && is_elem(cur, order[i][1]))) && rule_matches(cur, id, type, tables)) {
+				rule = cur;
+				break;
+			}
+		}
+	}
+
+	xmlFree(id);
+	xmlFree(type);
+
+	if (rule) {
+		add_rule_parts(para, rule, assert, tables, false);
+	}
+}
+
+/* Test whether two evaluates use different operators. */
+static bool different_ops(xmlNodePtr a, xmlNodePtr b)
+{
+	const char *names[] = {"andOr", "operator"};
+	bool diff = false;
+	int i, j;
+
+	for (i = 0; !diff && i < 2; ++i) {
+		xmlChar *x;
+
+		if (!(x = xmlGetProp(a, BAD_CAST names[i]))) {
+			continue;
+		}
+
+		for (j = 0; !diff && j < 2; ++j) {
+			xmlChar *y;
+
+			if ((y = xmlGetProp(b, BAD_CAST names[j]))) {
+				diff = xmlStrcmp(x, y) != 0;
+				xmlFree(y);
+			}
+		}
+
+		xmlFree(x);
+	}
+
+	return diff;
+}
+
+/* Test whether an evaluate uses a given operator. */
+static bool has_op(xmlNodePtr evaluate, const char *op)
+{
+	xmlChar *v;
+	bool match;
+
+	v = xmlGetProp(evaluate, BAD_CAST "andOr");
+	match = xmlStrcmp(v, BAD_CAST op) == 0;
+	xmlFree(v);
+
+	if (!match) {
+		v = xmlGetProp(evaluate, BAD_CAST "operator");
+		match = xmlStrcmp(v, BAD_CAST op) == 0;
+		xmlFree(v);
+	}
+
+	return match;
+}
+
+/* Add the display text of the contents of an applicability annotation. */
+static void add_applic_text(xmlNodePtr para, xmlNodePtr node, const struct xref_tables *tables)
+{
+	xmlNodePtr cur;
+
+	if (node->type == XML_TEXT_NODE || node->type == XML_CDATA_SECTION_NODE) {
+		xmlNodeAddContent(para, node->content);
+	} else if (node->type != XML_ELEMENT_NODE) {
+		return;
+	} else if (is_elem(node, "assert")) {
+		/* An assert containing text is displayed as-is. */
+		for (cur = node->children; cur; cur = cur->next) {
+			if (cur->type == XML_TEXT_NODE || cur->type == XML_CDATA_SECTION_NODE) {
+				break;
+			}
+		}
+
+		if (cur) {
+			for (cur = node->children; cur; cur = cur->next) {
+				xmlAddChild(para, xmlDocCopyNode(cur, para->doc, 1));
+			}
+		} else {
+			add_assert_text(para, node, tables);
+		}
+	} else if (is_elem(node, "evaluate")) {
+		const xmlChar *op = NULL;
+		xmlNodePtr last = NULL;
+
+		if (has_op(node, "and")) {
+			op = dispText.and_op;
+		} else if (has_op(node, "or")) {
+			op = dispText.or_op;
+		}
+
+		for (cur = node->children; cur; cur = cur->next) {
+			bool group;
+
+			if (!is_elem(cur, "assert") && !is_elem(cur, "evaluate")) {
+				continue;
+			}
+
+			if (last && op) {
+				xmlNodeAddContent(para, op);
+			}
+
+			group = is_elem(cur, "evaluate") && different_ops(cur, node);
+
+			if (group) {
+				xmlNodeAddContent(para, dispText.open_group);
+			}
+			add_applic_text(para, cur, tables);
+			if (group) {
+				xmlNodeAddContent(para, dispText.close_group);
+			}
+
+			last = cur;
+		}
+	} else {
+		for (cur = node->children; cur; cur = cur->next) {
+			add_applic_text(para, cur, tables);
+		}
+	}
+}
+
+/* Test whether a node is part of the logic of an applicability annotation. */
+static bool is_applic_logic(xmlNodePtr node)
+{
+	return is_elem(node, "assert") || is_elem(node, "evaluate") || is_elem(node, "expression");
+}
+
+/* Test whether a node is the display text of an applicability annotation. */
+static bool is_display_text(xmlNodePtr node)
+{
+	return is_elem(node, "displayText") || is_elem(node, "displaytext");
+}
+
+/* Generate the display text of an applicability annotation.
+ *
+ * The annotation is rebuilt with its display text first, followed by its
+ * asserts, evaluates and expressions. Anything else is removed. */
+static void addApplicDisplayText(xmlNodePtr applic, const struct xref_tables *tables)
+{
+	xmlNodePtr cur, disp, para;
+	bool keep = false, alt;
+	int n = 0;
+
+	cur = applic->children;
+	while (cur) {
+		xmlNodePtr next = cur->next;
+
+		if (is_display_text(cur)) {
+			keep = !overwriteDispText;
+		} else if (!is_applic_logic(cur)) {
+			xmlUnlinkNode(cur);
+			xmlFreeNode(cur);
+			cur = next;
+			continue;
+		}
+
+		++n;
+		cur = next;
+	}
+
+	if (keep) {
+		/* Move the logic after the existing display text. */
+		for (cur = applic->children; n > 0; --n) {
+			xmlNodePtr next = cur->next;
+
+			if (is_applic_logic(cur)) {
+				xmlUnlinkNode(cur);
+				xmlAddChild(applic, cur);
+			}
+
+			cur = next;
+		}
+
+		return;
+	}
+
+	cur = applic->children;
+	while (cur) {
+		xmlNodePtr next = cur->next;
+
+		if (is_display_text(cur)) {
+			xmlUnlinkNode(cur);
+			xmlFreeNode(cur);
+		}
+
+		cur = next;
+	}
+
+	alt = is_elem(applic->parent, "status") || is_elem(applic->parent, "inlineapplics");
+
+	disp = xmlNewDocNode(applic->doc, NULL, BAD_CAST (alt ? "displaytext" : "displayText"), NULL);
+	para = xmlNewChild(disp, NULL, BAD_CAST (alt ? "p" : "simplePara"), NULL);
+
+	for (cur = applic->children; cur; cur = cur->next) {
+		add_applic_text(para, cur, tables);
+	}
+
+	if (applic->children) {
+		xmlAddPrevSibling(applic->children, disp);
+	} else {
+		xmlAddChild(applic, disp);
+	}
+}
+
+/* Generate the display text of all applicability annotations in a node. */
+static void addDisplayTextNode(xmlNodePtr node, const struct xref_tables *tables)
+{
+	xmlNodePtr cur;
+
+	for (cur = node->children; cur; cur = cur->next) {
+		if (cur->type != XML_ELEMENT_NODE) {
+			continue;
+		}
+
+		if (is_elem(cur, "applic")) {
+			xmlNodePtr c;
+
+			for (c = cur->children; c && !is_applic_logic(c); c = c->next);
+
+			if (c) {
+				addApplicDisplayText(cur, tables);
+				continue;
+			}
+		}
+
+		addDisplayTextNode(cur, tables);
+	}
+}
+
+/* Generate display text directly from the .disptext rules.
+ *
+ * This gives the same result as the XSLT generated from the rules, without
+ * copying the object and its ACTs/CCTs into a single document for each
+ * object. */
+static void buildDisplayText(xmlDocPtr doc, xmlNodePtr acts, xmlNodePtr ccts)
+{
+	struct xref_tables tables;
+	xmlDocPtr self = NULL;
+	xmlNodePtr root, cur;
+	int n;
+
+	if (!(root = xmlDocGetRootElement(doc)) || !is_elem(root, "dmodule")) {
+		return;
+	}
+
+	n = xmlChildElementCount(acts) + xmlChildElementCount(ccts) + 1;
+	tables.docs = malloc(n * sizeof(xmlDocPtr));
+	tables.count = 0;
+
+	/* Definitions in the object itself are used before those in its
+	 * ACTs/CCTs. They are read from a copy of the object, since annotations
+	 * are rebuilt as the display text is generated. */
+	if (index_xref_doc(doc)) {
+		free_xref_index(doc);
+		self = xmlCopyDoc(doc, 1);
+		index_xref_doc(self);
+		tables.docs[tables.count++] = self;
+	}
+
+	for (cur = acts->children; cur; cur = cur->next) {
+		xmlDocPtr act;
+		xmlChar *path;
+		path = xmlNodeGetContent(cur);
+		if ((act = read_xref_table((char *) path))) {
+			tables.docs[tables.count++] = act;
+		}
+		xmlFree(path);
+	}
+	for (cur = ccts->children; cur; cur = cur->next) {
+		xmlDocPtr cct;
+		xmlChar *path;
+		path = xmlNodeGetContent(cur);
+		if ((cct = read_xref_table((char *) path))) {
+			tables.docs[tables.count++] = cct;
+		}
+		xmlFree(path);
+	}
+
+	addDisplayTextNode(root, &tables);
+
+	if (self) {
+		free_xref_index(self);
+		xmlFreeDoc(self);
+	}
+
+	free(tables.docs);
+}
+
+/* Read the settings for generating display text. */
+static void readDispText(xmlDocPtr config, const char *fmt)
+{
+	xmlNodePtr root, ops;
+
+	root = xmlDocGetRootElement(config);
+
+	if (root && is_elem(root, "disptext")) {
+		ops = firstXPathNode(config, NULL, "/disptext/operators");
+		dispText.rules = root;
+	} else {
+		ops = NULL;
+		dispText.rules = xmlNewNode(NULL, BAD_CAST "disptext");
+		dispText.format = xmlNewDoc(BAD_CAST "1.0");
+		xmlDocSetRootElement(dispText.format, dispText.rules);
+	}
+
+	if (ops) {
+		dispText.and_op      = first_child_value(ops, "and");
+		dispText.or_op       = first_child_value(ops, "or");
+		dispText.open_group  = first_child_value(ops, "openGroup");
+		dispText.close_group = first_child_value(ops, "closeGroup");
+		dispText.set_op      = first_child_value(ops, "set");
+		dispText.range_op    = first_child_value(ops, "range");
+	}
+
+	if (!dispText.and_op)      dispText.and_op      = xmlStrdup(BAD_CAST "");
+	if (!dispText.or_op)       dispText.or_op       = xmlStrdup(BAD_CAST "");
+	if (!dispText.open_group)  dispText.open_group  = xmlStrdup(BAD_CAST "");
+	if (!dispText.close_group) dispText.close_group = xmlStrdup(BAD_CAST "");
+	if (!dispText.set_op)      dispText.set_op      = xmlStrdup(BAD_CAST "");
+	if (!dispText.range_op)    dispText.range_op    = xmlStrdup(BAD_CAST "");
+
+	/* A format string replaces all rules with a single default rule. */
+	if (fmt) {
+		xmlNodePtr rule;
+		int i;
+
+		xmlFreeDoc(dispText.format);
+		dispText.format = xmlNewDoc(BAD_CAST "1.0");
+		dispText.rules = xmlNewNode(NULL, BAD_CAST "disptext");
+		xmlDocSetRootElement(dispText.format, dispText.rules);
+		rule = xmlNewChild(dispText.rules, NULL, BAD_CAST "default", NULL);
+
+		for (i = 0; fmt[i]; ++i) {
+			xmlChar s[2] = {0};
+
+			if (fmt[i] == FMTSTR_DELIM) {
+				if (fmt[i + 1] == FMTSTR_DELIM) {
+					s[0] = FMTSTR_DELIM;
+					xmlNewTextChild(rule, NULL, BAD_CAST "text", s);
+					++i;
+				} else {
+					const char *k, *e;
+					int n;
+
+					k = fmt + i + 1;
+					e = strchr(k, FMTSTR_DELIM);
+					if (!e) break;
+					n = e - k;
+
+					if (strncmp(k, "name", n) == 0) {
+						xmlNewChild(rule, NULL, BAD_CAST "name", NULL);
+					} else if (strncmp(k, "values", n) == 0) {
+						xmlNewChild(rule, NULL, BAD_CAST "values", NULL);
+					}
+
+					i += n + 1;
+				}
+			} else {
+				if (fmt[i] == '\\') {
+					switch (fmt[i + 1]) {
+						case 'n': s[0] = '\n'; ++i; break;
+						case 't': s[0] = '\t'; ++i; break;
+						default: s[0] = fmt[i]; break;
+					}
+				} else {
+					s[0] = fmt[i];
+				}
+				xmlNewTextChild(rule, NULL, BAD_CAST "text", s);
+			}
+		}
+	}
+}
+
+/* Free the settings for generating display text. */
+static void freeDispText(void)
+{
+	xmlFree(dispText.and_op);
+	xmlFree(dispText.or_op);
+	xmlFree(dispText.open_group);
+	xmlFree(dispText.close_group);
+	xmlFree(dispText.set_op);
+	xmlFree(dispText.range_op);
+	xmlFreeDoc(dispText.format);
+}
+
 static void processDmodule(xmlNodePtr dmodule)
 {
 	xmlXPathContextPtr ctx;
@@ -541,7 +1323,7 @@ static void find_cross_ref_tables(xmlDocPtr doc, xmlNodePtr acts, xmlNodePtr cct
 	char act_fname[PATH_MAX];
 	xmlDocPtr act = NULL;
 
-	if (find_act_fname(act_fname, doc) && (act = read_xml_doc(act_fname))) {
+	if (find_act_fname(act_fname, doc) && (act = read_xref_table(act_fname))) {
 		char cct_fname[PATH_MAX];
 
 		xmlNewChild(acts, NULL, BAD_CAST "act", BAD_CAST act_fname);
@@ -549,8 +1331,6 @@ static void find_cross_ref_tables(xmlDocPtr doc, xmlNodePtr acts, xmlNodePtr cct
 		if (find_cct_fname(cct_fname, act)) {
 			xmlNewChild(ccts, NULL, BAD_CAST "cct", BAD_CAST cct_fname);
 		}
-
-		xmlFreeDoc(act);
 	}
 }
 
@@ -657,7 +1437,11 @@ static void processFile(const char *in, const char *out, bool process,
 	if (delDispText) {
 		deleteDisplayText(doc);
 	} else if (genDispText) {
-		generateDisplayText(doc, all_acts, all_ccts, style);
+		if (style) {
+			generateDisplayText(doc, all_acts, all_ccts, style);
+		} else {
+			buildDisplayText(doc, all_acts, all_ccts);
+		}
 	}
 
 	if (tags) {
@@ -757,7 +1541,7 @@ int main(int argc, char **argv)
 	char *customGenDispTextFile = NULL;
 	xmlDocPtr disptext = NULL;
 	xmlDocPtr styledoc;
-	xsltStylesheetPtr style;
+	xsltStylesheetPtr style = NULL;
 	
 	xmlNodePtr acts, ccts;
 
@@ -903,16 +1687,16 @@ int main(int argc, char **argv)
 			}
 		}
 
-		styledoc = parse_disptext(disptext);
+		readDispText(disptext, format);
 	} else {
 		styledoc = read_xml_doc(customGenDispTextFile);
-	}
 
-	addIdentity(styledoc);
-	if (format) {
-		apply_format_str(styledoc, format);
+		addIdentity(styledoc);
+		if (format) {
+			apply_format_str(styledoc, format);
+		}
+		style = xsltParseStylesheetDoc(styledoc);
 	}
-	style = xsltParseStylesheetDoc(styledoc);
 
 	if (optind >= argc) {
 		if (islist) {
@@ -935,11 +1719,13 @@ int main(int argc, char **argv)
 
 	xmlFreeNode(acts);
 	xmlFreeNode(ccts);
+	free_xref_tables();
 
 	free(customGenDispTextFile);
 	free(search_dir);
 	free(format);
 	free(tags);
+	freeDispText();
 	xmlFreeDoc(disptext);
 	xsltFreeStylesheet(style);
 
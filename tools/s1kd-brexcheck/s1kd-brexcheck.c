@@ -16,6 +16,7 @@
 
 #include "brex.h"
 #include "s1kd_tools.h"
+#include "s1kd_dirwalk.h"
 
 #define STRUCT_OBJ_RULE_PATH \
 	"//contextRules[not(@rulesContext) or @rulesContext='%s']//structureObjectRule|" \
@@ -25,7 +26,7 @@
 #define XSI_URI BAD_CAST "http://www.w3.org/2001/XMLSchema-instance"
 
 #define PROG_NAME "s1kd-brexcheck"
-#define VERSION "3.6.8"
+#define VERSION "3.8.0"
 
 /* Prefixes on console messages. */
 #define E_PREFIX PROG_NAME ": ERROR: "
@@ -152,98 +153,94 @@ static xmlChar *firstXPathValue(xmlNodePtr node, const char *expr)
 	return xmlNodeGetContent(firstXPathNode(NULL, node, expr));
 }
 
+/* A value allowed for the objects of a BREX rule. */
+struct brex_value {
+	xmlChar *allowed;
+	xmlChar *form;
+};
+
+/* A BREX context rule, with its object path compiled so that it can be
+ * checked against any number of CSDB objects.
+ */
+struct brex_rule {
+	xmlNodePtr node;
+	xmlNodePtr brDecisionRef;
+	xmlNodePtr objectPath;
+	xmlChar *allowedObjectFlag;
+	xmlChar *path;
+	xmlChar *use;
+	xmlChar *severity;
+	xmlChar *context;
+	xmlXPathCompExprPtr expr;
+	struct brex_value *values;
+	int nvalues;
+};
+
+/* The context rules of a BREX DM. */
+struct brex_rules {
+	xmlChar *defaultBrSeverityLevel;
+	struct brex_rule *rules;
+	int nrules;
+};
+
 /* Check the values of objects against the patterns in the BREX rule. */
-static bool check_node_values(xmlNodePtr node, xmlNodeSetPtr values)
+static bool check_node_values(xmlNodePtr node, struct brex_rule *rule)
 {
 	int i;
 	bool ret = false;
+	xmlChar *value;
 
-	if (xmlXPathNodeSetIsEmpty(values))
+	if (rule->nvalues == 0)
 		return true;
 
-	for (i = 0; i < values->nodeNr; ++i) {
-		xmlChar *allowed, *value, *form;
+	value = xmlNodeGetContent(node);
 
-		allowed = firstXPathValue(values->nodeTab[i], "@valueAllowed|@val1");
-		form    = firstXPathValue(values->nodeTab[i], "@valueForm|@valtype");
-		value   = xmlNodeGetContent(node);
+	for (i = 0; i < rule->nvalues && !ret; ++i) {
+		xmlChar *allowed = rule->values[i].allowed;
+		xmlChar *form    = rule->values[i].form;
 
 		if (form && xmlStrcmp(form, BAD_CAST "range") == 0) {
-			ret = ret || is_in_set((char *) value, (char *) allowed);
+			ret = is_in_set((char *) value, (char *) allowed);
 		} else if (form && xmlStrcmp(form, BAD_CAST "pattern") == 0) {
-			ret = ret || match_pattern(value, allowed);
+			ret = match_pattern(value, allowed);
 		} else {
-			ret = ret || xmlStrcmp(value, allowed) == 0;
+			ret = xmlStrcmp(value, allowed) == 0;
 		}
-
-		xmlFree(allowed);
-		xmlFree(form);
-		xmlFree(value);
 	}
 
+	xmlFree(value);
+
 	return ret;
 }
 
 /* Check an individual node's value against a rule. */
-static bool check_single_object_values(xmlNodePtr rule, xmlNodePtr node)
+static bool check_single_object_values(struct brex_rule *rule, xmlNodePtr node)
 {
-	xmlXPathContextPtr ctx;
-	xmlXPathObjectPtr obj;
-	bool ret;
-
-	ctx = xmlXPathNewContext(rule->doc);
-	ctx->node = rule;
-
-	obj = xmlXPathEvalExpression(BAD_CAST "objectValue|objval", ctx);
-
-	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		ret = check_node_values(node, obj->nodesetval);
-	} else {
-		ret = false;
-	}
-
-	xmlXPathFreeObject(obj);
-	xmlXPathFreeContext(ctx);
-
-	return ret;
+	return rule->nvalues != 0 && check_node_values(node, rule);
 }
 
 /* Check the values of a set of nodes against a rule. */
-static bool check_objects_values(xmlNodePtr rule, xmlNodeSetPtr nodes)
+static bool check_objects_values(struct brex_rule *rule, xmlNodeSetPtr nodes)
 {
-	xmlXPathContextPtr ctx;
-	xmlXPathObjectPtr obj;
-	bool ret = true;
+	int i;
 
 	if (xmlXPathNodeSetIsEmpty(nodes))
 		return true;
 
-	ctx = xmlXPathNewContext(rule->doc);
-	ctx->node = rule;
-
-	obj = xmlXPathEvalExpression(BAD_CAST "objectValue|objval", ctx);
-
-	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		int i;
-
-		for (i = 0; i < nodes->nodeNr; ++i) {
-			if (!check_node_values(nodes->nodeTab[i], obj->nodesetval)) {
-				ret = false;
-				break;
-			}
+	for (i = 0; i < nodes->nodeNr; ++i) {
+		if (!check_node_values(nodes->nodeTab[i], rule)) {
+			return false;
 		}
 	}
 
-	xmlXPathFreeObject(obj);
-	xmlXPathFreeContext(ctx);
-
-	return ret;
+	return true;
 }
 
 /* Determine whether a BREX context rule is violated. */
-static bool is_invalid(xmlNodePtr rule, char *allowedObjectFlag, xmlXPathObjectPtr obj, struct opts *opts)
+static bool is_invalid(struct brex_rule *rule, xmlXPathObjectPtr obj, struct opts *opts)
 {
 	bool invalid = false;
+	char *allowedObjectFlag = (char *) rule->allowedObjectFlag;
 
 	if (allowedObjectFlag) {
 		if (strcmp(allowedObjectFlag, "0") == 0) {
@@ -268,7 +265,7 @@ static bool is_invalid(xmlNodePtr rule, char *allowedObjectFlag, xmlXPathObjectP
 }
 
 /* Dump the XML branches that violate a given BREX context rule. */
-static void dump_nodes_xml(xmlNodeSetPtr nodes, const char *fname, xmlNodePtr brexError, xmlNodePtr rule, struct opts *opts)
+static void dump_nodes_xml(xmlNodeSetPtr nodes, const char *fname, xmlNodePtr brexError, struct brex_rule *rule, struct opts *opts)
 {
 	int i;
 
@@ -314,20 +311,9 @@ static bool search_brex_fname_from_default_brex(char *fname, char *dmcode, int l
 		strcpy(fname, dmcode);
 }
 
-/* Find the filename of a BREX data module referenced by a CSDB object.
- * -1  Object does not reference a BREX DM.
- *  0  Object references a BREX DM, and it was found.
- *  1  Object references a BREX DM, but it couldn't be found.
- */
-static int find_brex_fname_from_doc(char *fname, xmlDocPtr doc, char (*spaths)[PATH_MAX],
-	int nspaths, char (*dmod_fnames)[PATH_MAX], int num_dmod_fnames,
-	struct opts *opts)
+/* Write the data module code of a dmCode (or avee) element to a string. */
+static void dmcode_string(char *dst, int n, xmlNodePtr dmCode)
 {
-	xmlXPathContextPtr context;
-	xmlXPathObjectPtr object;
-
-	xmlNodePtr dmCode;
-
 	char *modelIdentCode;
 	char *systemDiffCode;
 	char *systemCode;
@@ -340,26 +326,6 @@ static int find_brex_fname_from_doc(char *fname, xmlDocPtr doc, char (*spaths)[P
 	char *infoCodeVariant;
 	char *itemLocationCode;
 
-	char dmcode[256];
-	int len;
-
-	bool found;
-
-	context = xmlXPathNewContext(doc);
-
-	object = xmlXPathEvalExpression(BREX_REF_DMCODE_PATH, context);
-
-	if (xmlXPathNodeSetIsEmpty(object->nodesetval)) {
-		xmlXPathFreeObject(object);
-		xmlXPathFreeContext(context);
-		return -1;
-	}
-
-	dmCode = object->nodesetval->nodeTab[0];
-
-	xmlXPathFreeObject(object);
-	xmlXPathFreeContext(context);
-
 	if (xmlStrcmp(dmCode->name, BAD_CAST "dmCode") == 0) {
 		modelIdentCode     = (char *) xmlGetProp(dmCode, BAD_CAST "modelIdentCode");
 		systemDiffCode     = (char *) xmlGetProp(dmCode, BAD_CAST "systemDiffCode");
@@ -386,7 +352,7 @@ static int find_brex_fname_from_doc(char *fname, xmlDocPtr doc, char (*spaths)[P
 		itemLocationCode   = (char *) firstXPathValue(dmCode, "itemloc");
 	}
 
-	snprintf(dmcode, 256, "DMC-%s-%s-%s-%s%s-%s-%s%s-%s%s-%s",
+	snprintf(dst, n, "DMC-%s-%s-%s-%s%s-%s-%s%s-%s%s-%s",
 		modelIdentCode,
 		systemDiffCode,
 		systemCode,
@@ -410,6 +376,43 @@ static int find_brex_fname_from_doc(char *fname, xmlDocPtr doc, char (*spaths)[P
 	xmlFree(infoCode);
 	xmlFree(infoCodeVariant);
 	xmlFree(itemLocationCode);
+}
+
+/* Find the filename of a BREX data module referenced by a CSDB object.
+ * -1  Object does not reference a BREX DM.
+ *  0  Object references a BREX DM, and it was found.
+ *  1  Object references a BREX DM, but it couldn't be found.
+ */
+static int find_brex_fname_from_doc(char *fname, xmlDocPtr doc, char (*spaths)[PATH_MAX],
+	int nspaths, char (*dmod_fnames)[PATH_MAX], int num_dmod_fnames,
+	struct opts *opts)
+{
+	xmlXPathContextPtr context;
+	xmlXPathObjectPtr object;
+
+	xmlNodePtr dmCode;
+
+	char dmcode[256];
+	int len;
+
+	bool found;
+
+	context = xmlXPathNewContext(doc);
+
+	object = xmlXPathEvalExpression(BREX_REF_DMCODE_PATH, context);
+
+	if (xmlXPathNodeSetIsEmpty(object->nodesetval)) {
+		xmlXPathFreeObject(object);
+		xmlXPathFreeContext(context);
+		return -1;
+	}
+
+	dmCode = object->nodesetval->nodeTab[0];
+
+	xmlXPathFreeObject(object);
+	xmlXPathFreeContext(context);
+
+	dmcode_string(dmcode, 256, dmCode);
 
 	len = strlen(dmcode);
 
@@ -642,123 +645,226 @@ static void print_node(xmlNodePtr node)
 	}
 }
 
-/* Check the context rules of a BREX DM against a CSDB object. */
-static int check_brex_rules(xmlDocPtr brex_doc, xmlNodeSetPtr rules, xmlDocPtr doc, const char *fname,
+/* Compile a set of context rules from a BREX DM. */
+static void compile_brex_rules(struct brex_rules *compiled, xmlDocPtr brex_doc, xmlNodeSetPtr rules)
+{
+	int i;
+
+	compiled->defaultBrSeverityLevel = xmlGetProp(firstXPathNode(brex_doc, NULL, "//brex"), BAD_CAST "defaultBrSeverityLevel");
+	compiled->nrules = 0;
+
+	if (xmlXPathNodeSetIsEmpty(rules)) {
+		compiled->rules = NULL;
+		return;
+	}
+
+	compiled->rules = malloc(rules->nodeNr * sizeof(struct brex_rule));
+
+	for (i = 0; i < rules->nodeNr; ++i) {
+		struct brex_rule *rule = &compiled->rules[compiled->nrules++];
+		xmlXPathContextPtr ctx;
+		xmlXPathObjectPtr obj;
+		xmlNodePtr context;
+
+		rule->node = rules->nodeTab[i];
+		rule->brDecisionRef = firstXPathNode(brex_doc, rule->node, "brDecisionRef");
+		rule->objectPath = firstXPathNode(brex_doc, rule->node, "objectPath|objpath");
+		rule->allowedObjectFlag = firstXPathValue(rule->objectPath, "@allowedObjectFlag|@objappl");
+		rule->path = xmlNodeGetContent(rule->objectPath);
+		rule->use = xmlNodeGetContent(firstXPathNode(brex_doc, rule->node, "objectUse|objuse"));
+		rule->severity = xmlGetProp(rule->node, BAD_CAST "brSeverityLevel");
+		rule->expr = rule->path ? xmlXPathCompile(rule->path) : NULL;
+
+		if ((context = firstXPathNode(brex_doc, rule->node, "ancestor::contextRules[1]|ancestor::contextrules[1]"))) {
+			rule->context = firstXPathValue(context, "@rulesContext|@context");
+		} else {
+			rule->context = NULL;
+		}
+
+		ctx = xmlXPathNewContext(brex_doc);
+		ctx->node = rule->node;
+		obj = xmlXPathEvalExpression(BAD_CAST "objectValue|objval", ctx);
+
+		if (xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
+			rule->values = NULL;
+			rule->nvalues = 0;
+		} else {
+			int j;
+
+			rule->nvalues = obj->nodesetval->nodeNr;
+			rule->values = malloc(rule->nvalues * sizeof(struct brex_value));
+
+			for (j = 0; j < rule->nvalues; ++j) {
+				rule->values[j].allowed = firstXPathValue(obj->nodesetval->nodeTab[j], "@valueAllowed|@val1");
+				rule->values[j].form    = firstXPathValue(obj->nodesetval->nodeTab[j], "@valueForm|@valtype");
+			}
+		}
+
+		xmlXPathFreeObject(obj);
+		xmlXPathFreeContext(ctx);
+	}
+}
+
+/* Free a set of compiled context rules. */
+static void free_brex_rules(struct brex_rules *compiled)
+{
+	int i;
+
+	for (i = 0; i < compiled->nrules; ++i) {
+		struct brex_rule *rule = &compiled->rules[i];
+		int j;
+
+		xmlFree(rule->allowedObjectFlag);
+		xmlFree(rule->path);
+		xmlFree(rule->use);
+		xmlFree(rule->severity);
+		xmlFree(rule->context);
+		xmlXPathFreeCompExpr(rule->expr);
+
+		for (j = 0; j < rule->nvalues; ++j) {
+			xmlFree(rule->values[j].allowed);
+			xmlFree(rule->values[j].form);
+		}
+
+		free(rule->values);
+	}
+
+	free(compiled->rules);
+	xmlFree(compiled->defaultBrSeverityLevel);
+}
+
+/* Check compiled context rules against a CSDB object.
+ *
+ * If by_context is true, rules are skipped when their context does not match
+ * the schema of the object. Otherwise, all the rules are checked.
+ *
+ * The compiled rules and the BREX DM they came from are only read, so they can
+ * be used by several threads at once.
+ */
+static int check_compiled_brex_rules(struct brex_rules *compiled, bool by_context, xmlDocPtr doc, const char *fname,
 	const char *brexfname, xmlNodePtr documentNode, struct opts *opts)
 {
 	xmlXPathContextPtr context;
 	xmlXPathObjectPtr object;
-	xmlChar *defaultBrSeverityLevel;
+	xmlChar *schema = NULL;
 	int nerr = 0;
+	int i;
 	xmlNodePtr brexNode, brexError;
 
 	context = xmlXPathNewContext(doc);
 	xmlXPathRegisterNs(context, BAD_CAST "xsi", XSI_URI);
 
-	defaultBrSeverityLevel = xmlGetProp(firstXPathNode(brex_doc, NULL, "//brex"), BAD_CAST "defaultBrSeverityLevel");
+	if (by_context) {
+		schema = xmlGetProp(xmlDocGetRootElement(doc), BAD_CAST "noNamespaceSchemaLocation");
+	}
 
 	brexNode = xmlNewChild(documentNode, NULL, BAD_CAST "brex", NULL);
 	xmlSetProp(brexNode, BAD_CAST "path", BAD_CAST brexfname);
 
-	if (!xmlXPathNodeSetIsEmpty(rules)) {
-		int i;
+	for (i = 0; i < compiled->nrules; ++i) {
+		struct brex_rule *rule = &compiled->rules[i];
 
-		for (i = 0; i < rules->nodeNr; ++i) {
-			xmlNodePtr brDecisionRef, objectPath, objectUse;
-			xmlChar *allowedObjectFlag, *path, *use, *brdp;
-
-			brDecisionRef = firstXPathNode(brex_doc, rules->nodeTab[i], "brDecisionRef");
-			objectPath = firstXPathNode(brex_doc, rules->nodeTab[i], "objectPath|objpath");
-			objectUse  = firstXPathNode(brex_doc, rules->nodeTab[i], "objectUse|objuse");
+		if (by_context && rule->context && (!schema || xmlStrcmp(rule->context, schema) != 0)) {
+			continue;
+		}
 
-			brdp = xmlGetProp(brDecisionRef, BAD_CAST "brDecisionIdentNumber");
-			allowedObjectFlag = firstXPathValue(objectPath, "@allowedObjectFlag|@objappl");
-			path = xmlNodeGetContent(objectPath);
-			use  = xmlNodeGetContent(objectUse);
+		if (!rule->expr || !(object = xmlXPathCompiledEval(rule->expr, context))) {
+			if (opts->verbosity > SILENT) {
+				fprintf(stderr, E_INVOBJPATH, brexfname, xmlGetLineNo(rule->objectPath), rule->path);
+			}
 
-			object = xmlXPathEvalExpression(path, context);
+#ifdef LIBS1KD
+			/* The library must not end the calling process, so
+			 * count the rule as an error and carry on. */
+			++nerr;
+			continue;
+#else
+			exit(EXIT_INVALID_OBJ_PATH);
+#endif
+		}
 
-			if (!object) {
-				if (opts->verbosity > SILENT) {
-					fprintf(stderr, E_INVOBJPATH, brexfname, xmlGetLineNo(objectPath), path);
-				}
+		if (is_invalid(rule, object, opts)) {
+			xmlChar *severity;
+			xmlNodePtr err_path;
 
-				exit(EXIT_INVALID_OBJ_PATH);
+			if (rule->severity) {
+				severity = rule->severity;
+			} else {
+				severity = compiled->defaultBrSeverityLevel;
 			}
 
-			if (is_invalid(rules->nodeTab[i], (char *) allowedObjectFlag, object, opts)) {
-				xmlChar *severity;
-				xmlNodePtr err_path;
-
-				if (!(severity = xmlGetProp(rules->nodeTab[i], BAD_CAST "brSeverityLevel"))) {
-					severity = xmlStrdup(defaultBrSeverityLevel);
-				}
-
-				brexError = xmlNewChild(brexNode, NULL, BAD_CAST "error", NULL);
+			brexError = xmlNewChild(brexNode, NULL, BAD_CAST "error", NULL);
 
-				if (severity) {
-					xmlSetProp(brexError, BAD_CAST "brSeverityLevel", severity);
+			if (severity) {
+				xmlSetProp(brexError, BAD_CAST "brSeverityLevel", severity);
 
-					if (brsl_fname) {
-						xmlChar *type = brsl_type(severity);
-						xmlNewChild(brexError, NULL, BAD_CAST "type", type);
-						xmlFree(type);
-					}
-				} else {
-					xmlSetProp(brexError, BAD_CAST "fail", BAD_CAST "yes");
+				if (brsl_fname) {
+					xmlChar *type = brsl_type(severity);
+					xmlNewChild(brexError, NULL, BAD_CAST "type", type);
+					xmlFree(type);
 				}
+			} else {
+				xmlSetProp(brexError, BAD_CAST "fail", BAD_CAST "yes");
+			}
 
-				if (brDecisionRef) {
-					xmlAddChild(brexError, xmlCopyNode(brDecisionRef, 1));
-				}
+			if (rule->brDecisionRef) {
+				xmlAddChild(brexError, xmlCopyNode(rule->brDecisionRef, 1));
+			}
 
-				err_path = xmlNewChild(brexError, NULL, BAD_CAST "objectPath", path);
-				xmlSetProp(err_path, BAD_CAST "allowedObjectFlag", allowedObjectFlag);
-				xmlNewChild(brexError, NULL, BAD_CAST "objectUse", use);
+			err_path = xmlNewChild(brexError, NULL, BAD_CAST "objectPath", rule->path);
+			xmlSetProp(err_path, BAD_CAST "allowedObjectFlag", rule->allowedObjectFlag);
+			xmlNewChild(brexError, NULL, BAD_CAST "objectUse", rule->use);
 
-				add_object_values(brexError, rules->nodeTab[i]);
+			add_object_values(brexError, rule->node);
 
-				if (!xmlXPathNodeSetIsEmpty(object->nodesetval)) {
-					dump_nodes_xml(object->nodesetval, fname,
-						brexError, rules->nodeTab[i],
-						opts);
-				}
+			if (!xmlXPathNodeSetIsEmpty(object->nodesetval)) {
+				dump_nodes_xml(object->nodesetval, fname,
+					brexError, rule,
+					opts);
+			}
 
-				if (severity) {
-					if (is_failure(severity)) {
-						++nerr;
-					} else {
-						xmlSetProp(brexError, BAD_CAST "fail", BAD_CAST "no");
-					}
-				} else {
+			if (severity) {
+				if (is_failure(severity)) {
 					++nerr;
+				} else {
+					xmlSetProp(brexError, BAD_CAST "fail", BAD_CAST "no");
 				}
-
-				xmlFree(severity);
-
-				if (opts->verbosity > SILENT) {
-					print_node(brexError);
-				}
+			} else {
+				++nerr;
 			}
 
-			xmlXPathFreeObject(object);
-			xmlFree(brdp);
-			xmlFree(allowedObjectFlag);
-			xmlFree(path);
-			xmlFree(use);
+			if (opts->verbosity > SILENT) {
+				print_node(brexError);
+			}
 		}
+
+		xmlXPathFreeObject(object);
 	}
 
 	if (!brexNode->children) {
 		xmlNewChild(brexNode, NULL, BAD_CAST "noErrors", NULL);
 	}
 
-	xmlFree(defaultBrSeverityLevel);
+	xmlFree(schema);
 	xmlXPathFreeContext(context);
 
 	return nerr;
 }
 
+/* Check the context rules of a BREX DM against a CSDB object. */
+static int check_brex_rules(xmlDocPtr brex_doc, xmlNodeSetPtr rules, xmlDocPtr doc, const char *fname,
+	const char *brexfname, xmlNodePtr documentNode, struct opts *opts)
+{
+	struct brex_rules compiled;
+	int nerr;
+
+	compile_brex_rules(&compiled, brex_doc, rules);
+	nerr = check_compiled_brex_rules(&compiled, false, doc, fname, brexfname, documentNode, opts);
+	free_brex_rules(&compiled);
+
+	return nerr;
+}
+
 /* Load a BREX DM from the filesystem or from in-memory. */
 static xmlDocPtr load_brex(const char *name, xmlDocPtr dmod_doc)
 {
@@ -1341,7 +1447,7 @@ static void init_opts(struct opts *opts, int options)
 	opts->check_notations = optset(options, S1KD_BREXCHECK_NOTATIONS);
 }
 
-int s1kdDocCheckDefaultBREX(xmlDocPtr doc, int options, xmlDocPtr *report)
+int s1kdCtxDocCheckDefaultBREX(const s1kdContext *s1kdctx, xmlDocPtr doc, int options, xmlDocPtr *report)
 {
 	int err;
 	xmlDocPtr brex;
@@ -1368,7 +1474,7 @@ int s1kdDocCheckDefaultBREX(xmlDocPtr doc, int options, xmlDocPtr *report)
 	ctx = xmlXPathNewContext(brex);
 	obj = xmlXPathEvalExpression(BAD_CAST "//structureObjectRule", ctx);
 
-	err = check_brex_rules(brex, obj->nodesetval, doc, doc->URL, brex_dmc, node, &opts);
+	err = check_brex_rules(brex, obj->nodesetval, doc, (char *) doc->URL, brex_dmc, node, &opts);
 
 	xmlXPathFreeObject(obj);
 	xmlXPathFreeContext(ctx);
@@ -1383,13 +1489,18 @@ int s1kdDocCheckDefaultBREX(xmlDocPtr doc, int options, xmlDocPtr *report)
 	return err;
 }
 
-int s1kdCheckDefaultBREX(const char *object_xml, int object_size, int options, char **report_xml, int *report_size)
+int s1kdDocCheckDefaultBREX(xmlDocPtr doc, int options, xmlDocPtr *report)
+{
+	return s1kdCtxDocCheckDefaultBREX(NULL, doc, options, report);
+}
+
+int s1kdCtxCheckDefaultBREX(const s1kdContext *ctx, const char *object_xml, int object_size, int options, char **report_xml, int *report_size)
 {
 	xmlDocPtr doc, rep;
 	int err;
 
-	doc = read_xml_mem(object_xml, object_size);
-	err = s1kdDocCheckDefaultBREX(doc, options, &rep);
+	doc = read_xml_mem_ctx(ctx, object_xml, object_size);
+	err = s1kdCtxDocCheckDefaultBREX(ctx, doc, options, &rep);
 	xmlFreeDoc(doc);
 
 	if (report_xml && report_size) {
@@ -1400,7 +1511,12 @@ int s1kdCheckDefaultBREX(const char *object_xml, int object_size, int options, c
 	return err;
 }
 
-int s1kdDocCheckBREX(xmlDocPtr doc, xmlDocPtr brex, int options, xmlDocPtr *report)
+int s1kdCheckDefaultBREX(const char *object_xml, int object_size, int options, char **report_xml, int *report_size)
+{
+	return s1kdCtxCheckDefaultBREX(NULL, object_xml, object_size, options, report_xml, report_size);
+}
+
+int s1kdCtxDocCheckBREX(const s1kdContext *s1kdctx, xmlDocPtr doc, xmlDocPtr brex, int options, xmlDocPtr *report)
 {
 	int err = 0;
 	xmlDocPtr rep;
@@ -1429,7 +1545,9 @@ int s1kdDocCheckBREX(xmlDocPtr doc, xmlDocPtr brex, int options, xmlDocPtr *repo
 		xmlDocSetRootElement(snsRulesDoc, snsRulesGroup);
 		xmlAddChild(snsRulesGroup, xmlCopyNode(firstXPathNode(brex, NULL, "//snsRules"), 1));
 
-		err += check_brex_sns_rules(snsRulesDoc, snsRulesGroup, doc, node, &opts);
+		if (!check_brex_sns_rules(snsRulesDoc, snsRulesGroup, doc, node, &opts)) {
+			++err;
+		}
 
 		xmlFreeDoc(snsRulesDoc);
 	}
@@ -1446,7 +1564,7 @@ int s1kdDocCheckBREX(xmlDocPtr doc, xmlDocPtr brex, int options, xmlDocPtr *repo
 		xmlFreeDoc(notationRulesDoc);
 	}
 
-	err += check_brex_rules(brex, obj->nodesetval, doc, doc->URL, brex->URL, node, &opts);
+	err += check_brex_rules(brex, obj->nodesetval, doc, (char *) doc->URL, (char *) brex->URL, node, &opts);
 
 	xmlXPathFreeObject(obj);
 	xmlXPathFreeContext(ctx);
@@ -1460,14 +1578,19 @@ int s1kdDocCheckBREX(xmlDocPtr doc, xmlDocPtr brex, int options, xmlDocPtr *repo
 	return err;
 }
 
-int s1kdCheckBREX(const char *object_xml, int object_size, const char *brex_xml, int brex_size, int options, char **report_xml, int *report_size)
+int s1kdDocCheckBREX(xmlDocPtr doc, xmlDocPtr brex, int options, xmlDocPtr *report)
+{
+	return s1kdCtxDocCheckBREX(NULL, doc, brex, options, report);
+}
+
+int s1kdCtxCheckBREX(const s1kdContext *ctx, const char *object_xml, int object_size, const char *brex_xml, int brex_size, int options, char **report_xml, int *report_size)
 {
 	xmlDocPtr doc, brex, rep;
 	int err;
 
-	doc = read_xml_mem(object_xml, object_size);
-	brex = read_xml_mem(brex_xml, brex_size);
-	err = s1kdDocCheckBREX(doc, brex, options, &rep);
+	doc = read_xml_mem_ctx(ctx, object_xml, object_size);
+	brex = read_xml_mem_ctx(ctx, brex_xml, brex_size);
+	err = s1kdCtxDocCheckBREX(ctx, doc, brex, options, &rep);
 	xmlFreeDoc(doc);
 	xmlFreeDoc(brex);
 
@@ -1478,7 +1601,399 @@ int s1kdCheckBREX(const char *object_xml, int object_size, const char *brex_xml,
 
 	return err;
 }
+
+int s1kdCheckBREX(const char *object_xml, int object_size, const char *brex_xml, int brex_size, int options, char **report_xml, int *report_size)
+{
+	return s1kdCtxCheckBREX(NULL, object_xml, object_size, brex_xml, brex_size, options, report_xml, report_size);
+}
+
+/* A BREX DM in a compiled BREX. */
+struct brex_layer {
+	xmlDocPtr doc;
+	char dmcode[256];
+	struct brex_rules rules;
+};
+
+struct _s1kdBREX {
+	struct brex_layer *layers;
+	int nlayers;
+	xmlDocPtr snsRulesDoc;
+	xmlDocPtr notationRuleDoc;
+};
+typedef struct _s1kdBREX *s1kdBREXPtr;
+
+s1kdBREXPtr s1kdNewBREX(void)
+{
+	s1kdBREXPtr brex;
+
+	xmlInitParser();
+
+	if (!(brex = malloc(sizeof(struct _s1kdBREX)))) {
+		return NULL;
+	}
+
+	brex->layers = NULL;
+	brex->nlayers = 0;
+
+	/* The valid SNS and notations are taken as a combination of the rules
+	 * from all layers, as in check_brex_sns and check_brex_notations. */
+	brex->snsRulesDoc = xmlNewDoc(BAD_CAST "1.0");
+	xmlDocSetRootElement(brex->snsRulesDoc, xmlNewNode(NULL, BAD_CAST "snsRulesGroup"));
+	brex->notationRuleDoc = xmlNewDoc(BAD_CAST "1.0");
+	xmlDocSetRootElement(brex->notationRuleDoc, xmlNewNode(NULL, BAD_CAST "notationRuleGroup"));
+
+	return brex;
+}
+
+void s1kdFreeBREX(s1kdBREXPtr brex)
+{
+	int i;
+
+	if (!brex) {
+		return;
+	}
+
+	for (i = 0; i < brex->nlayers; ++i) {
+		free_brex_rules(&brex->layers[i].rules);
+		xmlFreeDoc(brex->layers[i].doc);
+	}
+
+	free(brex->layers);
+	xmlFreeDoc(brex->snsRulesDoc);
+	xmlFreeDoc(brex->notationRuleDoc);
+	free(brex);
+}
+
+/* Compile a BREX DM and add it as a layer. The layer takes ownership of doc. */
+static void add_brex_layer(s1kdBREXPtr brex, xmlDocPtr doc)
+{
+	struct brex_layer *layer;
+	xmlXPathContextPtr ctx;
+	xmlXPathObjectPtr obj;
+	xmlNodePtr dmCode;
+
+	brex->layers = realloc(brex->layers, (brex->nlayers + 1) * sizeof(struct brex_layer));
+	layer = &brex->layers[brex->nlayers++];
+
+	layer->doc = doc;
+
+	if ((dmCode = firstXPathNode(doc, NULL, "//dmIdent/dmCode|//dmaddres/dmc/avee"))) {
+		dmcode_string(layer->dmcode, 256, dmCode);
+	} else {
+		strcpy(layer->dmcode, "");
+	}
+
+	/* All rules are compiled, and the rules context is matched against
+	 * each object when it is checked. */
+	ctx = xmlXPathNewContext(doc);
+	obj = xmlXPathEvalExpression(BAD_CAST "//contextRules//structureObjectRule|//contextrules//objrule", ctx);
+	compile_brex_rules(&layer->rules, doc, obj->nodesetval);
+	xmlXPathFreeObject(obj);
+	xmlXPathFreeContext(ctx);
+
+	xmlAddChild(xmlDocGetRootElement(brex->snsRulesDoc), xmlCopyNode(firstXPathNode(doc, NULL, "//snsRules"), 1));
+	xmlAddChild(xmlDocGetRootElement(brex->notationRuleDoc), xmlCopyNode(firstXPathNode(doc, NULL, "//notationRuleList"), 1));
+}
+
+/* Determine whether a BREX DM is already a layer of a compiled BREX. */
+static bool has_brex_layer(s1kdBREXPtr brex, const char *dmcode)
+{
+	int i;
+
+	for (i = 0; i < brex->nlayers; ++i) {
+		if (strcmp(brex->layers[i].dmcode, dmcode) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int s1kdAddBREX(s1kdBREXPtr brex, xmlDocPtr doc)
+{
+	if (!doc) {
+		return 1;
+	}
+
+	add_brex_layer(brex, xmlCopyDoc(doc, 1));
+
+	return 0;
+}
+
+int s1kdAddLayeredBREX(s1kdBREXPtr brex, xmlDocPtr doc, const char *search_dir)
+{
+	if (s1kdAddBREX(brex, doc) != 0) {
+		return 1;
+	}
+
+	while (1) {
+		xmlDocPtr next;
+		xmlNodePtr dmCode;
+		char dmcode[256];
+		char fname[PATH_MAX];
+
+		/* Follow the BREX reference of the last layer added, until
+		 * one is reached which is already a layer (normally, the
+		 * S1000D default BREX references itself). */
+		if (!(dmCode = firstXPathNode(brex->layers[brex->nlayers - 1].doc, NULL, (char *) BREX_REF_DMCODE_PATH))) {
+			return 0;
+		}
+
+		dmcode_string(dmcode, 256, dmCode);
+
+		if (has_brex_layer(brex, dmcode)) {
+			return 0;
+		}
+
+		if (search_dir && find_csdb_object(fname, search_dir, dmcode, is_xml_file, false)) {
+			next = read_xml_doc(fname);
+		} else if (search_brex_fname_from_default_brex(fname, dmcode, strlen(dmcode))) {
+			next = load_brex(fname, NULL);
+		} else {
+			next = NULL;
+		}
+
+		if (!next) {
+			return 1;
+		}
+
+		add_brex_layer(brex, next);
+	}
+}
+
+int s1kdAddDefaultBREX(s1kdBREXPtr brex, const char *dmcode)
+{
+	char fname[PATH_MAX];
+	xmlDocPtr doc;
+
+	if (!search_brex_fname_from_default_brex(fname, (char *) dmcode, strlen(dmcode)) || !(doc = load_brex(fname, NULL))) {
+		return 1;
+	}
+
+	add_brex_layer(brex, doc);
+
+	return 0;
+}
+
+int s1kdGetBREXRef(xmlDocPtr doc, char *dmcode, int n)
+{
+	xmlNodePtr dmCode;
+
+	if (!(dmCode = firstXPathNode(doc, NULL, (char *) BREX_REF_DMCODE_PATH))) {
+		return 1;
+	}
+
+	dmcode_string(dmcode, n, dmCode);
+
+	return 0;
+}
+
+int s1kdCtxDocCheckCompiledBREX(const s1kdContext *s1kdctx, xmlDocPtr doc, s1kdBREXPtr brex, int options, xmlDocPtr *report)
+{
+	int i;
+	int err = 0;
+	xmlDocPtr rep;
+	xmlNodePtr node;
+	struct opts opts;
+
+	init_opts(&opts, options);
+	opts.layered = brex->nlayers > 1;
+
+	rep = xmlNewDoc(BAD_CAST "1.0");
+	node = xmlNewNode(NULL, BAD_CAST "brexCheck");
+	xmlDocSetRootElement(rep, node);
+	add_config_to_report(node, &opts);
+
+	node = xmlNewChild(node, NULL, BAD_CAST "document", NULL);
+	xmlSetProp(node, BAD_CAST "path", doc->URL);
+
+	if (opts.check_sns && !check_brex_sns_rules(brex->snsRulesDoc, xmlDocGetRootElement(brex->snsRulesDoc), doc, node, &opts)) {
+		++err;
+	}
+
+	if (opts.check_notations) {
+		err += check_brex_notation_rules(brex->notationRuleDoc, xmlDocGetRootElement(brex->notationRuleDoc), doc, node, &opts);
+	}
+
+	for (i = 0; i < brex->nlayers; ++i) {
+		struct brex_layer *layer = &brex->layers[i];
+		const char *name;
+
+		name = layer->doc->URL ? (char *) layer->doc->URL : layer->dmcode;
+
+		err += check_compiled_brex_rules(&layer->rules, true, doc, (char *) doc->URL, name, node, &opts);
+	}
+
+	if (report) {
+		*report = rep;
+	} else {
+		xmlFreeDoc(rep);
+	}
+
+	return err;
+}
+
+int s1kdDocCheckCompiledBREX(xmlDocPtr doc, s1kdBREXPtr brex, int options, xmlDocPtr *report)
+{
+	return s1kdCtxDocCheckCompiledBREX(NULL, doc, brex, options, report);
+}
+
+int s1kdCtxCheckCompiledBREX(const s1kdContext *ctx, const char *object_xml, int object_size, s1kdBREXPtr brex, int options, char **report_xml, int *report_size)
+{
+	xmlDocPtr doc, rep;
+	int err;
+
+	if (!(doc = read_xml_mem_ctx(ctx, object_xml, object_size))) {
+		return 1;
+	}
+
+	err = s1kdCtxDocCheckCompiledBREX(ctx, doc, brex, options, &rep);
+	xmlFreeDoc(doc);
+
+	if (report_xml && report_size) {
+		xmlDocDumpMemory(rep, (xmlChar **) report_xml, report_size);
+	}
+
+	xmlFreeDoc(rep);
+
+	return err;
+}
+
+int s1kdCheckCompiledBREX(const char *object_xml, int object_size, s1kdBREXPtr brex, int options, char **report_xml, int *report_size)
+{
+	return s1kdCtxCheckCompiledBREX(NULL, object_xml, object_size, brex, options, report_xml, report_size);
+}
 #else
+/* Socket of an s1kd-daemon to send requests to. */
+static char *daemon_socket = NULL;
+
+/* Check an object using a running s1kd-daemon, which keeps the compiled BREX
+ * between requests.
+ *
+ * Returns -1 if the daemon could not carry out the request, in which case the
+ * object should be checked as normal.
+ */
+static int daemon_brexcheck(const char *fname, char (*brex_fnames)[PATH_MAX], int num_brex_fnames, xmlNodePtr brexCheck, struct opts *opts)
+{
+	char **args;
+	int nargs = 0;
+	char flags[8], *f = flags;
+	char *body;
+	int size;
+	int i, err;
+	xmlDocPtr report;
+	xmlNodePtr documentNode, cur;
+
+	*(f++) = '-';
+	if (opts->check_values)    *(f++) = 'c';
+	if (opts->layered)         *(f++) = 'l';
+	if (opts->check_notations) *(f++) = 'n';
+	if (opts->check_sns)       *(f++) = 'S';
+	if (opts->strict_sns)      *(f++) = 't';
+	if (opts->unstrict_sns)    *(f++) = 'u';
+	*f = '\0';
+
+	args = malloc((num_brex_fnames + 3) * sizeof(char *));
+	args[nargs++] = "brexcheck";
+	args[nargs++] = (char *) fname;
+	args[nargs++] = flags;
+	for (i = 0; i < num_brex_fnames; ++i) {
+		args[nargs++] = brex_fnames[i];
+	}
+
+	err = daemon_request(daemon_socket, args, nargs, &body, &size);
+	free(args);
+
+	if (err == -1) {
+		return -1;
+	}
+
+	report = read_xml_mem(body, size);
+	free(body);
+
+	if (!report || !(documentNode = firstXPathNode(report, NULL, "//document"))) {
+		xmlFreeDoc(report);
+		return -1;
+	}
+
+	documentNode = xmlAddChild(brexCheck, xmlDocCopyNode(documentNode, brexCheck->doc, 1));
+	xmlSetProp(documentNode, BAD_CAST "path", BAD_CAST fname);
+	xmlFreeDoc(report);
+
+	/* Errors are printed as they would be if the object were checked
+	 * here. */
+	for (cur = documentNode->children; cur; cur = cur->next) {
+		xmlNodePtr error;
+
+		if (opts->verbosity > SILENT) {
+			for (error = cur->children; error; error = error->next) {
+				if (xmlStrcmp(error->name, BAD_CAST "error") == 0) {
+					print_node(error);
+				}
+			}
+		}
+
+		if (opts->verbosity >= VERBOSE && xmlStrcmp(cur->name, BAD_CAST "brex") == 0) {
+			xmlChar *brex = xmlGetProp(cur, BAD_CAST "path");
+
+			fprintf(stderr,
+				firstXPathNode(NULL, cur, "error") || firstXPathNode(NULL, documentNode, "sns/error|notations/error") ?
+				F_INVALIDDOC :
+				S_VALIDDOC, fname, (char *) brex);
+
+			xmlFree(brex);
+		}
+	}
+
+	switch (show_fnames) {
+		case SHOW_NONE: break;
+		case SHOW_INVALID: print_fnames(documentNode); break;
+		case SHOW_VALID: print_valid_fnames(documentNode); break;
+	}
+
+	return err;
+}
+
+/* Add the next object found in the directories given as arguments to the list
+ * of objects to check. Returns false when there are no more. */
+static bool add_walked_path(struct dir_walk *walk, char (**list)[PATH_MAX], int *n, struct opts *opts)
+{
+	char path[PATH_MAX];
+
+	if (!walk || !dir_walk_next(walk, path)) {
+		return false;
+	}
+
+	add_path(list, n, &DMOD_MAX, path, opts);
+
+	return true;
+}
+
+/* Find the BREX referenced by an object. Objects are checked while the
+ * directories given as arguments are still being walked, so if the BREX is
+ * not found, it may be one of the objects which have not been found yet. In
+ * that case, finish the walk and look again. */
+static int find_brex_fname_walked(char *fname, xmlDocPtr doc, char (*spaths)[PATH_MAX],
+	int nspaths, char (**dmod_fnames)[PATH_MAX], int *num_dmod_fnames,
+	struct dir_walk *walk, struct opts *opts)
+{
+	struct opts quiet;
+	int err;
+
+	if (walk) {
+		quiet = *opts;
+		quiet.verbosity = SILENT;
+
+		if ((err = find_brex_fname_from_doc(fname, doc, spaths, nspaths, *dmod_fnames, *num_dmod_fnames, &quiet)) != 1) {
+			return err;
+		}
+
+		while (add_walked_path(walk, dmod_fnames, num_dmod_fnames, opts));
+	}
+
+	return find_brex_fname_from_doc(fname, doc, spaths, nspaths, *dmod_fnames, *num_dmod_fnames, opts);
+}
+
 /* Show usage message. */
 static void show_help(void)
 {
@@ -1489,6 +2004,7 @@ static void show_help(void)
 	puts("  -b, --brex <brex>                    Use <brex> as the BREX data module.");
 	puts("  -c, --values                         Check object values.");
 	puts("  -d, --dir <dir>                      Directory to start search for BREX in.");
+	puts("  --daemon <socket>                    Send requests to an s1kd-daemon listening on <socket>.");
 	puts("  -e, --ignore-empty                   Ignore empty/non-XML files.");
 	puts("  -F, --valid-filenames                Print the filenames of valid objects.");
 	puts("  -f, --filenames                      Print the filenames of invalid objects.");
@@ -1543,6 +2059,9 @@ int main(int argc, char *argv[])
 	bool is_list = false;
 	bool use_default_brex = false;
 	bool show_stats = false;
+	bool use_daemon;
+
+	struct dir_walk *walk = NULL;
 
 	xmlDocPtr outdoc;
 	xmlNodePtr brexCheck;
@@ -1585,6 +2104,7 @@ int main(int argc, char *argv[])
 		{"recursive"      , no_argument      , 0, 'r'},
 		{"output-valid"   , no_argument      , 0, 'o'},
 		{"remove-deleted" , no_argument      , 0, '^'},
+		{"daemon"         , required_argument, 0, 0},
 		LIBXML2_PARSE_LONGOPT_DEFS
 		{0, 0, 0, 0}
 	};
@@ -1598,6 +2118,9 @@ int main(int argc, char *argv[])
 				if (strcmp(lopts[loptind].name, "version") == 0) {
 					show_version();
 					return 0;
+				} else if (strcmp(lopts[loptind].name, "daemon") == 0) {
+					free(daemon_socket);
+					daemon_socket = strdup(optarg);
 				}
 				LIBXML2_PARSE_LONGOPT_HANDLE(lopts, loptind)
 				break;
@@ -1654,6 +2177,18 @@ int main(int argc, char *argv[])
 		for (i = optind; i < argc; ++i) {
 			if (is_list) {
 				add_dmod_list(argv[i], &dmod_fnames, &num_dmod_fnames, &opts);
+			/* Objects in directories are found while they are
+			 * being checked, and are checked after any objects
+			 * given directly. */
+			} else if (is_dir_arg(argv[i])) {
+				if (!walk) {
+					walk = dir_walk_new(true, is_object_file, NULL);
+				}
+
+				if (!dir_walk_add(walk, argv[i])) {
+					if (opts.verbosity > SILENT) fprintf(stderr, E_NODMOD, argv[i]);
+					exit(EXIT_BAD_DMODULE);
+				}
 			} else {
 				add_path(&dmod_fnames, &num_dmod_fnames, &DMOD_MAX, argv[i], &opts);
 			}
@@ -1676,7 +2211,15 @@ int main(int argc, char *argv[])
 	/* Add configuration info to XML report. */
 	add_config_to_report(brexCheck, &opts);
 
-	for (i = 0; i < num_dmod_fnames; ++i) {
+	/* The daemon only finds BREX in its own index of the CSDB, and does
+	 * not support the options which change how objects are checked. It
+	 * also declines requests made with different XML parser options than
+	 * its own, which are then carried out here. */
+	use_daemon = daemon_socket && !use_stdin && !use_default_brex &&
+		num_brex_search_paths == 0 && strcmp(search_dir, ".") == 0 &&
+		!brsl_fname && !rem_delete && !output_tree;
+
+	for (i = 0; i < num_dmod_fnames || add_walked_path(walk, &dmod_fnames, &num_dmod_fnames, &opts); ++i) {
 		/* Indicates if a referenced BREX data module is used as
 		 * opposed to one specified on the command line.
 		 *
@@ -1686,6 +2229,20 @@ int main(int argc, char *argv[])
 		 * module which referenced it. */
 		bool ref_brex = false;
 
+		if (use_daemon) {
+			int err;
+
+			if ((err = daemon_brexcheck(dmod_fnames[i], brex_fnames, num_brex_fnames, brexCheck, &opts)) != -1) {
+				status += err;
+
+				if (progress) {
+					print_progress_bar(i, num_dmod_fnames);
+				}
+
+				continue;
+			}
+		}
+
 		dmod_doc = read_xml_doc(dmod_fnames[i]);
 
 		if (!dmod_doc) {
@@ -1719,12 +2276,13 @@ int main(int argc, char *argv[])
 			 * Indicate a BREX error in the exit status code if the
 			 * object references a BREX but it couldn't be located.
 			 */
-			} else if ((err = find_brex_fname_from_doc(
+			} else if ((err = find_brex_fname_walked(
 					brex_fnames[0], dmod_doc,
 					brex_search_paths,
 					num_brex_search_paths,
-					dmod_fnames,
-					num_dmod_fnames,
+					&dmod_fnames,
+					&num_dmod_fnames,
+					walk,
 					&opts))) {
 				if (use_stdin) {
 					if (opts.verbosity > SILENT) fprintf(stderr, err == 1 ? E_NOBREX_STDIN : W_NOBREX_STDIN);
@@ -1788,11 +2346,16 @@ int main(int argc, char *argv[])
 
 	xmlFreeDoc(outdoc);
 
+	if (walk) {
+		dir_walk_free(walk);
+	}
+
 	if (brsl_fname) {
 		xmlFreeDoc(brsl);
 		free(brsl_fname);
 	}
 
+	free_pattern_cache();
 	xsltCleanupGlobals();
 	xmlCleanupParser();
 
@@ -1800,6 +2363,7 @@ int main(int argc, char *argv[])
 	free(brex_search_paths);
 	free(dmod_fnames);
 	free(search_dir);
+	free(daemon_socket);
 
 	if (status > 0) {
 		return EXIT_BREX_ERROR;
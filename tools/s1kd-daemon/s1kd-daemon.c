@@ -0,0 +1,1221 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <getopt.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <libxml/tree.h>
+#include <libxslt/xsltInternals.h>
+#include "s1kd_tools.h"
+#include "s1kd/brexcheck.h"
+#include "s1kd/instance.h"
+#include "s1kd/validate.h"
+
+#define PROG_NAME "s1kd-daemon"
+#define VERSION "1.1.0"
+
+#define ERR_PREFIX PROG_NAME ": ERROR: "
+#define WRN_PREFIX PROG_NAME ": WARNING: "
+#define INF_PREFIX PROG_NAME ": INFO: "
+
+#define E_SOCKET ERR_PREFIX "Could not listen on %s: %s\n"
+#define E_DECLINED ERR_PREFIX "Request was not carried out by a daemon on %s\n"
+#define W_BAD_REQUEST WRN_PREFIX "Bad request: %s\n"
+#define I_LISTEN INF_PREFIX "Listening on %s\n"
+#define I_INDEX INF_PREFIX "Indexed %d objects in %s\n"
+#define I_REQUEST INF_PREFIX "%s %s\n"
+#define I_COMPILE INF_PREFIX "Compiling %s...\n"
+#define I_PARSE_OPTS INF_PREFIX "Declined %s: the client uses different XML parser options\n"
+
+#define EXIT_SOCKET 2
+#define EXIT_DECLINED 3
+
+/* Default name of the socket, relative to the current directory. */
+#define DEFAULT_SOCKET ".s1kd-daemon"
+
+/* Maximum size of a request. */
+#define REQUEST_MAX 65536
+
+/* Maximum number of arguments in a request. */
+#define ARGS_MAX 1024
+
+/* Maximum number of clients served at once. Further clients wait to be
+ * accepted until one is done. */
+#define CLIENTS_MAX 32
+
+/* Seconds a client has to send its request or read the response before it is
+ * disconnected. */
+#define CLIENT_TIMEOUT 10
+
+/* Milliseconds between checks of whether the daemon should stop while it is
+ * waiting for clients. */
+#define STOP_POLL_INTERVAL 500
+
+/* Maximum number of compiled schemas and BREX kept in each cache. When a cache
+ * is full, the entry used least recently is discarded to make room. */
+#define CACHE_MAX 16
+
+/* Status of a request which the client must carry out itself, either because
+ * it cannot be reached or because the daemon is not able to produce the same
+ * result as the tool would (the tool will then report the problem itself). */
+#define STATUS_DECLINED -1
+
+static enum verbosity {QUIET, NORMAL, VERBOSE} verbosity = NORMAL;
+
+/* Index of the CSDB objects in a directory.
+ *
+ * The modification times of all indexed directories are checked before each
+ * lookup, and the index is rebuilt if any have changed since it was built, so
+ * new objects and issues are seen without restarting the daemon.
+ */
+struct csdb_index {
+	char dir[PATH_MAX];
+	bool recursive;
+	char (*paths)[PATH_MAX];
+	int npaths;
+	int maxpaths;
+	char (*dirs)[PATH_MAX];
+	int ndirs;
+	int maxdirs;
+	time_t built;
+};
+
+/* A cached compiled schema. */
+struct schema_entry {
+	char *url;
+	time_t mtime;
+	s1kdSchemaPtr schema;
+	unsigned long used;
+};
+
+/* A cached compiled BREX.
+ *
+ * The key identifies the BREX data modules the compiled BREX was built from,
+ * and the stamp is the latest modification time among them, so that the BREX
+ * is recompiled if any of them are changed.
+ */
+struct brex_entry {
+	char *key;
+	time_t stamp;
+	s1kdBREXPtr brex;
+	unsigned long used;
+};
+
+static struct csdb_index csdb;
+
+static struct schema_entry *schemas = NULL;
+static int nschemas = 0;
+
+static struct brex_entry *brexes = NULL;
+static int nbrexes = 0;
+
+/* Counts uses of cached schemas and BREX, to find the one used least
+ * recently. */
+static unsigned long cache_uses = 0;
+
+/* Set by the signal handler or a stop request when the daemon should stop. */
+static volatile sig_atomic_t stopping = 0;
+
+/* Each client is served on its own thread, but requests are carried out one
+ * at a time, as they change the working directory of the daemon and share the
+ * index and caches. */
+static pthread_mutex_t request_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Number of clients being served. */
+static int nclients = 0;
+static pthread_mutex_t clients_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t clients_changed = PTHREAD_COND_INITIALIZER;
+
+/* Return the modification time of a file, or 0 if it does not exist (such as a
+ * built-in BREX or a schema URL). */
+static time_t file_mtime(const char *path)
+{
+	struct stat st;
+
+	if (stat(path, &st) == -1) {
+		return 0;
+	}
+
+	return st.st_mtime;
+}
+
+/* Make the path of a local file absolute, so that it means the same thing to
+ * every client. Other names, such as URLs, are copied as they are. */
+static void abs_name(char *dst, const char *name)
+{
+	if (access(name, F_OK) == 0) {
+		real_path(name, dst);
+	} else {
+		strncpy(dst, name, PATH_MAX - 1);
+		dst[PATH_MAX - 1] = '\0';
+	}
+}
+
+/* Determine whether a file name is an XML file. */
+static bool is_xml_file(const char *fname)
+{
+	const char *ext = strrchr(fname, '.');
+	return ext && strcasecmp(ext, ".xml") == 0;
+}
+
+/* Add the CSDB objects in a directory to the index.
+ *
+ * All files are indexed, not only XML files, so that references to ICNs and
+ * other non-XML objects are found as s1kd-refs would find them.
+ */
+static void index_dir(struct csdb_index *index, const char *path)
+{
+	DIR *dir;
+	struct dirent *cur;
+
+	if (!(dir = opendir(path))) {
+		return;
+	}
+
+	if (index->ndirs == index->maxdirs) {
+		index->maxdirs = index->maxdirs ? index->maxdirs * 2 : 16;
+		index->dirs = realloc(index->dirs, index->maxdirs * PATH_MAX);
+	}
+	strcpy(index->dirs[index->ndirs++], path);
+
+	while ((cur = readdir(dir))) {
+		char cpath[PATH_MAX];
+
+		if (strcmp(cur->d_name, ".") == 0 || strcmp(cur->d_name, "..") == 0) {
+			continue;
+		}
+
+		snprintf(cpath, PATH_MAX, "%s/%s", path, cur->d_name);
+
+		if (index->recursive && isdir(cpath, false)) {
+			index_dir(index, cpath);
+		} else {
+			if (index->npaths == index->maxpaths) {
+				index->maxpaths = index->maxpaths ? index->maxpaths * 2 : 256;
+				index->paths = realloc(index->paths, index->maxpaths * PATH_MAX);
+			}
+			strcpy(index->paths[index->npaths++], cpath);
+		}
+	}
+
+	closedir(dir);
+}
+
+/* Sort paths so that the latest issue of an object comes first. */
+static int compare_latest(const void *a, const void *b)
+{
+	return -compare_basename(a, b);
+}
+
+/* Build the index of the CSDB. */
+static void build_index(struct csdb_index *index)
+{
+	index->npaths = 0;
+	index->ndirs = 0;
+	index->built = time(NULL);
+
+	index_dir(index, index->dir);
+
+	qsort(index->paths, index->npaths, PATH_MAX, compare_latest);
+
+	if (verbosity >= VERBOSE) {
+		fprintf(stderr, I_INDEX, index->npaths, index->dir);
+	}
+}
+
+/* Rebuild the index if any indexed directory has changed since it was built.
+ *
+ * A directory modified in the same second as the index was built may have
+ * changed after it was read, so it is also treated as changed.
+ */
+static void update_index(struct csdb_index *index)
+{
+	int i;
+
+	for (i = 0; i < index->ndirs; ++i) {
+		if (file_mtime(index->dirs[i]) >= index->built) {
+			build_index(index);
+			return;
+		}
+	}
+}
+
+/* Find the latest issue of a CSDB object in the index by its code, optionally
+ * only among XML files. */
+static bool find_object(char *dst, const char *code, bool xml)
+{
+	int i;
+
+	update_index(&csdb);
+
+	for (i = 0; i < csdb.npaths; ++i) {
+		const char *base = strrchr(csdb.paths[i], '/') + 1;
+
+		if ((!xml || is_xml_file(base)) && strmatch(code, base)) {
+			strcpy(dst, csdb.paths[i]);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Find the cached schema used least recently. */
+static int least_used_schema(void)
+{
+	int i, least = 0;
+
+	for (i = 1; i < nschemas; ++i) {
+		if (schemas[i].used < schemas[least].used) {
+			least = i;
+		}
+	}
+
+	return least;
+}
+
+/* Get a compiled schema from the cache, compiling it if needed. */
+static s1kdSchemaPtr get_schema(const char *name)
+{
+	int i;
+	char url[PATH_MAX];
+	time_t mtime;
+	s1kdSchemaPtr schema;
+
+	abs_name(url, name);
+	mtime = file_mtime(url);
+
+	for (i = 0; i < nschemas; ++i) {
+		if (strcmp(schemas[i].url, url) == 0) {
+			if (schemas[i].mtime == mtime) {
+				schemas[i].used = ++cache_uses;
+				return schemas[i].schema;
+			}
+
+			s1kdFreeSchema(schemas[i].schema);
+			break;
+		}
+	}
+
+	if (verbosity >= VERBOSE) {
+		fprintf(stderr, I_COMPILE, url);
+	}
+
+	if (!(schema = s1kdNewSchema(url))) {
+		if (i < nschemas) {
+			free(schemas[i].url);
+			schemas[i] = schemas[--nschemas];
+		}
+		return NULL;
+	}
+
+	if (i == nschemas && nschemas == CACHE_MAX) {
+		i = least_used_schema();
+		free(schemas[i].url);
+		s1kdFreeSchema(schemas[i].schema);
+		schemas[i].url = strdup(url);
+	} else if (i == nschemas) {
+		schemas = realloc(schemas, (nschemas + 1) * sizeof(struct schema_entry));
+		schemas[nschemas++].url = strdup(url);
+	}
+
+	schemas[i].mtime = mtime;
+	schemas[i].schema = schema;
+	schemas[i].used = ++cache_uses;
+
+	return schema;
+}
+
+/* Find a compiled BREX in the cache.
+ *
+ * If the BREX is cached but out of date, it is removed, and NULL is returned
+ * so that the caller compiles it again.
+ */
+static s1kdBREXPtr find_brex(const char *key, time_t stamp)
+{
+	int i;
+
+	for (i = 0; i < nbrexes; ++i) {
+		if (strcmp(brexes[i].key, key) == 0) {
+			if (brexes[i].stamp == stamp) {
+				brexes[i].used = ++cache_uses;
+				return brexes[i].brex;
+			}
+
+			free(brexes[i].key);
+			s1kdFreeBREX(brexes[i].brex);
+			brexes[i] = brexes[--nbrexes];
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+/* Add a compiled BREX to the cache, discarding the BREX used least recently
+ * if the cache is full. */
+static void cache_brex(const char *key, time_t stamp, s1kdBREXPtr brex)
+{
+	int i;
+
+	if (nbrexes == CACHE_MAX) {
+		int least = 0;
+
+		for (i = 1; i < nbrexes; ++i) {
+			if (brexes[i].used < brexes[least].used) {
+				least = i;
+			}
+		}
+
+		free(brexes[least].key);
+		s1kdFreeBREX(brexes[least].brex);
+		i = least;
+	} else {
+		brexes = realloc(brexes, (nbrexes + 1) * sizeof(struct brex_entry));
+		i = nbrexes++;
+	}
+
+	brexes[i].key = strdup(key);
+	brexes[i].stamp = stamp;
+	brexes[i].brex = brex;
+	brexes[i].used = ++cache_uses;
+}
+
+/* Free all cached schemas and BREX. */
+static void clear_cache(void)
+{
+	int i;
+
+	for (i = 0; i < nschemas; ++i) {
+		free(schemas[i].url);
+		s1kdFreeSchema(schemas[i].schema);
+	}
+	free(schemas);
+	schemas = NULL;
+	nschemas = 0;
+
+	for (i = 0; i < nbrexes; ++i) {
+		free(brexes[i].key);
+		s1kdFreeBREX(brexes[i].brex);
+	}
+	free(brexes);
+	brexes = NULL;
+	nbrexes = 0;
+}
+
+/* Append the XML of a document to a response. */
+static void dump_doc(xmlDocPtr doc, xmlChar **body, int *size)
+{
+	if (doc) {
+		xmlDocDumpMemory(doc, body, size);
+	}
+}
+
+/* Make the paths of schemas or BREX in a report relative to the working
+ * directory of the client, as the tool would show them. */
+static void relative_paths(xmlDocPtr report, const char *xpath)
+{
+	char cwd[PATH_MAX];
+	int len;
+	xmlXPathContextPtr ctx;
+	xmlXPathObjectPtr obj;
+	int i;
+
+	if (!getcwd(cwd, PATH_MAX)) {
+		return;
+	}
+
+	strncat(cwd, "/", PATH_MAX - strlen(cwd) - 1);
+	len = strlen(cwd);
+
+	ctx = xmlXPathNewContext(report);
+	obj = xmlXPathEvalExpression(BAD_CAST xpath, ctx);
+
+	for (i = 0; obj && obj->nodesetval && i < obj->nodesetval->nodeNr; ++i) {
+		xmlNodePtr attr = obj->nodesetval->nodeTab[i];
+		xmlChar *path = xmlNodeGetContent(attr);
+
+		if (xmlStrncmp(path, BAD_CAST cwd, len) == 0) {
+			xmlNodeSetContent(attr, path + len);
+		}
+
+		xmlFree(path);
+	}
+
+	xmlXPathFreeObject(obj);
+	xmlXPathFreeContext(ctx);
+}
+
+/* validate <object> <flags> [<schema>]
+ *
+ * Flags:
+ *   ^  Validate with elements marked as "delete" removed.
+ */
+static int do_validate(char **args, int nargs, xmlChar **body, int *size)
+{
+	xmlDocPtr doc, report;
+	xmlChar *url = NULL;
+	s1kdSchemaPtr schema;
+	int options = 0;
+	int err;
+
+	if (nargs < 2) {
+		return STATUS_DECLINED;
+	}
+
+	if (strchr(args[1], '^')) {
+		options |= S1KD_VALIDATE_REMOVE_DELETED;
+	}
+
+	if (!(doc = read_xml_doc(args[0]))) {
+		return STATUS_DECLINED;
+	}
+
+	if (nargs > 2) {
+		url = xmlStrdup(BAD_CAST args[2]);
+	} else {
+		url = xmlGetNsProp(xmlDocGetRootElement(doc), BAD_CAST "noNamespaceSchemaLocation", BAD_CAST "http://www.w3.org/2001/XMLSchema-instance");
+	}
+
+	if (!url || !(schema = get_schema((char *) url))) {
+		xmlFree(url);
+		xmlFreeDoc(doc);
+		return STATUS_DECLINED;
+	}
+
+	err = s1kdDocValidate(doc, schema, options, &report);
+	relative_paths(report, "//document/@schema");
+	dump_doc(report, body, size);
+
+	xmlFreeDoc(report);
+	xmlFree(url);
+	xmlFreeDoc(doc);
+
+	return err;
+}
+
+/* Compile the BREX for a brexcheck request, or get it from the cache.
+ *
+ * If no BREX are named in the request, the BREX referenced by the object is
+ * found in the index of the CSDB, or in the built-in S1000D default BREX.
+ */
+static s1kdBREXPtr get_brex(xmlDocPtr doc, char **names, int nnames, bool layered)
+{
+	char key[REQUEST_MAX];
+	char (*paths)[PATH_MAX];
+	char dmcode[256];
+	bool builtin = false;
+	time_t stamp = 0;
+	s1kdBREXPtr brex;
+	int i;
+
+	if (nnames == 0) {
+		if (s1kdGetBREXRef(doc, dmcode, 256) != 0) {
+			return NULL;
+		}
+
+		/* When using the BREX referenced by a BREX data module, the
+		 * tool also checks the data module against itself, which is
+		 * left to the tool. */
+		if (xpath_first_node(doc, NULL, BAD_CAST "//brex")) {
+			return NULL;
+		}
+
+		paths = malloc(PATH_MAX);
+
+		if (!find_object(paths[0], dmcode, true)) {
+			strcpy(paths[0], dmcode);
+			builtin = true;
+		}
+
+		nnames = 1;
+	} else {
+		paths = malloc(nnames * PATH_MAX);
+
+		for (i = 0; i < nnames; ++i) {
+			abs_name(paths[i], names[i]);
+		}
+	}
+
+	strcpy(key, layered ? "l" : "");
+	for (i = 0; i < nnames; ++i) {
+		time_t mtime = file_mtime(paths[i]);
+
+		if (mtime > stamp) {
+			stamp = mtime;
+		}
+
+		strncat(key, "\t", REQUEST_MAX - strlen(key) - 1);
+		strncat(key, paths[i], REQUEST_MAX - strlen(key) - 1);
+	}
+
+	if ((brex = find_brex(key, stamp))) {
+		free(paths);
+		return brex;
+	}
+
+	if (verbosity >= VERBOSE) {
+		fprintf(stderr, I_COMPILE, strchr(key, '\t') + 1);
+	}
+
+	brex = s1kdNewBREX();
+
+	for (i = 0; i < nnames && brex; ++i) {
+		int err;
+
+		if (builtin) {
+			err = s1kdAddDefaultBREX(brex, paths[i]);
+		} else {
+			xmlDocPtr brex_doc;
+
+			if (!(brex_doc = read_xml_doc(paths[i]))) {
+				err = 1;
+			} else if (layered) {
+				err = s1kdAddLayeredBREX(brex, brex_doc, csdb.dir);
+			} else {
+				err = s1kdAddBREX(brex, brex_doc);
+			}
+
+			xmlFreeDoc(brex_doc);
+		}
+
+		if (err) {
+			s1kdFreeBREX(brex);
+			brex = NULL;
+		}
+	}
+
+	if (brex) {
+		cache_brex(key, stamp, brex);
+	}
+
+	free(paths);
+
+	return brex;
+}
+
+/* brexcheck <object> <flags> [<BREX>...]
+ *
+ * Flags (as in s1kd-brexcheck):
+ *   c  Check object values.
+ *   l  Check BREX referenced by other BREX.
+ *   n  Check notation rules.
+ *   S  Check SNS rules.
+ *   t  Strict SNS check.
+ *   u  Unstrict SNS check.
+ */
+static int do_brexcheck(char **args, int nargs, xmlChar **body, int *size)
+{
+	xmlDocPtr doc, report;
+	s1kdBREXPtr brex;
+	int options = 0;
+	int err;
+
+	if (nargs < 2) {
+		return STATUS_DECLINED;
+	}
+
+	if (strchr(args[1], 'c')) options |= S1KD_BREXCHECK_VALUES;
+	if (strchr(args[1], 'S')) options |= S1KD_BREXCHECK_SNS;
+	if (strchr(args[1], 't')) options |= S1KD_BREXCHECK_STRICT_SNS;
+	if (strchr(args[1], 'u')) options |= S1KD_BREXCHECK_UNSTRICT_SNS;
+	if (strchr(args[1], 'n')) options |= S1KD_BREXCHECK_NOTATIONS;
+
+	if (!(doc = read_xml_doc(args[0]))) {
+		return STATUS_DECLINED;
+	}
+
+	brex = get_brex(doc, args + 2, nargs - 2, strchr(args[1], 'l'));
+
+	if (!brex) {
+		xmlFreeDoc(doc);
+		return STATUS_DECLINED;
+	}
+
+	err = s1kdDocCheckCompiledBREX(doc, brex, options, &report);
+	relative_paths(report, "//brex/@path");
+	dump_doc(report, body, size);
+
+	xmlFreeDoc(report);
+	xmlFreeDoc(doc);
+
+	return err;
+}
+
+/* instance <object> <flags> [<ident>:<type>=<value>...]
+ *
+ * Flags (as in s1kd-instance):
+ *   a  Remove applicability annotations which are unambiguously valid or invalid.
+ *   A  Simplify and reduce applicability annotations.
+ *   9  Simplify by removing only false assertions.
+ *   J  Remove display text from simplified annotations.
+ *   T  Tag non-applicable elements instead of removing them.
+ */
+static int do_instance(char **args, int nargs, xmlChar **body, int *size)
+{
+	xmlDocPtr doc, inst;
+	s1kdApplicability app;
+	s1kdFilterMode mode = S1KD_FILTER_DEFAULT;
+	s1kdContextPtr ctx;
+	int options = 0;
+	int i;
+
+	if (nargs < 2) {
+		return STATUS_DECLINED;
+	}
+
+	if (strchr(args[1], '9')) {
+		mode = S1KD_FILTER_PRUNE;
+	} else if (strchr(args[1], 'A')) {
+		mode = S1KD_FILTER_SIMPLIFY;
+	} else if (strchr(args[1], 'a')) {
+		mode = S1KD_FILTER_REDUCE;
+	}
+
+	if (strchr(args[1], 'T')) options |= S1KD_FILTER_TAG_NON_APPLIC;
+	if (strchr(args[1], 'J')) options |= S1KD_FILTER_CLEAN_DISPLAY_TEXT;
+
+	if (!(doc = read_xml_doc(args[0]))) {
+		return STATUS_DECLINED;
+	}
+
+	app = s1kdNewApplicability();
+
+	for (i = 2; i < nargs; ++i) {
+		char *ident, *type, *value;
+
+		ident = args[i];
+
+		if (!(type = strchr(ident, ':')) || !(value = strchr(type, '='))) {
+			continue;
+		}
+
+		*(type++) = '\0';
+		*(value++) = '\0';
+
+		s1kdAssign(app, BAD_CAST ident, BAD_CAST type, BAD_CAST value);
+	}
+
+	ctx = s1kdNewContext();
+	s1kdContextSetFilterOptions(ctx, options);
+
+	inst = s1kdCtxDocFilter(ctx, doc, app, mode);
+	dump_doc(inst, body, size);
+
+	s1kdFreeContext(ctx);
+	xmlFreeDoc(inst);
+	s1kdFreeApplicability(app);
+	xmlFreeDoc(doc);
+
+	return 0;
+}
+
+/* find <code>
+ *
+ * Return the path of the latest issue of a CSDB object in the index.
+ */
+static int do_find(char **args, int nargs, xmlChar **body, int *size)
+{
+	char path[PATH_MAX];
+
+	if (nargs < 1 || !find_object(path, args[0], true)) {
+		return 1;
+	}
+
+	*body = xmlStrdup(BAD_CAST path);
+	*body = xmlStrcat(*body, BAD_CAST "\n");
+	*size = xmlStrlen(*body);
+
+	return 0;
+}
+
+/* refs <code> <dir> <flags>
+ *
+ * Find the latest issue of a CSDB object matching a reference, as s1kd-refs
+ * would find it in <dir>. The path is given as s1kd-refs would print it.
+ *
+ * Flags (as in s1kd-refs):
+ *   r  Search in subdirectories of <dir>.
+ *
+ * The request is declined if <dir> is not the indexed directory, or is not
+ * searched the same way, as the index could then give a different result.
+ */
+static int do_refs(char **args, int nargs, xmlChar **body, int *size)
+{
+	char dir[PATH_MAX], path[PATH_MAX];
+	int len;
+
+	if (nargs < 3) {
+		return STATUS_DECLINED;
+	}
+
+	if (access(args[1], F_OK) != 0) {
+		return STATUS_DECLINED;
+	}
+
+	real_path(args[1], dir);
+
+	if (strcmp(dir, csdb.dir) != 0 || (strchr(args[2], 'r') != NULL) != csdb.recursive) {
+		return STATUS_DECLINED;
+	}
+
+	if (!find_object(path, args[0], false)) {
+		return 1;
+	}
+
+	/* Paths in the index start with the indexed directory, which is
+	 * replaced by the directory as the client named it. */
+	len = strlen(args[1]);
+
+	if (strcmp(args[1], ".") != 0) {
+		*body = xmlStrdup(BAD_CAST args[1]);
+		if (args[1][len - 1] != '/') {
+			*body = xmlStrcat(*body, BAD_CAST "/");
+		}
+	}
+
+	*body = xmlStrcat(*body, BAD_CAST path + strlen(csdb.dir) + 1);
+	*body = xmlStrcat(*body, BAD_CAST "\n");
+	*size = xmlStrlen(*body);
+
+	return 0;
+}
+
+/* Carry out a request and return its status. */
+static int do_request(char **args, int nargs, xmlChar **body, int *size)
+{
+	const char *cmd = args[0];
+
+	++args;
+	--nargs;
+
+	if (strcmp(cmd, "validate") == 0) {
+		return do_validate(args, nargs, body, size);
+	} else if (strcmp(cmd, "brexcheck") == 0) {
+		return do_brexcheck(args, nargs, body, size);
+	} else if (strcmp(cmd, "instance") == 0) {
+		return do_instance(args, nargs, body, size);
+	} else if (strcmp(cmd, "find") == 0) {
+		return do_find(args, nargs, body, size);
+	} else if (strcmp(cmd, "refs") == 0) {
+		return do_refs(args, nargs, body, size);
+	} else if (strcmp(cmd, "rescan") == 0) {
+		clear_cache();
+		build_index(&csdb);
+		return 0;
+	} else if (strcmp(cmd, "stop") == 0) {
+		stopping = 1;
+		return 0;
+	}
+
+	if (verbosity > QUIET) {
+		fprintf(stderr, W_BAD_REQUEST, cmd);
+	}
+
+	return STATUS_DECLINED;
+}
+
+/* Write all of a buffer to a socket. */
+static void write_all(int fd, const char *buf, size_t len)
+{
+	while (len > 0) {
+		ssize_t n;
+
+		if ((n = write(fd, buf, len)) <= 0) {
+			return;
+		}
+
+		buf += n;
+		len -= n;
+	}
+}
+
+/* Errors from reading objects, schemas and BREX are left to the tools, which
+ * carry out requests themselves when the daemon cannot. */
+static void suppress_error(void *userData, xmlErrorPtr error)
+{
+}
+
+/* Read a request from a client, carry it out, and send the response.
+ *
+ * The first line of a request is the working directory of the client, which
+ * relative paths in the rest of the request are relative to. The second is
+ * the XML parser options of the client, and requests are declined if they
+ * are not the same as those of the daemon. The next is the command, followed
+ * by its arguments. Flags are given like the short options of the
+ * corresponding tool, for example -cSn, or - for none.
+ */
+static void serve_client(int fd)
+{
+	struct timeval timeout = {CLIENT_TIMEOUT, 0};
+	char *buf;
+	size_t len = 0;
+	ssize_t n;
+	char *args[ARGS_MAX];
+	int nargs = 0;
+	char *line, *next;
+	xmlChar *body = NULL;
+	int size = 0;
+	int status = STATUS_DECLINED;
+	char head[32];
+
+	/* A client which stops sending its request or reading the response
+	 * is disconnected, so it cannot hold up the daemon. */
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+	/* The error handler belongs to the thread. */
+	if (verbosity < VERBOSE) {
+		xmlSetStructuredErrorFunc(NULL, suppress_error);
+	}
+
+	buf = malloc(REQUEST_MAX + 1);
+
+	while (len < REQUEST_MAX && (n = read(fd, buf + len, REQUEST_MAX - len)) > 0) {
+		len += n;
+
+		if (len > 1 && buf[len - 1] == '\n' && buf[len - 2] == '\n') {
+			break;
+		}
+	}
+
+	buf[len] = '\0';
+
+	for (line = buf; nargs < ARGS_MAX && (next = strchr(line, '\n')) && next != line; line = next + 1) {
+		*next = '\0';
+		args[nargs++] = line;
+	}
+
+	pthread_mutex_lock(&request_lock);
+
+	if (nargs < 3 || chdir(args[0]) != 0) {
+		if (verbosity > QUIET) {
+			fprintf(stderr, W_BAD_REQUEST, nargs > 0 ? args[0] : "");
+		}
+	} else if (atoi(args[1]) != DEFAULT_PARSE_OPTS) {
+		if (verbosity >= VERBOSE) {
+			fprintf(stderr, I_PARSE_OPTS, args[2]);
+		}
+	} else {
+		if (verbosity >= VERBOSE) {
+			fprintf(stderr, I_REQUEST, args[2], nargs > 3 ? args[3] : "");
+		}
+
+		status = do_request(args + 2, nargs - 2, &body, &size);
+	}
+
+	pthread_mutex_unlock(&request_lock);
+
+	snprintf(head, 32, "%d\n", status);
+	write_all(fd, head, strlen(head));
+
+	if (body) {
+		write_all(fd, (char *) body, size);
+		xmlFree(body);
+	}
+
+	free(buf);
+}
+
+/* Determine whether a daemon is already listening on a socket. */
+static bool in_use(struct sockaddr_un *addr)
+{
+	int fd;
+	bool used;
+
+	if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) == -1) {
+		return false;
+	}
+
+	used = connect(fd, (struct sockaddr *) addr, sizeof(*addr)) == 0;
+
+	close(fd);
+
+	return used;
+}
+
+/* Serve a client on its own thread. */
+static void *client_thread(void *arg)
+{
+	int fd = *(int *) arg;
+
+	free(arg);
+
+	serve_client(fd);
+	close(fd);
+
+	pthread_mutex_lock(&clients_lock);
+	--nclients;
+	pthread_cond_broadcast(&clients_changed);
+	pthread_mutex_unlock(&clients_lock);
+
+	return NULL;
+}
+
+/* Start serving a client, on its own thread if possible. */
+static void start_client(int fd)
+{
+	pthread_t thread;
+	int *arg;
+
+	pthread_mutex_lock(&clients_lock);
+	while (nclients >= CLIENTS_MAX) {
+		pthread_cond_wait(&clients_changed, &clients_lock);
+	}
+	++nclients;
+	pthread_mutex_unlock(&clients_lock);
+
+	arg = malloc(sizeof(int));
+	*arg = fd;
+
+	if (pthread_create(&thread, NULL, client_thread, arg) == 0) {
+		pthread_detach(thread);
+	} else {
+		client_thread(arg);
+	}
+}
+
+/* Stop the daemon when it is interrupted. */
+static void handle_signal(int sig)
+{
+	stopping = 1;
+}
+
+/* Listen for requests on a socket until told to stop. */
+static int serve(const char *path)
+{
+	struct sockaddr_un addr;
+	struct sigaction sa;
+	struct pollfd pfd;
+	mode_t mask;
+	int sock;
+
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		if (verbosity > QUIET) {
+			fprintf(stderr, E_SOCKET, path, strerror(ENAMETOOLONG));
+		}
+		return EXIT_SOCKET;
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+
+	/* A socket left behind by a daemon which did not stop cleanly is
+	 * replaced, but not one which another daemon is still listening on. */
+	if (!in_use(&addr)) {
+		unlink(path);
+	}
+
+	if ((sock = socket(AF_UNIX, SOCK_STREAM, 0)) == -1) {
+		if (verbosity > QUIET) {
+			fprintf(stderr, E_SOCKET, path, strerror(errno));
+		}
+		return EXIT_SOCKET;
+	}
+
+	/* Requests are carried out with the permissions of the daemon, so only
+	 * the user running it may connect to the socket. */
+	mask = umask(0177);
+
+	if (bind(sock, (struct sockaddr *) &addr, sizeof(addr)) == -1 || listen(sock, 16) == -1) {
+		umask(mask);
+		if (verbosity > QUIET) {
+			fprintf(stderr, E_SOCKET, path, strerror(errno));
+		}
+		close(sock);
+		return EXIT_SOCKET;
+	}
+
+	umask(mask);
+
+	/* poll() is not restarted after a signal, so that the daemon stops
+	 * while it is waiting for a request. */
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = handle_signal;
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+	signal(SIGPIPE, SIG_IGN);
+
+	if (verbosity >= VERBOSE) {
+		fprintf(stderr, I_LISTEN, path);
+	}
+
+	pfd.fd = sock;
+	pfd.events = POLLIN;
+
+	while (!stopping) {
+		int fd;
+
+		/* A stop request is received by a client thread, so the
+		 * daemon checks whether it should stop at intervals. */
+		if (poll(&pfd, 1, STOP_POLL_INTERVAL) < 1 || (fd = accept(sock, NULL, NULL)) == -1) {
+			continue;
+		}
+
+		start_client(fd);
+	}
+
+	pthread_mutex_lock(&clients_lock);
+	while (nclients > 0) {
+		pthread_cond_wait(&clients_changed, &clients_lock);
+	}
+	pthread_mutex_unlock(&clients_lock);
+
+	close(sock);
+	unlink(path);
+
+	return EXIT_SUCCESS;
+}
+
+/* Show usage message. */
+static void show_help(void)
+{
+	puts("Usage: " PROG_NAME " [-d <dir>] [-s <socket>] [-qrvh?]");
+	puts("       " PROG_NAME " [-s <socket>] -x <command> [<arg>...]");
+	puts("");
+	puts("Options:");
+	puts("  -d, --dir <dir>        Index CSDB objects in <dir>.");
+	puts("  -h, -?, --help         Show usage message.");
+	puts("  -q, --quiet            Quiet mode.");
+	puts("  -r, --recursive        Index CSDB objects in subdirectories.");
+	puts("  -s, --socket <socket>  Listen on or send requests to <socket>.");
+	puts("  -v, --verbose          Verbose output.");
+	puts("  -x, --request          Send a request to a running daemon.");
+	puts("  --version              Show version information.");
+	LIBXML2_PARSE_LONGOPT_HELP
+}
+
+/* Show version information. */
+static void show_version(void)
+{
+	printf("%s (s1kd-tools) %s\n", PROG_NAME, VERSION);
+	printf("Using libxml %s and libxslt %s\n", xmlParserVersion, xsltEngineVersion);
+}
+
+int main(int argc, char **argv)
+{
+	int i;
+	char *dir = NULL;
+	char *sock = NULL;
+	bool request = false;
+	int status;
+
+	/* Arguments after -x are the request, not options. */
+	const char *sopts = "+d:qrs:vxh?";
+	struct option lopts[] = {
+		{"version"  , no_argument      , 0, 0},
+		{"help"     , no_argument      , 0, 'h'},
+		{"dir"      , required_argument, 0, 'd'},
+		{"quiet"    , no_argument      , 0, 'q'},
+		{"recursive", no_argument      , 0, 'r'},
+		{"socket"   , required_argument, 0, 's'},
+		{"verbose"  , no_argument      , 0, 'v'},
+		{"request"  , no_argument      , 0, 'x'},
+		LIBXML2_PARSE_LONGOPT_DEFS
+		{0, 0, 0, 0}
+	};
+	int loptind = 0;
+
+	while ((i = getopt_long(argc, argv, sopts, lopts, &loptind)) != -1) {
+		switch (i) {
+			case 0:
+				if (strcmp(lopts[loptind].name, "version") == 0) {
+					show_version();
+					return EXIT_SUCCESS;
+				}
+				LIBXML2_PARSE_LONGOPT_HANDLE(lopts, loptind)
+				break;
+			case 'd':
+				free(dir);
+				dir = strdup(optarg);
+				break;
+			case 'q':
+				verbosity = QUIET;
+				break;
+			case 'r':
+				csdb.recursive = true;
+				break;
+			case 's':
+				free(sock);
+				sock = strdup(optarg);
+				break;
+			case 'v':
+				verbosity = VERBOSE;
+				break;
+			case 'x':
+				request = true;
+				break;
+			case 'h':
+			case '?':
+				show_help();
+				return EXIT_SUCCESS;
+		}
+	}
+
+	if (!sock) {
+		sock = strdup(DEFAULT_SOCKET);
+	}
+
+	if (request) {
+		char *body = NULL;
+		int size = 0;
+
+		if ((status = daemon_request(sock, argv + optind, argc - optind, &body, &size)) == -1) {
+			if (verbosity > QUIET) {
+				fprintf(stderr, E_DECLINED, sock);
+			}
+			status = EXIT_DECLINED;
+		} else {
+			fwrite(body, 1, size, stdout);
+			status = status ? EXIT_FAILURE : EXIT_SUCCESS;
+		}
+
+		free(body);
+		free(sock);
+		free(dir);
+
+		return status;
+	}
+
+	LIBXML2_PARSE_INIT
+
+	if (verbosity < VERBOSE) {
+		xmlSetStructuredErrorFunc(NULL, suppress_error);
+	}
+
+	/* Requests change to the working directory of their client, so the
+	 * socket and the CSDB are referred to by absolute paths. */
+	if (sock[0] != '/') {
+		char path[PATH_MAX];
+		real_path(".", path);
+		strncat(path, "/", PATH_MAX - strlen(path) - 1);
+		strncat(path, sock, PATH_MAX - strlen(path) - 1);
+		free(sock);
+		sock = strdup(path);
+	}
+
+	real_path(dir ? dir : ".", csdb.dir);
+	build_index(&csdb);
+
+	status = serve(sock);
+
+	clear_cache();
+	free(csdb.paths);
+	free(csdb.dirs);
+	free(sock);
+	free(dir);
+
+	xmlCleanupParser();
+
+	return status;
+}
@@ -0,0 +1,30 @@
+unsigned char defaults_xml[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x64,
+  0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x64, 0x65, 0x6e,
+  0x74, 0x3d, 0x22, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x49, 0x73,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x3d, 0x22, 0x5a, 0x5a, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64,
+  0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74,
+  0x3d, 0x22, 0x69, 0x6e, 0x57, 0x6f, 0x72, 0x6b, 0x22, 0x20, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x31, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x64,
+  0x65, 0x6e, 0x74, 0x3d, 0x22, 0x69, 0x73, 0x73, 0x75, 0x65, 0x22, 0x20,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x35, 0x2e, 0x30, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+  0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x69, 0x73, 0x73, 0x75,
+  0x65, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x64,
+  0x65, 0x6e, 0x74, 0x3d, 0x22, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67,
+  0x65, 0x49, 0x73, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x3d, 0x22, 0x75, 0x6e, 0x64, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69,
+  0x64, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x73, 0x65, 0x63, 0x75, 0x72, 0x69,
+  0x74, 0x79, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+  0x22, 0x30, 0x31, 0x22, 0x2f, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x65, 0x66,
+  0x61, 0x75, 0x6c, 0x74, 0x73, 0x3e, 0x0a
+};
+unsigned int defaults_xml_len = 319;
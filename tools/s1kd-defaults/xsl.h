@@ -0,0 +1,588 @@
+unsigned char xsl_brexmap_defaults_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x62,
+  0x72, 0x65, 0x78, 0x4d, 0x61, 0x70, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22,
+  0x3e, 0x31, 0x2e, 0x30, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22,
+  0x3e, 0x2f, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x65,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x22, 0x3e, 0x2f, 0x2f, 0x73, 0x74, 0x72, 0x75, 0x63,
+  0x74, 0x75, 0x72, 0x65, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x52, 0x75,
+  0x6c, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x73, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x75, 0x72, 0x65, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x52,
+  0x75, 0x6c, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68,
+  0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e,
+  0x24, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x21, 0x3d, 0x20, 0x27, 0x27,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x56,
+  0x61, 0x6c, 0x75, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69, 0x64, 0x65,
+  0x6e, 0x74, 0x22, 0x3e, 0x7b, 0x24, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x7d,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0x7b, 0x6f, 0x62,
+  0x6a, 0x65, 0x63, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x5b, 0x31, 0x5d,
+  0x2f, 0x40, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x41, 0x6c, 0x6c, 0x6f, 0x77,
+  0x65, 0x64, 0x7d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+  0x50, 0x61, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x40, 0x70, 0x61, 0x74, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x69, 0x64,
+  0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65,
+  0x74, 0x3e, 0x0a
+};
+unsigned int xsl_brexmap_defaults_xsl_len = 1683;
+unsigned char xsl_brexmap_dmtypes_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x62,
+  0x72, 0x65, 0x78, 0x4d, 0x61, 0x70, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22,
+  0x3e, 0x31, 0x2e, 0x30, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22,
+  0x3e, 0x2f, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x6d,
+  0x74, 0x79, 0x70, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x64,
+  0x6d, 0x74, 0x79, 0x70, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x73, 0x74,
+  0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x4f, 0x62, 0x6a, 0x65, 0x63,
+  0x74, 0x52, 0x75, 0x6c, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x22, 0x3e, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x56, 0x61, 0x6c, 0x75,
+  0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x22,
+  0x3e, 0x7b, 0x40, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x41, 0x6c, 0x6c, 0x6f,
+  0x77, 0x65, 0x64, 0x7d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x22, 0x3e, 0x7b, 0x2e, 0x7d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x64, 0x6d, 0x74, 0x79, 0x70,
+  0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2f, 0x2f, 0x73, 0x74,
+  0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x4f, 0x62, 0x6a, 0x65, 0x63,
+  0x74, 0x52, 0x75, 0x6c, 0x65, 0x5b, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+  0x50, 0x61, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x40, 0x70, 0x61, 0x74, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x27, 0x5d, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74,
+  0x3e, 0x0a
+};
+unsigned int xsl_brexmap_dmtypes_xsl_len = 1430;
+unsigned char xsl_sort_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f,
+  0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x7c, 0x64,
+  0x6d, 0x74, 0x79, 0x70, 0x65, 0x73, 0x7c, 0x66, 0x6d, 0x74, 0x79, 0x70,
+  0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75,
+  0x6c, 0x74, 0x7c, 0x74, 0x79, 0x70, 0x65, 0x7c, 0x66, 0x6d, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x7c, 0x40, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x29,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int xsl_sort_xsl_len = 549;
+unsigned char xsl_xml_defaults_to_text_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x58, 0x4d, 0x4c, 0x20, 0x73, 0x31, 0x6b, 0x64, 0x2d,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x27, 0x64, 0x65, 0x66, 0x61, 0x75,
+  0x6c, 0x74, 0x73, 0x27, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x6f,
+  0x20, 0x74, 0x65, 0x78, 0x74, 0x2e, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x74, 0x65,
+  0x78, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2a, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2a, 0x7c, 0x63, 0x6f, 0x6d,
+  0x6d, 0x65, 0x6e, 0x74, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x40, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x26, 0x23, 0x30, 0x39, 0x3b, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x26,
+  0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x63, 0x6f,
+  0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x23, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x26, 0x23,
+  0x31, 0x30, 0x3b, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65,
+  0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int xsl_xml_defaults_to_text_xsl_len = 652;
+unsigned char xsl_xml_dmtypes_to_text_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x58, 0x4d, 0x4c, 0x20, 0x73, 0x31, 0x6b, 0x64, 0x2d,
+  0x6e, 0x65, 0x77, 0x64, 0x6d, 0x20, 0x27, 0x64, 0x6d, 0x74, 0x79, 0x70,
+  0x65, 0x73, 0x27, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x2e, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x74, 0x65, 0x78,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x3d, 0x22, 0x2a, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2a, 0x7c, 0x63, 0x6f, 0x6d, 0x6d,
+  0x65, 0x6e, 0x74, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x3d, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x40, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x26, 0x23, 0x30, 0x39, 0x3b, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73,
+  0x74, 0x3d, 0x22, 0x40, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x26, 0x23, 0x30, 0x39, 0x3b,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x40, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d,
+  0x22, 0x40, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x56, 0x61,
+  0x72, 0x69, 0x61, 0x6e, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x2c, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74,
+  0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x23, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int xsl_xml_dmtypes_to_text_xsl_len = 899;
+unsigned char xsl_xml_fmtypes_to_text_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x58, 0x4d, 0x4c, 0x20, 0x73, 0x31, 0x6b, 0x64, 0x2d,
+  0x6e, 0x65, 0x77, 0x64, 0x6d, 0x20, 0x27, 0x64, 0x6d, 0x74, 0x79, 0x70,
+  0x65, 0x73, 0x27, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x2e, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x74, 0x65, 0x78,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x3d, 0x22, 0x2a, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2a, 0x7c, 0x63, 0x6f, 0x6d, 0x6d,
+  0x65, 0x6e, 0x74, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x3d, 0x22, 0x66, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x26, 0x23, 0x30, 0x39, 0x3b, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x74, 0x79, 0x70,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x40,
+  0x78, 0x73, 0x6c, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x26, 0x23,
+  0x30, 0x39, 0x3b, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x78, 0x73, 0x6c, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x26, 0x23, 0x31, 0x30, 0x3b,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+  0x74, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x23, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int xsl_xml_fmtypes_to_text_xsl_len = 756;
+unsigned char ___common_brexmap_xml[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x62,
+  0x72, 0x65, 0x78, 0x4d, 0x61, 0x70, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64,
+  0x6d, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3d,
+  0x22, 0x2f, 0x2f, 0x40, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61, 0x75,
+  0x6c, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x2f, 0x2f, 0x40,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x49, 0x73, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x22, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x49, 0x73, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x2f, 0x2f,
+  0x40, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x49, 0x73, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x3d,
+  0x22, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x49, 0x73, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64,
+  0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3d,
+  0x22, 0x2f, 0x2f, 0x40, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x49, 0x64, 0x65,
+  0x6e, 0x74, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x69, 0x64, 0x65, 0x6e,
+  0x74, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x49, 0x64, 0x65, 0x6e,
+  0x74, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68,
+  0x3d, 0x22, 0x2f, 0x2f, 0x40, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x44,
+  0x69, 0x66, 0x66, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x69, 0x64, 0x65,
+  0x6e, 0x74, 0x3d, 0x22, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x44, 0x69,
+  0x66, 0x66, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x70, 0x61, 0x74,
+  0x68, 0x3d, 0x22, 0x2f, 0x2f, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73,
+  0x69, 0x62, 0x6c, 0x65, 0x50, 0x61, 0x72, 0x74, 0x6e, 0x65, 0x72, 0x43,
+  0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79, 0x2f, 0x40, 0x65, 0x6e, 0x74, 0x65,
+  0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x20,
+  0x69, 0x64, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x72, 0x65, 0x73, 0x70, 0x6f,
+  0x6e, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x50, 0x61, 0x72, 0x74, 0x6e, 0x65,
+  0x72, 0x43, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79, 0x43, 0x6f, 0x64, 0x65,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61, 0x75,
+  0x6c, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x2f, 0x2f, 0x72,
+  0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x50, 0x61,
+  0x72, 0x74, 0x6e, 0x65, 0x72, 0x43, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79,
+  0x2f, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x4e,
+  0x61, 0x6d, 0x65, 0x22, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x3d, 0x22,
+  0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x50,
+  0x61, 0x72, 0x74, 0x6e, 0x65, 0x72, 0x43, 0x6f, 0x6d, 0x70, 0x61, 0x6e,
+  0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x2f, 0x2f,
+  0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x6f, 0x72, 0x2f, 0x40,
+  0x65, 0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x43, 0x6f,
+  0x64, 0x65, 0x22, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x6f,
+  0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x6f, 0x72, 0x43, 0x6f, 0x64,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x2f, 0x2f,
+  0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x6f, 0x72, 0x2f, 0x65,
+  0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x4e, 0x61, 0x6d,
+  0x65, 0x22, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x6f, 0x72,
+  0x69, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x6f, 0x72, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x70,
+  0x61, 0x74, 0x68, 0x3d, 0x22, 0x2f, 0x2f, 0x40, 0x73, 0x6b, 0x69, 0x6c,
+  0x6c, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x20,
+  0x69, 0x64, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x73, 0x6b, 0x69, 0x6c, 0x6c,
+  0x4c, 0x65, 0x76, 0x65, 0x6c, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20,
+  0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x2f, 0x2f, 0x40, 0x73, 0x65, 0x63,
+  0x75, 0x72, 0x69, 0x74, 0x79, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66,
+  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x69, 0x64, 0x65,
+  0x6e, 0x74, 0x3d, 0x22, 0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79,
+  0x43, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x72, 0x65, 0x78,
+  0x4d, 0x61, 0x70, 0x3e, 0x0a
+};
+unsigned int ___common_brexmap_xml_len = 797;
@@ -0,0 +1,702 @@
+unsigned char dmrl_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x61, 0x20, 0x44, 0x4d, 0x4c, 0x20, 0x74, 0x6f, 0x20,
+  0x61, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x73, 0x31, 0x6b, 0x64, 0x2d, 0x6e, 0x65, 0x77, 0x2a, 0x20, 0x63, 0x61,
+  0x6c, 0x6c, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x6f, 0x2d, 0x69, 0x73, 0x73,
+  0x75, 0x65, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x66, 0x61, 0x6c, 0x73, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6f, 0x76, 0x65, 0x72, 0x77, 0x72,
+  0x69, 0x74, 0x65, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x6f, 0x2d, 0x6f, 0x76,
+  0x65, 0x72, 0x77, 0x72, 0x69, 0x74, 0x65, 0x2d, 0x65, 0x72, 0x72, 0x6f,
+  0x72, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x66,
+  0x61, 0x6c, 0x73, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x65, 0x72, 0x62, 0x6f, 0x73, 0x65,
+  0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x66, 0x61,
+  0x6c, 0x73, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x73, 0x70, 0x65, 0x63, 0x2d, 0x69, 0x73, 0x73,
+  0x75, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6f, 0x75, 0x74,
+  0x64, 0x69, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x6d, 0x74,
+  0x79, 0x70, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x75, 0x73, 0x65, 0x2d, 0x72, 0x65, 0x6d, 0x61, 0x72,
+  0x6b, 0x73, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x66, 0x61, 0x6c, 0x73, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x6f,
+  0x77, 0x65, 0x72, 0x22, 0x3e, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+  0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73,
+  0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x75, 0x70, 0x70,
+  0x65, 0x72, 0x22, 0x3e, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+  0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54,
+  0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x74, 0x65, 0x78,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x3d, 0x22, 0x2a, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2a, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x3d, 0x22, 0x64, 0x6d, 0x6c, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x64, 0x6d, 0x6c, 0x43,
+  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x7c, 0x64, 0x6d, 0x65, 0x6e, 0x74,
+  0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x64, 0x6d, 0x6c, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x7c, 0x64, 0x6d, 0x65,
+  0x6e, 0x74, 0x72, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x64, 0x6d,
+  0x52, 0x65, 0x66, 0x7c, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x64, 0x6d,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x73, 0x31, 0x6b,
+  0x64, 0x2d, 0x6e, 0x65, 0x77, 0x64, 0x6d, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74,
+  0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x6e, 0x6f, 0x2d, 0x69, 0x73, 0x73,
+  0x75, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x20, 0x2d, 0x4e, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69,
+  0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x64, 0x6d, 0x74,
+  0x79, 0x70, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x20, 0x2d, 0x44, 0x20, 0x22, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x24, 0x64, 0x6d, 0x74, 0x79, 0x70, 0x65, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x70,
+  0x6d, 0x52, 0x65, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x73, 0x31, 0x6b, 0x64, 0x2d, 0x6e, 0x65, 0x77, 0x70, 0x6d, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x6e, 0x6f,
+  0x2d, 0x69, 0x73, 0x73, 0x75, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x4e, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20,
+  0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+  0x74, 0x52, 0x65, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x73, 0x31, 0x6b, 0x64, 0x2d, 0x6e, 0x65, 0x77, 0x63, 0x6f, 0x6d,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x3d, 0x22, 0x64, 0x6d, 0x6c, 0x52, 0x65, 0x66, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x73, 0x31, 0x6b, 0x64, 0x2d,
+  0x6e, 0x65, 0x77, 0x64, 0x6d, 0x6c, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x3d, 0x22, 0x24, 0x6e, 0x6f, 0x2d, 0x69, 0x73, 0x73, 0x75,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x20, 0x2d, 0x4e, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65,
+  0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d,
+  0x22, 0x69, 0x6e, 0x66, 0x6f, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x52,
+  0x65, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x73,
+  0x31, 0x6b, 0x64, 0x2d, 0x6e, 0x65, 0x77, 0x69, 0x6d, 0x66, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68,
+  0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x3d, 0x22, 0x24, 0x73, 0x70, 0x65, 0x63, 0x2d, 0x69, 0x73,
+  0x73, 0x75, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d,
+  0x24, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x73, 0x70, 0x65, 0x63, 0x2d,
+  0x69, 0x73, 0x73, 0x75, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74,
+  0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x6f, 0x76, 0x65, 0x72, 0x77, 0x72,
+  0x69, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d,
+  0x66, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69,
+  0x66, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x6e, 0x6f,
+  0x2d, 0x6f, 0x76, 0x65, 0x72, 0x77, 0x72, 0x69, 0x74, 0x65, 0x2d, 0x65,
+  0x72, 0x72, 0x6f, 0x72, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20,
+  0x2d, 0x71, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x76,
+  0x65, 0x72, 0x62, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x20, 0x2d, 0x76, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22,
+  0x24, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x25, 0x20, 0x22, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x24, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x22, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74,
+  0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x6f, 0x75, 0x74, 0x64, 0x69, 0x72,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x40, 0x20, 0x22,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x24, 0x6f, 0x75, 0x74, 0x64, 0x69, 0x72, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x22, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x3d, 0x22, 0x24, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+  0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x64, 0x20,
+  0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x22, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70,
+  0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2a, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x26, 0x23, 0x31, 0x30, 0x3b, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x64, 0x6d, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x64,
+  0x6d, 0x63, 0x7c, 0x70, 0x6d, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x63, 0x6f,
+  0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x64, 0x6d,
+  0x6c, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d,
+  0x23, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2e,
+  0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x69, 0x6e,
+  0x66, 0x6f, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x52, 0x65, 0x66, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x69, 0x6e, 0x66, 0x6f,
+  0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x52, 0x65, 0x66, 0x49, 0x64, 0x65,
+  0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x64, 0x6d, 0x63, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x74,
+  0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x61, 0x76, 0x65, 0x65, 0x22, 0x20, 0x6d, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x3d, 0x22, 0x64, 0x6d, 0x43, 0x6f, 0x64, 0x65, 0x7c,
+  0x61, 0x76, 0x65, 0x65, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x64, 0x65,
+  0x7c, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x69, 0x63, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d,
+  0x44, 0x69, 0x66, 0x66, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x73, 0x64, 0x63,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x63, 0x68, 0x61,
+  0x70, 0x6e, 0x75, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x73, 0x75, 0x62, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x43,
+  0x6f, 0x64, 0x65, 0x7c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x73, 0x75, 0x62, 0x53, 0x75, 0x62,
+  0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x73,
+  0x75, 0x62, 0x73, 0x65, 0x63, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x61, 0x73, 0x73, 0x79, 0x43, 0x6f, 0x64, 0x65,
+  0x7c, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x64, 0x69, 0x73, 0x61, 0x73, 0x73,
+  0x79, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x64,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x64, 0x69, 0x73, 0x61,
+  0x73, 0x73, 0x79, 0x43, 0x6f, 0x64, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
+  0x6e, 0x74, 0x7c, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x64, 0x65, 0x76, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x69, 0x6e, 0x63, 0x6f, 0x64, 0x65,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x7c, 0x69,
+  0x6e, 0x63, 0x6f, 0x64, 0x65, 0x76, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x69, 0x74, 0x65, 0x6d, 0x4c, 0x6f, 0x63, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x69, 0x74, 0x65,
+  0x6d, 0x6c, 0x6f, 0x63, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x3d, 0x22, 0x40, 0x6c, 0x65, 0x61, 0x72, 0x6e, 0x43, 0x6f, 0x64, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x40, 0x6c, 0x65, 0x61, 0x72, 0x6e, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x6c, 0x65, 0x61, 0x72, 0x6e,
+  0x45, 0x76, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69,
+  0x66, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x70, 0x6d, 0x43,
+  0x6f, 0x64, 0x65, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x74,
+  0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x6d, 0x6f, 0x64,
+  0x65, 0x6c, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x64, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x70, 0x6d, 0x49,
+  0x73, 0x73, 0x75, 0x65, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x40, 0x70, 0x6d, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x70, 0x6d, 0x56,
+  0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x6f,
+  0x64, 0x65, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x74, 0x65,
+  0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x73, 0x65, 0x6e, 0x64,
+  0x65, 0x72, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x40, 0x79, 0x65, 0x61, 0x72, 0x4f, 0x66, 0x44,
+  0x61, 0x74, 0x61, 0x49, 0x73, 0x73, 0x75, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x73, 0x65, 0x71, 0x4e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x74, 0x72, 0x61, 0x6e, 0x73, 0x6c, 0x61, 0x74, 0x65, 0x28, 0x40, 0x63,
+  0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x54, 0x79, 0x70, 0x65, 0x2c, 0x20,
+  0x24, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x2c, 0x20, 0x24, 0x75, 0x70, 0x70,
+  0x65, 0x72, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e,
+  0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x64, 0x6d, 0x6c, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x20, 0x6d, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x49, 0x64, 0x65, 0x6e, 0x74,
+  0x43, 0x6f, 0x64, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x40, 0x73, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x49, 0x64, 0x65, 0x6e,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x74, 0x72,
+  0x61, 0x6e, 0x73, 0x6c, 0x61, 0x74, 0x65, 0x28, 0x40, 0x64, 0x6d, 0x6c,
+  0x54, 0x79, 0x70, 0x65, 0x2c, 0x20, 0x24, 0x6c, 0x6f, 0x77, 0x65, 0x72,
+  0x2c, 0x20, 0x24, 0x75, 0x70, 0x70, 0x65, 0x72, 0x29, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x79, 0x65, 0x61, 0x72, 0x4f,
+  0x66, 0x44, 0x61, 0x74, 0x61, 0x49, 0x73, 0x73, 0x75, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x73, 0x65, 0x71, 0x4e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x3d, 0x22, 0x69, 0x73, 0x73, 0x75, 0x65, 0x49, 0x6e, 0x66, 0x6f,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x6e, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40,
+  0x69, 0x73, 0x73, 0x75, 0x65, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x77, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40,
+  0x69, 0x6e, 0x57, 0x6f, 0x72, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x69, 0x73, 0x73, 0x6e, 0x6f, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x20, 0x2d, 0x6e, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x69, 0x73, 0x73,
+  0x6e, 0x6f, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22,
+  0x40, 0x69, 0x6e, 0x77, 0x6f, 0x72, 0x6b, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x20, 0x2d, 0x77, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x69,
+  0x6e, 0x77, 0x6f, 0x72, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x3d, 0x22, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x4c, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x40, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x49, 0x73, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x7c, 0x40, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61,
+  0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x43, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x40, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x49, 0x73,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x7c, 0x40, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x69, 0x73, 0x73, 0x75, 0x65, 0x44, 0x61, 0x74, 0x65, 0x7c, 0x69, 0x73,
+  0x73, 0x64, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d,
+  0x49, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x40, 0x79, 0x65, 0x61, 0x72, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x6d, 0x6f, 0x6e, 0x74, 0x68,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x64, 0x61,
+  0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x64,
+  0x6d, 0x54, 0x69, 0x74, 0x6c, 0x65, 0x7c, 0x64, 0x6d, 0x74, 0x69, 0x74,
+  0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x74, 0x65, 0x63, 0x68, 0x4e, 0x61, 0x6d, 0x65, 0x7c, 0x74,
+  0x65, 0x63, 0x68, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f,
+  0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x7c, 0x69,
+  0x6e, 0x66, 0x6f, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x7c, 0x69, 0x6e, 0x66, 0x6f,
+  0x6e, 0x61, 0x6d, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x21, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
+  0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x74, 0x65, 0x63, 0x68, 0x4e, 0x61, 0x6d, 0x65, 0x7c, 0x74, 0x65, 0x63,
+  0x68, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d,
+  0x74, 0x20, 0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x7c, 0x69, 0x6e, 0x66, 0x6f, 0x6e, 0x61, 0x6d, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x69, 0x20, 0x22, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x22, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x56, 0x61,
+  0x72, 0x69, 0x61, 0x6e, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d,
+  0x56, 0x20, 0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x70, 0x6d, 0x54, 0x69, 0x74,
+  0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x74, 0x20, 0x22,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x22, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x73, 0x68, 0x6f, 0x72, 0x74, 0x50, 0x6d, 0x54,
+  0x69, 0x74, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x73,
+  0x20, 0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x22,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e,
+  0x73, 0x69, 0x62, 0x6c, 0x65, 0x50, 0x61, 0x72, 0x74, 0x6e, 0x65, 0x72,
+  0x43, 0x6f, 0x6d, 0x70, 0x61, 0x6e, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x3d, 0x22, 0x40, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x70, 0x72,
+  0x69, 0x73, 0x65, 0x43, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x20, 0x2d, 0x52, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x65,
+  0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x43, 0x6f, 0x64,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d,
+  0x22, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x4e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d,
+  0x72, 0x20, 0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x65, 0x6e, 0x74, 0x65, 0x72,
+  0x70, 0x72, 0x69, 0x73, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x72, 0x70, 0x63, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x20, 0x2d, 0x52, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69,
+  0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x40, 0x72, 0x70, 0x63,
+  0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20,
+  0x2d, 0x72, 0x20, 0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x72, 0x70, 0x63,
+  0x6e, 0x61, 0x6d, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69,
+  0x66, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x73, 0x65, 0x63,
+  0x75, 0x72, 0x69, 0x74, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d,
+  0x63, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x40, 0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74,
+  0x79, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x7c, 0x40, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x72, 0x65, 0x6d, 0x61,
+  0x72, 0x6b, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22,
+  0x24, 0x75, 0x73, 0x65, 0x2d, 0x72, 0x65, 0x6d, 0x61, 0x72, 0x6b, 0x73,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x2d, 0x6d, 0x20, 0x22,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x50, 0x61,
+  0x72, 0x61, 0x7c, 0x70, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x22, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69,
+  0x66, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65,
+  0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int dmrl_xsl_len = 8380;
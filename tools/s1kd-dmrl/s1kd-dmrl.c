@@ -3,6 +3,11 @@
 #include <getopt.h>
 #include <stdbool.h>
 #include <string.h>
+#include <errno.h>
+#ifndef _WIN32
+#include <spawn.h>
+#include <sys/wait.h>
+#endif
 #include <libxml/tree.h>
 #include <libxml/debugXML.h>
 #include <libxslt/xslt.h>
@@ -12,7 +17,150 @@
 #include "dmrl.h"
 
 #define PROG_NAME "s1kd-dmrl"
-#define VERSION "1.11.0"
+#define VERSION "1.12.0"
+
+#define ERR_PREFIX PROG_NAME ": ERROR: "
+
+#define E_BAD_JOBS ERR_PREFIX "Bad number of jobs: %s\n"
+#define E_SPAWN ERR_PREFIX "Could not run %s: %s\n"
+
+#define EXIT_BAD_JOBS 1
+
+#ifndef _WIN32
+extern char **environ;
+
+/* Split an s1kd-new* command line into its arguments.
+ *
+ * The command lines generated by the DMRL stylesheet only quote arguments
+ * with double quotes, so that is all that is handled here. The text
+ * between quotes is taken literally, with no expansion by a shell.
+ */
+static char **split_command(char *line)
+{
+	char **argv;
+	int argc = 0;
+	char *src, *dst;
+
+	argv = malloc((strlen(line) / 2 + 2) * sizeof(char *));
+
+	src = dst = line;
+
+	while (*src) {
+		bool quoted = false;
+
+		while (*src == ' ' || *src == '\t') {
+			++src;
+		}
+
+		if (!*src) {
+			break;
+		}
+
+		argv[argc++] = dst;
+
+		while (*src && (quoted || (*src != ' ' && *src != '\t'))) {
+			if (*src == '"') {
+				quoted = !quoted;
+			} else {
+				*dst++ = *src;
+			}
+			++src;
+		}
+
+		if (*src) {
+			++src;
+		}
+
+		*dst++ = '\0';
+	}
+
+	argv[argc] = NULL;
+
+	return argv;
+}
+
+/* Start an s1kd-new* command without waiting for it to finish. */
+static int spawn_command(char *line)
+{
+	char **argv;
+	pid_t pid;
+	int e;
+
+	argv = split_command(line);
+
+	if (!argv[0]) {
+		free(argv);
+		return 0;
+	}
+
+	if ((e = posix_spawnp(&pid, argv[0], NULL, NULL, argv, environ)) != 0) {
+		fprintf(stderr, E_SPAWN, argv[0], strerror(e));
+		free(argv);
+		return -1;
+	}
+
+	free(argv);
+
+	return 1;
+}
+
+/* Wait for any running command to finish, and return its exit status. */
+static int wait_command(void)
+{
+	int status;
+
+	if (waitpid(-1, &status, 0) == -1 || !WIFEXITED(status)) {
+		return 1;
+	}
+
+	return WEXITSTATUS(status);
+}
+
+/* Run the s1kd-new* commands for a DMRL, up to jobs at a time.
+ *
+ * FIXME: Each command reads the .defaults, .dmtypes and template files again.
+ * Creating the objects in-process would read them only once, but the
+ * s1kd-new* tools keep their options in file-scope variables, exit() on
+ * errors and clean up the parser when they finish, so they would first need
+ * to be made callable more than once (as was done for libs1kd).
+ */
+static int run_commands(char *content, int jobs, bool failOnFirstErr)
+{
+	char *line = NULL;
+	int err = 0;
+	int running = 0;
+
+	while ((line = strtok(line ? NULL : content, "\n"))) {
+		int started;
+
+		if (running == jobs) {
+			err += wait_command();
+			--running;
+
+			if (err != 0 && failOnFirstErr) {
+				break;
+			}
+		}
+
+		if ((started = spawn_command(line)) == -1) {
+			++err;
+
+			if (failOnFirstErr) {
+				break;
+			}
+		} else {
+			running += started;
+		}
+	}
+
+	while (running > 0) {
+		err += wait_command();
+		--running;
+	}
+
+	return err;
+}
+#endif
 
 static void showHelp(void)
 {
@@ -29,6 +177,9 @@ static void showHelp(void)
 	#endif
 	puts("  -f, --overwrite        Overwrite existing CSDB objects.");
 	puts("  -h, -?, --help         Show usage message.");
+	#ifndef _WIN32
+	puts("  -j, --jobs <n>         Create up to <n> CSDB objects at a time.");
+	#endif
 	puts("  -m, --use-remarks      Use the remarks for entries in the objects.");
 	puts("  -N, --omit-issue       Omit issue/inwork numbers.");
 	puts("  -q, --quiet            Don't report errors if objects exist.");
@@ -54,6 +205,7 @@ int main(int argc, char **argv)
 	bool noIssue = false;
 	#ifndef _WIN32
 	bool failOnFirstErr = false;
+	int jobs = 1;
 	#endif
 	bool overwrite = false;
 	bool noOverwriteError = false;
@@ -65,7 +217,7 @@ int main(int argc, char **argv)
 	char *dmtypesFname = NULL;
 	bool use_remarks = false;
 
-	const char *sopts = "D:d:smNfFq$:%:@:vh?";
+	const char *sopts = "D:d:smNfFj:q$:%:@:vh?";
 	struct option lopts[] = {
 		{"version"    , no_argument      , 0, 0},
 		{"help"       , no_argument      , 0, 'h'},
@@ -76,6 +228,7 @@ int main(int argc, char **argv)
 		{"omit-issue" , no_argument      , 0, 'N'},
 		{"overwrite"  , no_argument      , 0, 'f'},
 		{"fail"       , no_argument      , 0, 'F'},
+		{"jobs"       , required_argument, 0, 'j'},
 		{"quiet"      , no_argument      , 0, 'q'},
 		{"issue"      , required_argument, 0, '$'},
 		{"verbose"    , no_argument      , 0, 'v'},
@@ -120,6 +273,12 @@ int main(int argc, char **argv)
 			case 'F':
 				failOnFirstErr = true;
 				break;
+			case 'j':
+				if ((jobs = atoi(optarg)) < 1) {
+					fprintf(stderr, E_BAD_JOBS, optarg);
+					exit(EXIT_BAD_JOBS);
+				}
+				break;
 			#endif
 			case 'q':
 				noOverwriteError = true;
@@ -231,24 +390,16 @@ int main(int argc, char **argv)
 
 		if (execute) {
 			#ifdef _WIN32
-			/* FIXME: Implement alternative to fmemopen and
-			 * WEXITSTATUS in order to use the -F ("fail on first
-			 * error") option on a Windows system.
+			/* FIXME: Implement alternative to posix_spawnp and
+			 * waitpid in order to use the -F ("fail on first
+			 * error") and -j options on a Windows system.
 			 */
 			char *line = NULL;
 			while ((line = strtok(line ? NULL : (char *) content, "\n"))) {
 				system(line);
 			}
 			#else
-			FILE *lines;
-			char line[LINE_MAX];
-
-			lines = fmemopen(content, xmlStrlen(content), "r");
-
-			while (fgets(line, LINE_MAX, lines))
-				if ((err += WEXITSTATUS(system(line))) != 0 && failOnFirstErr) break;
-
-			fclose(lines);
+			err += run_commands((char *) content, jobs, failOnFirstErr);
 			#endif
 		} else {
 			fputs((char *) content, stdout);
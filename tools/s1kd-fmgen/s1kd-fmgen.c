@@ -5,18 +5,20 @@
 #include <ctype.h>
 #include <stdbool.h>
 #include <time.h>
+#include <pthread.h>
 
 #include <libxml/tree.h>
 #include <libxml/xpath.h>
 #include <libxml/xpathInternals.h>
 #include <libxml/uri.h>
+#include <libxml/hash.h>
 #include <libxslt/transform.h>
 
 #include "s1kd_tools.h"
 #include "xsl.h"
 
 #define PROG_NAME "s1kd-fmgen"
-#define VERSION "3.5.3"
+#define VERSION "3.6.0"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 #define INF_PREFIX PROG_NAME ": INFO: "
@@ -26,6 +28,7 @@
 #define EXIT_BAD_TYPE 3
 #define EXIT_MERGE 4
 #define EXIT_BAD_STYLESHEET 5
+#define EXIT_BAD_JOBS 6
 
 #define S_NO_PM_ERR ERR_PREFIX "No publication module.\n"
 #define S_NO_TYPE_ERR ERR_PREFIX "No FM type specified.\n"
@@ -35,6 +38,7 @@
 #define E_MERGE_NAME ERR_PREFIX "Failed to update %s: no <%s> element to merge on.\n"
 #define E_MERGE_ELEM ERR_PREFIX "Failed to update %s: no front matter contents generated.\n"
 #define E_BAD_STYLESHEET ERR_PREFIX "Failed to update %s: %s is not a valid stylesheet.\n"
+#define E_BAD_JOBS ERR_PREFIX "Bad number of jobs: %s\n"
 #define I_GENERATE INF_PREFIX "Generating FM content for %s (%s)...\n"
 #define I_NO_INFOCODE INF_PREFIX "Skipping %s as no FM type is associated with info code: %s%s\n"
 #define I_TRANSFORM INF_PREFIX "Applying transformation %s...\n"
@@ -81,84 +85,61 @@ static bool has_param(const char **params, const char *name)
 	return false;
 }
 
-/* Apply an XProc XSLT step to a document. */
-static xmlDocPtr apply_xproc_xslt(const xmlDocPtr doc, const char *xslpath, const xmlNodePtr xslt, const char **params)
+/* A step of an XProc pipeline of XSLT stylesheets. */
+struct fm_xproc_step {
+	xsltStylesheetPtr style; /* NULL if the step copies its input. */
+	char **params;           /* Names and values of the step's parameters. */
+	xmlChar *name;           /* Name of the step, for debug messages. */
+	long line;
+};
+
+/* A compiled XSLT stylesheet or XProc pipeline of stylesheets.
+ *
+ * Each stylesheet is compiled once, by the main thread, and shared by all the
+ * threads that apply it, each of which uses its own transformation context.
+ */
+struct fm_xsl {
+	xsltStylesheetPtr style;
+	struct fm_xproc_step *steps;
+	int nsteps;
+};
+
+/* Compiled stylesheets, by path or by type of built-in front matter. */
+static xmlHashTablePtr fm_xsls = NULL;
+
+/* Compile an XProc XSLT step. */
+static void compile_xproc_step(struct fm_xproc_step *step, const char *xslpath, const xmlNodePtr xslt)
 {
 	xmlXPathContextPtr ctx;
 	xmlXPathObjectPtr obj;
-	xmlDocPtr res;
-	const char **combined_params;
-	int i, nparams = 0;
+	int i, n = 0;
 
-	if (verbosity >= DEBUG) {
-		xmlChar *name = xmlGetProp(xslt, BAD_CAST "name");
-
-		if (name) {
-			fprintf(stderr, I_XPROC_TRANSFORM, xslpath, name);
-		} else {
-			fprintf(stderr, I_XPROC_TRANSFORM_NONAME, xslpath, xmlGetLineNo(xslt));
-		}
-
-		xmlFree(name);
-	}
+	step->name = xmlGetProp(xslt, BAD_CAST "name");
+	step->line = xmlGetLineNo(xslt);
 
 	ctx = xmlXPathNewContext(xslt->doc);
 	xmlXPathRegisterNs(ctx, BAD_CAST "p", BAD_CAST "http://www.w3.org/ns/xproc");
 	xmlXPathSetContextNode(xslt, ctx);
 
-	/* Get number of current params. */
-	for (i = 0; params[i]; i += 2, ++nparams);
-
-	/* Combine the current params with additional params from the XSLT step. */
+	/* Read the additional params from the XSLT step. */
 	obj = xmlXPathEvalExpression(BAD_CAST "p:with-param", ctx);
 	if (xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		/* If there are no additional params, simply copy the current
-		 * params. */
-		combined_params = malloc((nparams * 2 + 1) * sizeof(char *));
-
-		for (i = 0; params[i]; ++i) {
-			combined_params[i] = strdup(params[i]);
-		}
-
-		combined_params[i] = NULL;
+		step->params = malloc(sizeof(char *));
 	} else {
-		/* If there are additional params, copy the current params and
-		 * then append the additional ones. */
-		int j;
-
-		combined_params = malloc(((nparams + obj->nodesetval->nodeNr) * 2 + 1) * sizeof(char *));
-
-		for (j = 0; params[j]; ++j) {
-			combined_params[j] = strdup(params[j]);
-		}
+		step->params = malloc((obj->nodesetval->nodeNr * 2 + 1) * sizeof(char *));
 
 		for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
-			char *name;
-
-			name = (char *) xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "name");
-
-			/* User-defined parameters override XProc parameters. */
-			if (has_param(params, name)) {
-				xmlFree(name);
-			} else {
-				char *select;
-
-				select = (char *) xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "select");
-
-				combined_params[j++] = name;
-				combined_params[j++] = select;
-			}
+			step->params[n++] = (char *) xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "name");
+			step->params[n++] = (char *) xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "select");
 		}
-
-		combined_params[j] = NULL;
 	}
+	step->params[n] = NULL;
 	xmlXPathFreeObject(obj);
 
 	/* Read the XProc stylesheet input. */
+	step->style = NULL;
 	obj = xmlXPathEvalExpression(BAD_CAST "p:input[@port='stylesheet']/p:*", ctx);
-	if (xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		res = xmlCopyDoc(doc, 1);
-	} else {
+	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
 		xmlNodePtr src = obj->nodesetval->nodeTab[0];
 		xmlDocPtr s;
 
@@ -177,37 +158,23 @@ static xmlDocPtr apply_xproc_xslt(const xmlDocPtr doc, const char *xslpath, cons
 		}
 
 		if (s) {
-			xsltStylesheetPtr style;
-			style = xsltParseStylesheetDoc(s);
-			res   = xsltApplyStylesheet(style, doc, combined_params);
-			xsltFreeStylesheet(style);
-		} else {
-			res = xmlCopyDoc(doc, 1);
+			step->style = xsltParseStylesheetDoc(s);
 		}
 	}
 	xmlXPathFreeObject(obj);
 
 	xmlXPathFreeContext(ctx);
-
-	for (i = 0; combined_params[i]; i += 2) {
-		xmlFree((char *) combined_params[i]);
-		xmlFree((char *) combined_params[i + 1]);
-	}
-	free(combined_params);
-
-	return res;
 }
 
-static xmlDocPtr transform_doc(xmlDocPtr doc, const char *xslpath, const char **params)
+/* Compile an XSLT stylesheet or XProc pipeline of stylesheets. */
+static struct fm_xsl *compile_xsl(const char *xslpath)
 {
-	xmlDocPtr styledoc, res = NULL;
-	xsltStylesheetPtr style;
+	xmlDocPtr styledoc;
 	xmlXPathContextPtr ctx;
 	xmlXPathObjectPtr obj;
+	struct fm_xsl *xsl;
 
-	if (verbosity >= DEBUG) {
-		fprintf(stderr, I_TRANSFORM, xslpath);
-	}
+	xsl = calloc(1, sizeof(struct fm_xsl));
 
 	styledoc = read_xml_doc(xslpath);
 
@@ -216,18 +183,16 @@ static xmlDocPtr transform_doc(xmlDocPtr doc, const char *xslpath, const char **
 	obj = xmlXPathEvalExpression(BAD_CAST "/p:pipeline/p:xslt", ctx);
 
 	if (xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		style = xsltParseStylesheetDoc(styledoc);
-		res = xsltApplyStylesheet(style, doc, params);
-		xsltFreeStylesheet(style);
+		xsl->style = xsltParseStylesheetDoc(styledoc);
 		styledoc = NULL;
 	} else {
 		int i;
-		xmlDocPtr d = xmlCopyDoc(doc, 1);
 
-		for (i =0; i < obj->nodesetval->nodeNr; ++i) {
-			res = apply_xproc_xslt(d, xslpath, obj->nodesetval->nodeTab[i], params);
-			xmlFreeDoc(d);
-			d = res;
+		xsl->nsteps = obj->nodesetval->nodeNr;
+		xsl->steps = malloc(xsl->nsteps * sizeof(struct fm_xproc_step));
+
+		for (i = 0; i < xsl->nsteps; ++i) {
+			compile_xproc_step(&xsl->steps[i], xslpath, obj->nodesetval->nodeTab[i]);
 		}
 	}
 
@@ -236,23 +201,7 @@ static xmlDocPtr transform_doc(xmlDocPtr doc, const char *xslpath, const char **
 
 	xmlFreeDoc(styledoc);
 
-	return res;
-}
-
-static xmlDocPtr transform_doc_builtin(xmlDocPtr doc, unsigned char *xsl, unsigned int len, const char **params)
-{
-	xmlDocPtr styledoc, res;
-	xsltStylesheetPtr style;
-
-	styledoc = read_xml_mem((const char *) xsl, len);
-
-	style = xsltParseStylesheetDoc(styledoc);
-
-	res = xsltApplyStylesheet(style, doc, params);
-
-	xsltFreeStylesheet(style);
-
-	return res;
+	return xsl;
 }
 
 static void get_builtin_xsl(const char *type, unsigned char **xsl, unsigned int *len)
@@ -295,14 +244,147 @@ static void get_builtin_xsl(const char *type, unsigned char **xsl, unsigned int
 	}
 }
 
-static xmlDocPtr generate_fm(xmlDocPtr doc, const char *type, const char **params)
+/* Compile the built-in XSLT for a type of front matter. */
+static struct fm_xsl *compile_builtin_xsl(const char *type)
 {
 	unsigned char *xsl;
 	unsigned int len;
+	struct fm_xsl *fmxsl;
 
 	get_builtin_xsl(type, &xsl, &len);
 
-	return transform_doc_builtin(doc, xsl, len, params);
+	fmxsl = calloc(1, sizeof(struct fm_xsl));
+	fmxsl->style = xsltParseStylesheetDoc(read_xml_mem((const char *) xsl, len));
+
+	return fmxsl;
+}
+
+static void free_fm_xsl(void *payload, const xmlChar *name)
+{
+	struct fm_xsl *xsl = (struct fm_xsl *) payload;
+	int i;
+
+	for (i = 0; i < xsl->nsteps; ++i) {
+		int j;
+
+		for (j = 0; xsl->steps[i].params[j]; ++j) {
+			xmlFree(xsl->steps[i].params[j]);
+		}
+		free(xsl->steps[i].params);
+		xmlFree(xsl->steps[i].name);
+		xsltFreeStylesheet(xsl->steps[i].style);
+	}
+
+	free(xsl->steps);
+	xsltFreeStylesheet(xsl->style);
+	free(xsl);
+}
+
+/* Return a compiled stylesheet, either from a path or the built-in XSLT for a
+ * type of front matter, compiling it if needed.
+ *
+ * Stylesheets must be compiled before any threads which apply them are
+ * started, as the cache is not locked. */
+static struct fm_xsl *get_fm_xsl(const char *type, const char *xslpath)
+{
+	struct fm_xsl *xsl;
+	const xmlChar *name, *kind;
+
+	if (xslpath) {
+		name = BAD_CAST xslpath;
+		kind = BAD_CAST "xsl";
+	} else {
+		name = BAD_CAST type;
+		kind = BAD_CAST "builtin";
+	}
+
+	if (!fm_xsls) {
+		fm_xsls = xmlHashCreate(16);
+	}
+
+	if (!(xsl = xmlHashLookup2(fm_xsls, name, kind))) {
+		xsl = xslpath ? compile_xsl(xslpath) : compile_builtin_xsl(type);
+		xmlHashAddEntry2(fm_xsls, name, kind, xsl);
+	}
+
+	return xsl;
+}
+
+/* Apply an XProc XSLT step to a document. */
+static xmlDocPtr apply_xproc_step(const struct fm_xproc_step *step, const xmlDocPtr doc, const char *xslpath, const char **params)
+{
+	xmlDocPtr res;
+	const char **combined_params;
+	int i, j, nparams = 0;
+
+	if (verbosity >= DEBUG) {
+		if (step->name) {
+			fprintf(stderr, I_XPROC_TRANSFORM, xslpath, step->name);
+		} else {
+			fprintf(stderr, I_XPROC_TRANSFORM_NONAME, xslpath, step->line);
+		}
+	}
+
+	if (!step->style) {
+		return xmlCopyDoc(doc, 1);
+	}
+
+	/* Get number of current and additional params. */
+	for (i = 0; params[i]; i += 2, ++nparams);
+	for (i = 0; step->params[i]; i += 2, ++nparams);
+
+	/* Combine the current params with additional params from the XSLT
+	 * step. User-defined parameters override XProc parameters. */
+	combined_params = malloc((nparams * 2 + 1) * sizeof(char *));
+
+	for (j = 0; params[j]; ++j) {
+		combined_params[j] = params[j];
+	}
+
+	for (i = 0; step->params[i]; i += 2) {
+		if (!has_param(params, step->params[i])) {
+			combined_params[j++] = step->params[i];
+			combined_params[j++] = step->params[i + 1];
+		}
+	}
+
+	combined_params[j] = NULL;
+
+	res = xsltApplyStylesheet(step->style, doc, combined_params);
+
+	free(combined_params);
+
+	return res;
+}
+
+/* Apply a compiled stylesheet to a document. */
+static xmlDocPtr apply_fm_xsl(const struct fm_xsl *xsl, const char *xslpath, xmlDocPtr doc, const char **params)
+{
+	xmlDocPtr res;
+	int i;
+
+	if (xslpath && verbosity >= DEBUG) {
+		fprintf(stderr, I_TRANSFORM, xslpath);
+	}
+
+	if (!xsl->steps) {
+		return xsltApplyStylesheet(xsl->style, doc, params);
+	}
+
+	/* The input of each step after the first is the output of the
+	 * previous one. */
+	res = doc;
+	for (i = 0; i < xsl->nsteps && res; ++i) {
+		xmlDocPtr d = res;
+
+		res = apply_xproc_step(&xsl->steps[i], d, xslpath, params);
+
+		if (d != doc) {
+			xmlFreeDoc(d);
+		}
+	}
+
+	return res;
 }
 
 static void set_def_param(const char **params, int i, const char *val)
@@ -330,63 +412,463 @@ static bool default_ignore_del(const char *type)
 		strcmp(type, "TP")    == 0;
 }
 
-/* Remove "deleted" DMs from the flattend PM format. */
-static void rem_deleted_dmodules(xmlDocPtr doc)
+/* Determine whether a DM in the flattened PM format is "deleted". */
+static bool is_deleted_dmodule(xmlNodePtr node)
 {
-	xmlXPathContextPtr ctx;
-	xmlXPathObjectPtr obj;
+	xmlNodePtr status;
+	xmlChar *type;
+	bool is;
 
-	ctx = xmlXPathNewContext(doc);
-	obj = xmlXPathEvalExpression(BAD_CAST "//dmodule[identAndStatusSection/dmStatus/@issueType='deleted' or status/issno/@isstype='deleted']", ctx);
+	if (!(status = first_xpath_node(NULL, node, BAD_CAST "identAndStatusSection/dmStatus|status/issno"))) {
+		return false;
+	}
 
-	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		int i;
-		for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
-			xmlUnlinkNode(obj->nodesetval->nodeTab[i]);
-			xmlFreeNode(obj->nodesetval->nodeTab[i]);
-			obj->nodesetval->nodeTab[i] = NULL;
+	if (xmlStrcmp(status->name, BAD_CAST "issno") == 0) {
+		type = xmlGetProp(status, BAD_CAST "isstype");
+	} else {
+		type = xmlGetProp(status, BAD_CAST "issueType");
+	}
+
+	is = xmlStrcmp(type, BAD_CAST "deleted") == 0;
+
+	xmlFree(type);
+
+	return is;
+}
+
+/* Determine whether an element of the flattened PM format is a "deleted" DM
+ * or is marked as "delete". */
+static bool is_deleted_node(xmlNodePtr node)
+{
+	xmlChar *change;
+	bool del;
+
+	if (!(change = xmlGetProp(node, BAD_CAST "change"))) {
+		change = xmlGetProp(node, BAD_CAST "changeType");
+	}
+
+	del = xmlStrcmp(change, BAD_CAST "delete") == 0 ||
+		(xmlStrcmp(node->name, BAD_CAST "dmodule") == 0 && is_deleted_dmodule(node));
+
+	xmlFree(change);
+
+	return del;
+}
+
+/* Remove "deleted" DMs and elements marked as "delete" from the flattened PM
+ * format, in a single walk of the document. */
+static void rem_deleted_nodes(xmlNodePtr node)
+{
+	xmlNodePtr cur;
+
+	if (is_deleted_node(node)) {
+		xmlUnlinkNode(node);
+		xmlFreeNode(node);
+		return;
+	}
+
+	cur = node->children;
+	while (cur) {
+		xmlNodePtr next = cur->next;
+
+		if (cur->type == XML_ELEMENT_NODE) {
+			rem_deleted_nodes(cur);
 		}
+
+		cur = next;
 	}
+}
 
-	xmlXPathFreeObject(obj);
-	xmlXPathFreeContext(ctx);
+/* The parts of the PM that the built-in types of front matter are generated
+ * from. */
+enum fm_part {
+	FM_PART_PM,       /* The PM without the content of its DMs. */
+	FM_PART_ACRONYMS, /* Acronyms. */
+	FM_PART_FIGURES,  /* Figures, with only their titles and graphics. */
+	FM_PART_TABLES,   /* Titled tables, with the address of their DM. */
+	FM_PARTS
+};
+
+/* Return the part of the PM a built-in type of front matter is generated from,
+ * or -1 if the type is not built-in. */
+static int get_fm_part(const char *type)
+{
+	if (strcmp(type, "TP") == 0 ||
+	    strcmp(type, "TOC") == 0 ||
+	    strcmp(type, "HIGH") == 0 ||
+	    strcmp(type, "LOEDM") == 0) {
+		return FM_PART_PM;
+	} else if (
+	    strcmp(type, "LOA") == 0 ||
+	    strcmp(type, "LOASD") == 0 ||
+	    strcmp(type, "LOS") == 0 ||
+	    strcmp(type, "LOT") == 0) {
+		return FM_PART_ACRONYMS;
+	} else if (strcmp(type, "LOI") == 0) {
+		return FM_PART_FIGURES;
+	} else if (strcmp(type, "LOTBL") == 0) {
+		return FM_PART_TABLES;
+	}
+
+	return -1;
+}
+
+/* Copy a node of the PM in to a collected part, optionally without "deleted"
+ * content. Returns NULL if the node itself is "deleted". */
+static xmlNodePtr copy_fm_node(xmlNodePtr node, xmlDocPtr doc, bool nodel)
+{
+	xmlNodePtr copy;
+
+	if (nodel && is_deleted_node(node)) {
+		return NULL;
+	}
+
+	copy = xmlDocCopyNode(node, doc, 1);
+
+	if (nodel) {
+		rem_deleted_nodes(copy);
+	}
+
+	return copy;
+}
+
+/* Copy the children of a node with a given name in to a collected part. */
+static void copy_fm_children(xmlNodePtr dst, xmlNodePtr node, const char *name, bool nodel)
+{
+	xmlNodePtr cur;
+
+	for (cur = node->children; cur; cur = cur->next) {
+		xmlNodePtr copy;
+
+		if (xmlStrcmp(cur->name, BAD_CAST name) == 0 && (copy = copy_fm_node(cur, dst->doc, nodel))) {
+			xmlAddChild(dst, copy);
+		}
+	}
 }
 
-static xmlDocPtr generate_fm_content_for_type(xmlDocPtr doc, const char *type, const char *fmxsl, const char *xslpath, const char **params, const bool ignore_del)
+/* State of the walk collecting the parts of the PM, for one of the two
+ * variants of each part: [0] with and [1] without "deleted" content. */
+struct fm_walk {
+	xmlNodePtr pm[2];     /* Parent of the next node of the PM part. */
+	xmlNodePtr tables[2]; /* DM of the next titled table. */
+	bool acronym;         /* Whether the walk is inside an acronym. */
+	bool deleted;         /* Whether the walk is inside "deleted" content. */
+};
+
+/* Collect the parts of the PM from one node and its descendants. */
+static void collect_fm_parts(xmlDocPtr parts[FM_PARTS][2], xmlNodePtr node, struct fm_walk walk)
 {
-	xmlDocPtr src, res = NULL;
-	int i = 0;
+	xmlNodePtr cur;
+	bool dm, content = false;
+	int i;
+
+	if (!walk.deleted && is_deleted_node(node)) {
+		walk.deleted = true;
+	}
+
+	dm = xmlStrcmp(node->name, BAD_CAST "dmodule") == 0;
+
+	for (i = 0; i < 2; ++i) {
+		xmlDocPtr doc;
+		bool nodel = i == 1;
+
+		if (nodel && walk.deleted) {
+			walk.pm[i] = NULL;
+			continue;
+		}
+
+		/* The content of DMs is left out of the PM part. */
+		if (walk.pm[i]) {
+			if (xmlStrcmp(node->name, BAD_CAST "content") == 0 && node->parent &&
+			    xmlStrcmp(node->parent->name, BAD_CAST "dmodule") == 0) {
+				walk.pm[i] = NULL;
+			} else {
+				walk.pm[i] = xmlAddChild(walk.pm[i], xmlDocCopyNode(node, walk.pm[i]->doc, 2));
+			}
+		}
+
+		if ((doc = parts[FM_PART_ACRONYMS][i]) && !walk.acronym &&
+		    xmlStrcmp(node->name, BAD_CAST "acronym") == 0) {
+			xmlAddChild(xmlDocGetRootElement(doc), copy_fm_node(node, doc, nodel));
+		}
+
+		if ((doc = parts[FM_PART_FIGURES][i]) && xmlStrcmp(node->name, BAD_CAST "figure") == 0) {
+			xmlNodePtr figure;
+
+			figure = xmlNewChild(xmlDocGetRootElement(doc), NULL, BAD_CAST "figure", NULL);
+			copy_fm_children(figure, node, "title", nodel);
+			copy_fm_children(figure, node, "graphic", nodel);
+		}
+
+		if ((doc = parts[FM_PART_TABLES][i])) {
+			if (dm) {
+				xmlNodePtr ident, address;
+
+				walk.tables[i] = xmlNewChild(xmlDocGetRootElement(doc), NULL, BAD_CAST "dmodule", NULL);
+				ident = xmlNewChild(walk.tables[i], NULL, BAD_CAST "identAndStatusSection", NULL);
+
+				if ((address = first_xpath_node(NULL, node, BAD_CAST "identAndStatusSection/dmAddress")) &&
+				    (address = copy_fm_node(address, doc, nodel))) {
+					xmlAddChild(ident, address);
+				}
+			} else if (xmlStrcmp(node->name, BAD_CAST "table") == 0) {
+				xmlNodePtr table;
+
+				table = xmlNewDocNode(doc, NULL, BAD_CAST "table", NULL);
+				copy_fm_children(table, node, "title", nodel);
+
+				if (table->children) {
+					xmlAddChild(walk.tables[i] ? walk.tables[i] : xmlDocGetRootElement(doc), table);
+				} else {
+					xmlFreeNode(table);
+				}
+			}
+		}
+
+		content |= walk.pm[i] || parts[FM_PART_ACRONYMS][i] || parts[FM_PART_FIGURES][i] || parts[FM_PART_TABLES][i];
+	}
+
+	/* Nothing more is collected from the descendants of this node. */
+	if (!content) {
+		return;
+	}
+
+	if (xmlStrcmp(node->name, BAD_CAST "acronym") == 0) {
+		walk.acronym = true;
+	}
+
+	for (cur = node->children; cur; cur = cur->next) {
+		if (cur->type == XML_ELEMENT_NODE) {
+			collect_fm_parts(parts, cur, walk);
+		} else {
+			for (i = 0; i < 2; ++i) {
+				if (walk.pm[i]) {
+					xmlAddChild(walk.pm[i], xmlDocCopyNode(cur, walk.pm[i]->doc, 1));
+				}
+			}
+		}
+	}
+}
+
+/* Contents generated for a type of front matter, shared by all the front
+ * matter DMs of that type. */
+struct fm_content {
+	const char *type;
+	const char *xsl;
+	bool ignore_del;
+	struct fm_xsl *style;
+	xmlDocPtr doc;
+};
+
+/* The PM that front matter is generated from.
+ *
+ * Everything derived from the PM is prepared at most once per run and shared
+ * by all front matter DMs: the copy of the PM with "deleted" content removed,
+ * and the contents generated for each type of front matter.
+ *
+ * The built-in types of front matter are not generated from the whole PM, but
+ * from the parts of it they use. The parts needed by all the front matter DMs
+ * are collected in a single walk of the PM, which also leaves out "deleted"
+ * content for the types that ignore it, so the PM is neither copied nor
+ * walked again for each type.
+ *
+ * When contents are generated by several threads, the PM is shared by them
+ * and is only read, except by libxslt, which annotates the nodes of the
+ * source document during a transformation (for generate-id(), keys, etc.).
+ * The whole PM is therefore only transformed by one thread at a time, while
+ * each thread transforms its own copy of the much smaller collected parts.
+ */
+struct fm_source {
+	xmlDocPtr pm;
+	xmlDocPtr pm_nodel;
+	bool threads;
+	pthread_mutex_t locks[2];
+	bool wanted[FM_PARTS][2];
+	xmlDocPtr parts[FM_PARTS][2];
+	xmlHashTablePtr contents;
+	struct fm_content **list;
+	int ncontents;
+};
+
+static void init_fm_source(struct fm_source *src, xmlDocPtr pm)
+{
+	src->pm = pm;
+	src->pm_nodel = NULL;
+	src->threads = false;
+	pthread_mutex_init(&src->locks[0], NULL);
+	pthread_mutex_init(&src->locks[1], NULL);
+	memset(src->wanted, 0, sizeof(src->wanted));
+	memset(src->parts, 0, sizeof(src->parts));
+	src->contents = xmlHashCreate(16);
+	src->list = NULL;
+	src->ncontents = 0;
+}
+
+static void free_fm_content(void *payload, const xmlChar *name)
+{
+	struct fm_content *content = (struct fm_content *) payload;
+	xmlFreeDoc(content->doc);
+	free(content);
+}
+
+static void free_fm_source(struct fm_source *src)
+{
+	int i, j;
+
+	for (i = 0; i < FM_PARTS; ++i) {
+		for (j = 0; j < 2; ++j) {
+			xmlFreeDoc(src->parts[i][j]);
+		}
+	}
+
+	xmlHashFree(src->contents, free_fm_content);
+	free(src->list);
+	xmlFreeDoc(src->pm_nodel);
+	pthread_mutex_destroy(&src->locks[0]);
+	pthread_mutex_destroy(&src->locks[1]);
+}
+
+/* Return the PM with "deleted" DMs and elements removed. */
+static xmlDocPtr get_pm_nodel(struct fm_source *src)
+{
+	if (!src->pm_nodel) {
+		xmlNodePtr root;
+
+		src->pm_nodel = xmlCopyDoc(src->pm, 1);
+
+		if ((root = xmlDocGetRootElement(src->pm_nodel))) {
+			rem_deleted_nodes(root);
+		}
+	}
+
+	return src->pm_nodel;
+}
+
+/* Collect all the wanted parts of the PM which have not been collected yet. */
+static void collect_fm_source(struct fm_source *src)
+{
+	xmlDocPtr parts[FM_PARTS][2] = {{NULL}};
+	struct fm_walk walk = {{NULL}};
+	xmlNodePtr root;
+	bool any = false;
+	int i, j;
+
+	if (!(root = xmlDocGetRootElement(src->pm))) {
+		return;
+	}
+
+	for (i = 0; i < FM_PARTS; ++i) {
+		for (j = 0; j < 2; ++j) {
+			if (!src->wanted[i][j] || src->parts[i][j]) {
+				continue;
+			}
+
+			parts[i][j] = xmlNewDoc(BAD_CAST "1.0");
+
+			if (i == FM_PART_PM) {
+				walk.pm[j] = (xmlNodePtr) parts[i][j];
+			} else {
+				xmlDocSetRootElement(parts[i][j], xmlDocCopyNode(root, parts[i][j], 2));
+			}
+
+			src->parts[i][j] = parts[i][j];
+			any = true;
+		}
+	}
+
+	if (any) {
+		collect_fm_parts(parts, root, walk);
+	}
+}
+
+/* Note that the contents for a type of front matter will be generated.
+ *
+ * The stylesheet used to generate them is compiled, the part of the PM they
+ * are generated from is marked to be collected along with the others, or the
+ * copy of the whole PM without "deleted" content is made, so that all of this
+ * is done before the contents are generated.
+ */
+static struct fm_content *want_fm_content(struct fm_source *src, const char *type, const char *xsl, bool ignore_del)
+{
+	struct fm_content *content;
+	const xmlChar *igndel;
+	int part;
+
+	igndel = BAD_CAST (ignore_del ? "yes" : "no");
+
+	if ((content = xmlHashLookup3(src->contents, BAD_CAST type, BAD_CAST xsl, igndel))) {
+		return content;
+	}
+
+	content = malloc(sizeof(struct fm_content));
+	content->type = type;
+	content->xsl = xsl;
+	content->ignore_del = ignore_del;
+	content->style = get_fm_xsl(type, xsl);
+	content->doc = NULL;
+
+	if (!xsl && (part = get_fm_part(type)) != -1) {
+		src->wanted[part][ignore_del] = true;
+	} else if (ignore_del) {
+		get_pm_nodel(src);
+	}
+
+	xmlHashAddEntry3(src->contents, BAD_CAST type, BAD_CAST xsl, igndel, content);
+
+	src->list = realloc(src->list, (src->ncontents + 1) * sizeof(struct fm_content *));
+	src->list[src->ncontents++] = content;
+
+	return content;
+}
+
+/* Generate the contents for a type of front matter.
+ *
+ * Contents are only generated once per type, XSLT and whether deleted content
+ * is ignored, regardless of how many DMs use them.
+ */
+static void generate_fm_content(struct fm_source *src, struct fm_content *content, const char **params)
+{
+	int i, part;
 
 	/* Supply values to default parameters. */
 	for (i = 0; params[i]; i += 2) {
 		if (strcmp(params[i], "type") == 0) {
-			set_def_param(params, i + 1, type);
+			set_def_param(params, i + 1, content->type);
 		}
 	}
 
-	/* Certain types of FM should ignore "deleted" objects/elements. */
-	if (ignore_del) {
-		src = xmlCopyDoc(doc, 1);
-		rem_deleted_dmodules(src);
-		rem_delete_elems(src);
-	} else {
-		src = doc;
-	}
+	if (!content->xsl && (part = get_fm_part(content->type)) != -1) {
+		xmlDocPtr doc = src->parts[part][content->ignore_del];
 
-	/* Generate contents. */
-	if (xslpath) {
-		res = transform_doc(src, xslpath, params);
-	} else if (fmxsl) {
-		res = transform_doc(src, fmxsl, params);
+		if (src->threads) {
+			doc = xmlCopyDoc(doc, 1);
+		}
+
+		content->doc = apply_fm_xsl(content->style, NULL, doc, params);
+
+		if (src->threads) {
+			xmlFreeDoc(doc);
+		}
 	} else {
-		res = generate_fm(src, type, params);
-	}
+		xmlDocPtr doc;
 
-	if (ignore_del) {
-		xmlFreeDoc(src);
-	}
+		/* Certain types of FM should ignore "deleted" objects/elements. */
+		if (content->ignore_del) {
+			doc = src->pm_nodel;
+		} else {
+			doc = src->pm;
+		}
 
-	return res;
+		if (src->threads) {
+			pthread_mutex_lock(&src->locks[content->ignore_del]);
+		}
+
+		content->doc = apply_fm_xsl(content->style, content->xsl, doc, params);
+
+		if (src->threads) {
+			pthread_mutex_unlock(&src->locks[content->ignore_del]);
+		}
+	}
 }
 
 static xmlNodePtr find_fm(xmlDocPtr fmtypes, const xmlChar *incode, const xmlChar *incodev)
@@ -473,6 +955,34 @@ static void copy_tp_elems(xmlDocPtr res, xmlDocPtr doc)
 	}
 }
 
+/* Resolve the issue date given with -I, so that the current date ("-") is only
+ * determined once, and check that it is a valid date.
+ * Returns false if it is not. */
+static bool resolve_issue_date(char *dst, const char *issdate)
+{
+	char year[5], month[3], day[3];
+
+	if (strcasecmp(issdate, "pm") == 0) {
+		strcpy(dst, issdate);
+	} else if (strcmp(issdate, "-") == 0) {
+		time_t now;
+		struct tm *local;
+
+		time(&now);
+		local = localtime(&now);
+
+		strftime(dst, 11, "%Y-%m-%d", local);
+	} else if (sscanf(issdate, "%4s-%2s-%2s", year, month, day) == 3) {
+		sprintf(dst, "%s-%s-%s", year, month, day);
+	} else {
+		return false;
+	}
+
+	return true;
+}
+
+/* Set the issue date of a DM, either to that of the PM ("pm") or to a date
+ * resolved by resolve_issue_date. */
 static void set_issue_date(xmlDocPtr doc, xmlDocPtr pm, const char *issdate)
 {
 	xmlNodePtr dm_issue_date;
@@ -497,28 +1007,7 @@ static void set_issue_date(xmlDocPtr doc, xmlDocPtr pm, const char *issdate)
 		month = malloc(3 * sizeof(xmlChar));
 		day   = malloc(3 * sizeof(xmlChar));
 
-		if (strcmp(issdate, "-") == 0) {
-			time_t now;
-			struct tm *local;
-
-			time(&now);
-			local = localtime(&now);
-
-			xmlStrPrintf(year, 5, "%.4d", local->tm_year + 1900);
-			xmlStrPrintf(month, 3, "%.2d", local->tm_mon + 1);
-			xmlStrPrintf(day, 3, "%.2d", local->tm_mday);
-		} else {
-			int n;
-
-			n = sscanf(issdate, "%4s-%2s-%2s", year, month, day);
-
-			if (n != 3) {
-				if (verbosity >= NORMAL) {
-					fprintf(stderr, E_BAD_DATE, issdate);
-				}
-				exit(EXIT_BAD_DATE);
-			}
-		}
+		sscanf(issdate, "%4s-%2s-%2s", year, month, day);
 	}
 
 	xmlSetProp(dm_issue_date, BAD_CAST "year", year);
@@ -530,28 +1019,49 @@ static void set_issue_date(xmlDocPtr doc, xmlDocPtr pm, const char *issdate)
 	xmlFree(day);
 }
 
-static void generate_fm_content_for_dm(
-	xmlDocPtr pm,
-	const char *dmpath,
-	xmlDocPtr fmtypes,
-	const char *fmtype,
-	bool overwrite,
-	const char *xslpath,
-	const char **params,
-	const char *issdate)
-{
-	xmlDocPtr doc, res = NULL;
-	char *type, *fmxsl;
+/* A front matter DM to generate content for. */
+struct fm_dm {
+	char path[PATH_MAX];
+	xmlDocPtr doc;
+	char *type;
+	char *fmxsl;
 	bool ignore_del;
+	struct fm_content *content;
+	int err;
+};
+
+static void free_fm_dm(struct fm_dm *dm)
+{
+	xmlFreeDoc(dm->doc);
+	xmlFree(dm->type);
+	xmlFree(dm->fmxsl);
+	free(dm);
+}
+
+/* Read a front matter DM and determine which type of front matter it is.
+ *
+ * Returns NULL if the DM could not be read or no type of front matter is
+ * associated with it.
+ */
+static struct fm_dm *read_fm_dm(const char *dmpath, xmlDocPtr fmtypes, const char *fmtype)
+{
+	xmlDocPtr doc;
+	struct fm_dm *dm;
 
 	if (!(doc = read_xml_doc(dmpath))) {
-		return;
+		return NULL;
 	}
 
+	dm = malloc(sizeof(struct fm_dm));
+	strcpy(dm->path, dmpath);
+	dm->doc = doc;
+	dm->content = NULL;
+	dm->err = 0;
+
 	if (fmtype) {
-		type  = strdup(fmtype);
-		fmxsl = NULL;
-		ignore_del = default_ignore_del(type);
+		dm->type  = strdup(fmtype);
+		dm->fmxsl = NULL;
+		dm->ignore_del = default_ignore_del(dm->type);
 	} else {
 		xmlChar *incode, *incodev;
 		xmlNodePtr fm;
@@ -564,13 +1074,13 @@ static void generate_fm_content_for_dm(
 		if (fm) {
 			xmlChar *igndel;
 
-			type  = (char *) xmlGetProp(fm, BAD_CAST "type");
-			fmxsl = (char *) xmlGetProp(fm, BAD_CAST "xsl");
+			dm->type  = (char *) xmlGetProp(fm, BAD_CAST "type");
+			dm->fmxsl = (char *) xmlGetProp(fm, BAD_CAST "xsl");
 
 			if ((igndel = xmlGetProp(fm, BAD_CAST "ignoreDel"))) {
-				ignore_del = xmlStrcmp(igndel, BAD_CAST "yes") == 0;
+				dm->ignore_del = xmlStrcmp(igndel, BAD_CAST "yes") == 0;
 			} else {
-				ignore_del = default_ignore_del(type);
+				dm->ignore_del = default_ignore_del(dm->type);
 			}
 
 			xmlFree(igndel);
@@ -579,83 +1089,141 @@ static void generate_fm_content_for_dm(
 				fprintf(stderr, I_NO_INFOCODE, dmpath, incode, incodev);
 			}
 
-			type = NULL;
-			fmxsl = NULL;
-			ignore_del = false;
+			dm->type = NULL;
+			dm->fmxsl = NULL;
+			dm->ignore_del = false;
 		}
 
 		xmlFree(incode);
 		xmlFree(incodev);
 	}
 
-	if (type) {
-		xmlNodePtr root;
+	if (!dm->type) {
+		free_fm_dm(dm);
+		return NULL;
+	}
 
-		if (verbosity >= VERBOSE) {
-			fprintf(stderr, I_GENERATE, dmpath, type);
-		}
+	return dm;
+}
 
-		if (!(res = generate_fm_content_for_type(pm, type, fmxsl, xslpath, params, ignore_del))) {
-			if (verbosity >= NORMAL) {
-				fprintf(stderr, E_BAD_STYLESHEET, dmpath, xslpath ? xslpath : fmxsl);
-			}
-			exit(EXIT_BAD_STYLESHEET);
-		}
+/* Merge the generated content of a front matter DM in to the DM.
+ *
+ * Returns 0, or the exit status of the error if the content could not be
+ * merged. */
+static int fill_fm_dm(struct fm_source *src, struct fm_dm *dm, const char *issdate)
+{
+	xmlDocPtr res;
+	xmlNodePtr root;
+	int err = 0;
 
-		if (strcmp(type, "TP") == 0) {
-			copy_tp_elems(res, doc);
+	if (verbosity >= VERBOSE) {
+		fprintf(stderr, I_GENERATE, dm->path, dm->type);
+	}
+
+	if (!dm->content->doc) {
+		if (verbosity >= NORMAL) {
+			fprintf(stderr, E_BAD_STYLESHEET, dm->path, dm->content->xsl);
 		}
+		return EXIT_BAD_STYLESHEET;
+	}
 
-		/* Merge the results of the transformation with the original DM
-		 * based on the name of the root element. */
-		if ((root = xmlDocGetRootElement(res))) {
-			xmlXPathContextPtr ctx;
-			xmlXPathObjectPtr obj;
+	/* The generated contents may be shared with other DMs. */
+	res = xmlCopyDoc(dm->content->doc, 1);
 
-			ctx = xmlXPathNewContext(doc);
-			xmlXPathRegisterVariable(ctx, BAD_CAST "name", xmlXPathNewString(root->name));
-			obj = xmlXPathEvalExpression(BAD_CAST "//*[name()=$name]", ctx);
+	if (strcmp(dm->type, "TP") == 0) {
+		copy_tp_elems(res, dm->doc);
+	}
 
-			if (xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-				if (verbosity >= NORMAL) {
-					fprintf(stderr, E_MERGE_NAME, dmpath, (char *) root->name);
-				}
-				exit(EXIT_MERGE);
-			} else {
-				xmlAddNextSibling(obj->nodesetval->nodeTab[0], xmlCopyNode(root, 1));
-				xmlUnlinkNode(obj->nodesetval->nodeTab[0]);
-				xmlFreeNode(obj->nodesetval->nodeTab[0]);
-				obj->nodesetval->nodeTab[0] = NULL;
-			}
+	/* Merge the results of the transformation with the original DM
+	 * based on the name of the root element. */
+	if ((root = xmlDocGetRootElement(res))) {
+		xmlXPathContextPtr ctx;
+		xmlXPathObjectPtr obj;
 
-			xmlXPathFreeObject(obj);
-			xmlXPathFreeContext(ctx);
-		} else {
+		ctx = xmlXPathNewContext(dm->doc);
+		xmlXPathRegisterVariable(ctx, BAD_CAST "name", xmlXPathNewString(root->name));
+		obj = xmlXPathEvalExpression(BAD_CAST "//*[name()=$name]", ctx);
+
+		if (xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
 			if (verbosity >= NORMAL) {
-				fprintf(stderr, E_MERGE_ELEM, dmpath);
+				fprintf(stderr, E_MERGE_NAME, dm->path, (char *) root->name);
 			}
-			exit(EXIT_MERGE);
+			err = EXIT_MERGE;
+		} else {
+			xmlAddNextSibling(obj->nodesetval->nodeTab[0], xmlCopyNode(root, 1));
+			xmlUnlinkNode(obj->nodesetval->nodeTab[0]);
+			xmlFreeNode(obj->nodesetval->nodeTab[0]);
+			obj->nodesetval->nodeTab[0] = NULL;
 		}
 
-		if (issdate) {
-			set_issue_date(doc, pm, issdate);
+		xmlXPathFreeObject(obj);
+		xmlXPathFreeContext(ctx);
+	} else {
+		if (verbosity >= NORMAL) {
+			fprintf(stderr, E_MERGE_ELEM, dm->path);
 		}
+		err = EXIT_MERGE;
+	}
 
-		if (overwrite) {
-			save_xml_doc(doc, dmpath);
-		} else {
-			save_xml_doc(doc, "-");
-		}
+	if (!err && issdate) {
+		set_issue_date(dm->doc, src->pm, issdate);
 	}
 
-	xmlFree(type);
-	xmlFree(fmxsl);
-	xmlFreeDoc(doc);
 	xmlFreeDoc(res);
+
+	return err;
+}
+
+/* Write out a front matter DM after its content has been generated. */
+static void output_fm_dm(struct fm_dm *dm, bool overwrite)
+{
+	if (overwrite) {
+		save_xml_doc(dm->doc, dm->path);
+	} else {
+		save_xml_doc(dm->doc, "-");
+	}
+}
+
+/* Front matter DMs queued to be generated.
+ *
+ * All the DMs are read before any are generated, so that the parts of the PM
+ * they use can be collected at once, and so that they can be generated
+ * concurrently (-j). */
+static struct fm_queue {
+	struct fm_dm **dms;
+	int count;
+	int max;
+	int next;
+	bool failed;
+	pthread_mutex_t lock;
+} *fm_queue = NULL;
+
+static void generate_fm_content_for_dm(
+	struct fm_source *src,
+	const char *dmpath,
+	xmlDocPtr fmtypes,
+	const char *fmtype,
+	bool overwrite,
+	const char *xslpath,
+	const char **params,
+	const char *issdate)
+{
+	struct fm_dm *dm;
+
+	if (!(dm = read_fm_dm(dmpath, fmtypes, fmtype))) {
+		return;
+	}
+
+	if (fm_queue->count == fm_queue->max) {
+		fm_queue->max *= 2;
+		fm_queue->dms = realloc(fm_queue->dms, fm_queue->max * sizeof(struct fm_dm *));
+	}
+
+	fm_queue->dms[fm_queue->count++] = dm;
 }
 
 static void generate_fm_content_for_list(
-	xmlDocPtr pm,
+	struct fm_source *src,
 	const char *path,
 	xmlDocPtr fmtypes,
 	const char *fmtype,
@@ -680,7 +1248,7 @@ static void generate_fm_content_for_list(
 
 	while (fgets(line, PATH_MAX, f)) {
 		strtok(line, "\t\r\n");
-		generate_fm_content_for_dm(pm, line, fmtypes, fmtype, overwrite, xslpath, params, issdate);
+		generate_fm_content_for_dm(src, line, fmtypes, fmtype, overwrite, xslpath, params, issdate);
 	}
 
 	if (path) {
@@ -688,6 +1256,190 @@ static void generate_fm_content_for_list(
 	}
 }
 
+/* A thread generating front matter contents or DMs. */
+struct fm_worker {
+	pthread_t thread;
+	struct fm_source *src;
+	bool overwrite;
+	const char **params;
+	const char *issdate;
+};
+
+/* Generate the contents claimed from the list of contents. */
+static void *fm_content_worker(void *arg)
+{
+	struct fm_worker *w = (struct fm_worker *) arg;
+	const char **params;
+	int i, n;
+
+	/* Parameters are modified per type, so each thread needs its own. */
+	for (n = 0; w->params[n]; ++n);
+	params = malloc((n + 1) * sizeof(char *));
+	for (i = 0; i < n; ++i) {
+		params[i] = strdup(w->params[i]);
+	}
+	params[n] = NULL;
+
+	while (1) {
+		pthread_mutex_lock(&fm_queue->lock);
+		i = fm_queue->next++;
+		pthread_mutex_unlock(&fm_queue->lock);
+
+		if (i >= w->src->ncontents) {
+			break;
+		}
+
+		generate_fm_content(w->src, w->src->list[i], params);
+	}
+
+	for (i = 0; i < n; ++i) {
+		free((char *) params[i]);
+	}
+	free(params);
+
+	return NULL;
+}
+
+/* Merge contents in to the DMs claimed from the queue.
+ *
+ * Errors are recorded in the DM for the main thread to report, and no more DMs
+ * are claimed after one, as a single thread would stop at the first error. */
+static void *fm_dm_worker(void *arg)
+{
+	struct fm_worker *w = (struct fm_worker *) arg;
+
+	while (1) {
+		struct fm_dm *dm;
+		int i;
+
+		pthread_mutex_lock(&fm_queue->lock);
+		i = fm_queue->failed ? fm_queue->count : fm_queue->next++;
+		pthread_mutex_unlock(&fm_queue->lock);
+
+		if (i >= fm_queue->count) {
+			break;
+		}
+
+		dm = fm_queue->dms[i];
+
+		if ((dm->err = fill_fm_dm(w->src, dm, w->issdate))) {
+			pthread_mutex_lock(&fm_queue->lock);
+			fm_queue->failed = true;
+			pthread_mutex_unlock(&fm_queue->lock);
+			break;
+		}
+
+		/* Output to stdout is written in the original order once all
+		 * threads are done. */
+		if (w->overwrite) {
+			output_fm_dm(dm, true);
+			xmlFreeDoc(dm->doc);
+			dm->doc = NULL;
+		}
+	}
+
+	return NULL;
+}
+
+/* Run a function on several threads and wait for them to finish. */
+static void run_fm_workers(void *(*fn)(void *), int njobs, struct fm_source *src, bool overwrite, const char **params, const char *issdate)
+{
+	struct fm_worker *workers;
+	int i;
+
+	workers = malloc(njobs * sizeof(struct fm_worker));
+
+	fm_queue->next = 0;
+
+	for (i = 0; i < njobs; ++i) {
+		workers[i].src = src;
+		workers[i].overwrite = overwrite;
+		workers[i].params = params;
+		workers[i].issdate = issdate;
+
+		pthread_create(&workers[i].thread, NULL, fn, &workers[i]);
+	}
+
+	for (i = 0; i < njobs; ++i) {
+		pthread_join(workers[i].thread, NULL);
+	}
+
+	free(workers);
+}
+
+/* Generate the queued front matter DMs, using multiple threads if njobs > 1.
+ *
+ * First, the contents of every type of front matter the DMs use are generated,
+ * each by one thread. Then, the contents are merged in to the DMs, which are
+ * written out as they are done when overwriting them.
+ *
+ * Returns 0, or the exit status of the first error in the order of the DMs.
+ */
+static int generate_fm_content_for_queue(
+	struct fm_source *src,
+	int njobs,
+	bool overwrite,
+	const char *xslpath,
+	const char **params,
+	const char *issdate)
+{
+	char date[11];
+	int i, err = 0;
+
+	if (fm_queue->count == 0) {
+		return 0;
+	}
+
+	if (issdate) {
+		if (!resolve_issue_date(date, issdate)) {
+			if (verbosity >= NORMAL) {
+				fprintf(stderr, E_BAD_DATE, issdate);
+			}
+			return EXIT_BAD_DATE;
+		}
+
+		issdate = date;
+	}
+
+	for (i = 0; i < fm_queue->count; ++i) {
+		struct fm_dm *dm = fm_queue->dms[i];
+		dm->content = want_fm_content(src, dm->type, xslpath ? xslpath : dm->fmxsl, dm->ignore_del);
+	}
+
+	collect_fm_source(src);
+
+	if (njobs == 1) {
+		for (i = 0; i < src->ncontents; ++i) {
+			generate_fm_content(src, src->list[i], params);
+		}
+
+		for (i = 0; i < fm_queue->count && !err; ++i) {
+			if (!(err = fill_fm_dm(src, fm_queue->dms[i], issdate))) {
+				output_fm_dm(fm_queue->dms[i], overwrite);
+			}
+		}
+	} else {
+		src->threads = true;
+
+		run_fm_workers(fm_content_worker, njobs < src->ncontents ? njobs : src->ncontents,
+			src, overwrite, params, issdate);
+		run_fm_workers(fm_dm_worker, njobs < fm_queue->count ? njobs : fm_queue->count,
+			src, overwrite, params, issdate);
+
+		for (i = 0; i < fm_queue->count && !err; ++i) {
+			if (!(err = fm_queue->dms[i]->err) && !overwrite) {
+				output_fm_dm(fm_queue->dms[i], false);
+			}
+		}
+	}
+
+	for (i = 0; i < fm_queue->count; ++i) {
+		free_fm_dm(fm_queue->dms[i]);
+	}
+
+	return err;
+}
+
 static void dump_fmtypes_xml(void)
 {
 	xmlDocPtr doc;
@@ -796,7 +1548,7 @@ static void add_def_param(xmlNodePtr params, const char *s)
 
 static void show_help(void)
 {
-	puts("Usage: " PROG_NAME " [-D <TYPE>] [-F <FMTYPES>] [-I <date>] [-P <PM>] [-p <name>=<val> ...] [-t <TYPE>] [-x <XSL>] [-,flqvh?] [<DM>...]");
+	puts("Usage: " PROG_NAME " [-D <TYPE>] [-F <FMTYPES>] [-I <date>] [-j <n>] [-P <PM>] [-p <name>=<val> ...] [-t <TYPE>] [-x <XSL>] [-,flqvh?] [<DM>...]");
 	puts("");
 	puts("Options:");
 	puts("  -,, --dump-fmtypes-xml      Dump the built-in .fmtypes file in XML format.");
@@ -806,6 +1558,7 @@ static void show_help(void)
 	puts("  -f, --overwrite             Overwrite input data modules.");
 	puts("  -h, -?, --help              Show usage message.");
 	puts("  -I, --date <date>           Set the issue date of the generated front matter.");
+	puts("  -j, --jobs <n>              Generate front matter for <n> data modules at a time.");
 	puts("  -l, --list                  Treat input as list of data modules.");
 	puts("  -P, --pm <PM>               Generate front matter from the specified PM.");
 	puts("  -p, --param <name>=<value>  Pass parameters to the XSLT used to generate the front matter.");
@@ -826,9 +1579,9 @@ static void show_version(void)
 
 int main(int argc, char **argv)
 {
-	int i;
+	int i, err = 0;
 
-	const char *sopts = ",.D:F:fI:lP:p:qt:vx:h?";
+	const char *sopts = ",.D:F:fI:j:lP:p:qt:vx:h?";
 	struct option lopts[] = {
 		{"version"         , no_argument      , 0, 0},
 		{"help"            , no_argument      , 0, 'h'},
@@ -838,6 +1591,7 @@ int main(int argc, char **argv)
 		{"fmtypes"         , required_argument, 0, 'F'},
 		{"date"            , required_argument, 0, 'I'},
 		{"overwrite"       , no_argument      , 0, 'f'},
+		{"jobs"            , required_argument, 0, 'j'},
 		{"list"            , no_argument      , 0, 'l'},
 		{"pm"              , required_argument, 0, 'P'},
 		{"param"           , required_argument, 0, 'p'},
@@ -854,6 +1608,7 @@ int main(int argc, char **argv)
 	char *fmtype = NULL;
 
 	xmlDocPtr pm, fmtypes = NULL;
+	struct fm_source src;
 
 	bool overwrite = false;
 	bool islist = false;
@@ -862,6 +1617,7 @@ int main(int argc, char **argv)
 	int nparams = 0;
 	const char **params = NULL;
 	char *issdate = NULL;
+	int njobs = 1;
 
 	params_node = xmlNewNode(NULL, BAD_CAST "params");
 
@@ -897,6 +1653,14 @@ int main(int argc, char **argv)
 			case 'I':
 				issdate = strdup(optarg);
 				break;
+			case 'j':
+				if ((njobs = atoi(optarg)) < 1) {
+					if (verbosity >= NORMAL) {
+						fprintf(stderr, E_BAD_JOBS, optarg);
+					}
+					exit(EXIT_BAD_JOBS);
+				}
+				break;
 			case 'l':
 				islist = true;
 				break;
@@ -961,9 +1725,25 @@ int main(int argc, char **argv)
 	}
 
 	pm = read_xml_doc(pmpath);
+	init_fm_source(&src, pm);
+
+	/* The front matter DMs are first read and queued, and then generated
+	 * from the shared PM. */
+	if (njobs > 1) {
+		xmlInitParser();
+		xsltInit();
+	}
+
+	fm_queue = malloc(sizeof(struct fm_queue));
+	fm_queue->max = 16;
+	fm_queue->dms = malloc(fm_queue->max * sizeof(struct fm_dm *));
+	fm_queue->count = 0;
+	fm_queue->next = 0;
+	fm_queue->failed = false;
+	pthread_mutex_init(&fm_queue->lock, NULL);
 
 	if (optind < argc) {
-		void (*gen_fn)(xmlDocPtr, const char *, xmlDocPtr, const char *,
+		void (*gen_fn)(struct fm_source *, const char *, xmlDocPtr, const char *,
 			bool, const char *, const char **, const char *);
 
 		if (islist) {
@@ -973,15 +1753,16 @@ int main(int argc, char **argv)
 		}
 
 		for (i = optind; i < argc; ++i) {
-			gen_fn(pm, argv[i], fmtypes, fmtype, overwrite, xslpath, params, issdate);
+			gen_fn(&src, argv[i], fmtypes, fmtype, overwrite, xslpath, params, issdate);
 		}
 	} else if (fmtype) {
-		xmlDocPtr res;
-		res = generate_fm_content_for_type(pm, fmtype, NULL, xslpath, params, default_ignore_del(fmtype));
-		save_xml_doc(res, "-");
-		xmlFreeDoc(res);
+		struct fm_content *content;
+		content = want_fm_content(&src, fmtype, xslpath, default_ignore_del(fmtype));
+		collect_fm_source(&src);
+		generate_fm_content(&src, content, params);
+		save_xml_doc(content->doc, "-");
 	} else if (islist) {
-		generate_fm_content_for_list(pm, NULL, fmtypes, fmtype, overwrite, xslpath, params, issdate);
+		generate_fm_content_for_list(&src, NULL, fmtypes, fmtype, overwrite, xslpath, params, issdate);
 	} else {
 		if (verbosity >= NORMAL) {
 			fprintf(stderr, S_NO_TYPE_ERR);
@@ -989,12 +1770,19 @@ int main(int argc, char **argv)
 		exit(EXIT_NO_TYPE);
 	}
 
+	err = generate_fm_content_for_queue(&src, njobs, overwrite, xslpath, params, issdate);
+
+	pthread_mutex_destroy(&fm_queue->lock);
+	free(fm_queue->dms);
+	free(fm_queue);
+
 	for (i = 0; i < nparams; ++i) {
 		xmlFree((char *) params[i * 2]);
 		xmlFree((char *) params[i * 2 + 1]);
 	}
 	free(params);
 
+	free_fm_source(&src);
 	xmlFreeDoc(pm);
 	xmlFreeDoc(fmtypes);
 
@@ -1004,8 +1792,10 @@ int main(int argc, char **argv)
 
 	xmlFree(issdate);
 
+	xmlHashFree(fm_xsls, free_fm_xsl);
+
 	xsltCleanupGlobals();
 	xmlCleanupParser();
 
-	return 0;
+	return err;
 }
@@ -15,7 +15,7 @@
 #include "s1kd_tools.h"
 
 #define PROG_NAME "s1kd-icncatalog"
-#define VERSION "3.2.0"
+#define VERSION "3.2.1"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 #define INF_PREFIX PROG_NAME ": INFO: "
@@ -27,39 +27,106 @@
 
 static enum verbosity { QUIET, NORMAL, VERBOSE } verbosity = NORMAL;
 
-/* Add a notation by its reference in the catalog file. */
-static void add_notation_ref(xmlDocPtr doc, xmlDocPtr icns, const xmlChar *notation)
+/* A rule from the ICN catalog. */
+struct icn_rule {
+	xmlChar *ident;
+	xmlChar *uri;
+	xmlChar *notation;
+	bool is_pattern;
+	regex_t re;
+	size_t nmatch;
+};
+
+/* The ICN catalog, compiled once and used to resolve ICNs in every object.
+ *
+ * The rules are kept in catalog order, as later rules override earlier ones.
+ * Pattern rules are compiled to a regex only once, and notations are indexed
+ * by name.
+ */
+struct icn_catalog {
+	struct icn_rule *rules;
+	int nrules;
+	xmlHashTablePtr notations;
+};
+
+/* Compile the rules of the ICN catalog for a particular media. */
+static void compile_catalog(struct icn_catalog *cat, xmlDocPtr icns, const char *media)
 {
 	xmlXPathContextPtr ctx;
 	xmlXPathObjectPtr obj;
+	xmlChar *xpath;
+
+	cat->rules = NULL;
+	cat->nrules = 0;
+	cat->notations = xmlHashCreate(16);
 
 	ctx = xmlXPathNewContext(icns);
+
 	obj = xmlXPathEvalExpression(BAD_CAST "/icnCatalog/notation", ctx);
 
 	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
 		int i;
-		bool found = false;
 
-		for (i = 0; i < obj->nodesetval->nodeNr && !found; ++i) {
+		for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
 			xmlChar *name;
 
 			name = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "name");
 
-			if (xmlStrcmp(name, notation) == 0) {
-				xmlChar *pubId, *sysId;
+			/* The first notation with a given name is used. */
+			if (name) {
+				xmlHashAddEntry(cat->notations, name, obj->nodesetval->nodeTab[i]);
+			}
 
-				pubId = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "publicId");
-				sysId = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "systemId");
+			xmlFree(name);
+		}
+	}
 
-				add_notation(doc, name, pubId, sysId);
+	xmlXPathFreeObject(obj);
 
-				xmlFree(pubId);
-				xmlFree(sysId);
+	if (media) {
+		xmlXPathRegisterVariable(ctx, BAD_CAST "media", xmlXPathNewString(BAD_CAST media));
+		xpath = BAD_CAST "/icnCatalog/media[@name=$media]/icn";
+	} else {
+		xpath = BAD_CAST "/icnCatalog/icn";
+	}
 
-				found = true;
+	obj = xmlXPathEvalExpression(xpath, ctx);
+
+	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
+		int i;
+
+		cat->rules = malloc(obj->nodesetval->nodeNr * sizeof(struct icn_rule));
+
+		for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
+			struct icn_rule *rule = &cat->rules[cat->nrules];
+			xmlChar *type;
+
+			type           = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "type");
+			rule->ident    = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "infoEntityIdent");
+			rule->uri      = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "uri");
+			rule->notation = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "notation");
+
+			rule->is_pattern = xmlStrcmp(type, BAD_CAST "pattern") == 0;
+
+			xmlFree(type);
+
+			if (rule->is_pattern) {
+				if (regcomp(&rule->re, (char *) rule->ident, REG_EXTENDED) != 0) {
+					if (verbosity > QUIET) {
+						fprintf(stderr, E_REGEX_INVALID, (char *) rule->ident);
+					}
+
+					xmlFree(rule->ident);
+					xmlFree(rule->uri);
+					xmlFree(rule->notation);
+
+					continue;
+				}
+
+				rule->nmatch = rule->re.re_nsub + 1;
 			}
 
-			xmlFree(name);
+			++cat->nrules;
 		}
 	}
 
@@ -67,27 +134,133 @@ static void add_notation_ref(xmlDocPtr doc, xmlDocPtr icns, const xmlChar *notat
 	xmlXPathFreeContext(ctx);
 }
 
-/* Check whether an ICN is used in an object. */
-static bool icn_is_used(xmlDocPtr doc, const xmlChar *ident)
+static void free_catalog(struct icn_catalog *cat)
 {
-	xmlXPathContextPtr ctx;
-	xmlXPathObjectPtr obj;
-	bool used;
+	int i;
 
-	ctx = xmlXPathNewContext(doc);
-	xmlXPathRegisterVariable(ctx, BAD_CAST "id", xmlXPathNewString(ident));
-	obj = xmlXPathEvalExpression(BAD_CAST "//@*[.=$id]", ctx);
+	for (i = 0; i < cat->nrules; ++i) {
+		xmlFree(cat->rules[i].ident);
+		xmlFree(cat->rules[i].uri);
+		xmlFree(cat->rules[i].notation);
 
-	used = !xmlXPathNodeSetIsEmpty(obj->nodesetval);
+		if (cat->rules[i].is_pattern) {
+			regfree(&cat->rules[i].re);
+		}
+	}
 
-	xmlXPathFreeObject(obj);
-	xmlXPathFreeContext(ctx);
+	free(cat->rules);
+	xmlHashFree(cat->notations, NULL);
+}
+
+/* Add a notation by its reference in the catalog file. */
+static void add_notation_ref(xmlDocPtr doc, struct icn_catalog *cat, const xmlChar *notation)
+{
+	xmlNodePtr node;
+
+	if ((node = xmlHashLookup(cat->notations, notation))) {
+		xmlChar *pubId, *sysId;
+
+		pubId = xmlGetProp(node, BAD_CAST "publicId");
+		sysId = xmlGetProp(node, BAD_CAST "systemId");
+
+		add_notation(doc, notation, pubId, sysId);
+
+		xmlFree(pubId);
+		xmlFree(sysId);
+	}
+}
+
+/* The ICNs referenced by an object, gathered in a single walk of it. */
+struct icn_refs {
+	/* Every attribute value in the object, used to check whether an ICN
+	 * is used at all. */
+	xmlHashTablePtr values;
+	/* The distinct values of infoEntityIdent attributes, ordered by their
+	 * last occurrence in the object. */
+	xmlChar **idents;
+	int nidents;
+	int max_idents;
+};
+
+static void find_icn_refs(struct icn_refs *refs, xmlNodePtr node)
+{
+	xmlNodePtr cur;
+	xmlAttrPtr attr;
+
+	for (attr = node->properties; attr; attr = attr->next) {
+		xmlChar *value;
+
+		value = xmlNodeGetContent((xmlNodePtr) attr);
+
+		xmlHashAddEntry(refs->values, value, attr);
+
+		if (xmlStrcmp(attr->name, BAD_CAST "infoEntityIdent") == 0) {
+			if (refs->nidents == refs->max_idents) {
+				refs->max_idents *= 2;
+				refs->idents = realloc(refs->idents, refs->max_idents * sizeof(xmlChar *));
+			}
+
+			refs->idents[refs->nidents++] = value;
+		} else {
+			xmlFree(value);
+		}
+	}
+
+	for (cur = node->children; cur; cur = cur->next) {
+		if (cur->type == XML_ELEMENT_NODE) {
+			find_icn_refs(refs, cur);
+		}
+	}
+}
+
+static void init_icn_refs(struct icn_refs *refs, xmlDocPtr doc)
+{
+	xmlHashTablePtr seen;
+	int i, n;
+
+	refs->values = xmlHashCreate(256);
+	refs->max_idents = 16;
+	refs->idents = malloc(refs->max_idents * sizeof(xmlChar *));
+	refs->nidents = 0;
+
+	find_icn_refs(refs, xmlDocGetRootElement(doc));
+
+	/* Remove duplicates, keeping only the last occurrence of each ICN.
+	 *
+	 * Resolving an ICN moves its entity declaration to the end of the
+	 * DTD, so this is the order in which the entities would be declared
+	 * if each occurrence was resolved.
+	 */
+	seen = xmlHashCreate(64);
+
+	for (i = refs->nidents - 1, n = refs->nidents; i >= 0; --i) {
+		if (xmlHashAddEntry(seen, refs->idents[i], refs->idents[i]) == 0) {
+			refs->idents[--n] = refs->idents[i];
+		} else {
+			xmlFree(refs->idents[i]);
+		}
+	}
+
+	memmove(refs->idents, refs->idents + n, (refs->nidents - n) * sizeof(xmlChar *));
+	refs->nidents -= n;
 
-	return used;
+	xmlHashFree(seen, NULL);
+}
+
+static void free_icn_refs(struct icn_refs *refs)
+{
+	int i;
+
+	for (i = 0; i < refs->nidents; ++i) {
+		xmlFree(refs->idents[i]);
+	}
+
+	free(refs->idents);
+	xmlHashFree(refs->values, NULL);
 }
 
 /* Replace the SYSTEM URI of an entity, adding a notation if necessary. */
-static void replace_entity(xmlDocPtr doc, xmlDocPtr icns, xmlEntityPtr e, const xmlChar *ident, const xmlChar *uri, const xmlChar *notation)
+static void replace_entity(xmlDocPtr doc, struct icn_catalog *cat, xmlEntityPtr e, const xmlChar *ident, const xmlChar *uri, const xmlChar *notation)
 {
 	xmlChar *ndata;
 
@@ -105,7 +278,7 @@ static void replace_entity(xmlDocPtr doc, xmlDocPtr icns, xmlEntityPtr e, const
 	}
 
 	if (notation) {
-		add_notation_ref(doc, icns, notation);
+		add_notation_ref(doc, cat, notation);
 	} else {
 		xmlFree(ndata);
 	}
@@ -147,102 +320,66 @@ static xmlChar *regex_replace(const xmlChar *icn, const xmlChar *uri, size_t nma
 	return s;
 }
 
-/* Resolve an ICN using regular expressions. */
-static void resolve_icn_regex(xmlDocPtr doc, xmlDocPtr icns, const xmlChar *pattern, const xmlChar *icn, const xmlChar *uri, const xmlChar *notation)
+/* Resolve the ICNs in a document against a pattern rule. */
+static void resolve_pattern_icn(xmlDocPtr doc, struct icn_catalog *cat, struct icn_rule *rule, struct icn_refs *refs)
 {
-	regex_t re;
 	regmatch_t *pmatch;
-	size_t nmatch;
+	int i;
 
-	if (regcomp(&re, (char *) pattern, REG_EXTENDED) != 0) {
-		if (verbosity > QUIET) {
-			fprintf(stderr, E_REGEX_INVALID, (char *) pattern);
-		}
-		return;
-	}
+	pmatch = malloc(sizeof(regmatch_t) * rule->nmatch);
 
-	nmatch = re.re_nsub + 1;
+	for (i = 0; i < refs->nidents; ++i) {
+		const xmlChar *icn = refs->idents[i];
 
-	pmatch = malloc(sizeof(regmatch_t) * nmatch);
+		if (regexec(&rule->re, (char *) icn, rule->nmatch, pmatch, 0) == 0) {
+			xmlChar *s;
+			xmlEntityPtr e;
 
-	if (regexec(&re, (char *) icn, nmatch, pmatch, 0) == 0) {
-		xmlChar *s;
-		xmlEntityPtr e;
+			s = regex_replace(icn, rule->uri, rule->nmatch, pmatch);
 
-		s = regex_replace(icn, uri, nmatch, pmatch);
+			e = xmlGetDocEntity(doc, icn);
 
-		e = xmlGetDocEntity(doc, icn);
+			if (e) {
+				replace_entity(doc, cat, e, icn, s, rule->notation);
+			} else if (rule->notation) {
+				add_notation_ref(doc, cat, rule->notation);
+				xmlAddDocEntity(doc, icn, XML_EXTERNAL_GENERAL_UNPARSED_ENTITY, NULL, s, rule->notation);
+			} else {
+				add_icn(doc, (char *) s, true);
+			}
 
-		if (e) {
-			replace_entity(doc, icns, e, icn, s, notation);
-		} else if (notation) {
-			add_notation_ref(doc, icns, notation);
-			xmlAddDocEntity(doc, icn, XML_EXTERNAL_GENERAL_UNPARSED_ENTITY, NULL, s, notation);
-		} else {
-			add_icn(doc, (char *) s, true);
+			xmlFree(s);
 		}
-
-		xmlFree(s);
 	}
 
 	free(pmatch);
-
-	regfree(&re);
-}
-
-/* Resolve an ICN pattern rule from the catalog. */
-static void resolve_pattern_icn(xmlDocPtr doc, xmlDocPtr icns, const xmlChar *pattern, const xmlChar *uri, const xmlChar *notation)
-{
-	xmlXPathContextPtr ctx;
-	xmlXPathObjectPtr obj;
-
-	ctx = xmlXPathNewContext(doc);
-	obj = xmlXPathEvalExpression(BAD_CAST "//@infoEntityIdent", ctx);
-
-	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		int i;
-
-		for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
-			xmlChar *icn;
-
-			icn = xmlNodeGetContent(obj->nodesetval->nodeTab[i]);
-
-			resolve_icn_regex(doc, icns, pattern, icn, uri, notation);
-
-			xmlFree(icn);
-		}
-	}
-
-	xmlXPathFreeObject(obj);
-	xmlXPathFreeContext(ctx);
 }
 
-/* Resolve the ICNs in a document against the ICN catalog. */
-static void resolve_icn(xmlDocPtr doc, xmlDocPtr icns, const xmlChar *ident, const xmlChar *uri, const xmlChar *notation)
+/* Resolve an ICN in a document against an exact rule. */
+static void resolve_icn(xmlDocPtr doc, struct icn_catalog *cat, struct icn_rule *rule, struct icn_refs *refs)
 {
 	xmlEntityPtr e;
 
-	e = xmlGetDocEntity(doc, ident);
+	e = xmlGetDocEntity(doc, rule->ident);
 
 	if (e) {
-		replace_entity(doc, icns, e, ident, uri, notation);
-	} else if (icn_is_used(doc, ident)) {
-		if (notation) {
-			add_notation_ref(doc, icns, notation);
-			xmlAddDocEntity(doc, ident, XML_EXTERNAL_GENERAL_UNPARSED_ENTITY, NULL, uri, notation);
+		replace_entity(doc, cat, e, rule->ident, rule->uri, rule->notation);
+	} else if (xmlHashLookup(refs->values, rule->ident)) {
+		if (rule->notation) {
+			add_notation_ref(doc, cat, rule->notation);
+			xmlAddDocEntity(doc, rule->ident, XML_EXTERNAL_GENERAL_UNPARSED_ENTITY, NULL, rule->uri, rule->notation);
 		} else {
-			add_icn(doc, (char *) uri, true);
+			add_icn(doc, (char *) rule->uri, true);
 		}
 	}
 }
 
 /* Resolve ICNs in a file against the ICN catalog. */
-static void resolve_icns_in_file(const char *fname, xmlDocPtr icns, bool overwrite, const char *media)
+static void resolve_icns_in_file(const char *fname, struct icn_catalog *cat, bool overwrite)
 {
 	xmlDocPtr doc;
-	xmlXPathContextPtr ctx;
-	xmlXPathObjectPtr obj;
-	xmlChar *xpath;
+	struct icn_refs refs;
+	int i;
 
 	if (verbosity == VERBOSE) {
 		fprintf(stderr, I_RESOLVE, fname);
@@ -252,43 +389,17 @@ static void resolve_icns_in_file(const char *fname, xmlDocPtr icns, bool overwri
 		return;
 	}
 
-	ctx = xmlXPathNewContext(icns);
-
-	if (media) {
-		xmlXPathRegisterVariable(ctx, BAD_CAST "media", xmlXPathNewString(BAD_CAST media));
-		xpath = BAD_CAST "/icnCatalog/media[@name=$media]/icn";
-	} else {
-		xpath = BAD_CAST "/icnCatalog/icn";
-	}
-
-	obj = xmlXPathEvalExpression(xpath, ctx);
-
-	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		int i;
-
-		for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
-			xmlChar *type, *ident, *uri, *notation;
+	init_icn_refs(&refs, doc);
 
-			type     = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "type");
-			ident    = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "infoEntityIdent");
-			uri      = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "uri");
-			notation = xmlGetProp(obj->nodesetval->nodeTab[i], BAD_CAST "notation");
-
-			if (xmlStrcmp(type, BAD_CAST "pattern") == 0) {
-				resolve_pattern_icn(doc, icns, ident, uri, notation);
-			} else {
-				resolve_icn(doc, icns, ident, uri, notation);
-			}
-
-			xmlFree(type);
-			xmlFree(ident);
-			xmlFree(uri);
-			xmlFree(notation);
+	for (i = 0; i < cat->nrules; ++i) {
+		if (cat->rules[i].is_pattern) {
+			resolve_pattern_icn(doc, cat, &cat->rules[i], &refs);
+		} else {
+			resolve_icn(doc, cat, &cat->rules[i], &refs);
 		}
 	}
 
-	xmlXPathFreeObject(obj);
-	xmlXPathFreeContext(ctx);
+	free_icn_refs(&refs);
 
 	if (overwrite) {
 		save_xml_doc(doc, fname);
@@ -300,7 +411,7 @@ static void resolve_icns_in_file(const char *fname, xmlDocPtr icns, bool overwri
 }
 
 /* Resolve ICNs in objects in a list of file names. */
-static void resolve_icns_in_list(const char *path, xmlDocPtr icns, bool overwrite, const char *media)
+static void resolve_icns_in_list(const char *path, struct icn_catalog *cat, bool overwrite)
 {
 	FILE *f;
 	char line[PATH_MAX];
@@ -318,7 +429,7 @@ static void resolve_icns_in_list(const char *path, xmlDocPtr icns, bool overwrit
 
 	while (fgets(line, PATH_MAX, f)) {
 		strtok(line, "\t\r\n");
-		resolve_icns_in_file(line, icns, overwrite, media);
+		resolve_icns_in_file(line, cat, overwrite);
 	}
 
 	if (path) {
@@ -546,24 +657,32 @@ int main(int argc, char **argv)
 		} else {
 			save_xml_doc(icns, "-");
 		}
-	} else if (optind < argc) {
-		for (i = optind; i < argc; ++i) {
-			if (islist) {
-				resolve_icns_in_list(argv[i], icns, overwrite, media);
-			} else {
-				resolve_icns_in_file(argv[i], icns, overwrite, media);
-			}
-		}
-	} else if (createnew) {
+	} else if (createnew && optind >= argc) {
 		if (overwrite) {
 			save_xml_doc(icns, icns_fname);
 		} else {
 			save_xml_doc(icns, "-");
 		}
-	} else if (islist) {
-		resolve_icns_in_list(NULL, icns, overwrite, media);
 	} else {
-		resolve_icns_in_file("-", icns, false, media);
+		struct icn_catalog cat;
+
+		compile_catalog(&cat, icns, media);
+
+		if (optind < argc) {
+			for (i = optind; i < argc; ++i) {
+				if (islist) {
+					resolve_icns_in_list(argv[i], &cat, overwrite);
+				} else {
+					resolve_icns_in_file(argv[i], &cat, overwrite);
+				}
+			}
+		} else if (islist) {
+			resolve_icns_in_list(NULL, &cat, overwrite);
+		} else {
+			resolve_icns_in_file("-", &cat, false);
+		}
+
+		free_catalog(&cat);
 	}
 
 	free(icns_fname);
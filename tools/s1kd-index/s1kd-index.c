@@ -12,7 +12,7 @@
 #include "s1kd_tools.h"
 
 #define PROG_NAME "s1kd-index"
-#define VERSION "1.9.0"
+#define VERSION "1.9.1"
 
 /* Path to text nodes where indexFlags may occur */
 #define ELEMENTS_XPATH BAD_CAST "//para/text()"
@@ -78,66 +78,466 @@ static xmlChar *last_level(xmlNodePtr flag)
 	return NULL;
 }
 
-static bool is_term(xmlChar *content, int content_len, int i, xmlChar *term, int term_len, bool ignorecase)
+/* A state in the automaton used to find all terms in a single pass.
+ *
+ * The automaton is a trie of the terms, with a failure link from each state
+ * to the state for the longest proper suffix of its string which is also in
+ * the trie (Aho-Corasick).
+ */
+struct term_state {
+	xmlChar c;	/* Byte leading to this state from its parent. */
+	int child;	/* First child state. */
+	int sibling;	/* Next sibling state. */
+	int fail;	/* Failure link. */
+	int out;	/* Nearest state on the failure path ending a term. */
+	int term;	/* Term ending at this state, or -1. */
+	int depth;	/* Length of the string of this state. */
+};
+
+/* A distinct term, and the flags which mark it. */
+struct term {
+	int len;
+	int *flags;
+	int nflags;
+};
+
+/* All terms of the index flags, compiled into a single automaton. */
+struct term_index {
+	xmlNodeSetPtr flags;
+	bool ignorecase;
+
+	struct term_state *states;
+	int nstates;
+	int root[256];
+
+	struct term *terms;
+	int nterms;
+
+	/* Term of each flag, or -1 if the flag has no term. */
+	int *flag_terms;
+};
+
+/* An occurrence of a term in a text node. */
+struct term_match {
+	int term;
+	int start;
+};
+
+/* An index flag to insert after a position in a text node. */
+struct flag_pos {
+	int pos;
+	int flag;
+};
+
+/* Fold a byte for case-insensitive matching. Like xmlStrncasecmp, only ASCII
+ * letters are folded. */
+static xmlChar fold(xmlChar c, bool ignorecase)
 {
-	bool is;
-	xmlChar s, e;
+	return ignorecase && c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
 
-	s = i == 0 ? ' ' : content[i - 1];
-	e = i + term_len >= content_len - 1 ? ' ' : content[i + term_len];
+/* Return the child of a state for a byte, or -1 if there is none. */
+static int term_child(const struct term_index *idx, int state, xmlChar c)
+{
+	int cur;
 
-	is = xmlStrchr(PRE_TERM_DELIM, s) &&
-	     (ignorecase ?
-	     	xmlStrncasecmp(content + i, term, term_len) :
-		xmlStrncmp(content + i, term, term_len)) == 0 &&
-	     xmlStrchr(POST_TERM_DELIM, e);
+	if (state == 0) {
+		return idx->root[c];
+	}
 
-	return is;
+	for (cur = idx->states[state].child; cur != -1; cur = idx->states[cur].sibling) {
+		if (idx->states[cur].c == c) {
+			return cur;
+		}
+	}
+
+	return -1;
 }
 
-/* Insert indexFlag elements after matched terms. */
-static void gen_index_node(xmlNodePtr node, xmlNodePtr flag, bool ignorecase)
+/* Add a new state to the automaton. */
+static int new_term_state(struct term_index *idx, int *max, xmlChar c, int depth)
 {
-	xmlChar *content;
-	xmlChar *term;
-	int term_len, content_len;
+	struct term_state *st;
+
+	if (idx->nstates == *max) {
+		*max *= 2;
+		idx->states = realloc(idx->states, *max * sizeof(struct term_state));
+	}
+
+	st = &idx->states[idx->nstates];
+	st->c = c;
+	st->child = -1;
+	st->sibling = -1;
+	st->fail = 0;
+	st->out = -1;
+	st->term = -1;
+	st->depth = depth;
+
+	return idx->nstates++;
+}
+
+/* Add a term to the trie, returning the id of the term. */
+static int add_term(struct term_index *idx, int *max, const xmlChar *term)
+{
+	int state = 0;
+	int i;
+
+	for (i = 0; term[i]; ++i) {
+		xmlChar c = fold(term[i], idx->ignorecase);
+		int next;
+
+		if ((next = term_child(idx, state, c)) == -1) {
+			next = new_term_state(idx, max, c, i + 1);
+
+			if (state == 0) {
+				idx->root[c] = next;
+			} else {
+				idx->states[next].sibling = idx->states[state].child;
+				idx->states[state].child = next;
+			}
+		}
+
+		state = next;
+	}
+
+	if (idx->states[state].term == -1) {
+		struct term *t;
+
+		idx->terms = realloc(idx->terms, (idx->nterms + 1) * sizeof(struct term));
+		t = &idx->terms[idx->nterms];
+		t->len = i;
+		t->flags = NULL;
+		t->nflags = 0;
+
+		idx->states[state].term = idx->nterms++;
+	}
+
+	return idx->states[state].term;
+}
+
+/* Compile the terms of a set of index flags. */
+static struct term_index *new_term_index(xmlNodeSetPtr flags, bool ignorecase)
+{
+	struct term_index *idx;
+	int max = 256;
+	int *queue;
+	int head, tail;
+	int i;
+
+	idx = malloc(sizeof(struct term_index));
+	idx->flags = flags;
+	idx->ignorecase = ignorecase;
+	idx->states = malloc(max * sizeof(struct term_state));
+	idx->nstates = 0;
+	idx->terms = NULL;
+	idx->nterms = 0;
+	idx->flag_terms = malloc((flags ? flags->nodeNr : 0) * sizeof(int));
+
+	for (i = 0; i < 256; ++i) {
+		idx->root[i] = -1;
+	}
+
+	new_term_state(idx, &max, 0, 0);
+
+	for (i = 0; flags && i < flags->nodeNr; ++i) {
+		xmlChar *term;
+		struct term *t;
+
+		term = last_level(flags->nodeTab[i]);
+
+		/* A flag without a term can never be matched. */
+		if (xmlStrlen(term) == 0) {
+			idx->flag_terms[i] = -1;
+			xmlFree(term);
+			continue;
+		}
+
+		idx->flag_terms[i] = add_term(idx, &max, term);
+		xmlFree(term);
+
+		t = &idx->terms[idx->flag_terms[i]];
+		t->flags = realloc(t->flags, (t->nflags + 1) * sizeof(int));
+		t->flags[t->nflags++] = i;
+	}
+
+	/* Set the failure links breadth-first, so that the link of each state
+	 * is set before those of its children. */
+	queue = malloc(idx->nstates * sizeof(int));
+	head = tail = 0;
+
+	for (i = 0; i < 256; ++i) {
+		if (idx->root[i] != -1) {
+			queue[tail++] = idx->root[i];
+		}
+	}
+
+	while (head < tail) {
+		int state = queue[head++];
+		int child;
+
+		for (child = idx->states[state].child; child != -1; child = idx->states[child].sibling) {
+			int f = idx->states[state].fail;
+			int next;
+
+			while ((next = term_child(idx, f, idx->states[child].c)) == -1 && f != 0) {
+				f = idx->states[f].fail;
+			}
+
+			f = next == -1 ? 0 : next;
+
+			idx->states[child].fail = f;
+			idx->states[child].out = idx->states[f].term != -1 ? f : idx->states[f].out;
+
+			queue[tail++] = child;
+		}
+	}
+
+	free(queue);
+
+	return idx;
+}
+
+/* Free a compiled set of index flag terms. */
+static void free_term_index(struct term_index *idx)
+{
+	int i;
+
+	if (!idx) {
+		return;
+	}
+
+	for (i = 0; i < idx->nterms; ++i) {
+		free(idx->terms[i].flags);
+	}
+
+	free(idx->terms);
+	free(idx->states);
+	free(idx->flag_terms);
+	free(idx);
+}
+
+/* Find every occurrence of every term in a string. */
+static struct term_match *find_terms(const struct term_index *idx, const xmlChar *content, int *n)
+{
+	struct term_match *matches = NULL;
+	int max = 0;
+	int state = 0;
 	int i;
 
+	*n = 0;
+
+	for (i = 0; content[i]; ++i) {
+		xmlChar c = fold(content[i], idx->ignorecase);
+		int next, out;
+
+		while ((next = term_child(idx, state, c)) == -1 && state != 0) {
+			state = idx->states[state].fail;
+		}
+
+		state = next == -1 ? 0 : next;
+
+		out = idx->states[state].term != -1 ? state : idx->states[state].out;
+
+		for (; out != -1; out = idx->states[out].out) {
+			if (*n == max) {
+				max = max ? max * 2 : 16;
+				matches = realloc(matches, max * sizeof(struct term_match));
+			}
+
+			matches[*n].term = idx->states[out].term;
+			matches[*n].start = i - idx->states[out].depth + 1;
+			++(*n);
+		}
+	}
+
+	return matches;
+}
+
+/* Order matches by term, then by position. */
+static int compare_matches(const void *a, const void *b)
+{
+	const struct term_match *m1 = a, *m2 = b;
+
+	if (m1->term != m2->term) {
+		return m1->term - m2->term;
+	}
+
+	return m1->start - m2->start;
+}
+
+/* Order flags by position. Where several flags follow the same position, the
+ * flag which comes later in the index comes first, as each flag is inserted
+ * directly after the text. */
+static int compare_flag_pos(const void *a, const void *b)
+{
+	const struct flag_pos *f1 = a, *f2 = b;
+
+	if (f1->pos != f2->pos) {
+		return f1->pos - f2->pos;
+	}
+
+	return f2->flag - f1->flag;
+}
+
+/* Compare two ints. */
+static int compare_ints(const void *a, const void *b)
+{
+	return *(const int *) a - *(const int *) b;
+}
+
+/* Find the text piece around a position. The text is split after each flagged
+ * term, and a term cannot span two pieces. */
+static void find_piece(const int *splits, int nsplits, int len, int pos, int *start, int *end)
+{
+	int lo = 0, hi = nsplits;
+
+	/* First split after pos. */
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+
+		if (splits[mid] <= pos) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	*start = lo > 0 ? splits[lo - 1] : 0;
+	*end = lo < nsplits ? splits[lo] : len;
+}
+
+/* Test whether a matched term is delimited within its text piece. */
+static bool is_term(const xmlChar *content, int start, int end, int i, int term_len)
+{
+	xmlChar s, e;
+
+	s = i == start ? ' ' : content[i - 1];
+	e = i + term_len >= end - 1 ? ' ' : content[i + term_len];
+
+	return xmlStrchr(PRE_TERM_DELIM, s) && xmlStrchr(POST_TERM_DELIM, e);
+}
+
+/* Insert indexFlag elements after matched terms.
+ *
+ * Flags are applied in the order they appear in the index, and each flag's
+ * term is only matched within the pieces of text left between the terms
+ * flagged before it, so the result is the same as flagging each term in
+ * turn. */
+static void gen_index_node(xmlNodePtr node, const struct term_index *idx)
+{
+	xmlChar *content;
+	int content_len;
+	struct term_match *matches;
+	int nmatches;
+	int *flags = NULL, nflags = 0;
+	int *ranges;
+	int *splits = NULL, nsplits = 0;
+	struct flag_pos *inserts = NULL;
+	int ninserts = 0, maxinserts = 0;
+	int i, j;
+	xmlNodePtr cur;
+
 	content = xmlNodeGetContent(node);
+
+	if (!(matches = find_terms(idx, content, &nmatches))) {
+		xmlFree(content);
+		return;
+	}
+
 	content_len = xmlStrlen(content);
 
-	term = last_level(flag);
-	term_len = xmlStrlen(term);
+	qsort(matches, nmatches, sizeof(struct term_match), compare_matches);
 
-	i = 0;
-	while (i + term_len <= content_len) {
-		if (is_term(content, content_len, i, term, term_len, ignorecase)) {
-			xmlChar *s1 = xmlStrndup(content, i + term_len);
-			xmlChar *s2 = xmlStrsub(content, i + term_len, content_len - (i + term_len));
-			xmlNodePtr acr;
+	/* First match of each term found. */
+	ranges = malloc(idx->nterms * sizeof(int));
 
-			xmlFree(content);
+	for (i = 0; i < nmatches; ++i) {
+		if (i == 0 || matches[i].term != matches[i - 1].term) {
+			struct term *t = &idx->terms[matches[i].term];
 
-			xmlNodeSetContent(node, s1);
-			xmlFree(s1);
+			ranges[matches[i].term] = i;
 
-			acr = xmlAddNextSibling(node, xmlCopyNode(flag, 1));
-			node = xmlAddNextSibling(acr, xmlNewText(s2));
+			flags = realloc(flags, (nflags + t->nflags) * sizeof(int));
+			memcpy(flags + nflags, t->flags, t->nflags * sizeof(int));
+			nflags += t->nflags;
+		}
+	}
 
-			content = s2;
-			content_len = xmlStrlen(s2);
-			i = 0;
-		} else {
-			++i;
+	qsort(flags, nflags, sizeof(int), compare_ints);
+
+	splits = malloc(nmatches * sizeof(int));
+
+	for (i = 0; i < nflags; ++i) {
+		int term = idx->flag_terms[flags[i]];
+		int term_len = idx->terms[term].len;
+
+		for (j = ranges[term]; j < nmatches && matches[j].term == term; ++j) {
+			int start, end, pos, k;
+
+			find_piece(splits, nsplits, content_len, matches[j].start, &start, &end);
+
+			if (matches[j].start + term_len > end || !is_term(content, start, end, matches[j].start, term_len)) {
+				continue;
+			}
+
+			pos = matches[j].start + term_len;
+
+			if (ninserts == maxinserts) {
+				maxinserts = maxinserts ? maxinserts * 2 : 16;
+				inserts = realloc(inserts, maxinserts * sizeof(struct flag_pos));
+			}
+
+			inserts[ninserts].pos = pos;
+			inserts[ninserts].flag = flags[i];
+			++ninserts;
+
+			/* Split the text after the term. */
+			if (pos < end) {
+				for (k = nsplits; k > 0 && splits[k - 1] > pos; --k) {
+					splits[k] = splits[k - 1];
+				}
+				splits[k] = pos;
+				++nsplits;
+			}
 		}
 	}
 
-	xmlFree(term);
+	qsort(inserts, ninserts, sizeof(struct flag_pos), compare_flag_pos);
+
+	cur = node;
+
+	for (i = 0; i < ninserts; i = j) {
+		int pos = inserts[i].pos;
+		int next;
+
+		if (i == 0) {
+			xmlChar *s = xmlStrndup(content, pos);
+			xmlNodeSetContent(node, s);
+			xmlFree(s);
+		}
+
+		for (j = i; j < ninserts && inserts[j].pos == pos; ++j) {
+			cur = xmlAddNextSibling(cur, xmlCopyNode(idx->flags->nodeTab[inserts[j].flag], 1));
+		}
+
+		next = j < ninserts ? inserts[j].pos : content_len;
+
+		if (next > pos) {
+			cur = xmlAddNextSibling(cur, xmlNewTextLen(content + pos, next - pos));
+		}
+	}
+
+	free(inserts);
+	free(splits);
+	free(ranges);
+	free(flags);
+	free(matches);
 	xmlFree(content);
 }
 
-/* Flag an individual term in all applicable elements in a module. */
-static void gen_index_flag(xmlNodePtr flag, xmlXPathContextPtr ctx, bool ignorecase)
+/* Insert indexFlags for each term included in the index in all applicable
+ * elements in a module. */
+static void gen_index_flags(const struct term_index *idx, xmlXPathContextPtr ctx)
 {
 	xmlXPathObjectPtr obj;
 
@@ -147,23 +547,13 @@ static void gen_index_flag(xmlNodePtr flag, xmlXPathContextPtr ctx, bool ignorec
 		int i;
 
 		for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
-			gen_index_node(obj->nodesetval->nodeTab[i], flag, ignorecase);
+			gen_index_node(obj->nodesetval->nodeTab[i], idx);
 		}
 	}
 
 	xmlXPathFreeObject(obj);
 }
 
-/* Insert indexFlags for each term included in the specified index file. */
-static void gen_index_flags(xmlNodeSetPtr flags, xmlXPathContextPtr ctx, bool ignorecase)
-{
-	int i;
-
-	for (i = 0; i < flags->nodeNr; ++i) {
-		gen_index_flag(flags->nodeTab[i], ctx, ignorecase);
-	}
-}
-
 /* Apply a built-in XSLT transform to a doc in place. */
 static void transform_doc(xmlDocPtr doc, unsigned char *xsl, unsigned int len)
 {
@@ -212,12 +602,10 @@ static void delete_index_flags(const char *path, bool overwrite)
 }
 
 /* Insert indexFlag elements after matched terms in a document. */
-static void gen_index(const char *path, xmlDocPtr index_doc, bool overwrite, bool ignorecase)
+static void gen_index(const char *path, const struct term_index *idx, bool overwrite)
 {
 	xmlDocPtr doc;
-	xmlXPathContextPtr doc_ctx, index_ctx;
-	xmlXPathObjectPtr index_obj;
-	xmlNodeSetPtr flags;
+	xmlXPathContextPtr doc_ctx;
 
 	if (verbosity >= VERBOSE) {
 		fprintf(stderr, I_MARKUP, path);
@@ -230,19 +618,13 @@ static void gen_index(const char *path, xmlDocPtr index_doc, bool overwrite, boo
 		return;
 	}
 
-	index_ctx = xmlXPathNewContext(index_doc);
-	index_obj = xmlXPathEvalExpression(BAD_CAST "//indexFlag", index_ctx);
-	flags = index_obj->nodesetval;
-
 	doc_ctx = xmlXPathNewContext(doc);
 
-	if (!xmlXPathNodeSetIsEmpty(flags)) {
-		gen_index_flags(flags, doc_ctx, ignorecase);
+	if (idx->nterms > 0) {
+		gen_index_flags(idx, doc_ctx);
 	}
 
 	xmlXPathFreeContext(doc_ctx);
-	xmlXPathFreeObject(index_obj);
-	xmlXPathFreeContext(index_ctx);
 
 	if (xmlStrcmp(xmlFirstElementChild(xmlDocGetRootElement(doc))->name, BAD_CAST "idstatus") == 0) {
 		convert_to_iss_30(doc);
@@ -271,7 +653,7 @@ static xmlDocPtr read_index_flags(const char *fname)
 	return index_doc;
 }
 
-static void handle_list(const char *path, bool delflags, xmlDocPtr index_doc, bool overwrite, bool ignorecase)
+static void handle_list(const char *path, bool delflags, const struct term_index *idx, bool overwrite)
 {
 	FILE *f;
 	char line[PATH_MAX];
@@ -295,7 +677,7 @@ static void handle_list(const char *path, bool delflags, xmlDocPtr index_doc, bo
 		if (delflags) {
 			delete_index_flags(line, overwrite);
 		} else {
-			gen_index(line, index_doc, overwrite, ignorecase);
+			gen_index(line, idx, overwrite);
 		}
 	}
 
@@ -311,6 +693,9 @@ int main(int argc, char **argv)
 	bool list = false;
 
 	xmlDocPtr index_doc = NULL;
+	xmlXPathContextPtr index_ctx = NULL;
+	xmlXPathObjectPtr index_obj = NULL;
+	struct term_index *idx = NULL;
 
 	const char *sopts = "DfI:liqvh?";
 	struct option lopts[] = {
@@ -373,24 +758,34 @@ int main(int argc, char **argv)
 		index_doc = read_index_flags(fname);
 	}
 
+	/* Compile the terms of all flags once for all modules. */
+	if (!delflags) {
+		index_ctx = xmlXPathNewContext(index_doc);
+		index_obj = xmlXPathEvalExpression(BAD_CAST "//indexFlag", index_ctx);
+		idx = new_term_index(index_obj->nodesetval, ignorecase);
+	}
+
 	if (optind < argc) {
 		for (i = optind; i < argc; ++i) {
 			if (list) {
-				handle_list(argv[i], delflags, index_doc, overwrite, ignorecase);
+				handle_list(argv[i], delflags, idx, overwrite);
 			} else if (delflags) {
 				delete_index_flags(argv[i], overwrite);
 			} else {
-				gen_index(argv[i], index_doc, overwrite, ignorecase);
+				gen_index(argv[i], idx, overwrite);
 			}
 		}
 	} else if (list) {
-		handle_list(NULL, delflags, index_doc, overwrite, ignorecase);
+		handle_list(NULL, delflags, idx, overwrite);
 	} else if (delflags) {
 		delete_index_flags("-", false);
 	} else {
-		gen_index("-", index_doc, false, ignorecase);
+		gen_index("-", idx, false);
 	}
 
+	free_term_index(idx);
+	xmlXPathFreeObject(index_obj);
+	xmlXPathFreeContext(index_ctx);
 	xmlFreeDoc(index_doc);
 
 	xsltCleanupGlobals();
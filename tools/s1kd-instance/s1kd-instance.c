@@ -17,7 +17,7 @@
 #include "xsl.h"
 
 #define PROG_NAME "s1kd-instance"
-#define VERSION "9.4.4"
+#define VERSION "9.4.9"
 
 /* Prefixes before messages printed to console */
 #define ERR_PREFIX PROG_NAME ": ERROR: "
@@ -674,7 +674,13 @@ static bool eval_evaluate(xmlNodePtr defs, xmlNodePtr evaluate, bool assume)
 		if (verbosity > QUIET) {
 			fprintf(stderr, S_MISSING_ANDOR);
 		}
+#ifdef LIBS1KD
+		/* The library must not end the calling process, so treat the
+		 * malformed evaluation as unresolved instead. */
+		return assume;
+#else
 		exit(EXIT_BAD_XML);
+#endif
 	}
 
 	if (xmlStrcmp(andOr, BAD_CAST "and") == 0) {
@@ -759,7 +765,7 @@ static xmlNodePtr get_element_by_id(xmlNodePtr root, const char *id)
 }
 
 /* Remove non-applicable elements from content */
-static void strip_applic(xmlNodePtr defs, xmlNodePtr referencedApplicGroup, xmlNodePtr node)
+static void strip_applic(xmlNodePtr defs, xmlNodePtr referencedApplicGroup, xmlNodePtr node, bool tag)
 {
 	xmlNodePtr cur, next;
 	xmlNodePtr attr;
@@ -775,7 +781,7 @@ static void strip_applic(xmlNodePtr defs, xmlNodePtr referencedApplicGroup, xmlN
 		xmlFree(applicRefId);
 
 		if (applic && !eval_applic_stmt(defs, applic, true)) {
-			if (tag_non_applic) {
+			if (tag) {
 				add_first_child(node, xmlNewPI(BAD_CAST "notApplicable", NULL));
 			} else {
 				xmlUnlinkNode(node);
@@ -788,7 +794,7 @@ static void strip_applic(xmlNodePtr defs, xmlNodePtr referencedApplicGroup, xmlN
 	cur = node->children;
 	while (cur) {
 		next = cur->next;
-		strip_applic(defs, referencedApplicGroup, cur);
+		strip_applic(defs, referencedApplicGroup, cur, tag);
 		cur = next;
 	}
 }
@@ -887,7 +893,7 @@ static void rem_disp_text(xmlNodePtr node)
  * Returns true if the whole annotation is removed, or false if only parts of
  * it are removed.
  */
-static bool simpl_applic(xmlNodePtr defs, xmlNodePtr node, bool remtrue)
+static bool simpl_applic(xmlNodePtr defs, xmlNodePtr node, bool remtrue, bool clean_text)
 {
 	xmlNodePtr cur, next;
 
@@ -899,7 +905,7 @@ static bool simpl_applic(xmlNodePtr defs, xmlNodePtr node, bool remtrue)
 		}
 	} else if (xmlStrcmp(node->name, BAD_CAST "evaluate") == 0) {
 		if ((remtrue && eval_applic(defs, node, false)) || !eval_applic(defs, node, true)) {
-			if (clean_disp_text) {
+			if (clean_text) {
 				rem_disp_text(node);
 			}
 
@@ -910,7 +916,7 @@ static bool simpl_applic(xmlNodePtr defs, xmlNodePtr node, bool remtrue)
 		}
 	} else if (xmlStrcmp(node->name, BAD_CAST "assert") == 0) {
 		if ((remtrue && eval_assert(defs, node, false)) || !eval_assert(defs, node, true)) {
-			if (clean_disp_text) {
+			if (clean_text) {
 				rem_disp_text(node);
 			}
 
@@ -924,7 +930,7 @@ static bool simpl_applic(xmlNodePtr defs, xmlNodePtr node, bool remtrue)
 	cur = node->children;
 	while (cur) {
 		next = cur->next;
-		simpl_applic(defs, cur, remtrue);
+		simpl_applic(defs, cur, remtrue, clean_text);
 		cur = next;
 	}
 
@@ -978,7 +984,7 @@ static void simpl_applic_evals(xmlNodePtr node)
 }
 
 /* Remove <referencedApplicGroup> if all applic statements are removed */
-static void simpl_applic_clean(xmlNodePtr defs, xmlNodePtr referencedApplicGroup, bool remtrue)
+static void simpl_applic_clean(xmlNodePtr defs, xmlNodePtr referencedApplicGroup, bool remtrue, bool clean_text)
 {
 	bool has_applic = false;
 	xmlNodePtr cur;
@@ -987,7 +993,7 @@ static void simpl_applic_clean(xmlNodePtr defs, xmlNodePtr referencedApplicGroup
 		return;
 	}
 
-	simpl_applic(defs, referencedApplicGroup, remtrue);
+	simpl_applic(defs, referencedApplicGroup, remtrue, clean_text);
 	simpl_applic_evals(referencedApplicGroup);
 
 	for (cur = referencedApplicGroup->children; cur; cur = cur->next) {
@@ -1047,7 +1053,7 @@ static xmlNodePtr simpl_whole_applic(xmlNodePtr defs, xmlDocPtr doc, bool remtru
 
 	applic = xmlCopyNode(orig, 1);
 
-	if (simpl_applic(userdefs, applic, remtrue)) {
+	if (simpl_applic(userdefs, applic, remtrue, clean_disp_text)) {
 		xmlNodePtr disptext;
 		applic = xmlNewNode(NULL, BAD_CAST "applic");
 		disptext = xmlNewChild(applic, NULL, BAD_CAST "displayText", NULL);
@@ -1861,7 +1867,7 @@ static xmlNodePtr undepend_cir(xmlDocPtr dm, xmlNodePtr defs, const char *cirdoc
 
 	if (!xmlXPathNodeSetIsEmpty(results->nodesetval)) {
 		referencedApplicGroup = results->nodesetval->nodeTab[0];
-		strip_applic(defs, referencedApplicGroup, content);
+		strip_applic(defs, referencedApplicGroup, content, tag_non_applic);
 	}
 
 	xmlXPathFreeObject(results);
@@ -3216,7 +3222,7 @@ static xmlNodePtr resolve_container_ref(xmlNodePtr refident, xmlDocPtr doc, cons
 	}
 
 	/* Filter the container. */
-	strip_applic(defs, rag, root);
+	strip_applic(defs, rag, root, tag_non_applic);
 
 	ctx = xmlXPathNewContext(doc);
 	xmlXPathSetContextNode(container, ctx);
@@ -3298,42 +3304,26 @@ static void add_ct_prop_vals(xmlDocPtr act, xmlDocPtr cct, const xmlChar *id, co
 	xmlNodePtr property = NULL;
 
 	if (act && xmlStrcmp(type, BAD_CAST "prodattr") == 0) {
-		ctx = xmlXPathNewContext(act);
-		xmlXPathRegisterVariable(ctx, BAD_CAST "id", xmlXPathNewString(id));
-		obj = xmlXPathEvalExpression(BAD_CAST "//productAttribute[@id=$id]|//prodattr[@id=$id]", ctx);
-
-		if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-			property = obj->nodesetval->nodeTab[0];
-		}
+		property = xref_table_property(act, type, id);
 	} else if (cct && xmlStrcmp(type, BAD_CAST "condition") == 0) {
+		xmlNodePtr cond;
 		xmlChar *condtype;
 
-		ctx = xmlXPathNewContext(cct);
-		xmlXPathRegisterVariable(ctx, BAD_CAST "id", xmlXPathNewString(id));
-		obj = xmlXPathEvalExpression(BAD_CAST "//cond[@id=$id]/@condTypeRefId|//condition[@id=$id]/@condtyperef", ctx);
-
-		if (xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
+		/* The values of a condition are defined by its condition type,
+		 * so a condition without one has no definition. */
+		if (!(cond = xref_table_definition(cct, "cond", id)) ||
+		    !(condtype = first_xpath_value(NULL, cond, BAD_CAST "@condTypeRefId|@condtyperef"))) {
 			fprintf(stderr, S_NO_CT_PROP, (char *) type, (char *) id);
 			return;
 		}
 
-		condtype = xmlNodeGetContent(obj->nodesetval->nodeTab[0]);
-		xmlXPathFreeObject(obj);
-		xmlXPathRegisterVariable(ctx, BAD_CAST "id", xmlXPathNewString(condtype));
+		property = xref_table_definition(cct, "condtype", condtype);
 		xmlFree(condtype);
-
-		obj = xmlXPathEvalExpression(BAD_CAST "//condType[@id=$id]|//conditiontype[@id=$id]", ctx);
-
-		if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-			property = obj->nodesetval->nodeTab[0];
-		}
 	} else {
 		fprintf(stderr, S_NO_CT, (char *) id, (char *) type, xmlStrcmp(type, BAD_CAST "prodattr") == 0 ? "ACT" : "CCT");
 		return;
 	}
 
-	xmlXPathFreeObject(obj);
-
 	if (property) {
 		xmlChar *s;
 
@@ -3358,6 +3348,7 @@ static void add_ct_prop_vals(xmlDocPtr act, xmlDocPtr cct, const xmlChar *id, co
 			xmlFree(s);
 		}
 
+		ctx = xmlXPathNewContext(property->doc);
 		xmlXPathSetContextNode(property, ctx);
 
 		obj = xmlXPathEvalExpression(BAD_CAST "enumeration|enum", ctx);
@@ -3401,11 +3392,10 @@ static void add_ct_prop_vals(xmlDocPtr act, xmlDocPtr cct, const xmlChar *id, co
 		}
 
 		xmlXPathFreeObject(obj);
+		xmlXPathFreeContext(ctx);
 	} else {
 		fprintf(stderr, S_NO_CT_PROP, (char *) type, (char *) id);
 	}
-
-	xmlXPathFreeContext(ctx);
 }
 
 /* Add a property used in an object to the properties report. */
@@ -3488,13 +3478,13 @@ static void add_props(xmlNodePtr report, const char *path, bool all, const char
 		char fname[PATH_MAX];
 
 		if (useract) {
-			if (!(act = read_xml_doc(useract))) {
+			if (!(act = read_xref_table(useract))) {
 				if (verbosity > QUIET) {
 					fprintf(stderr, S_MISSING_ACT, useract);
 				}
 			}
 		} else if (find_act_fname(fname, doc)) {
-			if (!(act = read_xml_doc(fname))) {
+			if (!(act = read_xref_table(fname))) {
 				if (verbosity > QUIET) {
 					fprintf(stderr, S_MISSING_ACT, fname);
 				}
@@ -3503,13 +3493,13 @@ static void add_props(xmlNodePtr report, const char *path, bool all, const char
 
 		if (act) {
 			if (usercct) {
-				if (!(cct = read_xml_doc(usercct))) {
+				if (!(cct = read_xref_table(usercct))) {
 					if (verbosity > QUIET) {
 						fprintf(stderr, S_MISSING_CCT, usercct);
 					}
 				}
 			} else if (find_cct_fname(fname, act)) {
-				if (!(cct = read_xml_doc(fname))) {
+				if (!(cct = read_xref_table(fname))) {
 					if (verbosity > QUIET) {
 						fprintf(stderr, S_MISSING_CCT, fname);
 					}
@@ -3535,8 +3525,6 @@ static void add_props(xmlNodePtr report, const char *path, bool all, const char
 	xmlXPathFreeObject(obj);
 	xmlXPathFreeContext(ctx);
 
-	xmlFreeDoc(act);
-	xmlFreeDoc(cct);
 	xmlFreeDoc(doc);
 }
 
@@ -3640,7 +3628,7 @@ static bool annotation_is_superset(xmlNodePtr defs, xmlNodePtr applic, bool simp
 	app = xmlCopyNode(applic, 1);
 
 	if (simpl) {
-		simpl_applic(defscopy, app, true);
+		simpl_applic(defscopy, app, true, clean_disp_text);
 		simpl_applic_evals(app);
 	}
 
@@ -3866,6 +3854,10 @@ typedef enum {
 	S1KD_FILTER_SIMPLIFY,
 	S1KD_FILTER_PRUNE
 } s1kdFilterMode;
+typedef enum {
+	S1KD_FILTER_TAG_NON_APPLIC = 1,
+	S1KD_FILTER_CLEAN_DISPLAY_TEXT = 2
+} s1kdFilterOption;
 
 s1kdApplicability s1kdNewApplicability(void)
 {
@@ -3886,10 +3878,11 @@ void s1kdAssign(s1kdApplicability app, const xmlChar *ident, const xmlChar *type
 	xmlSetProp(a, BAD_CAST "applicPropertyValues", value);
 }
 
-xmlDocPtr s1kdDocFilter(const xmlDocPtr doc, s1kdApplicability app, s1kdFilterMode mode)
+xmlDocPtr s1kdCtxDocFilter(const s1kdContext *ctx, const xmlDocPtr doc, s1kdApplicability app, s1kdFilterMode mode)
 {
 	xmlDocPtr out;
 	xmlNodePtr root, referencedApplicGroup;
+	int opts = ctx_filter_opts(ctx);
 
 	out = xmlCopyDoc(doc, 1);
 
@@ -3904,7 +3897,7 @@ xmlDocPtr s1kdDocFilter(const xmlDocPtr doc, s1kdApplicability app, s1kdFilterMo
 		return out;
 	}
 
-	strip_applic(app, referencedApplicGroup, root);
+	strip_applic(app, referencedApplicGroup, root, optset(opts, S1KD_FILTER_TAG_NON_APPLIC));
 
 	if (mode >= S1KD_FILTER_REDUCE) {
 		clean_applic_stmts(app, referencedApplicGroup, mode < S1KD_FILTER_PRUNE);
@@ -3918,7 +3911,7 @@ xmlDocPtr s1kdDocFilter(const xmlDocPtr doc, s1kdApplicability app, s1kdFilterMo
 		clean_applic(referencedApplicGroup, root);
 
 		if (mode >= S1KD_FILTER_SIMPLIFY && xmlChildElementCount(referencedApplicGroup) != 0) {
-			simpl_applic_clean(app, referencedApplicGroup, mode == S1KD_FILTER_PRUNE);
+			simpl_applic_clean(app, referencedApplicGroup, mode == S1KD_FILTER_PRUNE, optset(opts, S1KD_FILTER_CLEAN_DISPLAY_TEXT));
 		}
 
 		if (mode != S1KD_FILTER_PRUNE && xmlChildElementCount(referencedApplicGroup) != 0) {
@@ -3929,17 +3922,23 @@ xmlDocPtr s1kdDocFilter(const xmlDocPtr doc, s1kdApplicability app, s1kdFilterMo
 	return out;
 }
 
-int s1kdFilter(const char *object_xml, int object_size, s1kdApplicability app, s1kdFilterMode mode, char **result_xml, int *result_size)
+xmlDocPtr s1kdDocFilter(const xmlDocPtr doc, s1kdApplicability app, s1kdFilterMode mode)
+{
+	return s1kdCtxDocFilter(NULL, doc, app, mode);
+}
+
+int s1kdCtxFilter(const s1kdContext *ctx, const char *object_xml, int object_size, s1kdApplicability app, s1kdFilterMode mode, char **result_xml, int *result_size)
 {
 	xmlDocPtr doc, res;
 
-	if ((doc = read_xml_mem(object_xml, object_size)) == NULL) {
+	if ((doc = read_xml_mem_ctx(ctx, object_xml, object_size)) == NULL) {
 		return 1;
 	}
-	if ((res = s1kdDocFilter(doc, app, mode)) == NULL) {
+	res = s1kdCtxDocFilter(ctx, doc, app, mode);
+	xmlFreeDoc(doc);
+	if (res == NULL) {
 		return 1;
 	}
-	xmlFreeDoc(doc);
 
 	if (result_xml && result_size) {
 		xmlDocDumpMemory(res, (xmlChar **) result_xml, result_size);
@@ -3949,6 +3948,11 @@ int s1kdFilter(const char *object_xml, int object_size, s1kdApplicability app, s
 
 	return 0;
 }
+
+int s1kdFilter(const char *object_xml, int object_size, s1kdApplicability app, s1kdFilterMode mode, char **result_xml, int *result_size)
+{
+	return s1kdCtxFilter(NULL, object_xml, object_size, app, mode, result_xml, result_size);
+}
 #else
 /* Print a usage message */
 static void show_help(void)
@@ -4661,7 +4665,7 @@ int main(int argc, char **argv)
 			if (!useract && ((add_deps && !usercct) || (strcmp(product, "") != 0 && !userpct))) {
 				char fname[PATH_MAX];
 				if (find_act_fname(fname, doc)) {
-					act = read_xml_doc(fname);
+					act = read_xref_table(fname);
 				}
 			}
 
@@ -4672,9 +4676,8 @@ int main(int argc, char **argv)
 				} else if (act) {
 					char fname[PATH_MAX];
 					if (find_cct_fname(fname, act)) {
-						if ((cct = read_xml_doc(fname))) {
+						if ((cct = read_xref_table(fname))) {
 							add_cct_depends(doc, cct, NULL);
-							xmlFreeDoc(cct);
 						}
 					}
 				}
@@ -4686,15 +4689,13 @@ int main(int argc, char **argv)
 			if (!userpct && act && strcmp(product, "") != 0) {
 				char fname[PATH_MAX];
 				if (find_pct_fname(fname, act)) {
-					if ((pct = read_xml_doc(fname))) {
+					if ((pct = read_xref_table(fname))) {
 						load_applic_from_pct(pct, fname, product);
-						xmlFreeDoc(pct);
 					}
 				}
 			}
 
 			if (act && !useract) {
-				xmlFreeDoc(act);
 				act = NULL;
 			}
 
@@ -4759,7 +4760,7 @@ int main(int argc, char **argv)
 
 				if (referencedApplicGroup) {
 					if (applicability->children) {
-						strip_applic(applicability, referencedApplicGroup, root);
+						strip_applic(applicability, referencedApplicGroup, root, tag_non_applic);
 
 						if (clean || simpl) {
 							clean_applic_stmts(applicability, referencedApplicGroup, remtrue);
@@ -4773,7 +4774,7 @@ int main(int argc, char **argv)
 							clean_applic(referencedApplicGroup, root);
 
 							if (simpl && xmlChildElementCount(referencedApplicGroup) != 0) {
-								simpl_applic_clean(applicability, referencedApplicGroup, remtrue);
+								simpl_applic_clean(applicability, referencedApplicGroup, remtrue, clean_disp_text);
 							}
 
 							if (remtrue && xmlChildElementCount(referencedApplicGroup) != 0) {
@@ -5001,6 +5002,9 @@ cleanup:
 	xmlFreeDoc(def_cir_xsl);
 	xmlFreeNode(applicability);
 	xmlFreeDoc(props_report);
+	free_object_info_cache();
+	free_pattern_cache();
+	free_xref_tables();
 	xsltCleanupGlobals();
 	xmlCleanupParser();
 
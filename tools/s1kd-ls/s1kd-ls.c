@@ -26,7 +26,7 @@ static unsigned UPF_MAX = OBJECT_MAX;
 static unsigned NON_MAX = OBJECT_MAX;
 
 #define PROG_NAME "s1kd-ls"
-#define VERSION "1.14.0"
+#define VERSION "1.14.1"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 
@@ -262,58 +262,17 @@ static void list_dir(const char *path, int only_writable, int only_readonly, int
 	closedir(dir);
 }
 
-/* Return the first node matching an XPath expression. */
-static xmlNodePtr first_xpath_node(xmlDocPtr doc, xmlNodePtr node, const char *xpath)
-{
-	xmlXPathContextPtr ctx;
-	xmlXPathObjectPtr obj;
-	xmlNodePtr first;
-
-	ctx = xmlXPathNewContext(doc ? doc : node->doc);
-	ctx->node = node;
-
-	obj = xmlXPathEvalExpression(BAD_CAST xpath, ctx);
-
-	if (xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		first = NULL;
-	} else {
-		first = obj->nodesetval->nodeTab[0];
-	}
-
-	xmlXPathFreeObject(obj);
-	xmlXPathFreeContext(ctx);
-
-	return first;
-}
-
-/* Return the content of the first node matching an XPath expression. */
-static xmlChar *first_xpath_value(xmlDocPtr doc, xmlNodePtr node, const char *xpath)
-{
-	return xmlNodeGetContent(first_xpath_node(doc, node, xpath));
-}
-
 /* Checks if a CSDB object is in the official state (inwork = 00). */
 static int is_official_issue(const char *fname, const char *path)
 {
 	if (no_issue) {
-		xmlDocPtr doc;
-		xmlChar *inwork;
-		int official;
+		struct object_info info;
 
-		doc = read_xml_doc(path);
-
-		if (!doc) {
+		if (get_object_info(path, &info) != 0) {
 			return 1;
 		}
 
-		inwork = first_xpath_value(doc, NULL, "//@inWork|//@inwork");
-
-		official = !inwork || xmlStrcmp(inwork, BAD_CAST "00") == 0;
-
-		xmlFree(inwork);
-		xmlFreeDoc(doc);
-
-		return official;
+		return !info.in_work[0] || strcmp(info.in_work, "00") == 0;
 	} else {
 		char inwork[3] = "";
 		int n;
@@ -1040,6 +999,7 @@ int main(int argc, char **argv)
 	}
 
 	free(execstr);
+	free_object_info_cache();
 
 	xmlCleanupParser();
 
@@ -9,11 +9,13 @@
 
 #include <libxml/tree.h>
 #include <libxml/xpath.h>
+#include <libxml/pattern.h>
+#include <libxml/xmlreader.h>
 
 #include "s1kd_tools.h"
 
 #define PROG_NAME "s1kd-metadata"
-#define VERSION "4.3.3"
+#define VERSION "4.4.1"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 
@@ -34,16 +36,20 @@
 
 enum verbosity {SILENT, NORMAL};
 
+struct extraction;
+
 struct opts {
 	xmlNodePtr conds;
 	int endl;
 	char *execstr;
+	struct extraction *extract;
 	char *fmtstr;
 	int format_all;
 	xmlNodePtr keys;
 	char *metadata_fname;
 	int only_editable;
 	int overwrite;
+	int status_only;
 	char *timefmt;
 	enum verbosity verbosity;
 };
@@ -2331,6 +2337,271 @@ static struct icn_metadata icn_metadata[] = {
 	{NULL}
 };
 
+/* Number of entries in the metadata table. */
+#define METADATA_COUNT (sizeof(metadata) / sizeof(metadata[0]) - 1)
+
+/* The metadata wanted from each object, found in a single walk.
+ *
+ * The path of each wanted item is compiled once as a streamable pattern,
+ * and each object is walked in document order until every wanted item has
+ * been found, which gives the same first node as evaluating each path
+ * separately. Paths which are not streamable are compiled as XPath. */
+struct extraction {
+	bool wanted[METADATA_COUNT];
+	xmlPatternPtr pats[METADATA_COUNT];
+	xmlXPathCompExprPtr exprs[METADATA_COUNT];
+	xmlNodePtr nodes[METADATA_COUNT];
+};
+
+/* Find the index of a metadata item by the first n characters of a key. */
+static int metadata_index(const char *key, int n)
+{
+	int i;
+
+	for (i = 0; metadata[i].key; ++i) {
+		if (strncmp(metadata[i].key, key, n) == 0 && metadata[i].key[n] == '\0') {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static void want_metadata(struct extraction *ext, int i)
+{
+	if (i == -1 || ext->wanted[i]) {
+		return;
+	}
+
+	ext->wanted[i] = true;
+
+	if (!(ext->pats[i] = xmlPatterncompile(BAD_CAST metadata[i].path, NULL, 0, NULL))) {
+		ext->exprs[i] = xmlXPathCompile(BAD_CAST metadata[i].path);
+	}
+}
+
+/* Want each metadata item named in a format string. */
+static void want_fmtstr_metadata(struct extraction *ext, const char *fmtstr)
+{
+	int i;
+
+	for (i = 0; fmtstr[i]; ++i) {
+		if (fmtstr[i] == FMTSTR_DELIM) {
+			if (fmtstr[i + 1] == FMTSTR_DELIM) {
+				++i;
+			} else {
+				const char *k, *e;
+				int n;
+
+				k = fmtstr + i + 1;
+				if (!(e = strchr(k, FMTSTR_DELIM))) break;
+				n = e - k;
+
+				want_metadata(ext, metadata_index(k, n));
+
+				i += n + 1;
+			}
+		}
+	}
+}
+
+/* Determine which metadata will be shown or tested for each object. */
+static struct extraction *new_extraction(struct opts *opts)
+{
+	struct extraction *ext;
+	xmlNodePtr cur;
+
+	ext = calloc(1, sizeof(struct extraction));
+
+	for (cur = opts->conds->children; cur; cur = cur->next) {
+		char *key;
+		key = (char *) xmlGetProp(cur, BAD_CAST "key");
+		want_metadata(ext, metadata_index(key, strlen(key)));
+		xmlFree(key);
+	}
+
+	if (opts->execstr) {
+		return ext;
+	} else if (opts->fmtstr) {
+		want_fmtstr_metadata(ext, opts->fmtstr);
+	} else if (opts->keys->children) {
+		for (cur = opts->keys->children; cur; cur = cur->next) {
+			char *key;
+			key = (char *) xmlGetProp(cur, BAD_CAST "name");
+			want_metadata(ext, metadata_index(key, strlen(key)));
+			xmlFree(key);
+		}
+	} else {
+		int i;
+		for (i = 0; metadata[i].key; ++i) {
+			if (!opts->only_editable || metadata[i].edit) {
+				want_metadata(ext, i);
+			}
+		}
+	}
+
+	return ext;
+}
+
+static void free_extraction(struct extraction *ext)
+{
+	int i;
+
+	if (!ext) {
+		return;
+	}
+
+	for (i = 0; metadata[i].key; ++i) {
+		xmlFreePattern(ext->pats[i]);
+		xmlXPathFreeCompExpr(ext->exprs[i]);
+	}
+
+	free(ext);
+}
+
+/* Match a node against the patterns of the wanted metadata not yet found.
+ * Returns the number of items found. */
+static int match_metadata(struct extraction *ext, xmlNodePtr node)
+{
+	int i, n = 0;
+
+	for (i = 0; metadata[i].key; ++i) {
+		if (ext->pats[i] && !ext->nodes[i] && xmlPatternMatch(ext->pats[i], node) == 1) {
+			ext->nodes[i] = node;
+			++n;
+		}
+	}
+
+	return n;
+}
+
+/* Find all wanted metadata in an object. */
+static void extract_metadata(struct extraction *ext, xmlDocPtr doc)
+{
+	int i, pending = 0;
+	xmlXPathContextPtr ctx;
+	xmlNodePtr cur;
+
+	memset(ext->nodes, 0, sizeof(ext->nodes));
+
+	if (!doc) {
+		return;
+	}
+
+	ctx = xmlXPathNewContext(doc);
+
+	for (i = 0; metadata[i].key; ++i) {
+		if (ext->pats[i]) {
+			++pending;
+		} else if (ext->exprs[i]) {
+			xmlXPathObjectPtr obj;
+
+			obj = xmlXPathCompiledEval(ext->exprs[i], ctx);
+
+			if (obj && !xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
+				ext->nodes[i] = obj->nodesetval->nodeTab[0];
+			}
+
+			xmlXPathFreeObject(obj);
+		}
+	}
+
+	xmlXPathFreeContext(ctx);
+
+	cur = xmlDocGetRootElement(doc);
+
+	while (cur && pending > 0) {
+		if (cur->type == XML_ELEMENT_NODE) {
+			xmlAttrPtr attr;
+
+			pending -= match_metadata(ext, cur);
+
+			for (attr = cur->properties; attr && pending > 0; attr = attr->next) {
+				pending -= match_metadata(ext, (xmlNodePtr) attr);
+			}
+
+			if (cur->children) {
+				cur = cur->children;
+				continue;
+			}
+		}
+
+		while (cur && !cur->next) {
+			cur = cur->parent;
+
+			if (cur && cur->type != XML_ELEMENT_NODE) {
+				cur = NULL;
+			}
+		}
+
+		if (cur) {
+			cur = cur->next;
+		}
+	}
+}
+
+/* Get the first node for a metadata item in an object. */
+static xmlNodePtr metadata_node(int i, xmlXPathContextPtr ctx, struct opts *opts)
+{
+	if (opts->extract && opts->extract->wanted[i]) {
+		return opts->extract->nodes[i];
+	}
+
+	return first_xpath_node(metadata[i].path, ctx);
+}
+
+/* Read only the root element and identification and status section of an
+ * object, stopping the parser at the end of the section. */
+static xmlDocPtr read_ident_status(const char *fname)
+{
+	xmlTextReaderPtr reader;
+	xmlDocPtr doc = NULL;
+	xmlNodePtr root = NULL;
+
+	if (!(reader = xmlReaderForFile(fname, NULL, DEFAULT_PARSE_OPTS))) {
+		return NULL;
+	}
+
+	while (xmlTextReaderRead(reader) == 1) {
+		xmlNodePtr node;
+
+		if (xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT) {
+			continue;
+		}
+
+		node = xmlTextReaderCurrentNode(reader);
+
+		if (!root) {
+			doc = xmlNewDoc(node->doc->version);
+			doc->URL = xmlStrdup(node->doc->URL);
+
+			if (node->doc->intSubset) {
+				doc->intSubset = xmlCopyDtd(node->doc->intSubset);
+				xmlAddChild((xmlNodePtr) doc, (xmlNodePtr) doc->intSubset);
+			}
+
+			root = xmlDocCopyNode(node, doc, 2);
+			xmlDocSetRootElement(doc, root);
+
+			if (xmlTextReaderIsEmptyElement(reader)) {
+				break;
+			}
+		} else if (xmlStrcmp(node->name, BAD_CAST "identAndStatusSection") == 0 || xmlStrcmp(node->name, BAD_CAST "idstatus") == 0) {
+			xmlNodePtr sect;
+
+			if ((sect = xmlTextReaderExpand(reader))) {
+				xmlAddChild(root, xmlDocCopyNode(sect, doc, 1));
+			}
+
+			break;
+		}
+	}
+
+	xmlFreeTextReader(reader);
+
+	return doc;
+}
+
 static int show_metadata(xmlXPathContextPtr ctxt, const char *key, struct opts *opts)
 {
 	int i;
@@ -2338,7 +2609,7 @@ static int show_metadata(xmlXPathContextPtr ctxt, const char *key, struct opts *
 	for (i = 0; metadata[i].key; ++i) {
 		if (strcmp(key, metadata[i].key) == 0) {
 			xmlNodePtr node;
-			if (!(node = first_xpath_node(metadata[i].path, ctxt))) {
+			if (!(node = metadata_node(i, ctxt, opts))) {
 				if (opts->endl > -1) putchar(opts->endl);
 				return EXIT_MISSING_METADATA;
 			}
@@ -2389,7 +2660,7 @@ static int show_all_metadata(xmlXPathContextPtr ctxt, struct opts *opts)
 
 		if (opts->only_editable && !metadata[i].edit) continue;
 
-		if ((node = first_xpath_node(metadata[i].path, ctxt))) {
+		if ((node = metadata_node(i, ctxt, opts))) {
 			if (node->type == XML_ATTRIBUTE_NODE) node = node->parent;
 
 			if (opts->endl == '\n') {
@@ -2552,7 +2823,7 @@ static int show_metadata_fmtstr_key(xmlXPathContextPtr ctx, const char *k, int n
 	for (i = 0; metadata[i].key; ++i) {
 		if (strcmp(metadata[i].key, key) == 0) {
 			xmlNodePtr node;
-			if (!(node = first_xpath_node(metadata[i].path, ctx))) {
+			if (!(node = metadata_node(i, ctx, opts))) {
 				show_err(EXIT_MISSING_METADATA, key, NULL, NULL, opts);
 				free(key);
 				return EXIT_MISSING_METADATA;
@@ -2651,7 +2922,7 @@ static xmlChar *get_cond_content(int i, xmlXPathContextPtr ctx, const char *fnam
 		return xmlCharStrdup(get_format(fname, opts));
 	} else if (strcmp(metadata[i].key, "modified") == 0) {
 		return xmlCharStrdup(get_modtime(fname, opts));
-	} else if ((node = first_xpath_node(metadata[i].path, ctx))) {
+	} else if ((node = metadata_node(i, ctx, opts))) {
 		if (metadata[i].get) {
 			return BAD_CAST metadata[i].get(node, opts);
 		} else {
@@ -2752,7 +3023,15 @@ static int show_or_edit_metadata(const char *fname, struct opts *opts)
 	int edit = 0;
 	xmlNodePtr cond;
 
-	doc = read_xml_doc(fname);
+	if (opts->extract && opts->status_only) {
+		doc = read_ident_status(fname);
+	} else {
+		doc = read_xml_doc(fname);
+	}
+
+	if (opts->extract) {
+		extract_metadata(opts->extract, doc);
+	}
 
 	ctxt = xmlXPathNewContext(doc);
 
@@ -2863,6 +3142,20 @@ static void add_val(xmlNodePtr keys, const char *val)
 	xmlSetProp(key, BAD_CAST "value", BAD_CAST val);
 }
 
+/* Whether any metadata is to be edited. */
+static bool has_values(xmlNodePtr keys)
+{
+	xmlNodePtr cur;
+
+	for (cur = keys->children; cur; cur = cur->next) {
+		if (xmlHasProp(cur, BAD_CAST "value")) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 static void add_cond(xmlNodePtr conds, const char *k, const char *o)
 {
 	xmlNodePtr cond;
@@ -2909,7 +3202,7 @@ static int show_or_edit_metadata_list(const char *fname, struct opts *opts)
 }
 
 #ifdef LIBS1KD
-xmlChar *s1kdDocGetMetadata(xmlDocPtr doc, const xmlChar *name)
+xmlChar *s1kdCtxDocGetMetadata(const s1kdContext *s1kdctx, xmlDocPtr doc, const xmlChar *name)
 {
 	int i;
 	xmlChar *value = NULL;
@@ -2919,13 +3212,15 @@ xmlChar *s1kdDocGetMetadata(xmlDocPtr doc, const xmlChar *name)
 	opts.conds = NULL;
 	opts.endl = '\n';
 	opts.execstr = NULL;
+	opts.extract = NULL;
 	opts.fmtstr = NULL;
 	opts.format_all = 1;
 	opts.keys = NULL;
 	opts.metadata_fname = NULL;
 	opts.only_editable = 0;
 	opts.overwrite = 0;
-	opts.timefmt = strdup(DEFAULT_TIMEFMT);
+	opts.status_only = 0;
+	opts.timefmt = strdup(s1kdctx && s1kdctx->date_format ? s1kdctx->date_format : DEFAULT_TIMEFMT);
 	opts.verbosity = NORMAL;
 
 	for (i = 0; metadata[i].key && !value; ++i) {
@@ -2954,19 +3249,29 @@ xmlChar *s1kdDocGetMetadata(xmlDocPtr doc, const xmlChar *name)
 	return value;
 }
 
-char *s1kdGetMetadata(const char *object_xml, int object_size, const char *name)
+xmlChar *s1kdDocGetMetadata(xmlDocPtr doc, const xmlChar *name)
+{
+	return s1kdCtxDocGetMetadata(NULL, doc, name);
+}
+
+char *s1kdCtxGetMetadata(const s1kdContext *ctx, const char *object_xml, int object_size, const char *name)
 {
 	xmlDocPtr doc;
 	char *val;
 
-	doc = read_xml_mem(object_xml, object_size);
-	val = (char *) s1kdDocGetMetadata(doc, BAD_CAST name);
+	doc = read_xml_mem_ctx(ctx, object_xml, object_size);
+	val = (char *) s1kdCtxDocGetMetadata(ctx, doc, BAD_CAST name);
 	xmlFreeDoc(doc);
 
 	return val;
 }
 
-int s1kdDocSetMetadata(xmlDocPtr doc, const xmlChar *name, const xmlChar *value)
+char *s1kdGetMetadata(const char *object_xml, int object_size, const char *name)
+{
+	return s1kdCtxGetMetadata(NULL, object_xml, object_size, name);
+}
+
+int s1kdCtxDocSetMetadata(const s1kdContext *s1kdctx, xmlDocPtr doc, const xmlChar *name, const xmlChar *value)
 {
 	xmlXPathContextPtr ctx;
 	int err;
@@ -2976,13 +3281,18 @@ int s1kdDocSetMetadata(xmlDocPtr doc, const xmlChar *name, const xmlChar *value)
 	return err;
 }
 
-int s1kdSetMetadata(const char *object_xml, int object_size, const char *name, const char *value, char **result_xml, int *result_size)
+int s1kdDocSetMetadata(xmlDocPtr doc, const xmlChar *name, const xmlChar *value)
+{
+	return s1kdCtxDocSetMetadata(NULL, doc, name, value);
+}
+
+int s1kdCtxSetMetadata(const s1kdContext *ctx, const char *object_xml, int object_size, const char *name, const char *value, char **result_xml, int *result_size)
 {
 	xmlDocPtr doc;
 	int err;
 
-	doc = read_xml_mem(object_xml, object_size);
-	err = s1kdDocSetMetadata(doc, BAD_CAST name, BAD_CAST value);
+	doc = read_xml_mem_ctx(ctx, object_xml, object_size);
+	err = s1kdCtxDocSetMetadata(ctx, doc, BAD_CAST name, BAD_CAST value);
 
 	if (result_xml && result_size) {
 		xmlDocDumpMemory(doc, (xmlChar **) result_xml, result_size);
@@ -2992,6 +3302,11 @@ int s1kdSetMetadata(const char *object_xml, int object_size, const char *name, c
 
 	return err;
 }
+
+int s1kdSetMetadata(const char *object_xml, int object_size, const char *name, const char *value, char **result_xml, int *result_size)
+{
+	return s1kdCtxSetMetadata(NULL, object_xml, object_size, name, value, result_xml, result_size);
+}
 #else
 static void show_help(void)
 {
@@ -3010,6 +3325,7 @@ static void show_help(void)
 	puts("  -m, --matches <regex>    Use a pattern instead of a literal value (-v) with -w/-W.");
 	puts("  -n, --name <name>        Specific metadata name to view/edit.");
 	puts("  -q, --quiet              Quiet mode, do not show non-fatal errors.");
+	puts("  -s, --status-only        Only read the identification and status section.");
 	puts("  -T, --raw                Do not format columns in output.");
 	puts("  -t, --tab                Use tab-delimited fields.");
 	puts("  -v, --value <value>      The value to set or match.");
@@ -3036,7 +3352,7 @@ int main(int argc, char **argv)
 	int islist = 0;
 	struct opts opts;
 
-	const char *sopts = "0d:c:Ee:F:fHlm:n:Ttv:qW:w:h?";
+	const char *sopts = "0d:c:Ee:F:fHlm:n:sTtv:qW:w:h?";
 	struct option lopts[] = {
 		{"version"    , no_argument      , 0, 0},
 		{"help"       , no_argument      , 0, 'h'},
@@ -3051,6 +3367,7 @@ int main(int argc, char **argv)
 		{"list"       , no_argument      , 0, 'l'},
 		{"matches"    , required_argument, 0, 'm'},
 		{"name"       , required_argument, 0, 'n'},
+		{"status-only", no_argument      , 0, 's'},
 		{"raw"        , no_argument      , 0, 'T'},
 		{"tab"        , no_argument      , 0, 't'},
 		{"value"      , required_argument, 0, 'v'},
@@ -3066,12 +3383,14 @@ int main(int argc, char **argv)
 	opts.conds = xmlNewNode(NULL, BAD_CAST "conds");
 	opts.endl = '\n';
 	opts.execstr = NULL;
+	opts.extract = NULL;
 	opts.fmtstr = NULL;
 	opts.format_all = 1;
 	opts.keys = xmlNewNode(NULL, BAD_CAST "keys");
 	opts.metadata_fname = NULL;
 	opts.only_editable = 0;
 	opts.overwrite = 0;
+	opts.status_only = 0;
 	opts.timefmt = strdup(DEFAULT_TIMEFMT);
 	opts.verbosity = NORMAL;
 
@@ -3099,6 +3418,7 @@ int main(int argc, char **argv)
 				  }
 				  break;
 			case 'n': add_key(opts.keys, optarg); last = opts.keys; break;
+			case 's': opts.status_only = 1; break;
 			case 'T': opts.format_all = 0; break;
 			case 't': opts.endl = '\t'; break;
 			case 'v':
@@ -3115,6 +3435,11 @@ int main(int argc, char **argv)
 		}
 	}
 
+	/* Find all metadata in one walk of each object when only showing it. */
+	if (!list_keys && !opts.metadata_fname && !has_values(opts.keys)) {
+		opts.extract = new_extraction(&opts);
+	}
+
 	if (list_keys) {
 		list_metadata_keys(&opts);
 	} else if (optind < argc) {
@@ -3132,12 +3457,14 @@ int main(int argc, char **argv)
 	}
 
 cleanup:
+	free_extraction(opts.extract);
 	free(opts.metadata_fname);
 	free(opts.fmtstr);
 	free(opts.execstr);
 	free(opts.timefmt);
 	xmlFreeNode(opts.keys);
 	xmlFreeNode(opts.conds);
+	free_pattern_cache();
 
 	xmlCleanupParser();
 
@@ -0,0 +1,6815 @@
+unsigned char dmtypes_xml[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x64,
+  0x6d, 0x74, 0x79, 0x70, 0x65, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x30, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x6c, 0x61, 0x6e, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x30, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x69,
+  0x74, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x32, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x70,
+  0x61, 0x67, 0x65, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x33, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x72, 0x65,
+  0x63, 0x6f, 0x72, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x68, 0x69, 0x67, 0x68,
+  0x6c, 0x69, 0x67, 0x68, 0x74, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x69, 0x6c, 0x6c, 0x75,
+  0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x35, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61,
+  0x62, 0x62, 0x72, 0x65, 0x76, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30,
+  0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x37, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73,
+  0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x54, 0x65, 0x63, 0x68, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73,
+  0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x72, 0x65, 0x63, 0x6f,
+  0x72, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x30, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+  0x74, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x31, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x65, 0x6e,
+  0x65, 0x72, 0x61, 0x6c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x31, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x31,
+  0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x65, 0x6e, 0x65, 0x72,
+  0x61, 0x6c, 0x20, 0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x63, 0x61, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x73, 0x61, 0x66, 0x65, 0x74, 0x79, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x31,
+  0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x75, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x31, 0x34, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 0x69,
+  0x63, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x6e,
+  0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x31,
+  0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x6d,
+  0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x31, 0x36, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x64,
+  0x61, 0x6e, 0x67, 0x65, 0x72, 0x6f, 0x75, 0x73, 0x20, 0x6d, 0x61, 0x74,
+  0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x30, 0x31, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x65, 0x6c,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x31, 0x38, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x49, 0x6e, 0x74, 0x72, 0x6f, 0x64, 0x75, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x31, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53,
+  0x75, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x32,
+  0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x66, 0x69,
+  0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x32, 0x31, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x32,
+  0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x62,
+  0x72, 0x65, 0x78, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x42, 0x75, 0x73, 0x69, 0x6e, 0x65, 0x73, 0x73, 0x20,
+  0x72, 0x75, 0x6c, 0x65, 0x73, 0x20, 0x65, 0x78, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x32, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x64, 0x6d,
+  0x69, 0x6e, 0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x32, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x62, 0x72, 0x64, 0x6f, 0x63, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x75, 0x73, 0x69, 0x6e, 0x65,
+  0x73, 0x73, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x32, 0x35, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x70, 0x6f, 0x6c, 0x69, 0x63, 0x79,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x32,
+  0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x67, 0x75, 0x6c,
+  0x61, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x70, 0x6f, 0x6c, 0x69, 0x63, 0x79,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x30,
+  0x32, 0x37, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x32, 0x38, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x32, 0x39, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x44, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+  0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x30, 0x33, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x54, 0x65, 0x63, 0x68, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x33, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x6c,
+  0x65, 0x63, 0x74, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x61,
+  0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21,
+  0x2d, 0x2d, 0x20, 0x30, 0x33, 0x32, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61,
+  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x33, 0x33,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x65, 0x63, 0x68, 0x6e, 0x69,
+  0x63, 0x61, 0x6c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x28, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x62, 0x72, 0x65,
+  0x61, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x33, 0x34, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x54, 0x65, 0x63, 0x68, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x28, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63,
+  0x61, 0x6c, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x64, 0x6f, 0x77, 0x6e,
+  0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
+  0x30, 0x33, 0x35, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x30, 0x33, 0x39,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+  0x63, 0x74, 0x73, 0x20, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x30, 0x34, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x34, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x68, 0x6f, 0x77,
+  0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x34, 0x32,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x75, 0x6e,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x30, 0x34, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x63, 0x72, 0x65, 0x77, 0x20, 0x28, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b,
+  0x64, 0x6f, 0x77, 0x6e, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x30, 0x34, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x28, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x62, 0x72,
+  0x65, 0x61, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x29, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x34, 0x35, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x44, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x65,
+  0x64, 0x20, 0x75, 0x73, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x30, 0x34, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x6f,
+  0x6e, 0x20, 0x70, 0x65, 0x72, 0x69, 0x70, 0x68, 0x65, 0x72, 0x61, 0x6c,
+  0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2f, 0x65, 0x71, 0x75,
+  0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x30, 0x34, 0x37, 0x20, 0x74, 0x68, 0x72,
+  0x75, 0x20, 0x30, 0x34, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x20, 0x2d, 0x2d,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x35, 0x30, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d,
+  0x2f, 0x4c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x30, 0x35, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x57, 0x69, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x61, 0x67, 0x72,
+  0x61, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x35, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x6f, 0x75,
+  0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x35,
+  0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x6e, 0x65,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x35, 0x34, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x74,
+  0x69, 0x63, 0x20, 0x64, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x35, 0x35, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x64, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x35, 0x36, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x45, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x30, 0x35, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x57, 0x69, 0x72, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x35, 0x38, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x61, 0x72, 0x6e, 0x65, 0x73, 0x73,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x30, 0x35, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20,
+  0x65, 0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x20, 0x64, 0x69, 0x61,
+  0x67, 0x72, 0x61, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x36, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50,
+  0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74,
+  0x2c, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x36, 0x31, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f,
+  0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x36, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74, 0x61,
+  0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+  0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x36, 0x33, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x47, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20,
+  0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69,
+  0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f,
+  0x6f, 0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x36, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x6f,
+  0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f,
+  0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x36, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x6f, 0x66,
+  0x74, 0x77, 0x61, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x30, 0x36, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x53, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69,
+  0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f,
+  0x6f, 0x6c, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x36, 0x37, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x44, 0x65, 0x63, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x30, 0x36, 0x38, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x30, 0x36, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x20,
+  0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x37,
+  0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x73, 0x75,
+  0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x78,
+  0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x37, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62,
+  0x6c, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x37, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x61,
+  0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x37, 0x33, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x45, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30,
+  0x37, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x61, 0x74, 0x61,
+  0x20, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64,
+  0x61, 0x6e, 0x67, 0x65, 0x72, 0x6f, 0x75, 0x73, 0x20, 0x63, 0x6f, 0x6e,
+  0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x37, 0x35, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c,
+  0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x37, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x6c,
+  0x75, 0x69, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x37, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x61,
+  0x74, 0x61, 0x20, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61,
+  0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x37, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x73,
+  0x74, 0x65, 0x6e, 0x65, 0x72, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x30, 0x37, 0x39, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30,
+  0x38, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69, 0x78, 0x74,
+  0x75, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x6f, 0x6c, 0x75,
+  0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x38, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x68, 0x65, 0x6d, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x6f, 0x6c, 0x75,
+  0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x38, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x68, 0x65, 0x6d, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x69, 0x78, 0x74,
+  0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x30, 0x38, 0x33, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x30,
+  0x38, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x39, 0x30, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x30,
+  0x39, 0x31, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x30, 0x39, 0x35, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
+  0x74, 0x73, 0x20, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x39, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53,
+  0x61, 0x66, 0x65, 0x74, 0x79, 0x20, 0x63, 0x72, 0x69, 0x74, 0x69, 0x63,
+  0x61, 0x6c, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x30, 0x39, 0x37, 0x20, 0x74, 0x68, 0x72,
+  0x75, 0x20, 0x30, 0x39, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x20, 0x2d, 0x2d,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x41, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x69, 0x6c, 0x6c, 0x75, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x30, 0x42, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x43, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x73, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x44, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x73, 0x70, 0x61, 0x72, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x45, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x69, 0x74,
+  0x65, 0x6d, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x20, 0x63,
+  0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x6f, 0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x30, 0x46, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x69, 0x72,
+  0x63, 0x75, 0x69, 0x74, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x65, 0x72,
+  0x73, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x47, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x48,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x63, 0x6f,
+  0x6d, 0x72, 0x65, 0x70, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x5a, 0x6f, 0x6e, 0x65, 0x73, 0x20, 0x63, 0x6f,
+  0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74,
+  0x6f, 0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x30, 0x4a, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x63, 0x63, 0x65,
+  0x73, 0x73, 0x20, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x64, 0x6f, 0x6f, 0x72, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x6d,
+  0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72,
+  0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30,
+  0x30, 0x4b, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x72, 0x67, 0x61, 0x6e, 0x69,
+  0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x6d,
+  0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72,
+  0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30,
+  0x30, 0x4c, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x75, 0x70, 0x70, 0x6c, 0x69,
+  0x65, 0x73, 0x20, 0x2d, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x73, 0x20, 0x63, 0x6f,
+  0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74,
+  0x6f, 0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x30, 0x4d, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x75, 0x70, 0x70,
+  0x6c, 0x69, 0x65, 0x73, 0x20, 0x2d, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72,
+  0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x4e, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x72,
+  0x65, 0x70, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x53, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x6d,
+  0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72,
+  0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30,
+  0x30, 0x50, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x64, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x72, 0x65, 0x66, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x20,
+  0x43, 0x72, 0x6f, 0x73, 0x73, 0x2d, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65,
+  0x6e, 0x63, 0x65, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x28, 0x50,
+  0x43, 0x54, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x30, 0x51, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x64, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x72,
+  0x65, 0x66, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x64, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x43, 0x72, 0x6f, 0x73, 0x73, 0x2d,
+  0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x54, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x28, 0x43, 0x43, 0x54, 0x29, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x52, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x70, 0x61,
+  0x67, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x30, 0x53, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74,
+  0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6d, 0x6f, 0x64,
+  0x75, 0x6c, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x30, 0x54, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30,
+  0x55, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x69, 0x67, 0x68, 0x6c,
+  0x69, 0x67, 0x68, 0x74, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x30, 0x30, 0x56, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x70, 0x70, 0x6c,
+  0x69, 0x63, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69,
+  0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x30, 0x30, 0x57, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x63, 0x72, 0x6f, 0x73,
+  0x73, 0x72, 0x65, 0x66, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x70, 0x70,
+  0x6c, 0x69, 0x63, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x43,
+  0x72, 0x6f, 0x73, 0x73, 0x2d, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e,
+  0x63, 0x65, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x28, 0x41, 0x43,
+  0x54, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x30, 0x30, 0x58, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x72,
+  0x6f, 0x6c, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x69,
+  0x63, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+  0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30,
+  0x59, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x30, 0x5a, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x61,
+  0x62, 0x6c, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x41, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x75, 0x6e,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x2f,
+  0x6f, 0x72, 0x20, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x20,
+  0x61, 0x72, 0x65, 0x61, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x6f, 0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x41, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x70, 0x70,
+  0x6c, 0x69, 0x63, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x72,
+  0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x41, 0x33, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x61, 0x70, 0x70, 0x6c,
+  0x69, 0x63, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x72, 0x65, 0x66, 0x74, 0x61,
+  0x62, 0x6c, 0x65, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x62, 0x69,
+  0x6c, 0x69, 0x74, 0x79, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x2d, 0x72,
+  0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x63, 0x61, 0x74, 0x61, 0x6c, 0x6f, 0x67, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x41, 0x34, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x63, 0x6f, 0x6d,
+  0x72, 0x65, 0x70, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x57, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x73, 0x20,
+  0x2d, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x61,
+  0x72, 0x6e, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x41, 0x35, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x43, 0x61, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x2d, 0x20, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x61, 0x75, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x6f, 0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21,
+  0x2d, 0x2d, 0x20, 0x30, 0x41, 0x36, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20,
+  0x30, 0x41, 0x5a, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x20, 0x2d, 0x2d, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x42, 0x30, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e,
+  0x63, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x30, 0x42, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x69, 0x6d, 0x65, 0x20, 0x6c,
+  0x69, 0x6d, 0x69, 0x74, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x30, 0x42, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74,
+  0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x2f, 0x69, 0x6e, 0x73, 0x70, 0x65,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61, 0x73, 0x6b, 0x73, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x42, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6d, 0x61, 0x69,
+  0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x2f, 0x69, 0x6e, 0x73,
+  0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61, 0x73, 0x6b,
+  0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x30, 0x42, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x5a, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74,
+  0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x2f, 0x69, 0x6e, 0x73, 0x70, 0x65,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61, 0x73, 0x6b, 0x73, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x30, 0x42, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x55,
+  0x6e, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6c, 0x65, 0x64, 0x20, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21,
+  0x2d, 0x2d, 0x20, 0x30, 0x42, 0x36, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20,
+  0x30, 0x42, 0x5a, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31,
+  0x30, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c,
+  0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x31, 0x30, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64,
+  0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x70,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x34, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70,
+  0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+  0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73,
+  0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x35,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x70,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x36, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f,
+  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f,
+  0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x37, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x31, 0x30, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x31,
+  0x30, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x31, 0x31, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x31,
+  0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x72,
+  0x6f, 0x6c, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x69,
+  0x63, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x31, 0x31, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x70,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x31, 0x31, 0x33, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x31, 0x31, 0x34, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x31, 0x35,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x69, 0x73, 0x70, 0x6c, 0x61,
+  0x79, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
+  0x31, 0x31, 0x36, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x31, 0x31, 0x39,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+  0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x31, 0x32, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x65,
+  0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x32, 0x31, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x50, 0x72, 0x65, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x31, 0x32, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x69, 0x74, 0x69, 0x6e,
+  0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31,
+  0x32, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x68, 0x65, 0x6c, 0x74, 0x65,
+  0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
+  0x31, 0x32, 0x34, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x32, 0x35, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c,
+  0x69, 0x73, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x50, 0x72, 0x65, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31,
+  0x32, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x64,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x65,
+  0x61, 0x64, 0x69, 0x6e, 0x65, 0x73, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x32, 0x37, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x45, 0x73, 0x74, 0x61, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x6f, 0x70,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21,
+  0x2d, 0x2d, 0x20, 0x31, 0x32, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20,
+  0x31, 0x32, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x33, 0x30, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x31, 0x33, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x6f, 0x72,
+  0x6d, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x33, 0x32,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74, 0x61, 0x72, 0x74, 0x2d, 0x75, 0x70,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e,
+  0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x31, 0x33, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x68, 0x75, 0x74, 0x64,
+  0x6f, 0x77, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65,
+  0x6e, 0x61, 0x6e, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x31, 0x33, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x41, 0x76, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x33, 0x35, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c,
+  0x69, 0x73, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x6f, 0x70,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x31, 0x33, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x47, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69,
+  0x6e, 0x67, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x31, 0x33, 0x37, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x31, 0x33, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20,
+  0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65, 0x20,
+  0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x33, 0x39, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x2c, 0x20,
+  0x62, 0x69, 0x6f, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x63, 0x68, 0x65, 0x6d, 0x69, 0x63, 0x61, 0x6c, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x34, 0x30, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x45, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x34, 0x31, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x45, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x34, 0x32, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75,
+  0x6e, 0x64, 0x65, 0x72, 0x20, 0x75, 0x6e, 0x75, 0x73, 0x75, 0x61, 0x6c,
+  0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x34, 0x33,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x52, 0x61, 0x64, 0x69, 0x6f, 0x20, 0x69, 0x6e,
+  0x74, 0x65, 0x72, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x34, 0x34, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x61, 0x6d, 0x6d, 0x69, 0x6e, 0x67,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x6f,
+  0x6e, 0x69, 0x63, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x6d,
+  0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x73, 0x20, 0x28, 0x45, 0x43, 0x4d,
+  0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31,
+  0x34, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x6d, 0x65,
+  0x72, 0x67, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31,
+  0x34, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x6d, 0x65, 0x72, 0x67, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x73, 0x68, 0x75, 0x74, 0x64, 0x6f, 0x77, 0x6e,
+  0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x31, 0x34, 0x37, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x31, 0x34, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x35, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x50, 0x6f, 0x73, 0x74, 0x2d, 0x6f, 0x70, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x31, 0x35, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50,
+  0x6f, 0x73, 0x74, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x31, 0x35,
+  0x32, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x31, 0x35, 0x34, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x31, 0x35, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x6f,
+  0x73, 0x74, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x31, 0x35, 0x36, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
+  0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x31, 0x35, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x73, 0x74, 0x61,
+  0x62, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65,
+  0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
+  0x20, 0x31, 0x35, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x31, 0x35,
+  0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x31, 0x36, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x6f,
+  0x61, 0x64, 0x69, 0x6e, 0x67, 0x2f, 0x55, 0x6e, 0x6c, 0x6f, 0x61, 0x64,
+  0x69, 0x6e, 0x67, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31,
+  0x36, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61,
+  0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x36, 0x32,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x6f, 0x6e, 0x2d, 0x74, 0x61, 0x63, 0x74,
+  0x69, 0x63, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
+  0x20, 0x31, 0x36, 0x33, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x31, 0x36,
+  0x38, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x31, 0x36, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x61,
+  0x73, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x42, 0x61, 0x6c, 0x61, 0x6e,
+  0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x31, 0x37, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x61, 0x6e, 0x64, 0x6c,
+  0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x31, 0x37, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x66, 0x74,
+  0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x31, 0x37, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x61, 0x63, 0x6b,
+  0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x31, 0x37, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x68, 0x6f, 0x72,
+  0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x31, 0x37, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x6f, 0x77, 0x69,
+  0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x31, 0x37, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x61, 0x78, 0x69, 0x69,
+  0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x31, 0x37, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x6f, 0x77, 0x65, 0x72,
+  0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x31, 0x37, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74, 0x61, 0x62,
+  0x69, 0x6c, 0x69, 0x7a, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x37, 0x38, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x54, 0x65, 0x74, 0x68, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x37, 0x39, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x44, 0x65, 0x62, 0x6f, 0x67, 0x67, 0x69, 0x6e, 0x67, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x38, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68,
+  0x20, 0x64, 0x65, 0x76, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x31, 0x38, 0x31, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x44, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74,
+  0x63, 0x68, 0x20, 0x64, 0x65, 0x76, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x31,
+  0x38, 0x32, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x31, 0x39, 0x39, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
+  0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x30, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x65, 0x72, 0x76,
+  0x69, 0x63, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+  0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f,
+  0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73,
+  0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x33,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65,
+  0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63,
+  0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x30, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61,
+  0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65,
+  0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x35, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75,
+  0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c,
+  0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63,
+  0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x30, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61,
+  0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65,
+  0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69,
+  0x63, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x30, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50,
+  0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x73,
+  0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x32, 0x30,
+  0x38, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x32, 0x30, 0x39, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x32, 0x31, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6c, 0x6c, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x31, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x66, 0x75, 0x65, 0x6c, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x31, 0x32, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x46, 0x69, 0x6c, 0x6c, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x6f, 0x69, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x31, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6c,
+  0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x78, 0x79, 0x67, 0x65,
+  0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32,
+  0x31, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6c, 0x6c, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x6e, 0x69, 0x74, 0x72, 0x6f, 0x67, 0x65, 0x6e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x31,
+  0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6c, 0x6c, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x61, 0x69, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x32, 0x31, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46,
+  0x69, 0x6c, 0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x77, 0x61, 0x74,
+  0x65, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x32, 0x31, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6c, 0x6c, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x68, 0x79, 0x64, 0x72, 0x6f, 0x67, 0x65,
+  0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32,
+  0x31, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6c, 0x6c, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6c, 0x69,
+  0x71, 0x75, 0x69, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x31, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6c,
+  0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x67, 0x61, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x32, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x72, 0x61,
+  0x69, 0x6e, 0x20, 0x6c, 0x69, 0x71, 0x75, 0x69, 0x64, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x70, 0x72,
+  0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x32, 0x32, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44,
+  0x65, 0x66, 0x75, 0x65, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x72,
+  0x61, 0x69, 0x6e, 0x20, 0x66, 0x75, 0x65, 0x6c, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x32, 0x32, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x44, 0x72, 0x61, 0x69, 0x6e, 0x20, 0x6f, 0x69, 0x6c, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x32, 0x33, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x6f,
+  0x78, 0x79, 0x67, 0x65, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75,
+  0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x32, 0x32, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x6c, 0x65, 0x61,
+  0x73, 0x65, 0x20, 0x6e, 0x69, 0x74, 0x72, 0x6f, 0x67, 0x65, 0x6e, 0x20,
+  0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x32, 0x35, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x61, 0x69, 0x72,
+  0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x32, 0x36, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x44, 0x72, 0x61, 0x69, 0x6e, 0x20, 0x77, 0x61, 0x74, 0x65,
+  0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32,
+  0x32, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73,
+  0x65, 0x20, 0x68, 0x79, 0x64, 0x72, 0x6f, 0x67, 0x65, 0x6e, 0x20, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x32, 0x38, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x44, 0x72, 0x61, 0x69, 0x6e, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20,
+  0x6c, 0x69, 0x71, 0x75, 0x69, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x32, 0x32, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52,
+  0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x67, 0x61, 0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32,
+  0x33, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x6c, 0x65, 0x65, 0x64, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x33, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x42, 0x6c, 0x65, 0x65, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x33, 0x32, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x50, 0x72, 0x69, 0x6d, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x32, 0x33, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x72,
+  0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32,
+  0x33, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x63, 0x69, 0x6c, 0x69,
+  0x74, 0x79, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65, 0x72, 0x76,
+  0x69, 0x63, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x32, 0x33, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x6c,
+  0x75, 0x73, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x33, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6c, 0x6c,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x65, 0x72, 0x74, 0x20,
+  0x68, 0x61, 0x73, 0x2f, 0x69, 0x6e, 0x65, 0x72, 0x74, 0x20, 0x6c, 0x69,
+  0x71, 0x75, 0x69, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x33, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x76, 0x61,
+  0x63, 0x75, 0x61, 0x74, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x21, 0x2d, 0x2d, 0x20, 0x32, 0x33, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75,
+  0x20, 0x32, 0x33, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61,
+  0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70,
+  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x34, 0x30, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4c, 0x75, 0x62, 0x72, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x34,
+  0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x69, 0x6c, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x34, 0x32, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x47, 0x72, 0x65, 0x61, 0x73, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x34, 0x33, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x44, 0x72, 0x79, 0x20, 0x66, 0x69, 0x6c, 0x6d, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x32, 0x34, 0x34, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x32, 0x34, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x35, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x73, 0x75, 0x72, 0x66,
+  0x61, 0x63, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x32, 0x35, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6c, 0x65, 0x61, 0x6e,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x68, 0x65, 0x6d, 0x69, 0x63,
+  0x61, 0x6c, 0x20, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x35, 0x32, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x61, 0x62,
+  0x72, 0x61, 0x73, 0x69, 0x76, 0x65, 0x20, 0x62, 0x6c, 0x61, 0x73, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x35,
+  0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x62,
+  0x79, 0x20, 0x75, 0x6c, 0x74, 0x72, 0x61, 0x73, 0x6f, 0x6e, 0x69, 0x63,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32,
+  0x35, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x20,
+  0x6d, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x35,
+  0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x75, 0x72, 0x67, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x35, 0x36, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x77, 0x61, 0x78, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x35, 0x37,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x6d, 0x61, 0x72, 0x6b,
+  0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x35, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x74, 0x68, 0x65,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x35, 0x39, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x74,
+  0x65, 0x63, 0x74, 0x20, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x36, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x69,
+  0x63, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x36, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x69, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x32, 0x36, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50,
+  0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x63, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x36, 0x33, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x55, 0x73, 0x65, 0x20, 0x64, 0x69, 0x73, 0x69, 0x6e,
+  0x66, 0x65, 0x63, 0x74, 0x61, 0x6e, 0x74, 0x2f, 0x53, 0x61, 0x6e, 0x69,
+  0x74, 0x69, 0x7a, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x36, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x6d,
+  0x6f, 0x76, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x6d, 0x69, 0x6e,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x21, 0x2d, 0x2d, 0x20, 0x32, 0x36, 0x35, 0x20, 0x74, 0x68, 0x72, 0x75,
+  0x20, 0x32, 0x36, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61,
+  0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70,
+  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x37, 0x30, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x41, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x2c, 0x20, 0x61, 0x6c, 0x69,
+  0x67, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x61, 0x6c, 0x69, 0x62,
+  0x72, 0x61, 0x74, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x37, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x64, 0x6a,
+  0x75, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x37, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x6c, 0x69, 0x67,
+  0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32,
+  0x37, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x61, 0x6c, 0x69, 0x62, 0x72,
+  0x61, 0x74, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x37, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x61, 0x72, 0x6d,
+  0x6f, 0x6e, 0x69, 0x7a, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x32, 0x37, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x72,
+  0x6f, 0x6f, 0x6d, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x32, 0x37, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52,
+  0x69, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x32, 0x37, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6d, 0x70, 0x65,
+  0x6e, 0x73, 0x61, 0x74, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x32, 0x37, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x61,
+  0x73, 0x69, 0x6c, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x71, 0x75, 0x69,
+  0x63, 0x6b, 0x6c, 0x79, 0x20, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x20,
+  0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x62, 0x61, 0x74, 0x74,
+  0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65,
+  0x70, 0x61, 0x69, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x37, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x61, 0x73,
+  0x69, 0x6c, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x71, 0x75, 0x69, 0x63,
+  0x6b, 0x79, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x20, 0x61, 0x66, 0x74,
+  0x65, 0x72, 0x20, 0x61, 0x20, 0x62, 0x61, 0x74, 0x74, 0x6c, 0x65, 0x20,
+  0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69,
+  0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32,
+  0x38, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49, 0x6e, 0x73, 0x70, 0x65, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x38, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x63, 0x68,
+  0x65, 0x64, 0x75, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x73, 0x70, 0x65,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x32, 0x38, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x55, 0x6e,
+  0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x38, 0x33, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x67,
+  0x75, 0x6c, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x38, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x70, 0x65, 0x63,
+  0x69, 0x61, 0x6c, 0x20, 0x69, 0x72, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61,
+  0x72, 0x20, 0x69, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x38,
+  0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+  0x72, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x6c,
+  0x69, 0x6d, 0x69, 0x74, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x32, 0x38, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74,
+  0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x70,
+  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72,
+  0x65, 0x70, 0x61, 0x69, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x21, 0x2d, 0x2d, 0x20, 0x32, 0x38, 0x37, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x38, 0x38,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x76, 0x65, 0x72, 0x68, 0x61,
+  0x75, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x69, 0x72,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75,
+  0x6c, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x32, 0x38, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6b,
+  0x20, 0x66, 0x69, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x71, 0x75, 0x61,
+  0x6e, 0x74, 0x69, 0x74, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x32, 0x39, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x69, 0x71, 0x75,
+  0x69, 0x64, 0x2f, 0x68, 0x61, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x32, 0x39, 0x31, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x39,
+  0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x6f, 0x69, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x32, 0x39, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x78, 0x79,
+  0x67, 0x65, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x39, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x69, 0x74, 0x72, 0x6f, 0x67,
+  0x65, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x32, 0x39, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x69, 0x72, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x32, 0x39, 0x36, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x77,
+  0x61, 0x74, 0x65, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x32, 0x39, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x68, 0x79, 0x64, 0x72, 0x6f,
+  0x67, 0x65, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x32, 0x39, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20,
+  0x6c, 0x69, 0x71, 0x75, 0x69, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x32, 0x39, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x20, 0x67, 0x61, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x33, 0x30, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x45, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x30, 0x31, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73,
+  0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x30, 0x32, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61,
+  0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f,
+  0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x33, 0x30, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70,
+  0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x30, 0x34, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70,
+  0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+  0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73,
+  0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x30, 0x35, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f,
+  0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65,
+  0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x74, 0x65, 0x73,
+  0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33,
+  0x30, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x30, 0x37,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x78, 0x61,
+  0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x74,
+  0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x33, 0x30, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x33,
+  0x30, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x33, 0x31, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x56,
+  0x69, 0x73, 0x75, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x33, 0x31, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x56, 0x69,
+  0x73, 0x75, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74,
+  0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x65, 0x71, 0x75,
+  0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x33, 0x31, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45,
+  0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x62, 0x6f, 0x72, 0x65, 0x73, 0x63,
+  0x6f, 0x70, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x33, 0x31, 0x33, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x33,
+  0x31, 0x34, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x33, 0x31, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x51, 0x41, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21,
+  0x2d, 0x2d, 0x20, 0x33, 0x31, 0x36, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20,
+  0x33, 0x31, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x32, 0x30, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x33, 0x32, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x55, 0x6e, 0x69, 0x74, 0x20,
+  0x62, 0x72, 0x65, 0x61, 0x6b, 0x2d, 0x69, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x32, 0x32, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x54, 0x65, 0x73, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e,
+  0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x33, 0x32, 0x33, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x33, 0x32, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x33, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x54, 0x65, 0x73, 0x74, 0x20, 0x70, 0x72, 0x65,
+  0x70, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x33, 0x31, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69,
+  0x70, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x33, 0x33, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65,
+  0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x65, 0x73,
+  0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x33, 0x33,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x75, 0x6e, 0x69, 0x74, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x33, 0x34, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x20, 0x61, 0x66, 0x74,
+  0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x33, 0x35,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x6d, 0x65,
+  0x61, 0x73, 0x75, 0x72, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x33, 0x33, 0x36, 0x20, 0x74, 0x68, 0x72,
+  0x75, 0x20, 0x33, 0x33, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x34, 0x30, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74,
+  0x65, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x33, 0x34, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x61, 0x6e, 0x75,
+  0x61, 0x6c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x34, 0x32, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x41, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x33, 0x34, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x49, 0x54, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x34, 0x34, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x61, 0x62, 0x69,
+  0x6c, 0x69, 0x74, 0x79, 0x20, 0x74, 0x65, 0x73, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x34, 0x35, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x74, 0x65, 0x73,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33,
+  0x34, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x33, 0x34, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74,
+  0x61, 0x72, 0x74, 0x2d, 0x75, 0x70, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x65, 0x73,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33,
+  0x34, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x69, 0x6e, 0x61, 0x6c, 0x20,
+  0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x74,
+  0x65, 0x73, 0x74, 0x20, 0x28, 0x46, 0x41, 0x54, 0x29, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x34, 0x39, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x54, 0x65, 0x73, 0x74, 0x20, 0x72, 0x65, 0x63,
+  0x6f, 0x72, 0x64, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x33, 0x35, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74, 0x72,
+  0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x35, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x54, 0x65, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x72, 0x61,
+  0x63, 0x6b, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x79, 0x65,
+  0x20, 0x70, 0x65, 0x6e, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x35, 0x32, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x54, 0x65, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x72, 0x61, 0x63,
+  0x6b, 0x73, 0x20, 0x77, 0x74, 0x68, 0x20, 0x6d, 0x61, 0x67, 0x6e, 0x65,
+  0x74, 0x69, 0x63, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33,
+  0x35, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x65, 0x73, 0x74, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x63, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x65,
+  0x63, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x64, 0x64,
+  0x79, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x35, 0x34, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x54, 0x65, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63,
+  0x72, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x74,
+  0x68, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x58, 0x2d, 0x72, 0x61, 0x79, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x35, 0x35,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x54, 0x65, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x63, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x75, 0x6c, 0x74, 0x72, 0x61,
+  0x73, 0x6f, 0x6e, 0x69, 0x63, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x33, 0x35, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48,
+  0x61, 0x72, 0x64, 0x6e, 0x65, 0x73, 0x73, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x35,
+  0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x61, 0x6d, 0x6d, 0x61, 0x2d, 0x72,
+  0x61, 0x79, 0x20, 0x74, 0x65, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x35, 0x38, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x52, 0x65, 0x73, 0x6f, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x66, 0x72,
+  0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x35,
+  0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x74, 0x65, 0x73, 0x74, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x36, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x44, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x2f, 0x74, 0x6f, 0x6c, 0x65, 0x72, 0x61, 0x6e, 0x63,
+  0x65, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x36, 0x31, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x33, 0x36, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72,
+  0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x36,
+  0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x6c, 0x6f, 0x77, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x33, 0x36, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x65, 0x61, 0x6b,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x33, 0x36, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x69, 0x74, 0x79, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x33, 0x36, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x73, 0x69,
+  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x36,
+  0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69,
+  0x63, 0x61, 0x6c, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x33, 0x36, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x69, 0x67, 0x6e,
+  0x61, 0x6c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x33, 0x36, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x74,
+  0x68, 0x65, 0x72, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x37, 0x30, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x37, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x69, 0x6c, 0x20, 0x61, 0x6e, 0x61, 0x6c,
+  0x79, 0x73, 0x69, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x33, 0x37, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x56, 0x69, 0x62,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x79,
+  0x73, 0x69, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x33, 0x37, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x72, 0x61, 0x63,
+  0x6b, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x37, 0x34, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x46, 0x75, 0x65, 0x6c, 0x20, 0x61, 0x6e, 0x61, 0x6c,
+  0x79, 0x73, 0x69, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x33, 0x37, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x68, 0x6f,
+  0x6f, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x63, 0x63, 0x69, 0x64, 0x65,
+  0x6e, 0x74, 0x61, 0x6c, 0x20, 0x64, 0x69, 0x73, 0x63, 0x68, 0x61, 0x72,
+  0x67, 0x65, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x79, 0x73, 0x69, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x37, 0x36,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x70, 0x6f,
+  0x73, 0x74, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x64, 0x68, 0x65, 0x73, 0x69,
+  0x76, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x33, 0x37, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x61,
+  0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x61,
+  0x6c, 0x79, 0x73, 0x69, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x21, 0x2d, 0x2d, 0x20, 0x33, 0x37, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75,
+  0x20, 0x33, 0x38, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61,
+  0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70,
+  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x33, 0x39, 0x30, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x33,
+  0x39, 0x31, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x33, 0x39, 0x35, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
+  0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x33, 0x39, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x6c, 0x69, 0x67,
+  0x68, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x73,
+  0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x33, 0x39, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x61, 0x6e, 0x64,
+  0x69, 0x6e, 0x67, 0x20, 0x67, 0x65, 0x61, 0x72, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x33, 0x39, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72,
+  0x6f, 0x64, 0x75, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67,
+  0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x33, 0x39, 0x39, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73,
+  0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34,
+  0x30, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x72,
+  0x65, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69,
+  0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x30, 0x31, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73,
+  0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67,
+  0x6e, 0x6f, 0x73, 0x69, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x34, 0x30, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x69,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34,
+  0x30, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62,
+  0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x69, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x30, 0x34,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x75,
+  0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c,
+  0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20,
+  0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x69, 0x73, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x30, 0x35, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69,
+  0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f,
+  0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x69, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x30, 0x36,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x64, 0x69, 0x61,
+  0x67, 0x6e, 0x6f, 0x73, 0x69, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x34, 0x30, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x64, 0x69,
+  0x61, 0x67, 0x6e, 0x6f, 0x73, 0x69, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x34, 0x30, 0x38, 0x20, 0x74, 0x68,
+  0x72, 0x75, 0x20, 0x34, 0x30, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61,
+  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x31, 0x30, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x66, 0x61, 0x75,
+  0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x34, 0x31, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49, 0x73, 0x6f, 0x6c, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x31, 0x32, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x44, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x34, 0x31, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x62, 0x73, 0x65, 0x72,
+  0x76, 0x65, 0x64, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x31, 0x34, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x43, 0x6f, 0x72, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x34, 0x31, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49, 0x6d, 0x70,
+  0x61, 0x63, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x34,
+  0x31, 0x36, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x34, 0x31, 0x39, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
+  0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x34, 0x32, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x65, 0x6e, 0x65, 0x72,
+  0x61, 0x6c, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f,
+  0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x34, 0x32, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x75, 0x6c,
+  0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x32, 0x32, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x34, 0x32, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20,
+  0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x32, 0x34, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46,
+  0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x32,
+  0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x66,
+  0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73,
+  0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x34, 0x32, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x75,
+  0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x32, 0x37, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x66, 0x61, 0x75,
+  0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x34, 0x32, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x75, 0x6c, 0x74,
+  0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x32, 0x39, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x44, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x74, 0x69,
+  0x63, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x34, 0x33, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x75,
+  0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x74, 0x61, 0x73, 0x6b, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+  0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x34, 0x33, 0x31, 0x20,
+  0x74, 0x68, 0x72, 0x75, 0x20, 0x34, 0x33, 0x39, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x34,
+  0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49, 0x6e, 0x64, 0x65, 0x78,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x34,
+  0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x61, 0x75, 0x6c, 0x74,
+  0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x34, 0x32,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x61, 0x69, 0x6e, 0x74, 0x65,
+  0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
+  0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x34, 0x34, 0x33, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x50, 0x6f, 0x73, 0x74, 0x2d, 0x74, 0x72, 0x6f, 0x75, 0x62, 0x6c, 0x65,
+  0x73, 0x68, 0x6f, 0x6f, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x68, 0x75,
+  0x74, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x34, 0x34, 0x34, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x34,
+  0x34, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x34, 0x35, 0x30, 0x20, 0x74, 0x68, 0x72,
+  0x75, 0x20, 0x34, 0x39, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x30, 0x30, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x44, 0x69, 0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+  0x2c, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x64, 0x69, 0x73, 0x61, 0x73, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x79,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x30, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65,
+  0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61,
+  0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35,
+  0x30, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c,
+  0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61,
+  0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35,
+  0x30, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62,
+  0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f,
+  0x76, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x35, 0x30, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61,
+  0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65,
+  0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x35, 0x30, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70,
+  0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x30, 0x36,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x30, 0x37, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c,
+  0x69, 0x73, 0x74, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f,
+  0x76, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x35, 0x30, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x35,
+  0x30, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x35, 0x31, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44,
+  0x69, 0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x35, 0x31, 0x31, 0x20, 0x74, 0x68,
+  0x72, 0x75, 0x20, 0x35, 0x31, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61,
+  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x32, 0x30, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x32, 0x31, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x61,
+  0x73, 0x69, 0x63, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x35, 0x32, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65,
+  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x2f, 0x52,
+  0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x35, 0x32, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x65,
+  0x70, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x65, 0x66,
+  0x6f, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x32, 0x34,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x46, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x2d, 0x6f,
+  0x6e, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35,
+  0x32, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x6d, 0x6d, 0x75, 0x6e, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x69,
+  0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x35, 0x32, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x65, 0x61, 0x63, 0x74,
+  0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68,
+  0x69, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x35, 0x32, 0x37,
+  0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x35, 0x32, 0x39, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73,
+  0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35,
+  0x33, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x69, 0x73, 0x61, 0x73, 0x73,
+  0x65, 0x6d, 0x62, 0x6c, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x35, 0x33, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x69, 0x73, 0x61,
+  0x73, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x6f,
+  0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x69, 0x74,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
+  0x35, 0x33, 0x32, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x35, 0x33, 0x39,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+  0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x35, 0x34, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x70, 0x65,
+  0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x35, 0x34, 0x31,
+  0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x35, 0x34, 0x39, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73,
+  0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35,
+  0x35, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x55, 0x6e, 0x6c, 0x6f, 0x61, 0x64,
+  0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x35, 0x31, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x6d, 0x6f, 0x6e, 0x69, 0x74, 0x6f,
+  0x72, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
+  0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x75, 0x74, 0x20, 0x28, 0x64, 0x6f,
+  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x29, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x35, 0x32, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x44, 0x61, 0x74, 0x61, 0x20, 0x65, 0x72, 0x61, 0x73,
+  0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x35, 0x35, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x69, 0x73, 0x70,
+  0x6c, 0x61, 0x79, 0x2c, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x35, 0x35, 0x34, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x35,
+  0x35, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x35, 0x36, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44,
+  0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x36, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x44, 0x65, 0x2d, 0x65, 0x6e, 0x65, 0x72, 0x67, 0x69, 0x7a,
+  0x65, 0x20, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69, 0x63, 0x61, 0x6c,
+  0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x36, 0x32, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x44, 0x65, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x69, 0x7a,
+  0x65, 0x20, 0x68, 0x79, 0x64, 0x72, 0x61, 0x75, 0x6c, 0x69, 0x63, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x35, 0x36,
+  0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65,
+  0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x70, 0x72, 0x61, 0x63, 0x74, 0x69,
+  0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
+  0x20, 0x35, 0x36, 0x34, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x35, 0x39,
+  0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x36, 0x30, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x52, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6d, 0x61, 0x6b, 0x65,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x30, 0x31, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63,
+  0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x30, 0x32, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x30, 0x33, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x30,
+  0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f,
+  0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65,
+  0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69,
+  0x72, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x36, 0x30, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x30, 0x36, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73,
+  0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f,
+  0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x30, 0x37, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x36,
+  0x30, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x36, 0x30, 0x39, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
+  0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x31, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x64, 0x64, 0x20,
+  0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x31, 0x31, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x49, 0x6e, 0x73, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x31, 0x32,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x65, 0x74, 0x61, 0x6c, 0x69, 0x7a, 0x65,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x31,
+  0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x6f, 0x74, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x31, 0x34, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x52, 0x65, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x31, 0x35, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x52, 0x65, 0x74, 0x72, 0x65, 0x61, 0x64, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x36, 0x31, 0x36, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x36, 0x31, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x32, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x41, 0x74, 0x74, 0x61, 0x63, 0x68, 0x20, 0x6d,
+  0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x32, 0x31, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x42, 0x6f, 0x6e, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x36, 0x32, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x72, 0x69,
+  0x6d, 0x70, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x36, 0x32, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x72, 0x61, 0x7a, 0x65,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x32,
+  0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x69, 0x76, 0x65, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x32, 0x35, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x53, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x32, 0x36, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x53, 0x70, 0x6c, 0x69, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x32, 0x37, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x57, 0x65, 0x6c, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x21, 0x2d, 0x2d, 0x20, 0x36, 0x32, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75,
+  0x20, 0x36, 0x32, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61,
+  0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70,
+  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x33, 0x30, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6d, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73,
+  0x74, 0x72, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2f, 0x73, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74,
+  0x65, 0x72, 0x69, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x36, 0x33, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x6e,
+  0x6e, 0x65, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x36, 0x33, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x61, 0x73,
+  0x65, 0x20, 0x68, 0x61, 0x72, 0x64, 0x65, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x33, 0x33, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x43, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x36, 0x33, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x6f,
+  0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x33, 0x35, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x53, 0x68, 0x6f, 0x74, 0x2d, 0x70, 0x65, 0x65, 0x6e, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x33, 0x36, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x54, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x36, 0x33, 0x37, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x36, 0x33, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x33, 0x39, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x65, 0x63, 0x68, 0x61,
+  0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x6e, 0x67,
+  0x74, 0x68, 0x2f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x34,
+  0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20,
+  0x66, 0x69, 0x6e, 0x69, 0x73, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61,
+  0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x36, 0x34, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41,
+  0x6e, 0x6f, 0x64, 0x69, 0x7a, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x36, 0x34, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42,
+  0x75, 0x66, 0x66, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x34, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x75, 0x72, 0x6e,
+  0x69, 0x73, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x34, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x72, 0x6f,
+  0x6d, 0x61, 0x74, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x36, 0x34, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x6f, 0x6e,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36,
+  0x34, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x61, 0x70, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x34, 0x37, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x50, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x34, 0x38, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x36, 0x34, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x6c, 0x65, 0x61, 0x6e, 0x75, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x65,
+  0x6e, 0x74, 0x73, 0x2c, 0x20, 0x63, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x65,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36,
+  0x35, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x35, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x41, 0x62, 0x72, 0x61, 0x73, 0x69, 0x76, 0x65, 0x20, 0x62,
+  0x6c, 0x61, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x36, 0x35, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x6f, 0x72,
+  0x65, 0x2f, 0x64, 0x72, 0x69, 0x6c, 0x6c, 0x2f, 0x72, 0x65, 0x61, 0x6d,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x35,
+  0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69,
+  0x63, 0x61, 0x6c, 0x2f, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x6f, 0x63,
+  0x68, 0x65, 0x6d, 0x69, 0x63, 0x61, 0x6c, 0x2f, 0x63, 0x68, 0x65, 0x6d,
+  0x69, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x74, 0x63, 0x68, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x35, 0x34, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x42, 0x72, 0x6f, 0x61, 0x63, 0x68, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x35, 0x35, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x47, 0x72, 0x69, 0x6e, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x36, 0x35, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d,
+  0x69, 0x6c, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x35, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x68, 0x72, 0x65,
+  0x61, 0x64, 0x2f, 0x74, 0x61, 0x70, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x36, 0x35, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54,
+  0x75, 0x72, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x35, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4f, 0x74, 0x68, 0x65,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6f,
+  0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x36, 0x36, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x72, 0x65, 0x70,
+  0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x36, 0x31, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x6c, 0x6c, 0x6f, 0x77, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x36, 0x32, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x54, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x79, 0x20,
+  0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x36, 0x36, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74, 0x61,
+  0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x36, 0x34, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x72,
+  0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x36, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x6c, 0x79, 0x2d,
+  0x69, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x36, 0x36, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36,
+  0x36, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69,
+  0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x36, 0x38, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x41, 0x6c, 0x6c, 0x6f, 0x77, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x63,
+  0x6f, 0x6d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x65, 0x20, 0x73, 0x74, 0x72,
+  0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x36, 0x39, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x41, 0x6c, 0x6c, 0x6f, 0x77, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x64, 0x61, 0x6d, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6d,
+  0x69, 0x78, 0x65, 0x64, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+  0x72, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x37, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x6f,
+  0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x36, 0x37, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x61,
+  0x6b, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x61, 0x72, 0x74,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
+  0x36, 0x37, 0x32, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x36, 0x37, 0x39,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+  0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x36, 0x38, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42,
+  0x61, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x6e, 0x67,
+  0x65, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x38, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x61, 0x6d, 0x61,
+  0x67, 0x65, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x73, 0x79,
+  0x6d, 0x62, 0x6f, 0x6c, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x69, 0x6e, 0x67,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x38,
+  0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
+  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x64,
+  0x61, 0x6d, 0x61, 0x67, 0x65, 0x64, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77,
+  0x61, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x38, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x61, 0x6d, 0x61,
+  0x67, 0x65, 0x20, 0x61, 0x73, 0x73, 0x65, 0x73, 0x73, 0x6d, 0x65, 0x6e,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36,
+  0x38, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x55, 0x74, 0x69, 0x6c,
+  0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x67, 0x72,
+  0x61, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x38, 0x35, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x52, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x36, 0x38, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49, 0x73, 0x6f,
+  0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x36, 0x38, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x75, 0x6e,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x61,
+  0x66, 0x74, 0x65, 0x72, 0x20, 0x62, 0x61, 0x74, 0x74, 0x6c, 0x65, 0x20,
+  0x64, 0x61, 0x6d, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x72, 0x65, 0x70, 0x61,
+  0x69, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x36, 0x38, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x61, 0x74,
+  0x74, 0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x72,
+  0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x6b, 0x69, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x38, 0x39, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x44, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x70,
+  0x61, 0x69, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x36, 0x39, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69,
+  0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x39, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x61, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x39, 0x32,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x6f,
+  0x72, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x36, 0x39, 0x33, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x56, 0x61, 0x72, 0x6e, 0x69, 0x73, 0x68, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x36, 0x39, 0x34, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x36, 0x39, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x30, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x41, 0x73, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x65,
+  0x2c, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x30, 0x31, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63,
+  0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x37, 0x30, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69,
+  0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x73, 0x74,
+  0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x30, 0x33, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65,
+  0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x37, 0x30, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61,
+  0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e,
+  0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x30, 0x35, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75,
+  0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+  0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x73,
+  0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x30, 0x36, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37,
+  0x30, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61, 0x72, 0x74,
+  0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69,
+  0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x37, 0x30,
+  0x38, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x37, 0x30, 0x39, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x37, 0x31, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x73, 0x73, 0x65, 0x6d,
+  0x62, 0x6c, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37,
+  0x31, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x69, 0x67, 0x68, 0x74, 0x65,
+  0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x31, 0x32,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x6f, 0x63, 0x6b, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x37, 0x31, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50,
+  0x61, 0x63, 0x6b, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37,
+  0x31, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x73, 0x73, 0x65, 0x6d, 0x62,
+  0x6c, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x73, 0x69, 0x74, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x37, 0x31, 0x35, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x37, 0x31, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x32, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x32, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x75, 0x70, 0x20, 0x74,
+  0x6f, 0x20, 0x75, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x6e,
+  0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x32, 0x32, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x2f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c,
+  0x20, 0x6f, 0x6e, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20,
+  0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x32, 0x33, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x50, 0x72, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x73,
+  0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x32, 0x34, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x46, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x2d, 0x6f, 0x6e, 0x20,
+  0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x32, 0x35,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x41, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x32, 0x36, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20,
+  0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x65,
+  0x76, 0x69, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x37, 0x32, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x69, 0x74,
+  0x65, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70,
+  0x6c, 0x61, 0x6e, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x37, 0x32, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x6f, 0x75,
+  0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x70,
+  0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x37, 0x32, 0x39, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73,
+  0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37,
+  0x33, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+  0x74, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x37, 0x33,
+  0x31, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x37, 0x33, 0x39, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x37, 0x34, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6c, 0x6f, 0x73, 0x65,
+  0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73,
+  0x73, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x37, 0x34,
+  0x31, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x37, 0x34, 0x39, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x37, 0x35, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x6f, 0x61, 0x64, 0x20,
+  0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x37, 0x35, 0x31, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x35,
+  0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x61, 0x74, 0x61, 0x20, 0x6c, 0x6f,
+  0x61, 0x64, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x21, 0x2d, 0x2d, 0x20, 0x37, 0x35, 0x33, 0x20, 0x74, 0x68, 0x72, 0x75,
+  0x20, 0x37, 0x35, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61,
+  0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70,
+  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x36, 0x30, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x52, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x36, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x45, 0x6e, 0x65, 0x72, 0x67, 0x69, 0x7a, 0x65,
+  0x20, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x20,
+  0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x37, 0x36, 0x32, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x69, 0x7a, 0x65, 0x20, 0x68,
+  0x79, 0x64, 0x72, 0x61, 0x75, 0x6c, 0x69, 0x63, 0x73, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x37, 0x36, 0x33, 0x20,
+  0x74, 0x68, 0x72, 0x75, 0x20, 0x37, 0x39, 0x39, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38, 0x30,
+  0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61, 0x63, 0x6b, 0x61,
+  0x67, 0x65, 0x2c, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x69, 0x6e, 0x67,
+  0x2c, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x38, 0x30, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75,
+  0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73,
+  0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x38, 0x30, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74,
+  0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73,
+  0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x38, 0x30, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70,
+  0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38, 0x30, 0x34, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73,
+  0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38, 0x30, 0x35, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75,
+  0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+  0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x74, 0x6f,
+  0x72, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x38, 0x30, 0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77,
+  0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x74, 0x6f, 0x72,
+  0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x38, 0x30, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61,
+  0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61,
+  0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x38, 0x30, 0x38, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x38, 0x30, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38, 0x31, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x38, 0x31, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x65, 0x70, 0x61,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x76,
+  0x65, 0x68, 0x69, 0x63, 0x6c, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73,
+  0x70, 0x6f, 0x72, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38, 0x31, 0x32, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x53, 0x68, 0x69, 0x70, 0x70, 0x69, 0x6e, 0x67,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
+  0x20, 0x2d, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x38, 0x31, 0x33,
+  0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x38, 0x31, 0x39, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73,
+  0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38,
+  0x32, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x38, 0x32,
+  0x31, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x38, 0x32, 0x39, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74,
+  0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x38, 0x33, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x75, 0x74, 0x20,
+  0x69, 0x74, 0x65, 0x6d, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+  0x61, 0x69, 0x6e, 0x65, 0x72, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x38, 0x33, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x56,
+  0x65, 0x68, 0x69, 0x63, 0x6c, 0x65, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69,
+  0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x38, 0x33, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x61, 0x63, 0x6b,
+  0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x38, 0x33, 0x33, 0x20, 0x74, 0x68, 0x72,
+  0x75, 0x20, 0x38, 0x33, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38, 0x34, 0x30, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x69, 0x74,
+  0x65, 0x6d, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+  0x61, 0x69, 0x6e, 0x65, 0x72, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x38, 0x34, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x56,
+  0x65, 0x68, 0x69, 0x63, 0x6c, 0x65, 0x20, 0x75, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x38, 0x34, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x6e,
+  0x70, 0x61, 0x63, 0x6b, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x38, 0x34, 0x33,
+  0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x38, 0x34, 0x39, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73,
+  0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38,
+  0x35, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20,
+  0x69, 0x74, 0x65, 0x6d, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x6e,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x38, 0x35, 0x31, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x38, 0x35, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38, 0x36, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x69, 0x74,
+  0x65, 0x6d, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x73,
+  0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x38, 0x36, 0x31, 0x20, 0x74, 0x68, 0x72,
+  0x75, 0x20, 0x38, 0x36, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38, 0x37, 0x30, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x70, 0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x20, 0x69,
+  0x74, 0x65, 0x6d, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20,
+  0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38,
+  0x37, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x65, 0x74, 0x20, 0x6f, 0x6e,
+  0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x38, 0x37, 0x32,
+  0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x38, 0x37, 0x39, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73,
+  0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38,
+  0x38, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x74, 0x65,
+  0x6d, 0x20, 0x67, 0x6f, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x38, 0x38, 0x31, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x38, 0x38, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x38, 0x39, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x66, 0x65, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x20,
+  0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x74, 0x6f, 0x72,
+  0x61, 0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x38, 0x39, 0x31, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x38,
+  0x39, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x39, 0x30, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f,
+  0x75, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x39, 0x30, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73,
+  0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75,
+  0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x39, 0x30, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f,
+  0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d,
+  0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x30, 0x33, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e,
+  0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x30,
+  0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73, 0x63, 0x65,
+  0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c,
+  0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75,
+  0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+  0x6f, 0x6f, 0x6c, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x39, 0x30, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d,
+  0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70,
+  0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x30,
+  0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73, 0x63, 0x65,
+  0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39,
+  0x30, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73, 0x63,
+  0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x70, 0x61,
+  0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x39, 0x30, 0x38, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x39, 0x30, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x31, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c,
+  0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x31, 0x31, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x49, 0x6c, 0x6c, 0x75, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x39, 0x31, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x61, 0x6e, 0x64, 0x6c,
+  0x69, 0x6e, 0x67, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39,
+  0x31, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61,
+  0x6c, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63,
+  0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x31, 0x34,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x63, 0x6f,
+  0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6e, 0x74, 0x61,
+  0x69, 0x6e, 0x65, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6d, 0x6f,
+  0x64, 0x75, 0x6c, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x39, 0x31, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46,
+  0x61, 0x63, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x31, 0x36, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61,
+  0x6e, 0x63, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x39, 0x31, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x6f, 0x6e,
+  0x2d, 0x53, 0x31, 0x30, 0x30, 0x30, 0x44, 0x20, 0x70, 0x75, 0x62, 0x6c,
+  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x39, 0x31, 0x38, 0x20, 0x74, 0x68,
+  0x72, 0x75, 0x20, 0x39, 0x31, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61,
+  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x32, 0x30, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x3d, 0x20,
+  0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69,
+  0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x39, 0x32, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x3d, 0x20, 0x52, 0x65, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61,
+  0x6c, 0x6c, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x69, 0x74, 0x65,
+  0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39,
+  0x32, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x20, 0x3d, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x69, 0x74,
+  0x65, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
+  0x20, 0x39, 0x32, 0x34, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x39, 0x32,
+  0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x39, 0x33, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x73, 0x62, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63,
+  0x65, 0x20, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74, 0x69, 0x6e, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x33, 0x31, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65,
+  0x20, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74, 0x69, 0x6e, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x39, 0x33, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x6c, 0x61,
+  0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x39, 0x33, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x63,
+  0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x69, 0x73, 0x68, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x2d,
+  0x20, 0x54, 0x61, 0x73, 0x6b, 0x20, 0x73, 0x65, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x33, 0x34, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x73, 0x62, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x61,
+  0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72,
+  0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x39, 0x33, 0x35, 0x20, 0x74, 0x68, 0x72,
+  0x75, 0x20, 0x39, 0x33, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x34, 0x30, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x76, 0x69, 0x73, 0x69, 0x6f,
+  0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x34, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x69, 0x70, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49,
+  0x6c, 0x6c, 0x75, 0x73, 0x74, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x70,
+  0x61, 0x72, 0x74, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x34, 0x32, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x69, 0x70, 0x64, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e,
+  0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
+  0x20, 0x39, 0x34, 0x33, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x39, 0x34,
+  0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x39, 0x35, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x35, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x73, 0x73, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x39, 0x35, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x6c, 0x65, 0x61, 0x72, 0x6e, 0x69, 0x6e,
+  0x67, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x20, 0x6c, 0x65, 0x61,
+  0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
+  0x39, 0x35, 0x33, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x39, 0x36, 0x30,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+  0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x39, 0x36, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x61, 0x6c, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77,
+  0x6f, 0x72, 0x6b, 0x73, 0x68, 0x65, 0x65, 0x74, 0x73, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x39, 0x36, 0x32, 0x20,
+  0x74, 0x68, 0x72, 0x75, 0x20, 0x39, 0x36, 0x39, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x37,
+  0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x70, 0x70, 0x72, 0x6f,
+  0x76, 0x65, 0x64, 0x20, 0x76, 0x65, 0x6e, 0x64, 0x6f, 0x72, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x39, 0x37, 0x31, 0x20, 0x74,
+  0x68, 0x72, 0x75, 0x20, 0x39, 0x37, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d,
+  0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x38, 0x30,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x6e, 0x76, 0x69, 0x72, 0x6f,
+  0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x6d, 0x61, 0x6c, 0x20, 0x70, 0x72, 0x6f,
+  0x74, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x66, 0x69, 0x72,
+  0x65, 0x2d, 0x66, 0x69, 0x67, 0x68, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x72, 0x65, 0x73, 0x63, 0x75, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x38, 0x31, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x41, 0x69, 0x72, 0x20, 0x63, 0x6c, 0x65, 0x61,
+  0x6e, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x39, 0x38, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53,
+  0x65, 0x77, 0x61, 0x67, 0x65, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x6d,
+  0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x39, 0x38, 0x33, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x39,
+  0x38, 0x38, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x39, 0x38, 0x39, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x46, 0x69, 0x72, 0x65, 0x2d, 0x66, 0x69, 0x67, 0x68, 0x74, 0x69,
+  0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x73, 0x63, 0x75,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39,
+  0x39, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x65, 0x75, 0x74,
+  0x72, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6f, 0x73, 0x61, 0x6c, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x39, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x65, 0x75, 0x74, 0x72, 0x61,
+  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x6f, 0x72, 0x64, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x39, 0x32, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4e, 0x65, 0x75, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x7a,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x62,
+  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x39, 0x39, 0x33, 0x20, 0x74, 0x68, 0x72,
+  0x75, 0x20, 0x39, 0x39, 0x35, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x39, 0x36, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x44, 0x69, 0x73, 0x70, 0x6f, 0x73, 0x61, 0x6c,
+  0x20, 0x6f, 0x66, 0x20, 0x6f, 0x72, 0x64, 0x6e, 0x61, 0x6e, 0x63, 0x65,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x39, 0x39,
+  0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x69, 0x73, 0x70, 0x6f,
+  0x73, 0x61, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x75,
+  0x63, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x39, 0x39, 0x38, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x69, 0x73,
+  0x70, 0x6f, 0x73, 0x61, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x62,
+  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x39, 0x39, 0x39, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x30,
+  0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6f, 0x6d, 0x70, 0x75,
+  0x74, 0x65, 0x72, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c,
+  0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x43, 0x30, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f,
+  0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63,
+  0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20,
+  0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x66,
+  0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x43, 0x30, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73,
+  0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72,
+  0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d,
+  0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d,
+  0x73, 0x2c, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x30, 0x33, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e,
+  0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65,
+  0x72, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73,
+  0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x43, 0x30, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d,
+  0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65,
+  0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77,
+  0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x30,
+  0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73, 0x63, 0x65,
+  0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77,
+  0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x30,
+  0x36, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73, 0x63, 0x65,
+  0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+  0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74,
+  0x65, 0x72, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20,
+  0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x43, 0x30, 0x37, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75,
+  0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65,
+  0x72, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73,
+  0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21,
+  0x2d, 0x2d, 0x20, 0x43, 0x30, 0x38, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20,
+  0x43, 0x31, 0x32, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x31, 0x33, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x31, 0x34, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x50, 0x72, 0x6f, 0x62, 0x6c, 0x65, 0x6d, 0x20, 0x68, 0x61,
+  0x6e, 0x64, 0x6c, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f,
+  0x64, 0x65, 0x3d, 0x22, 0x43, 0x31, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x20, 0x6f, 0x66, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x31, 0x36, 0x20, 0x74, 0x68,
+  0x72, 0x75, 0x20, 0x43, 0x31, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61,
+  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x32, 0x30, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20,
+  0x61, 0x64, 0x6d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x43, 0x32, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x79, 0x73,
+  0x74, 0x65, 0x6d, 0x20, 0x6d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x69,
+  0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x43, 0x32, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x32, 0x33, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x20, 0x68, 0x61, 0x72, 0x64,
+  0x77, 0x61, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21,
+  0x2d, 0x2d, 0x20, 0x43, 0x32, 0x34, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61,
+  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x32, 0x35, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20,
+  0x72, 0x65, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x79, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x32, 0x36, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x42, 0x61, 0x63, 0x6b, 0x75, 0x70, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x32, 0x37, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x52, 0x65, 0x62, 0x6f, 0x6f, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x32, 0x38, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x43, 0x32, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61,
+  0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70,
+  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x33, 0x30, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x33, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x44, 0x65, 0x66, 0x72, 0x61, 0x67, 0x6d, 0x65,
+  0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x33, 0x32, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x2f, 0x4f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x20, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x33, 0x33, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x44, 0x69, 0x73, 0x6b, 0x20, 0x6d, 0x69, 0x72, 0x72,
+  0x6f, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x43, 0x33, 0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x6c,
+  0x65, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x65, 0x72,
+  0x65, 0x6e, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x43, 0x33, 0x35, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x69, 0x6d,
+  0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x33, 0x36, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x43, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74,
+  0x79, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x33, 0x37, 0x20, 0x74, 0x68,
+  0x72, 0x75, 0x20, 0x43, 0x34, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61,
+  0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x35, 0x30, 0x22,
+  0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x43, 0x35, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d,
+  0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x6f, 0x76, 0x65, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x43, 0x35, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x61, 0x6e,
+  0x69, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2f, 0x55, 0x73, 0x65, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x43, 0x35, 0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
+  0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61,
+  0x67, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
+  0x20, 0x43, 0x35, 0x34, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x43, 0x35,
+  0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64,
+  0x65, 0x3d, 0x22, 0x43, 0x36, 0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65,
+  0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x6d, 0x69, 0x6e, 0x67, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x36, 0x31,
+  0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61,
+  0x6d, 0x20, 0x66, 0x6c, 0x6f, 0x77, 0x20, 0x63, 0x68, 0x61, 0x72, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x36,
+  0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x72, 0x6f, 0x63, 0x65,
+  0x73, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65,
+  0x6e, 0x63, 0x65, 0x20, 0x67, 0x75, 0x69, 0x64, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x36, 0x33, 0x20,
+  0x74, 0x68, 0x72, 0x75, 0x20, 0x43, 0x36, 0x39, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x37,
+  0x30, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x65, 0x63, 0x75, 0x72,
+  0x69, 0x74, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x72, 0x69, 0x76,
+  0x61, 0x63, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x20, 0x43, 0x37, 0x31, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x37, 0x32, 0x22, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x53, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x37,
+  0x33, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74,
+  0x79, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x37,
+  0x34, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 0x2f,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x37, 0x35, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x21, 0x2d, 0x2d, 0x20, 0x43, 0x37, 0x36, 0x20, 0x74, 0x68, 0x72, 0x75,
+  0x20, 0x43, 0x38, 0x39, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61,
+  0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70,
+  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x39, 0x30, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e,
+  0x65, 0x6f, 0x75, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x43, 0x39, 0x31, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x51,
+  0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x61, 0x73, 0x73, 0x75, 0x72,
+  0x61, 0x6e, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43, 0x6f, 0x64, 0x65,
+  0x3d, 0x22, 0x43, 0x39, 0x32, 0x22, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x56,
+  0x65, 0x6e, 0x64, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x21, 0x2d, 0x2d, 0x20, 0x43, 0x39, 0x33, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x43, 0x39, 0x34, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x43,
+  0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x39, 0x35, 0x22, 0x20, 0x73, 0x63,
+  0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4e, 0x61, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x43, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x43, 0x39, 0x36, 0x22, 0x20, 0x73,
+  0x63, 0x68, 0x65, 0x6d, 0x61, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x22, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x4e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x54, 0x65, 0x63, 0x68, 0x6e, 0x69, 0x63, 0x61, 0x6c,
+  0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
+  0x43, 0x39, 0x37, 0x20, 0x74, 0x68, 0x72, 0x75, 0x20, 0x43, 0x39, 0x39,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+  0x63, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x6d,
+  0x74, 0x79, 0x70, 0x65, 0x73, 0x3e, 0x0a
+};
+unsigned int dmtypes_xml_len = 50995;
+unsigned char dmtypes_txt[] = {
+  0x30, 0x30, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x70, 0x6c, 0x61,
+  0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x30, 0x30, 0x31, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x69, 0x74,
+  0x6c, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x0a, 0x30, 0x30, 0x32, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20,
+  0x6f, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x75,
+  0x6c, 0x65, 0x73, 0x0a, 0x30, 0x30, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x20, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x68,
+  0x69, 0x67, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x73, 0x0a, 0x30, 0x30,
+  0x34, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x69, 0x6c, 0x6c, 0x75, 0x73,
+  0x74, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x30, 0x30, 0x35, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x62, 0x62, 0x72, 0x65, 0x76,
+  0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x30, 0x30, 0x36, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x0a,
+  0x30, 0x30, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x79,
+  0x6d, 0x62, 0x6f, 0x6c, 0x73, 0x0a, 0x30, 0x30, 0x38, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x65, 0x63, 0x68,
+  0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61,
+  0x72, 0x64, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x0a, 0x30, 0x30,
+  0x39, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x54, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x30, 0x31, 0x30, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x6c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x30, 0x31, 0x31,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x30, 0x31, 0x32, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x65,
+  0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e,
+  0x67, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x61, 0x75, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x6c, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x73, 0x61, 0x66, 0x65, 0x74, 0x79, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x0a, 0x30, 0x31, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x75, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0a, 0x30, 0x31, 0x34, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6c,
+  0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 0x69, 0x63, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0a, 0x30, 0x31, 0x35, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61,
+  0x6c, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x0a,
+  0x30, 0x31, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x61,
+  0x6e, 0x67, 0x65, 0x72, 0x6f, 0x75, 0x73, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x73, 0x0a, 0x30, 0x31, 0x37, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x0a, 0x30, 0x31, 0x38, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x6e, 0x74, 0x72, 0x6f,
+  0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x30, 0x31, 0x39, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x75,
+  0x70, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a,
+  0x30, 0x32, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x30, 0x32, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69,
+  0x67, 0x68, 0x74, 0x0a, 0x30, 0x32, 0x32, 0x20, 0x20, 0x62, 0x72, 0x65,
+  0x78, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x75, 0x73, 0x69, 0x6e, 0x65,
+  0x73, 0x73, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x73, 0x20, 0x65, 0x78, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x0a, 0x30, 0x32, 0x33, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x64, 0x6d, 0x69,
+  0x6e, 0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x0a, 0x30, 0x32, 0x34, 0x20, 0x20, 0x62, 0x72, 0x64, 0x6f, 0x63,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x42, 0x75, 0x73, 0x69, 0x6e, 0x65, 0x73, 0x73,
+  0x20, 0x72, 0x75, 0x6c, 0x65, 0x73, 0x0a, 0x30, 0x32, 0x35, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x78, 0x70,
+  0x6f, 0x72, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20,
+  0x70, 0x6f, 0x6c, 0x69, 0x63, 0x79, 0x0a, 0x30, 0x32, 0x36, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x67,
+  0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x70, 0x6f, 0x6c, 0x69,
+  0x63, 0x79, 0x0a, 0x30, 0x32, 0x38, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c,
+  0x0a, 0x30, 0x32, 0x39, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x44, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x75, 0x72, 0x65, 0x0a, 0x30, 0x33, 0x30, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x65, 0x63, 0x68,
+  0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x30,
+  0x33, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x45, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x20,
+  0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x70, 0x61, 0x72,
+  0x74, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x30, 0x33, 0x33, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x65,
+  0x63, 0x68, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x20, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c,
+  0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x29, 0x0a,
+  0x30, 0x33, 0x34, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x54, 0x65, 0x63, 0x68, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x28, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63,
+  0x61, 0x6c, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x64, 0x6f, 0x77, 0x6e,
+  0x29, 0x0a, 0x30, 0x34, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x30, 0x34, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x68, 0x6f, 0x77,
+  0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x0a,
+  0x30, 0x34, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x0a, 0x30, 0x34, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x72, 0x65, 0x77, 0x20, 0x28,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x62,
+  0x72, 0x65, 0x61, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x29, 0x0a, 0x30, 0x34,
+  0x34, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x28, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x62, 0x72,
+  0x65, 0x61, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x29, 0x0a, 0x30, 0x34, 0x35,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44,
+  0x65, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x65, 0x64, 0x20, 0x75, 0x73,
+  0x65, 0x0a, 0x30, 0x34, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e,
+  0x63, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x70, 0x65, 0x72, 0x69, 0x70, 0x68,
+  0x65, 0x72, 0x61, 0x6c, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73,
+  0x2f, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x30,
+  0x35, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x44, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d, 0x2f, 0x4c, 0x69, 0x73,
+  0x74, 0x0a, 0x30, 0x35, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x57, 0x69, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x64,
+  0x69, 0x61, 0x67, 0x72, 0x61, 0x6d, 0x0a, 0x30, 0x35, 0x32, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x6f, 0x75,
+  0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d,
+  0x0a, 0x30, 0x35, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x30, 0x35, 0x34, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x20, 0x64, 0x69, 0x61, 0x67, 0x72,
+  0x61, 0x6d, 0x0a, 0x30, 0x35, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x64, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d, 0x0a, 0x30, 0x35,
+  0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x45, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x0a, 0x30, 0x35, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x69, 0x72, 0x65, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x0a, 0x30, 0x35, 0x38, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x61, 0x72, 0x6e, 0x65, 0x73, 0x73,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x30, 0x35, 0x39, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x69, 0x6e,
+  0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x65, 0x6e, 0x76, 0x65,
+  0x6c, 0x6f, 0x70, 0x65, 0x20, 0x64, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d,
+  0x0a, 0x30, 0x36, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+  0x0a, 0x30, 0x36, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f,
+  0x6c, 0x73, 0x0a, 0x30, 0x36, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72,
+  0x64, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x0a, 0x30, 0x36, 0x33, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x6f, 0x76, 0x65,
+  0x72, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c,
+  0x69, 0x65, 0x64, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20,
+  0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x0a, 0x30, 0x36, 0x34, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x6f,
+  0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f,
+  0x6c, 0x73, 0x0a, 0x30, 0x36, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+  0x65, 0x0a, 0x30, 0x36, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x53, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20,
+  0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x0a, 0x30, 0x36, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x44, 0x65, 0x63, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x0a, 0x30, 0x37, 0x30,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x2c, 0x20,
+  0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65,
+  0x73, 0x0a, 0x30, 0x37, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62,
+  0x6c, 0x65, 0x73, 0x0a, 0x30, 0x37, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x74, 0x65, 0x72, 0x69,
+  0x61, 0x6c, 0x73, 0x0a, 0x30, 0x37, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x78, 0x70, 0x65, 0x6e, 0x64,
+  0x61, 0x62, 0x6c, 0x65, 0x73, 0x0a, 0x30, 0x37, 0x34, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x61, 0x74, 0x61,
+  0x20, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64,
+  0x61, 0x6e, 0x67, 0x65, 0x72, 0x6f, 0x75, 0x73, 0x20, 0x63, 0x6f, 0x6e,
+  0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x0a, 0x30,
+  0x37, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a,
+  0x30, 0x37, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x46, 0x6c, 0x75, 0x69, 0x64, 0x0a, 0x30, 0x37, 0x37, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x61,
+  0x74, 0x61, 0x20, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61,
+  0x6c, 0x73, 0x0a, 0x30, 0x37, 0x38, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x61, 0x73, 0x74, 0x65, 0x6e, 0x65,
+  0x72, 0x73, 0x0a, 0x30, 0x38, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x78, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f,
+  0x6e, 0x0a, 0x30, 0x38, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x6d, 0x69, 0x63, 0x61, 0x6c,
+  0x20, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x30, 0x38,
+  0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x43, 0x68, 0x65, 0x6d, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x69, 0x78,
+  0x74, 0x75, 0x72, 0x65, 0x0a, 0x30, 0x39, 0x30, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77,
+  0x61, 0x72, 0x65, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x30, 0x39, 0x36, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x61, 0x66, 0x65,
+  0x74, 0x79, 0x20, 0x63, 0x72, 0x69, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20,
+  0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x61,
+  0x72, 0x74, 0x73, 0x0a, 0x30, 0x30, 0x41, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x69, 0x6c, 0x6c, 0x75, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x0a, 0x30, 0x30, 0x42, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x30, 0x30, 0x43, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x69,
+  0x65, 0x73, 0x0a, 0x30, 0x30, 0x44, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x70, 0x61, 0x72, 0x65, 0x73, 0x0a, 0x30, 0x30, 0x45, 0x20,
+  0x20, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x69, 0x74, 0x65,
+  0x6d, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x20, 0x63, 0x6f,
+  0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74,
+  0x6f, 0x72, 0x79, 0x0a, 0x30, 0x30, 0x46, 0x20, 0x20, 0x63, 0x6f, 0x6d,
+  0x72, 0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x69, 0x72, 0x63, 0x75, 0x69,
+  0x74, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x63,
+  0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x6f, 0x72, 0x79, 0x0a, 0x30, 0x30, 0x47, 0x20, 0x20, 0x63, 0x6f,
+  0x6d, 0x72, 0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x61, 0x72, 0x74, 0x73,
+  0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f,
+  0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x0a, 0x30, 0x30, 0x48, 0x20, 0x20,
+  0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5a, 0x6f, 0x6e,
+  0x65, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65,
+  0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x0a, 0x30, 0x30, 0x4a,
+  0x20, 0x20, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41,
+  0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x70, 0x61, 0x6e, 0x65, 0x6c, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x6f, 0x6f, 0x72, 0x73, 0x20, 0x63,
+  0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x6f, 0x72, 0x79, 0x0a, 0x30, 0x30, 0x4b, 0x20, 0x20, 0x63, 0x6f,
+  0x6d, 0x72, 0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x72, 0x67, 0x61, 0x6e,
+  0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x63, 0x6f, 0x6d,
+  0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f,
+  0x72, 0x79, 0x0a, 0x30, 0x30, 0x4c, 0x20, 0x20, 0x63, 0x6f, 0x6d, 0x72,
+  0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x75, 0x70, 0x70, 0x6c, 0x69, 0x65,
+  0x73, 0x20, 0x2d, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6d,
+  0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f,
+  0x72, 0x79, 0x0a, 0x30, 0x30, 0x4d, 0x20, 0x20, 0x63, 0x6f, 0x6d, 0x72,
+  0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x75, 0x70, 0x70, 0x6c, 0x69, 0x65,
+  0x73, 0x20, 0x2d, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73,
+  0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f,
+  0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x0a, 0x30, 0x30, 0x4e, 0x20, 0x20,
+  0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x75, 0x70,
+  0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65,
+  0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x0a, 0x30, 0x30, 0x50,
+  0x20, 0x20, 0x70, 0x72, 0x64, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x72, 0x65,
+  0x66, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50,
+  0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x20, 0x43, 0x72, 0x6f, 0x73, 0x73,
+  0x2d, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x54,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x28, 0x50, 0x43, 0x54, 0x29, 0x0a, 0x30,
+  0x30, 0x51, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x63, 0x72, 0x6f, 0x73,
+  0x73, 0x72, 0x65, 0x66, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x20, 0x20,
+  0x20, 0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
+  0x43, 0x72, 0x6f, 0x73, 0x73, 0x2d, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65,
+  0x6e, 0x63, 0x65, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x28, 0x43,
+  0x43, 0x54, 0x29, 0x0a, 0x30, 0x30, 0x52, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20,
+  0x70, 0x61, 0x67, 0x65, 0x73, 0x0a, 0x30, 0x30, 0x53, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76,
+  0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+  0x65, 0x73, 0x0a, 0x30, 0x30, 0x54, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20,
+  0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x0a, 0x30, 0x30, 0x55, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x69, 0x67,
+  0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x73, 0x0a, 0x30, 0x30, 0x56, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69,
+  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x0a, 0x30, 0x30, 0x57, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+  0x63, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x72, 0x65, 0x66, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x62,
+  0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x43, 0x72, 0x6f, 0x73, 0x73, 0x2d,
+  0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x54, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x28, 0x41, 0x43, 0x54, 0x29, 0x0a, 0x30, 0x30,
+  0x58, 0x20, 0x20, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x20,
+  0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72,
+  0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73,
+  0x69, 0x74, 0x6f, 0x72, 0x79, 0x0a, 0x30, 0x30, 0x59, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x0a, 0x30, 0x30, 0x5a,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
+  0x73, 0x0a, 0x30, 0x41, 0x31, 0x20, 0x20, 0x63, 0x6f, 0x6d, 0x72, 0x65,
+  0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x61, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x70, 0x68,
+  0x79, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x61, 0x72, 0x65, 0x61, 0x73,
+  0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x0a,
+  0x30, 0x41, 0x32, 0x20, 0x20, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x62, 0x69, 0x6c,
+  0x69, 0x74, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f,
+  0x72, 0x79, 0x0a, 0x30, 0x41, 0x33, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c,
+  0x69, 0x63, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x72, 0x65, 0x66, 0x74, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61,
+  0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73,
+  0x2d, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x63, 0x61, 0x74, 0x61, 0x6c, 0x6f, 0x67,
+  0x0a, 0x30, 0x41, 0x34, 0x20, 0x20, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x57, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x73, 0x20,
+  0x2d, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x61,
+  0x72, 0x6e, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x0a, 0x30, 0x41, 0x35, 0x20,
+  0x20, 0x63, 0x6f, 0x6d, 0x72, 0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x61,
+  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x2d, 0x20, 0x4c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x61, 0x75, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d,
+  0x6d, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f,
+  0x72, 0x79, 0x0a, 0x30, 0x42, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e,
+  0x61, 0x6e, 0x63, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x6e, 0x6e, 0x69, 0x6e,
+  0x67, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x0a, 0x30, 0x42, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x54, 0x69, 0x6d, 0x65, 0x20, 0x6c, 0x69, 0x6d,
+  0x69, 0x74, 0x73, 0x0a, 0x30, 0x42, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d,
+  0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65,
+  0x2f, 0x69, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x74, 0x61, 0x73, 0x6b, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x30,
+  0x42, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6d,
+  0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x2f, 0x69,
+  0x6e, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61,
+  0x73, 0x6b, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x30, 0x42, 0x34,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5a,
+  0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e,
+  0x61, 0x6e, 0x63, 0x65, 0x2f, 0x69, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61, 0x73, 0x6b, 0x73, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x0a, 0x30, 0x42, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x6e, 0x73, 0x63, 0x68, 0x65, 0x64,
+  0x75, 0x6c, 0x65, 0x64, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x31,
+  0x30, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31,
+  0x30, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e,
+  0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31,
+  0x30, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74,
+  0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f,
+  0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x30, 0x33,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e,
+  0x64, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f,
+  0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x30, 0x34,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69,
+  0x61, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65,
+  0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f,
+  0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x30, 0x35,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x0a, 0x31, 0x30, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73,
+  0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f,
+  0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x30,
+  0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x0a, 0x31, 0x31, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x6f,
+  0x72, 0x73, 0x0a, 0x31, 0x31, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c,
+  0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61,
+  0x74, 0x6f, 0x72, 0x73, 0x0a, 0x31, 0x31, 0x32, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x0a, 0x31, 0x31, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79,
+  0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x73,
+  0x0a, 0x31, 0x32, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x50, 0x72, 0x65, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x32, 0x31, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x65, 0x2d, 0x6f,
+  0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x31, 0x32, 0x32, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x69, 0x74,
+  0x69, 0x6e, 0x67, 0x0a, 0x31, 0x32, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x68, 0x65, 0x6c, 0x74, 0x65,
+  0x72, 0x0a, 0x31, 0x32, 0x35, 0x20, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x6c, 0x69, 0x73, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x65, 0x2d, 0x6f, 0x70, 0x65, 0x72,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69,
+  0x73, 0x74, 0x0a, 0x31, 0x32, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69,
+  0x6e, 0x65, 0x73, 0x73, 0x0a, 0x31, 0x32, 0x37, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x73, 0x74, 0x61, 0x62,
+  0x6c, 0x69, 0x73, 0x68, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69,
+  0x6e, 0x67, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x31, 0x33, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x33, 0x31, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x72,
+  0x6d, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a,
+  0x31, 0x33, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x2d, 0x75, 0x70, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65,
+  0x0a, 0x31, 0x33, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x68, 0x75, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63,
+  0x65, 0x0a, 0x31, 0x33, 0x34, 0x20, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x6c, 0x69, 0x73, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x41, 0x76, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x31,
+  0x33, 0x35, 0x20, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69,
+  0x73, 0x74, 0x0a, 0x31, 0x33, 0x36, 0x20, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20,
+  0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x0a, 0x31, 0x33, 0x38, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x47, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x72,
+  0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6f,
+  0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x61, 0x64, 0x6a, 0x75, 0x73,
+  0x74, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x31, 0x33, 0x39, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x75, 0x63, 0x6c,
+  0x65, 0x61, 0x72, 0x2c, 0x20, 0x62, 0x69, 0x6f, 0x6c, 0x6f, 0x67, 0x69,
+  0x63, 0x61, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x68, 0x65, 0x6d,
+  0x69, 0x63, 0x61, 0x6c, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x73, 0x0a, 0x31, 0x34, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x6d, 0x65, 0x72, 0x67, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x0a, 0x31, 0x34, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x45, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x31, 0x34,
+  0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x6e,
+  0x64, 0x65, 0x72, 0x20, 0x75, 0x6e, 0x75, 0x73, 0x75, 0x61, 0x6c, 0x20,
+  0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x31,
+  0x34, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x52, 0x61, 0x64, 0x69, 0x6f, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72,
+  0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x34, 0x34, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4a, 0x61,
+  0x6d, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x72, 0x6f, 0x6e, 0x69, 0x63, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x73,
+  0x20, 0x28, 0x45, 0x43, 0x4d, 0x29, 0x0a, 0x31, 0x34, 0x35, 0x20, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x6d, 0x65,
+  0x72, 0x67, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x6c, 0x69, 0x73,
+  0x74, 0x0a, 0x31, 0x34, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x45, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x73, 0x68, 0x75, 0x74, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x6f,
+  0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x31, 0x35, 0x30, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x6f, 0x73,
+  0x74, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x31, 0x35, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x2d, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x0a, 0x31, 0x35, 0x35, 0x20, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x6f, 0x73, 0x74, 0x2d, 0x6f, 0x70,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x6c, 0x69, 0x73, 0x74, 0x0a, 0x31, 0x35, 0x37, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x73, 0x74, 0x61, 0x62,
+  0x6c, 0x69, 0x73, 0x68, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e,
+  0x61, 0x6e, 0x63, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x0a, 0x31, 0x36, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x2f,
+  0x55, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x31, 0x36, 0x31, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x70,
+  0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x36, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x6e, 0x2d, 0x74, 0x61,
+  0x63, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x36, 0x39, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x73, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x42, 0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x0a,
+  0x31, 0x37, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x48, 0x61, 0x6e, 0x64, 0x6c, 0x69, 0x6e, 0x67, 0x0a, 0x31,
+  0x37, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4c, 0x69, 0x66, 0x74, 0x69, 0x6e, 0x67, 0x0a, 0x31, 0x37, 0x32,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4a,
+  0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x31, 0x37, 0x33, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x68, 0x6f,
+  0x72, 0x69, 0x6e, 0x67, 0x0a, 0x31, 0x37, 0x34, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x6f, 0x77, 0x69, 0x6e,
+  0x67, 0x0a, 0x31, 0x37, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x54, 0x61, 0x78, 0x69, 0x69, 0x6e, 0x67, 0x0a,
+  0x31, 0x37, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x0a, 0x31,
+  0x37, 0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x53, 0x74, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x7a, 0x69, 0x6e, 0x67,
+  0x0a, 0x31, 0x37, 0x38, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x54, 0x65, 0x74, 0x68, 0x65, 0x72, 0x69, 0x6e, 0x67,
+  0x0a, 0x31, 0x37, 0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x44, 0x65, 0x62, 0x6f, 0x67, 0x67, 0x69, 0x6e, 0x67,
+  0x0a, 0x31, 0x38, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20,
+  0x64, 0x65, 0x76, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x31, 0x38,
+  0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x44, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20,
+  0x64, 0x65, 0x76, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x32, 0x30,
+  0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x0a, 0x32, 0x30,
+  0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+  0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f,
+  0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x0a, 0x32, 0x30,
+  0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65,
+  0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x0a, 0x32, 0x30, 0x33, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64,
+  0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65,
+  0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x0a, 0x32, 0x30, 0x34, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61,
+  0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65,
+  0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x0a, 0x32, 0x30, 0x35, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+  0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73,
+  0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x0a,
+  0x32, 0x30, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f,
+  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73,
+  0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x0a, 0x32, 0x30, 0x37,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50,
+  0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x73,
+  0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x0a,
+  0x32, 0x31, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x46, 0x69, 0x6c, 0x6c, 0x0a, 0x32, 0x31, 0x31, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x66,
+  0x75, 0x65, 0x6c, 0x0a, 0x32, 0x31, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x69, 0x6c, 0x6c, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x6f, 0x69, 0x6b, 0x0a, 0x32, 0x31, 0x33, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x69,
+  0x6c, 0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x78, 0x79, 0x67,
+  0x65, 0x6e, 0x0a, 0x32, 0x31, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x69, 0x6c, 0x6c, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x6e, 0x69, 0x74, 0x72, 0x6f, 0x67, 0x65, 0x6e, 0x0a,
+  0x32, 0x31, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x46, 0x69, 0x6c, 0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x61, 0x69, 0x72, 0x0a, 0x32, 0x31, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x69, 0x6c, 0x6c, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x77, 0x61, 0x74, 0x65, 0x72, 0x0a, 0x32, 0x31,
+  0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x46, 0x69, 0x6c, 0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68, 0x79,
+  0x64, 0x72, 0x6f, 0x67, 0x65, 0x6e, 0x0a, 0x32, 0x31, 0x38, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x69, 0x6c,
+  0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x6c, 0x69, 0x71, 0x75, 0x69, 0x64, 0x0a, 0x32, 0x31, 0x39, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x69,
+  0x6c, 0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f, 0x74, 0x68, 0x65,
+  0x72, 0x20, 0x67, 0x61, 0x73, 0x0a, 0x32, 0x32, 0x30, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x72, 0x61, 0x69,
+  0x6e, 0x20, 0x6c, 0x69, 0x71, 0x75, 0x69, 0x64, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x70, 0x72, 0x65,
+  0x73, 0x73, 0x75, 0x72, 0x65, 0x0a, 0x32, 0x32, 0x31, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x66, 0x75,
+  0x65, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x72, 0x61, 0x69, 0x6e,
+  0x20, 0x66, 0x75, 0x65, 0x6c, 0x0a, 0x32, 0x32, 0x32, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x72, 0x61, 0x69,
+  0x6e, 0x20, 0x6f, 0x69, 0x6c, 0x0a, 0x32, 0x32, 0x33, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x6c, 0x65,
+  0x61, 0x73, 0x65, 0x20, 0x6f, 0x78, 0x79, 0x67, 0x65, 0x6e, 0x20, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x0a, 0x32, 0x32, 0x34, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65,
+  0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x6e, 0x69, 0x74, 0x72, 0x6f, 0x67,
+  0x65, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x0a,
+  0x32, 0x32, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x61, 0x69,
+  0x72, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x0a, 0x32,
+  0x32, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x44, 0x72, 0x61, 0x69, 0x6e, 0x20, 0x77, 0x61, 0x74, 0x65, 0x72,
+  0x0a, 0x32, 0x32, 0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x68,
+  0x79, 0x64, 0x72, 0x6f, 0x67, 0x65, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x73,
+  0x73, 0x75, 0x72, 0x65, 0x0a, 0x32, 0x32, 0x38, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x72, 0x61, 0x69, 0x6e,
+  0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x71, 0x75, 0x69,
+  0x64, 0x0a, 0x32, 0x32, 0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x67, 0x61, 0x73, 0x20, 0x70, 0x72,
+  0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x0a, 0x32, 0x33, 0x30, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x6c, 0x65,
+  0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x65,
+  0x0a, 0x32, 0x33, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x42, 0x6c, 0x65, 0x65, 0x64, 0x0a, 0x32, 0x33, 0x32,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50,
+  0x72, 0x69, 0x6d, 0x65, 0x0a, 0x32, 0x33, 0x33, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x72, 0x79, 0x0a, 0x32,
+  0x33, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x46, 0x61, 0x63, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x72, 0x65,
+  0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x69, 0x6e, 0x67,
+  0x0a, 0x32, 0x33, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x46, 0x6c, 0x75, 0x73, 0x68, 0x0a, 0x32, 0x33, 0x36,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46,
+  0x69, 0x6c, 0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x65,
+  0x72, 0x74, 0x20, 0x68, 0x61, 0x73, 0x2f, 0x69, 0x6e, 0x65, 0x72, 0x74,
+  0x20, 0x6c, 0x69, 0x71, 0x75, 0x69, 0x64, 0x0a, 0x32, 0x33, 0x37, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x76,
+  0x61, 0x63, 0x75, 0x61, 0x74, 0x65, 0x0a, 0x32, 0x34, 0x30, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x75, 0x62,
+  0x72, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x32, 0x34, 0x31,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f,
+  0x69, 0x6c, 0x0a, 0x32, 0x34, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x72, 0x65, 0x61, 0x73, 0x65, 0x0a,
+  0x32, 0x34, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x44, 0x72, 0x79, 0x20, 0x66, 0x69, 0x6c, 0x6d, 0x0a, 0x32,
+  0x35, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x20, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65,
+  0x20, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x32, 0x35, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x63, 0x68, 0x65, 0x6d, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x61, 0x67,
+  0x65, 0x6e, 0x74, 0x0a, 0x32, 0x35, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x20,
+  0x62, 0x79, 0x20, 0x61, 0x62, 0x72, 0x61, 0x73, 0x69, 0x76, 0x65, 0x20,
+  0x62, 0x6c, 0x61, 0x73, 0x74, 0x0a, 0x32, 0x35, 0x33, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6c, 0x65, 0x61,
+  0x6e, 0x20, 0x62, 0x79, 0x20, 0x75, 0x6c, 0x74, 0x72, 0x61, 0x73, 0x6f,
+  0x6e, 0x69, 0x63, 0x73, 0x0a, 0x32, 0x35, 0x34, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6c, 0x65, 0x61, 0x6e,
+  0x20, 0x6d, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x6c,
+  0x79, 0x0a, 0x32, 0x35, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x50, 0x75, 0x72, 0x67, 0x65, 0x0a, 0x32, 0x35,
+  0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x20, 0x77, 0x61, 0x78, 0x0a, 0x32, 0x35, 0x37,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50,
+  0x61, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x32,
+  0x35, 0x38, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6c, 0x65, 0x61,
+  0x6e, 0x0a, 0x32, 0x35, 0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70,
+  0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x20, 0x73, 0x75, 0x72, 0x66, 0x61,
+  0x63, 0x65, 0x0a, 0x32, 0x36, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x20,
+  0x69, 0x63, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x6d, 0x69, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x32, 0x36, 0x31, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x69, 0x63, 0x65, 0x0a, 0x32, 0x36, 0x32, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x65, 0x76,
+  0x65, 0x6e, 0x74, 0x20, 0x69, 0x63, 0x65, 0x0a, 0x32, 0x36, 0x33, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x73,
+  0x65, 0x20, 0x64, 0x69, 0x73, 0x69, 0x6e, 0x66, 0x65, 0x63, 0x74, 0x61,
+  0x6e, 0x74, 0x2f, 0x53, 0x61, 0x6e, 0x69, 0x74, 0x69, 0x7a, 0x65, 0x0a,
+  0x32, 0x36, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x32,
+  0x37, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x41, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x2c, 0x20, 0x61, 0x6c, 0x69,
+  0x67, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x61, 0x6c, 0x69, 0x62,
+  0x72, 0x61, 0x74, 0x65, 0x0a, 0x32, 0x37, 0x31, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x64, 0x6a, 0x75, 0x73,
+  0x74, 0x0a, 0x32, 0x37, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x41, 0x6c, 0x69, 0x67, 0x6e, 0x0a, 0x32, 0x37,
+  0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x43, 0x61, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x74, 0x65, 0x0a, 0x32, 0x37,
+  0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x48, 0x61, 0x72, 0x6d, 0x6f, 0x6e, 0x69, 0x7a, 0x65, 0x0a, 0x32, 0x37,
+  0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x47, 0x72, 0x6f, 0x6f, 0x6d, 0x69, 0x6e, 0x67, 0x0a, 0x32, 0x37, 0x36,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52,
+  0x69, 0x67, 0x0a, 0x32, 0x37, 0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x65, 0x6e, 0x73,
+  0x61, 0x74, 0x65, 0x0a, 0x32, 0x37, 0x38, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x61, 0x73, 0x69, 0x6c, 0x79,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x6c, 0x79,
+  0x20, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65,
+  0x72, 0x20, 0x61, 0x20, 0x62, 0x61, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x64,
+  0x61, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72,
+  0x0a, 0x32, 0x37, 0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x45, 0x61, 0x73, 0x69, 0x6c, 0x79, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x79, 0x20, 0x61, 0x6c, 0x69,
+  0x67, 0x6e, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x62,
+  0x61, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65,
+  0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x0a, 0x32, 0x38, 0x30, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x6e,
+  0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x32, 0x38, 0x31,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53,
+  0x63, 0x68, 0x65, 0x64, 0x75, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x73,
+  0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x32, 0x38, 0x32, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x6e,
+  0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x32, 0x38, 0x33,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53,
+  0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x67, 0x75, 0x6c,
+  0x61, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x0a, 0x32, 0x38, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20,
+  0x69, 0x72, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x20, 0x69, 0x6e,
+  0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x32, 0x38, 0x35,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x73,
+  0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x64, 0x61,
+  0x6d, 0x61, 0x67, 0x65, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x73, 0x0a,
+  0x32, 0x38, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20,
+  0x69, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x0a, 0x32, 0x38,
+  0x38, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4f, 0x76, 0x65, 0x72, 0x68, 0x61, 0x75, 0x6c, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x72, 0x65, 0x74, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6c, 0x65, 0x0a, 0x32, 0x38, 0x39,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x69, 0x6e, 0x67,
+  0x20, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x0a, 0x32, 0x39,
+  0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x69,
+  0x71, 0x75, 0x69, 0x64, 0x2f, 0x68, 0x61, 0x73, 0x0a, 0x32, 0x39, 0x32,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x69, 0x6c,
+  0x0a, 0x32, 0x39, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x6f, 0x78, 0x79, 0x67, 0x65, 0x6e, 0x0a, 0x32, 0x39, 0x34, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x69, 0x74, 0x72,
+  0x6f, 0x67, 0x65, 0x6e, 0x0a, 0x32, 0x39, 0x35, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x69, 0x72, 0x0a, 0x32, 0x39, 0x36,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x61, 0x74,
+  0x65, 0x72, 0x0a, 0x32, 0x39, 0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x68, 0x79, 0x64, 0x72, 0x6f, 0x67, 0x65, 0x6e, 0x0a,
+  0x32, 0x39, 0x38, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x71, 0x75, 0x69, 0x64,
+  0x0a, 0x32, 0x39, 0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x67, 0x61, 0x73, 0x0a, 0x33,
+  0x30, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x45, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x0a, 0x33, 0x30, 0x31, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d,
+  0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x78,
+  0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20,
+  0x74, 0x65, 0x73, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x73, 0x0a, 0x33, 0x30, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x0a, 0x33,
+  0x30, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70,
+  0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x0a, 0x33, 0x30, 0x34, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61,
+  0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x78,
+  0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20,
+  0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x73, 0x0a, 0x33, 0x30, 0x35, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65,
+  0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65,
+  0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x73, 0x0a, 0x33, 0x30, 0x36, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x0a,
+  0x33, 0x30, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x0a,
+  0x33, 0x31, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x56, 0x69, 0x73, 0x75, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x61,
+  0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x33, 0x31, 0x31,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56,
+  0x69, 0x73, 0x75, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x69, 0x6e,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75,
+  0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x33, 0x31, 0x32, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x78,
+  0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x61, 0x20, 0x62, 0x6f, 0x72, 0x65, 0x73, 0x63, 0x6f,
+  0x70, 0x65, 0x0a, 0x33, 0x31, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x51, 0x41, 0x20, 0x72, 0x65, 0x71, 0x75,
+  0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x33, 0x32, 0x30,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f,
+  0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x65, 0x73,
+  0x74, 0x0a, 0x33, 0x32, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x20, 0x62, 0x72, 0x65,
+  0x61, 0x6b, 0x2d, 0x69, 0x6e, 0x0a, 0x33, 0x32, 0x32, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x65, 0x73, 0x74,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x33, 0x33, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x70,
+  0x72, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x33,
+  0x33, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69,
+  0x70, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x33, 0x33, 0x32, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x6d, 0x6f,
+  0x76, 0x61, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20,
+  0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x33, 0x33,
+  0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6e, 0x69, 0x74,
+  0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x74, 0x65, 0x73, 0x74, 0x0a, 0x33, 0x33, 0x34, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76,
+  0x61, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6e,
+  0x69, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x0a, 0x33, 0x33, 0x35, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x69, 0x6e, 0x61,
+  0x6c, 0x20, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x73, 0x0a, 0x33,
+  0x34, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x0a, 0x33, 0x34, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x20,
+  0x74, 0x65, 0x73, 0x74, 0x0a, 0x33, 0x34, 0x32, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x75, 0x74, 0x6f, 0x6d,
+  0x61, 0x74, 0x69, 0x63, 0x20, 0x74, 0x65, 0x73, 0x74, 0x0a, 0x33, 0x34,
+  0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x42, 0x49, 0x54, 0x0a, 0x33, 0x34, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x61, 0x74,
+  0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x0a, 0x33, 0x34, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x0a, 0x33, 0x34, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x0a, 0x33, 0x34, 0x37, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74,
+  0x2d, 0x75, 0x70, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x65, 0x73, 0x74, 0x0a, 0x33,
+  0x34, 0x38, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x46, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70,
+  0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x28,
+  0x46, 0x41, 0x54, 0x29, 0x0a, 0x33, 0x34, 0x39, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20,
+  0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x73, 0x0a, 0x33, 0x35, 0x30, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74,
+  0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x0a, 0x33, 0x35, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x72, 0x61, 0x63,
+  0x6b, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x79, 0x65, 0x20,
+  0x70, 0x65, 0x6e, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x74, 0x0a, 0x33, 0x35,
+  0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x54, 0x65, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x75, 0x72,
+  0x66, 0x61, 0x63, 0x65, 0x20, 0x63, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x20,
+  0x77, 0x74, 0x68, 0x20, 0x6d, 0x61, 0x67, 0x6e, 0x65, 0x74, 0x69, 0x63,
+  0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x0a, 0x33,
+  0x35, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x72,
+  0x61, 0x63, 0x6b, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x65, 0x63, 0x74, 0x73, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x65, 0x64, 0x64, 0x79, 0x20, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x0a, 0x33, 0x35, 0x34, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x63, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66,
+  0x65, 0x63, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x58, 0x2d,
+  0x72, 0x61, 0x79, 0x73, 0x0a, 0x33, 0x35, 0x35, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x63, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66,
+  0x65, 0x63, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x75, 0x6c,
+  0x74, 0x72, 0x61, 0x73, 0x6f, 0x6e, 0x69, 0x63, 0x73, 0x0a, 0x33, 0x35,
+  0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x48, 0x61, 0x72, 0x64, 0x6e, 0x65, 0x73, 0x73, 0x20, 0x74, 0x65, 0x73,
+  0x74, 0x0a, 0x33, 0x35, 0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x47, 0x61, 0x6d, 0x6d, 0x61, 0x2d, 0x72, 0x61,
+  0x79, 0x20, 0x74, 0x65, 0x73, 0x74, 0x0a, 0x33, 0x35, 0x38, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x73,
+  0x6f, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x66, 0x72, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x63, 0x79, 0x20, 0x74, 0x65, 0x73, 0x74, 0x0a, 0x33, 0x35,
+  0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x54, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x69,
+  0x63, 0x20, 0x74, 0x65, 0x73, 0x74, 0x0a, 0x33, 0x36, 0x30, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x73,
+  0x69, 0x67, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2f, 0x74, 0x6f, 0x6c,
+  0x65, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x0a, 0x33, 0x36, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+  0x6e, 0x73, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x33, 0x36, 0x32,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50,
+  0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x0a, 0x33, 0x36, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x46, 0x6c, 0x6f, 0x77, 0x20, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x0a, 0x33, 0x36, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x65, 0x61, 0x6b, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x0a, 0x33, 0x36, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x69, 0x6e,
+  0x75, 0x69, 0x74, 0x79, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x33,
+  0x36, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x52, 0x65, 0x73, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x33, 0x36, 0x37, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x6c, 0x65, 0x63,
+  0x74, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x33, 0x36, 0x38, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x69, 0x67,
+  0x6e, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x6e, 0x67, 0x74, 0x68,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x33, 0x36, 0x39, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x74, 0x68,
+  0x65, 0x72, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x33, 0x37, 0x30,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d,
+  0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x33, 0x37, 0x31,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f,
+  0x69, 0x6c, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x79, 0x73, 0x69, 0x73, 0x0a,
+  0x33, 0x37, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x56, 0x69, 0x62, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x61, 0x6e, 0x61, 0x6c, 0x79, 0x73, 0x69, 0x73, 0x0a, 0x33, 0x37, 0x33,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54,
+  0x72, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x0a, 0x33, 0x37, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x46, 0x75, 0x65, 0x6c, 0x20, 0x61, 0x6e, 0x61,
+  0x6c, 0x79, 0x73, 0x69, 0x73, 0x0a, 0x33, 0x37, 0x35, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x68, 0x6f, 0x6f,
+  0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x63, 0x63, 0x69, 0x64, 0x65, 0x6e,
+  0x74, 0x61, 0x6c, 0x20, 0x64, 0x69, 0x73, 0x63, 0x68, 0x61, 0x72, 0x67,
+  0x65, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x79, 0x73, 0x69, 0x73, 0x0a, 0x33,
+  0x37, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x70, 0x6f, 0x73, 0x74, 0x20,
+  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x61, 0x64, 0x68, 0x65, 0x73, 0x69, 0x76, 0x65, 0x0a,
+  0x33, 0x37, 0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x79, 0x73, 0x69, 0x73,
+  0x0a, 0x33, 0x39, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x0a, 0x33, 0x39, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x73, 0x75, 0x72, 0x66,
+  0x61, 0x63, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x0a, 0x33, 0x39, 0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4c, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x67,
+  0x65, 0x61, 0x72, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x0a, 0x33, 0x39, 0x38, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x20, 0x63,
+  0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x0a, 0x34, 0x30, 0x30, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x72, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x73, 0x6f,
+  0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x73, 0x0a, 0x34, 0x30, 0x31, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62,
+  0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x69, 0x73, 0x0a,
+  0x34, 0x30, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61,
+  0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f,
+  0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f,
+  0x73, 0x69, 0x73, 0x0a, 0x34, 0x30, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65,
+  0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20,
+  0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x69, 0x73, 0x0a, 0x34, 0x30,
+  0x34, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63,
+  0x69, 0x61, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20,
+  0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f,
+  0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f,
+  0x73, 0x69, 0x73, 0x0a, 0x34, 0x30, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x69,
+  0x73, 0x0a, 0x34, 0x30, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6e,
+  0x6f, 0x73, 0x69, 0x73, 0x0a, 0x34, 0x30, 0x37, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x61, 0x72, 0x74, 0x73,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x69,
+  0x73, 0x0a, 0x34, 0x31, 0x30, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x34, 0x31, 0x31, 0x20, 0x20, 0x66,
+  0x61, 0x75, 0x6c, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x73, 0x6f, 0x6c,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0a, 0x34,
+  0x31, 0x32, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x44, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x0a, 0x34, 0x31, 0x33, 0x20, 0x20, 0x66, 0x61, 0x75,
+  0x6c, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x76,
+  0x65, 0x64, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0a, 0x34, 0x31, 0x34,
+  0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x6f, 0x72, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x0a, 0x34, 0x31, 0x35, 0x20, 0x20, 0x66, 0x61, 0x75,
+  0x6c, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x6d, 0x70, 0x61, 0x63, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0a, 0x34, 0x32,
+  0x30, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x34, 0x32,
+  0x31, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x0a, 0x34, 0x32, 0x32, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73,
+  0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x34, 0x32, 0x33, 0x20, 0x20, 0x66,
+  0x61, 0x75, 0x6c, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x61, 0x75, 0x6c,
+  0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x34, 0x32,
+  0x34, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x0a, 0x34, 0x32, 0x35, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73,
+  0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x34, 0x32, 0x36, 0x20, 0x20, 0x66,
+  0x61, 0x75, 0x6c, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x61, 0x75, 0x6c,
+  0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x34, 0x32,
+  0x37, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x0a, 0x34, 0x32, 0x38, 0x20, 0x20, 0x66, 0x61, 0x75, 0x6c, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x69, 0x73,
+  0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x34, 0x32, 0x39, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x61, 0x67,
+  0x6e, 0x6f, 0x73, 0x74, 0x69, 0x63, 0x73, 0x0a, 0x34, 0x33, 0x30, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x61,
+  0x75, 0x6c, 0x74, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x74, 0x61, 0x73, 0x6b, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x34,
+  0x34, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0a, 0x34, 0x34, 0x31, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x61, 0x75,
+  0x6c, 0x74, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x0a, 0x34, 0x34, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61,
+  0x6e, 0x63, 0x65, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x0a, 0x34, 0x34, 0x33, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x6f, 0x73, 0x74,
+  0x2d, 0x74, 0x72, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x73, 0x68, 0x6f, 0x6f,
+  0x74, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x68, 0x75, 0x74, 0x64, 0x6f, 0x77,
+  0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a,
+  0x35, 0x30, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x44, 0x69, 0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+  0x2c, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x64, 0x69, 0x73, 0x61, 0x73, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x79,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x0a,
+  0x35, 0x30, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73,
+  0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x0a, 0x35, 0x30,
+  0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65,
+  0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x0a, 0x35, 0x30, 0x33, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62,
+  0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f,
+  0x76, 0x61, 0x6c, 0x0a, 0x35, 0x30, 0x34, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x75,
+  0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c,
+  0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61,
+  0x6c, 0x0a, 0x35, 0x30, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69,
+  0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f,
+  0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f,
+  0x76, 0x61, 0x6c, 0x0a, 0x35, 0x30, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x0a, 0x35,
+  0x30, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x0a,
+  0x35, 0x31, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x44, 0x69, 0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x35,
+  0x32, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x35, 0x32, 0x31, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x61, 0x73, 0x69, 0x63, 0x20,
+  0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x0a, 0x35, 0x32, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x2f, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x35,
+  0x32, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x50, 0x72, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f,
+  0x76, 0x61, 0x6c, 0x0a, 0x35, 0x32, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x6f, 0x6c, 0x6c, 0x6f, 0x77,
+  0x2d, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61,
+  0x6e, 0x63, 0x65, 0x0a, 0x35, 0x32, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6d, 0x6d, 0x75, 0x6e, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x69,
+  0x6e, 0x67, 0x0a, 0x35, 0x32, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x65, 0x20, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x69, 0x6e,
+  0x67, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x0a, 0x35, 0x33, 0x30,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44,
+  0x69, 0x73, 0x61, 0x73, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x65, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x35, 0x33, 0x31,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44,
+  0x69, 0x73, 0x61, 0x73, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x65, 0x20, 0x6f,
+  0x6e, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x73, 0x69, 0x74, 0x65, 0x0a, 0x35, 0x34, 0x30, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x35, 0x35, 0x30,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
+  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61,
+  0x72, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65,
+  0x0a, 0x35, 0x35, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x46, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x6d, 0x6f, 0x6e,
+  0x69, 0x74, 0x6f, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x74, 0x6f, 0x72,
+  0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x75, 0x74, 0x20,
+  0x28, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67,
+  0x29, 0x0a, 0x35, 0x35, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x44, 0x61, 0x74, 0x61, 0x20, 0x65, 0x72, 0x61,
+  0x73, 0x69, 0x6e, 0x67, 0x0a, 0x35, 0x35, 0x33, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x73, 0x70, 0x6c,
+  0x61, 0x79, 0x2c, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x0a, 0x35, 0x36, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x0a, 0x35, 0x36, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x2d, 0x65, 0x6e, 0x65,
+  0x72, 0x67, 0x69, 0x7a, 0x65, 0x20, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x72,
+  0x69, 0x63, 0x61, 0x6c, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b,
+  0x0a, 0x35, 0x36, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x44, 0x65, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72,
+  0x69, 0x7a, 0x65, 0x20, 0x68, 0x79, 0x64, 0x72, 0x61, 0x75, 0x6c, 0x69,
+  0x63, 0x73, 0x0a, 0x35, 0x36, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65,
+  0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x70, 0x72, 0x61, 0x63, 0x74, 0x69,
+  0x63, 0x65, 0x0a, 0x36, 0x30, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x6c, 0x79,
+  0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x0a, 0x36, 0x30, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73, 0x0a,
+  0x36, 0x30, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61,
+  0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f,
+  0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73, 0x0a, 0x36, 0x30, 0x33, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64,
+  0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65,
+  0x70, 0x61, 0x69, 0x72, 0x73, 0x0a, 0x36, 0x30, 0x34, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20,
+  0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69,
+  0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f,
+  0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x61,
+  0x69, 0x72, 0x73, 0x0a, 0x36, 0x30, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65,
+  0x70, 0x61, 0x69, 0x72, 0x73, 0x0a, 0x36, 0x30, 0x36, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x73,
+  0x0a, 0x36, 0x30, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72,
+  0x73, 0x0a, 0x36, 0x31, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x41, 0x64, 0x64, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x0a, 0x36, 0x31, 0x31, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x6e, 0x73, 0x75, 0x6c,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x36, 0x31, 0x32, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x65, 0x74, 0x61,
+  0x6c, 0x69, 0x7a, 0x65, 0x0a, 0x36, 0x31, 0x33, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x6f, 0x74, 0x0a, 0x36,
+  0x31, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x52, 0x65, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x0a, 0x36, 0x31, 0x35,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52,
+  0x65, 0x74, 0x72, 0x65, 0x61, 0x64, 0x0a, 0x36, 0x32, 0x30, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x74, 0x74,
+  0x61, 0x63, 0x68, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c,
+  0x0a, 0x36, 0x32, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x42, 0x6f, 0x6e, 0x64, 0x0a, 0x36, 0x32, 0x32, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x72,
+  0x69, 0x6d, 0x70, 0x0a, 0x36, 0x32, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x72, 0x61, 0x7a, 0x65, 0x0a,
+  0x36, 0x32, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x52, 0x69, 0x76, 0x65, 0x74, 0x0a, 0x36, 0x32, 0x35, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x6f,
+  0x6c, 0x64, 0x65, 0x72, 0x0a, 0x36, 0x32, 0x36, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x70, 0x6c, 0x69, 0x63,
+  0x65, 0x0a, 0x36, 0x32, 0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x57, 0x65, 0x6c, 0x64, 0x0a, 0x36, 0x33, 0x30,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x65,
+  0x63, 0x68, 0x61, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x72,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x2f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+  0x75, 0x72, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72,
+  0x69, 0x61, 0x6c, 0x0a, 0x36, 0x33, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6e, 0x6e, 0x65, 0x61, 0x6c,
+  0x0a, 0x36, 0x33, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x61, 0x73, 0x65, 0x20, 0x68, 0x61, 0x72, 0x64,
+  0x65, 0x6e, 0x0a, 0x36, 0x33, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x75, 0x72, 0x65, 0x0a, 0x36, 0x33,
+  0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x0a, 0x36, 0x33,
+  0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x53, 0x68, 0x6f, 0x74, 0x2d, 0x70, 0x65, 0x65, 0x6e, 0x0a, 0x36, 0x33,
+  0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x54, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x0a, 0x36, 0x33, 0x38, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x74, 0x68,
+  0x65, 0x72, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x6d, 0x65, 0x6e, 0x74,
+  0x0a, 0x36, 0x33, 0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x65, 0x63, 0x68, 0x61,
+  0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x72, 0x65, 0x6e, 0x67,
+  0x74, 0x68, 0x2f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c,
+  0x0a, 0x36, 0x34, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x66, 0x69,
+  0x6e, 0x69, 0x73, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x0a, 0x36, 0x34, 0x31, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6e, 0x6f, 0x64, 0x69,
+  0x7a, 0x65, 0x0a, 0x36, 0x34, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x75, 0x66, 0x66, 0x0a, 0x36, 0x34,
+  0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x42, 0x75, 0x72, 0x6e, 0x69, 0x73, 0x68, 0x0a, 0x36, 0x34, 0x34, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68,
+  0x72, 0x6f, 0x6d, 0x61, 0x74, 0x65, 0x0a, 0x36, 0x34, 0x35, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x6f, 0x6e,
+  0x65, 0x0a, 0x36, 0x34, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4c, 0x61, 0x70, 0x0a, 0x36, 0x34, 0x37, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x6c,
+  0x61, 0x74, 0x65, 0x0a, 0x36, 0x34, 0x38, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68,
+  0x0a, 0x36, 0x34, 0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x75, 0x70, 0x20, 0x6f,
+  0x66, 0x20, 0x64, 0x65, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x63, 0x72, 0x61,
+  0x63, 0x6b, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x63, 0x72, 0x61,
+  0x74, 0x63, 0x68, 0x65, 0x73, 0x0a, 0x36, 0x35, 0x30, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x0a,
+  0x36, 0x35, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x41, 0x62, 0x72, 0x61, 0x73, 0x69, 0x76, 0x65, 0x20, 0x62,
+  0x6c, 0x61, 0x73, 0x74, 0x0a, 0x36, 0x35, 0x32, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x6f, 0x72, 0x65, 0x2f,
+  0x64, 0x72, 0x69, 0x6c, 0x6c, 0x2f, 0x72, 0x65, 0x61, 0x6d, 0x0a, 0x36,
+  0x35, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x45, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x2f,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x6f, 0x63, 0x68, 0x65, 0x6d, 0x69,
+  0x63, 0x61, 0x6c, 0x2f, 0x63, 0x68, 0x65, 0x6d, 0x69, 0x63, 0x61, 0x6c,
+  0x20, 0x65, 0x74, 0x63, 0x68, 0x0a, 0x36, 0x35, 0x34, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x72, 0x6f, 0x61,
+  0x63, 0x68, 0x0a, 0x36, 0x35, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x72, 0x69, 0x6e, 0x64, 0x0a, 0x36,
+  0x35, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4d, 0x69, 0x6c, 0x6c, 0x0a, 0x36, 0x35, 0x37, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x72, 0x65,
+  0x61, 0x64, 0x2f, 0x74, 0x61, 0x70, 0x0a, 0x36, 0x35, 0x38, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x75, 0x72,
+  0x6e, 0x0a, 0x36, 0x35, 0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d,
+  0x6f, 0x76, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c,
+  0x0a, 0x36, 0x36, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x0a, 0x36, 0x36, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6c, 0x6c, 0x6f, 0x77, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x0a, 0x36, 0x36,
+  0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x54, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x79, 0x20, 0x72, 0x65,
+  0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x0a, 0x36, 0x36, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72,
+  0x64, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x36, 0x36, 0x34, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x70, 0x65,
+  0x63, 0x69, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x36, 0x36,
+  0x35, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x46, 0x6c, 0x79, 0x2d, 0x69, 0x6e, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69,
+  0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a,
+  0x36, 0x36, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x0a, 0x36, 0x36, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+  0x65, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x36, 0x36, 0x38, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6c, 0x6c, 0x6f, 0x77,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x65,
+  0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x73, 0x0a,
+  0x36, 0x36, 0x39, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x41, 0x6c, 0x6c, 0x6f, 0x77, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x64, 0x61, 0x6d, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6d,
+  0x69, 0x78, 0x65, 0x64, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+  0x72, 0x65, 0x73, 0x0a, 0x36, 0x37, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x6c,
+  0x79, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x0a, 0x36, 0x37, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x6f,
+  0x66, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x0a, 0x36, 0x38, 0x30, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x61,
+  0x74, 0x74, 0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x6e, 0x67, 0x65,
+  0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x0a, 0x36, 0x38, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20,
+  0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x73, 0x79, 0x6d, 0x62, 0x6f,
+  0x6c, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x36, 0x38,
+  0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x49, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67, 0x65,
+  0x64, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x0a, 0x36,
+  0x38, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x44, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x61, 0x73, 0x73, 0x65,
+  0x73, 0x73, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x36, 0x38, 0x34, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x74, 0x69,
+  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x67,
+  0x72, 0x61, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x36, 0x38, 0x35,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52,
+  0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x0a, 0x36, 0x38, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x73, 0x6f, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x0a, 0x36, 0x38, 0x37, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20,
+  0x62, 0x61, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x6e,
+  0x67, 0x65, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x0a, 0x36, 0x38,
+  0x38, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x42, 0x61, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x64, 0x61, 0x6d, 0x61, 0x67,
+  0x65, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 0x20, 0x6b, 0x69, 0x74,
+  0x0a, 0x36, 0x38, 0x39, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x44, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65,
+  0x70, 0x61, 0x69, 0x72, 0x0a, 0x36, 0x39, 0x30, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65,
+  0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x0a, 0x36, 0x39, 0x31,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d,
+  0x61, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x36, 0x39, 0x32, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e,
+  0x6e, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69,
+  0x72, 0x0a, 0x36, 0x39, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x56, 0x61, 0x72, 0x6e, 0x69, 0x73, 0x68, 0x0a,
+  0x37, 0x30, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x41, 0x73, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x65, 0x2c, 0x20,
+  0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x0a, 0x37, 0x30, 0x31, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61,
+  0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x73,
+  0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x37, 0x30,
+  0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e,
+  0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x37,
+  0x30, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x78, 0x70,
+  0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x0a, 0x37, 0x30, 0x34, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x70,
+  0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x37, 0x30, 0x35, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65,
+  0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69,
+  0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x37, 0x30, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f,
+  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69,
+  0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x37, 0x30, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x50, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x37, 0x31, 0x30, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x73, 0x73, 0x65,
+  0x6d, 0x62, 0x6c, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x0a, 0x37, 0x31, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x69, 0x67, 0x68, 0x74, 0x65, 0x6e,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x37,
+  0x31, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4c, 0x6f, 0x63, 0x6b, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x0a, 0x37, 0x31, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x61, 0x63, 0x6b, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x37, 0x31, 0x34,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41,
+  0x73, 0x73, 0x65, 0x6d, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x6f,
+  0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x69, 0x74,
+  0x65, 0x0a, 0x37, 0x32, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x37, 0x32,
+  0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6f, 0x20,
+  0x75, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69,
+  0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x37, 0x32, 0x32,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49,
+  0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74,
+  0x2f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x6e, 0x20,
+  0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69,
+  0x70, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x37, 0x32, 0x33, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x65, 0x70,
+  0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x65, 0x66, 0x6f,
+  0x72, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x37, 0x32, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x6f, 0x6c, 0x6c, 0x6f, 0x77,
+  0x2d, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61,
+  0x6e, 0x63, 0x65, 0x0a, 0x37, 0x32, 0x35, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6d, 0x6d, 0x75, 0x6e, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67,
+  0x0a, 0x37, 0x32, 0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20,
+  0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x65,
+  0x76, 0x69, 0x63, 0x65, 0x0a, 0x37, 0x32, 0x37, 0x20, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x69, 0x74, 0x65, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x6c, 0x61,
+  0x6e, 0x73, 0x0a, 0x37, 0x32, 0x38, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x37, 0x33, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+  0x74, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a,
+  0x37, 0x34, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x43, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x61, 0x66, 0x74, 0x65,
+  0x72, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x37, 0x35, 0x30, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x6f, 0x61,
+  0x64, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x37, 0x35, 0x32,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44,
+  0x61, 0x74, 0x61, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x0a,
+  0x37, 0x36, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x52, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65,
+  0x0a, 0x37, 0x36, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x45, 0x6e, 0x65, 0x72, 0x67, 0x69, 0x7a, 0x65, 0x20,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6e,
+  0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x0a, 0x37, 0x36, 0x32, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x65,
+  0x73, 0x73, 0x75, 0x72, 0x69, 0x7a, 0x65, 0x20, 0x68, 0x79, 0x64, 0x72,
+  0x61, 0x75, 0x6c, 0x69, 0x63, 0x73, 0x0a, 0x38, 0x30, 0x30, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x61, 0x63,
+  0x6b, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x69,
+  0x6e, 0x67, 0x2c, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72,
+  0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x38, 0x30, 0x31, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61,
+  0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x74, 0x6f,
+  0x72, 0x61, 0x67, 0x65, 0x0a, 0x38, 0x30, 0x32, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
+  0x0a, 0x38, 0x30, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65,
+  0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x0a, 0x38,
+  0x30, 0x34, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x65,
+  0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x0a, 0x38, 0x30, 0x35,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x0a, 0x38,
+  0x30, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66,
+  0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x74,
+  0x6f, 0x72, 0x61, 0x67, 0x65, 0x0a, 0x38, 0x30, 0x37, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x61, 0x72, 0x74,
+  0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73,
+  0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x0a, 0x38, 0x31, 0x30, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x65,
+  0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x38, 0x31, 0x31, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72,
+  0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x76, 0x65, 0x68, 0x69, 0x63, 0x6c, 0x65, 0x20, 0x74, 0x72,
+  0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x0a, 0x38, 0x31, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x68, 0x69, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x20,
+  0x2d, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x0a, 0x38, 0x32,
+  0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x50, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f,
+  0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73,
+  0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x74,
+  0x65, 0x72, 0x69, 0x61, 0x6c, 0x0a, 0x38, 0x33, 0x30, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x75, 0x74,
+  0x20, 0x69, 0x74, 0x65, 0x6d, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x73, 0x0a, 0x38, 0x33, 0x31, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56, 0x65,
+  0x68, 0x69, 0x63, 0x6c, 0x65, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e,
+  0x67, 0x0a, 0x38, 0x33, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72,
+  0x65, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x69, 0x74,
+  0x65, 0x6d, 0x73, 0x0a, 0x38, 0x34, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x73, 0x0a, 0x38,
+  0x34, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x56, 0x65, 0x68, 0x69, 0x63, 0x6c, 0x65, 0x20, 0x75, 0x6e, 0x6c,
+  0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x0a, 0x38, 0x34, 0x32, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x6e,
+  0x70, 0x61, 0x63, 0x6b, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x0a, 0x38,
+  0x35, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x74,
+  0x6f, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x20,
+  0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x74, 0x6f, 0x72,
+  0x61, 0x67, 0x65, 0x0a, 0x38, 0x36, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x64,
+  0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x69, 0x74, 0x65, 0x6d, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x6e,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x0a, 0x38, 0x37, 0x30,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20,
+  0x70, 0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x20, 0x69, 0x74, 0x65, 0x6d,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x61, 0x66, 0x74,
+  0x65, 0x72, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x0a, 0x38,
+  0x37, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x53, 0x65, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x64,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x38, 0x38, 0x30, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x75, 0x72, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x69,
+  0x74, 0x65, 0x6d, 0x20, 0x67, 0x6f, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x0a, 0x38,
+  0x39, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4c, 0x69, 0x66, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6f,
+  0x66, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20,
+  0x69, 0x6e, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x0a, 0x39,
+  0x30, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f,
+  0x75, 0x73, 0x0a, 0x39, 0x30, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c,
+  0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61, 0x62, 0x6c,
+  0x65, 0x73, 0x0a, 0x39, 0x30, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c,
+  0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x73,
+  0x0a, 0x39, 0x30, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e,
+  0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x65, 0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73,
+  0x0a, 0x39, 0x30, 0x34, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e,
+  0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x75, 0x70,
+  0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73,
+  0x0a, 0x39, 0x30, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e,
+  0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75,
+  0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+  0x6f, 0x6f, 0x6c, 0x73, 0x0a, 0x39, 0x30, 0x36, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65,
+  0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+  0x65, 0x0a, 0x39, 0x30, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61,
+  0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x0a, 0x39, 0x31, 0x30, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65,
+  0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x0a, 0x39, 0x31, 0x31,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49,
+  0x6c, 0x6c, 0x75, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x39, 0x31, 0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x48, 0x61, 0x6e, 0x64, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x0a, 0x39, 0x31, 0x33,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47,
+  0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74,
+  0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x75, 0x72, 0x65, 0x0a, 0x39, 0x31, 0x34, 0x20, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x61,
+  0x69, 0x6e, 0x65, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6d, 0x6f,
+  0x64, 0x75, 0x6c, 0x65, 0x0a, 0x39, 0x31, 0x35, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x61, 0x63, 0x69, 0x6c,
+  0x69, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x39, 0x31, 0x36, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x69, 0x6e,
+  0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x6f,
+  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x39, 0x31, 0x37, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x6e,
+  0x2d, 0x53, 0x31, 0x30, 0x30, 0x30, 0x44, 0x20, 0x70, 0x75, 0x62, 0x6c,
+  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x39, 0x32, 0x30, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x20, 0x3d, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c,
+  0x6c, 0x0a, 0x39, 0x32, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x3d,
+  0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x20, 0x6e, 0x65,
+  0x77, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x0a, 0x39, 0x32, 0x32, 0x20, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x20, 0x3d, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64,
+  0x20, 0x69, 0x74, 0x65, 0x6d, 0x0a, 0x39, 0x33, 0x30, 0x20, 0x20, 0x73,
+  0x62, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x72, 0x76,
+  0x69, 0x63, 0x65, 0x20, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74, 0x69, 0x6e,
+  0x0a, 0x39, 0x33, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x20, 0x62,
+  0x75, 0x6c, 0x6c, 0x65, 0x74, 0x69, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x0a, 0x39, 0x33, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x50, 0x6c, 0x61, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20,
+  0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x39, 0x33, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x41, 0x63, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x69, 0x73, 0x68,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75,
+  0x72, 0x65, 0x20, 0x2d, 0x20, 0x54, 0x61, 0x73, 0x6b, 0x20, 0x73, 0x65,
+  0x74, 0x0a, 0x39, 0x33, 0x34, 0x20, 0x20, 0x73, 0x62, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c,
+  0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x0a, 0x39, 0x34, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e,
+  0x69, 0x6e, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x39, 0x34, 0x31,
+  0x20, 0x20, 0x69, 0x70, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49,
+  0x6c, 0x6c, 0x75, 0x73, 0x74, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x70,
+  0x61, 0x72, 0x74, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x39, 0x34,
+  0x32, 0x20, 0x20, 0x69, 0x70, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x0a, 0x39, 0x35, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x73,
+  0x69, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x39, 0x35, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x73, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x69,
+  0x63, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x0a, 0x39, 0x35,
+  0x32, 0x20, 0x20, 0x6c, 0x65, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x47, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x20, 0x6c, 0x65, 0x61, 0x72,
+  0x6e, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+  0x0a, 0x39, 0x36, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x61, 0x6c, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x68, 0x65, 0x65, 0x74,
+  0x73, 0x0a, 0x39, 0x37, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x41, 0x70, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x64,
+  0x20, 0x76, 0x65, 0x6e, 0x64, 0x6f, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x73, 0x73, 0x65, 0x73, 0x0a, 0x39, 0x38, 0x30, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x6e, 0x76, 0x69,
+  0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x6d, 0x61, 0x6c, 0x20, 0x70,
+  0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x66,
+  0x69, 0x72, 0x65, 0x2d, 0x66, 0x69, 0x67, 0x68, 0x74, 0x69, 0x6e, 0x67,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x73, 0x63, 0x75, 0x65, 0x0a,
+  0x39, 0x38, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x41, 0x69, 0x72, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0x69,
+  0x6e, 0x67, 0x0a, 0x39, 0x38, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x77, 0x61, 0x67, 0x65, 0x20,
+  0x74, 0x72, 0x65, 0x61, 0x74, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x39, 0x38,
+  0x39, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x46, 0x69, 0x72, 0x65, 0x2d, 0x66, 0x69, 0x67, 0x68, 0x74, 0x69, 0x6e,
+  0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x73, 0x63, 0x75, 0x65,
+  0x0a, 0x39, 0x39, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4e, 0x65, 0x75, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x7a,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x69,
+  0x73, 0x70, 0x6f, 0x73, 0x61, 0x6c, 0x0a, 0x39, 0x39, 0x31, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x65, 0x75,
+  0x74, 0x72, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x6f, 0x72, 0x64, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x0a,
+  0x39, 0x39, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x4e, 0x65, 0x75, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x7a, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x62, 0x73,
+  0x74, 0x61, 0x6e, 0x63, 0x65, 0x0a, 0x39, 0x39, 0x36, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x73, 0x70,
+  0x6f, 0x73, 0x61, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x72, 0x64, 0x6e,
+  0x61, 0x6e, 0x63, 0x65, 0x0a, 0x39, 0x39, 0x37, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x73, 0x70, 0x6f,
+  0x73, 0x61, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x75,
+  0x63, 0x74, 0x0a, 0x39, 0x39, 0x38, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x73, 0x70, 0x6f, 0x73, 0x61,
+  0x6c, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x61, 0x6e,
+  0x63, 0x65, 0x0a, 0x43, 0x30, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65,
+  0x72, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73,
+  0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x0a, 0x43, 0x30, 0x31, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65,
+  0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6d, 0x61,
+  0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d,
+  0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d,
+  0x73, 0x2c, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x43, 0x30, 0x32,
+  0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d,
+  0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74,
+  0x65, 0x72, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63,
+  0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x73, 0x79, 0x73, 0x74,
+  0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+  0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x43,
+  0x30, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f,
+  0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x65,
+  0x78, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20,
+  0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x66,
+  0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x0a, 0x43, 0x30, 0x34, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c,
+  0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f,
+  0x6c, 0x73, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65,
+  0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75,
+  0x74, 0x65, 0x72, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c,
+  0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x43, 0x30, 0x35, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73,
+  0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c,
+  0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x20, 0x65, 0x71, 0x75, 0x69, 0x70, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20,
+  0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x66,
+  0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x0a, 0x43, 0x30, 0x36, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c,
+  0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72,
+  0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73, 0x6f,
+  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x0a, 0x43, 0x30, 0x37, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c,
+  0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74,
+  0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
+  0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63,
+  0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x73, 0x79, 0x73, 0x74,
+  0x65, 0x6d, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+  0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x43,
+  0x31, 0x33, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x0a, 0x43, 0x31, 0x34, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f,
+  0x62, 0x6c, 0x65, 0x6d, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x69, 0x6e,
+  0x67, 0x0a, 0x43, 0x31, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x20,
+  0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x0a, 0x43,
+  0x32, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x61, 0x64, 0x6d, 0x69,
+  0x6e, 0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x43,
+  0x32, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x6d, 0x6f, 0x6e, 0x69,
+  0x74, 0x6f, 0x72, 0x69, 0x6e, 0x67, 0x0a, 0x43, 0x32, 0x32, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x0a, 0x43, 0x32, 0x33, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f,
+  0x6e, 0x6e, 0x65, 0x63, 0x74, 0x20, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61,
+  0x72, 0x65, 0x0a, 0x43, 0x32, 0x35, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20,
+  0x72, 0x65, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x79, 0x0a, 0x43, 0x32, 0x36,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42,
+  0x61, 0x63, 0x6b, 0x75, 0x70, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65,
+  0x73, 0x74, 0x6f, 0x72, 0x65, 0x0a, 0x43, 0x32, 0x37, 0x20, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x62, 0x6f,
+  0x6f, 0x74, 0x0a, 0x43, 0x33, 0x30, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e,
+  0x61, 0x74, 0x65, 0x0a, 0x43, 0x33, 0x31, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x66, 0x72, 0x61, 0x67,
+  0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x43, 0x33,
+  0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x2f, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x20, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x0a, 0x43, 0x33, 0x33, 0x20, 0x20,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x73,
+  0x6b, 0x20, 0x6d, 0x69, 0x72, 0x72, 0x6f, 0x72, 0x69, 0x6e, 0x67, 0x0a,
+  0x43, 0x33, 0x34, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x43, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x0a, 0x43, 0x33, 0x35,
+  0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54,
+  0x69, 0x6d, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x43, 0x33,
+  0x36, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x43, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74,
+  0x79, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x43, 0x35, 0x30, 0x20,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x61,
+  0x6e, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x43, 0x35,
+  0x31, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4d, 0x6f, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x43, 0x35,
+  0x32, 0x20, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4d, 0x61, 0x6e, 0x69, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x2f, 0x55,
+  0x73, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x43, 0x35, 0x33, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66,
+  0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67,
+  0x65, 0x0a, 0x43, 0x36, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x6d,
+  0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x43, 0x36, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61,
+  0x6d, 0x20, 0x66, 0x6c, 0x6f, 0x77, 0x20, 0x63, 0x68, 0x61, 0x72, 0x74,
+  0x0a, 0x43, 0x36, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6e,
+  0x67, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20,
+  0x67, 0x75, 0x69, 0x64, 0x65, 0x0a, 0x43, 0x37, 0x30, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x63, 0x75,
+  0x72, 0x69, 0x74, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x72, 0x69,
+  0x76, 0x61, 0x63, 0x79, 0x0a, 0x43, 0x37, 0x32, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x63, 0x75, 0x72,
+  0x69, 0x74, 0x79, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x43, 0x37, 0x33, 0x20, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x63, 0x75, 0x72, 0x69,
+  0x74, 0x79, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65,
+  0x73, 0x0a, 0x43, 0x37, 0x34, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 0x2f, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x63, 0x6f, 0x64, 0x65, 0x73, 0x0a, 0x43, 0x37, 0x35, 0x20, 0x20, 0x64,
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x63, 0x63, 0x65,
+  0x73, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x0a, 0x43,
+  0x39, 0x30, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f,
+  0x75, 0x73, 0x0a, 0x43, 0x39, 0x31, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x51, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79,
+  0x20, 0x61, 0x73, 0x73, 0x75, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x0a, 0x43,
+  0x39, 0x32, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x56, 0x65, 0x6e, 0x64, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+  0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x43, 0x39, 0x35, 0x20,
+  0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x61,
+  0x6d, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x6e, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x43, 0x39, 0x36, 0x20, 0x20, 0x64, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x65, 0x63, 0x68, 0x6e,
+  0x69, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a
+};
+unsigned int dmtypes_txt_len = 30702;
@@ -0,0 +1,537 @@
+unsigned char elems_csn_txt[] = {
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61, 0x6c, 0x74, 0x65,
+  0x72, 0x65, 0x64, 0x46, 0x72, 0x6f, 0x6d, 0x50, 0x61, 0x72, 0x74, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64,
+  0x53, 0x70, 0x61, 0x72, 0x65, 0x44, 0x65, 0x73, 0x63, 0x72, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x53,
+  0x75, 0x70, 0x70, 0x6c, 0x79, 0x44, 0x65, 0x73, 0x63, 0x72, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x53,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x45, 0x71, 0x75, 0x69, 0x70, 0x44,
+  0x65, 0x73, 0x63, 0x72, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x71, 0x75,
+  0x69, 0x70, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x68, 0x6f, 0x74, 0x73, 0x70,
+  0x6f, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x69, 0x63, 0x6e, 0x4f, 0x62,
+  0x6a, 0x65, 0x63, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x46, 0x61, 0x62, 0x72, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x4d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x6c, 0x72, 0x75, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x6f, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64,
+  0x53, 0x70, 0x61, 0x72, 0x65, 0x50, 0x61, 0x72, 0x74, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x72, 0x65, 0x66, 0x65, 0x72, 0x54, 0x6f, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x64, 0x42, 0x79,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x73, 0x62, 0x41, 0x6c, 0x74, 0x65, 0x72,
+  0x65, 0x64, 0x54, 0x6f, 0x50, 0x61, 0x72, 0x74, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x3a, 0x73, 0x62, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x53, 0x70,
+  0x61, 0x72, 0x65, 0x44, 0x65, 0x73, 0x63, 0x72, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x3a, 0x73, 0x70, 0x61, 0x72, 0x65, 0x44, 0x65, 0x73, 0x63, 0x72, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x73, 0x72, 0x75, 0x2f, 0x74, 0x65, 0x78, 0x74,
+  0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61,
+  0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a,
+  0x73, 0x75, 0x70, 0x70, 0x6c, 0x79, 0x44, 0x65, 0x73, 0x63, 0x72, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x45,
+  0x71, 0x75, 0x69, 0x70, 0x44, 0x65, 0x73, 0x63, 0x72, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x0a
+};
+unsigned int elems_csn_txt_len = 797;
+unsigned char elems_dmc_txt[] = {
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61, 0x63, 0x74, 0x72, 0x65,
+  0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
+  0x43, 0x72, 0x6f, 0x73, 0x73, 0x52, 0x65, 0x66, 0x54, 0x61, 0x62, 0x6c,
+  0x65, 0x52, 0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x69, 0x63, 0x52, 0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61,
+  0x73, 0x73, 0x6f, 0x63, 0x57, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x4d,
+  0x61, 0x6c, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e,
+  0x4c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x50, 0x61, 0x72, 0x61,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x62, 0x69, 0x74, 0x4d, 0x65, 0x73, 0x73,
+  0x61, 0x67, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a,
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x62, 0x72, 0x44, 0x65,
+  0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x54,
+  0x65, 0x78, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a,
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x62, 0x72, 0x65, 0x78,
+  0x44, 0x6d, 0x52, 0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x62, 0x72,
+  0x65, 0x78, 0x72, 0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x61,
+  0x70, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x61,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x65, 0x78, 0x74, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x63, 0x61, 0x73, 0x65, 0x43, 0x6f, 0x6e, 0x64, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x63, 0x61, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x52, 0x65,
+  0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x63, 0x74, 0x72, 0x65, 0x66,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x49, 0x6e,
+  0x6c, 0x69, 0x6e, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x6c, 0x6f,
+  0x73, 0x65, 0x74, 0x78, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x6f,
+  0x6e, 0x64, 0x43, 0x72, 0x6f, 0x73, 0x73, 0x52, 0x65, 0x66, 0x54, 0x61,
+  0x62, 0x6c, 0x65, 0x52, 0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63,
+  0x6f, 0x6e, 0x64, 0x69, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x6f,
+  0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x41, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x69,
+  0x74, 0x79, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x72,
+  0x69, 0x67, 0x68, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x6f, 0x70,
+  0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x50, 0x61, 0x72, 0x61, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x64, 0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x69, 0x74,
+  0x6c, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x6d, 0x45, 0x6e, 0x74,
+  0x72, 0x79, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x6d, 0x6c, 0x45, 0x6e,
+  0x74, 0x72, 0x79, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a,
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x6d, 0x4e, 0x6f,
+  0x64, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x6d, 0x2d, 0x6e, 0x6f,
+  0x64, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x6d, 0x52, 0x65, 0x66,
+  0x47, 0x72, 0x6f, 0x75, 0x70, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x6d,
+  0x70, 0x68, 0x61, 0x73, 0x69, 0x73, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x65,
+  0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x52, 0x65, 0x66,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x52, 0x65, 0x67,
+  0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x53, 0x74, 0x6d,
+  0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x78, 0x70, 0x73, 0x74, 0x61,
+  0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x66,
+  0x72, 0x6f, 0x6e, 0x74, 0x4d, 0x61, 0x74, 0x74, 0x65, 0x72, 0x44, 0x6d,
+  0x45, 0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x50, 0x68, 0x79, 0x73,
+  0x69, 0x63, 0x61, 0x6c, 0x41, 0x72, 0x65, 0x61, 0x52, 0x65, 0x66, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x68, 0x6f, 0x74, 0x73, 0x70, 0x6f, 0x74, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x69, 0x63, 0x6e, 0x4f, 0x62, 0x6a, 0x65, 0x63,
+  0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x69, 0x74, 0x65, 0x6d, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x6c, 0x63, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x69,
+  0x76, 0x65, 0x49, 0x74, 0x65, 0x6d, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x6c,
+  0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x44, 0x65, 0x66, 0x69, 0x6e,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x6c, 0x69,
+  0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x54, 0x65, 0x72, 0x6d, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x53,
+  0x65, 0x74, 0x52, 0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x6d, 0x73,
+  0x67, 0x64, 0x65, 0x73, 0x63, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x6e, 0x6f,
+  0x74, 0x65, 0x50, 0x61, 0x72, 0x61, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x6f,
+  0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x72,
+  0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x70, 0x63, 0x74, 0x72, 0x65, 0x66, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x70, 0x6d, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x70, 0x6d, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x43, 0x72,
+  0x6f, 0x73, 0x73, 0x52, 0x65, 0x66, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x52,
+  0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x65, 0x61, 0x73, 0x6f,
+  0x6e, 0x46, 0x6f, 0x72, 0x41, 0x6d, 0x65, 0x6e, 0x64, 0x6d, 0x65, 0x6e,
+  0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x65, 0x66, 0x64, 0x6d, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x65, 0x66, 0x73, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x3a, 0x72, 0x65, 0x71, 0x43, 0x6f, 0x6e, 0x64, 0x44, 0x6d, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x72, 0x65, 0x71, 0x63, 0x6f, 0x6e, 0x64, 0x6d, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x65, 0x71, 0x54, 0x65, 0x63, 0x68, 0x49,
+  0x6e, 0x66, 0x6f, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a,
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x66, 0x61, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x71, 0x6d, 0x74, 0x53, 0x6f, 0x75, 0x72,
+  0x63, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x73, 0x63, 0x6f, 0x45, 0x6e,
+  0x74, 0x72, 0x79, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x73, 0x63, 0x6f, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x49,
+  0x74, 0x65, 0x6d, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a,
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x73, 0x69, 0x6d, 0x70,
+  0x6c, 0x65, 0x52, 0x65, 0x66, 0x50, 0x61, 0x72, 0x61, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x44, 0x6f, 0x63, 0x52,
+  0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x74, 0x65, 0x72, 0x6d, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x74, 0x65, 0x72, 0x6d, 0x54, 0x69, 0x74, 0x6c,
+  0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x74, 0x6f, 0x63, 0x45, 0x6e, 0x74, 0x72, 0x79,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x74, 0x72, 0x61, 0x69, 0x6e, 0x69, 0x6e,
+  0x67, 0x53, 0x74, 0x65, 0x70, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74,
+  0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x77, 0x61,
+  0x72, 0x6e, 0x69, 0x6e, 0x67, 0x41, 0x6e, 0x64, 0x43, 0x61, 0x75, 0x74,
+  0x69, 0x6f, 0x6e, 0x50, 0x61, 0x72, 0x61, 0x2f, 0x74, 0x65, 0x78, 0x74,
+  0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61,
+  0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a,
+  0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x4d, 0x61, 0x6c, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x77,
+  0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x52, 0x65, 0x66, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x77, 0x6d, 0x6c, 0x66, 0x32, 0x64, 0x65, 0x73, 0x63, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x77, 0x6d, 0x6c, 0x66, 0x64, 0x65, 0x73, 0x63,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x0a
+};
+unsigned int elems_dmc_txt_len = 2948;
+unsigned char elems_dml_txt[] = {
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x6d, 0x6c, 0x45,
+  0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x6d, 0x6c,
+  0x52, 0x65, 0x66, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x3a, 0x64, 0x6d, 0x6c, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x0a
+};
+unsigned int elems_dml_txt_len = 114;
+unsigned char elems_epr_txt[] = {
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61, 0x74, 0x74, 0x65, 0x6e,
+  0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d,
+  0x50, 0x61, 0x72, 0x61, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x62, 0x72, 0x44,
+  0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x50, 0x6f, 0x69, 0x6e, 0x74,
+  0x54, 0x65, 0x78, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x61, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x54, 0x65, 0x78, 0x74, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x3a, 0x63, 0x61, 0x73, 0x65, 0x43, 0x6f, 0x6e, 0x64, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x49, 0x6e, 0x6c, 0x69,
+  0x6e, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x69, 0x74, 0x6c, 0x65, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x65, 0x6d, 0x70, 0x68, 0x61, 0x73, 0x69, 0x73, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x53, 0x63,
+  0x6f, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x4d,
+  0x61, 0x74, 0x74, 0x65, 0x72, 0x45, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x61,
+  0x6c, 0x50, 0x75, 0x62, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x44, 0x65,
+  0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x3a, 0x6c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x54, 0x65, 0x72,
+  0x6d, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x6e, 0x6f, 0x74, 0x65, 0x50, 0x61,
+  0x72, 0x61, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x70, 0x6d, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x65, 0x61, 0x73, 0x6f, 0x6e, 0x46, 0x6f,
+  0x72, 0x41, 0x6d, 0x65, 0x6e, 0x64, 0x6d, 0x65, 0x6e, 0x74, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x72, 0x65, 0x66, 0x73, 0x2f, 0x74, 0x65, 0x78, 0x74,
+  0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61,
+  0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a,
+  0x72, 0x65, 0x71, 0x43, 0x6f, 0x6e, 0x64, 0x45, 0x78, 0x74, 0x65, 0x72,
+  0x6e, 0x61, 0x6c, 0x50, 0x75, 0x62, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x72,
+  0x65, 0x71, 0x54, 0x65, 0x63, 0x68, 0x49, 0x6e, 0x66, 0x6f, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x72, 0x71, 0x6d, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63,
+  0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65,
+  0x52, 0x65, 0x66, 0x50, 0x61, 0x72, 0x61, 0x2f, 0x74, 0x65, 0x78, 0x74,
+  0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61,
+  0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a,
+  0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x44, 0x6f, 0x63, 0x52, 0x65, 0x66,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x74, 0x65, 0x72, 0x6d, 0x54, 0x69, 0x74,
+  0x6c, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x74, 0x69, 0x74, 0x6c, 0x65,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x74, 0x6f, 0x63, 0x45, 0x6e, 0x74, 0x72,
+  0x79, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e,
+  0x67, 0x41, 0x6e, 0x64, 0x43, 0x61, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x50,
+  0x61, 0x72, 0x61, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x0a
+};
+unsigned int elems_epr_txt_len = 1103;
+unsigned char elems_icn_txt[] = {
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x6d, 0x6c, 0x45,
+  0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x0a
+};
+unsigned int elems_icn_txt_len = 36;
+unsigned char elems_pmc_txt[] = {
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x61, 0x74, 0x74, 0x65, 0x6e,
+  0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d,
+  0x50, 0x61, 0x72, 0x61, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x62, 0x72, 0x44,
+  0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x50, 0x6f, 0x69, 0x6e, 0x74,
+  0x54, 0x65, 0x78, 0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x63, 0x61, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x54, 0x65, 0x78, 0x74, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x3a, 0x63, 0x61, 0x73, 0x65, 0x43, 0x6f, 0x6e, 0x64, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x49, 0x6e, 0x6c, 0x69,
+  0x6e, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x69, 0x74, 0x6c, 0x65, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x64, 0x6d, 0x6c, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x6d, 0x70, 0x68, 0x61, 0x73, 0x69, 0x73,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x4d, 0x61, 0x74, 0x74,
+  0x65, 0x72, 0x50, 0x6d, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66,
+  0x3a, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x44, 0x65,
+  0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x3a, 0x6c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x54, 0x65, 0x72,
+  0x6d, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x6e, 0x6f, 0x74, 0x65, 0x50, 0x61,
+  0x72, 0x61, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x70, 0x6d, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63,
+  0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x3a, 0x70, 0x6d, 0x52, 0x65, 0x66, 0x47, 0x72, 0x6f,
+  0x75, 0x70, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64,
+  0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72,
+  0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x65, 0x61, 0x73, 0x6f,
+  0x6e, 0x46, 0x6f, 0x72, 0x41, 0x6d, 0x65, 0x6e, 0x64, 0x6d, 0x65, 0x6e,
+  0x74, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x65, 0x66, 0x73, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x3a, 0x72, 0x65, 0x71, 0x43, 0x6f, 0x6e, 0x64, 0x50, 0x6d,
+  0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x65, 0x71, 0x54, 0x65, 0x63, 0x68,
+  0x49, 0x6e, 0x66, 0x6f, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c,
+  0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d,
+  0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x72, 0x71, 0x6d,
+  0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74,
+  0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61,
+  0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a,
+  0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x52, 0x65, 0x66, 0x50, 0x61, 0x72,
+  0x61, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65,
+  0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+  0x44, 0x6f, 0x63, 0x52, 0x65, 0x66, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x74,
+  0x65, 0x72, 0x6d, 0x54, 0x69, 0x74, 0x6c, 0x65, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x3a, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x28,
+  0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x74,
+  0x6f, 0x63, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x2f, 0x74, 0x65, 0x78, 0x74,
+  0x28, 0x29, 0x7c, 0x0a, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61,
+  0x6e, 0x74, 0x2d, 0x6f, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a,
+  0x77, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x41, 0x6e, 0x64, 0x43, 0x61,
+  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x61, 0x72, 0x61, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x28, 0x29, 0x0a
+};
+unsigned int elems_pmc_txt_len = 1121;
+unsigned char elems_smc_txt[] = {
+  0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x2d, 0x6f,
+  0x72, 0x2d, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x73, 0x63, 0x6f, 0x45,
+  0x6e, 0x74, 0x72, 0x79, 0x49, 0x74, 0x65, 0x6d, 0x2f, 0x74, 0x65, 0x78,
+  0x74, 0x28, 0x29, 0x0a
+};
+unsigned int elems_smc_txt_len = 40;
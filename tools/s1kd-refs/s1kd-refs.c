@@ -11,9 +11,10 @@
 #include <libxml/debugXML.h>
 #include <libxml/xpathInternals.h>
 #include "s1kd_tools.h"
+#include "s1kd_dirwalk.h"
 
 #define PROG_NAME "s1kd-refs"
-#define VERSION "4.16.0"
+#define VERSION "4.17.1"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 #define SUCC_PREFIX PROG_NAME ": SUCCESS: "
@@ -24,6 +25,7 @@
 #define E_OUT_OF_MEMORY ERR_PREFIX "Too many files in recursive listing.\n"
 #define E_BAD_STDIN ERR_PREFIX "stdin does not contain valid XML.\n"
 #define E_BAD_CSN_CODE ERR_PREFIX "Invalid non-chapterized IPD SNS: %s\n"
+#define E_BAD_DIR ERR_PREFIX "Could not read directory: %s\n"
 
 #define S_UNMATCHED SUCC_PREFIX "No unmatched references in %s\n"
 #define F_UNMATCHED FAIL_PREFIX "Unmatched references in %s\n"
@@ -59,6 +61,9 @@ static char *directory;
 /* Ignore issue info when matching. */
 static bool ignoreIss = false;
 
+/* Socket of an s1kd-daemon to send requests to. */
+static char *daemonSocket = NULL;
+
 /* Include the source object as a reference. */
 static bool listSrc = false;
 
@@ -397,10 +402,53 @@ static bool exact_match(char *dst, const char *code)
 	return match;
 }
 
+/* Find a CSDB object using the index of a running s1kd-daemon.
+ *
+ * Returns -1 if the daemon could not carry out the request, in which case the
+ * object should be searched for as normal.
+ */
+static int daemon_find_object(char *dst, const char *dir, const char *code, bool recursive)
+{
+	char *args[4];
+	char *body = NULL;
+	int size, err;
+
+	args[0] = "refs";
+	args[1] = (char *) code;
+	args[2] = (char *) dir;
+	args[3] = recursive ? "-r" : "-";
+
+	err = daemon_request(daemonSocket, args, 4, &body, &size);
+
+	if (err == 0) {
+		char *end;
+
+		if ((end = strchr(body, '\n'))) {
+			*end = '\0';
+		}
+
+		strncpy(dst, body, PATH_MAX - 1);
+		dst[PATH_MAX - 1] = '\0';
+	}
+
+	free(body);
+
+	return err;
+}
+
 /* Match a code to a file name. */
 static bool find_object_fname(char *dst, const char *dir, const char *code, bool recursive)
 {
-	return find_csdb_object(dst, dir, code, NULL, recursive) && (looseMatch || exact_match(dst, code));
+	bool found;
+	int err;
+
+	if (daemonSocket && (err = daemon_find_object(dst, dir, code, recursive)) != -1) {
+		found = err == 0;
+	} else {
+		found = find_csdb_object(dst, dir, code, NULL, recursive);
+	}
+
+	return found && (looseMatch || exact_match(dst, code));
 }
 
 /* Tag unmatched references in the source object. */
@@ -823,22 +871,170 @@ static void getICNAttr(char *dst, xmlNodePtr ref)
 	xmlFree(icn);
 }
 
-/* Match each hotspot against the ICN. */
-static int matchHotspot(xmlNodePtr ref, xmlDocPtr doc, const char *code, const char *fname, const char *src)
+/* Objects referenced by fragments, hotspots and CSN items.
+ *
+ * Many references usually point in to the same few objects, so the most
+ * recently used objects are kept parsed, along with an index of the IDs of
+ * their elements. An object is read again if the size, modification time or
+ * inode of its file change.
+ */
+#define TARGET_DOCS_MAX 16
+
+struct target_doc {
+	char *path;
+	off_t size;
+	time_t mtime;
+	ino_t ino;
+	xmlDocPtr doc;
+	xmlHashTablePtr ids;     /* Elements by @id. */
+	xmlHashTablePtr defs;    /* Elements in an X3D ICN by @DEF. */
+	xmlXPathContextPtr ctx;  /* Context for a custom hotspot XPath. */
+};
+
+/* Most recently used first. */
+static struct target_doc *targetDocs[TARGET_DOCS_MAX];
+static int numTargetDocs = 0;
+
+/* Custom XPath for matching hotspots, compiled when first used. */
+static xmlXPathCompExprPtr hotspotXPathComp = NULL;
+static bool hotspotXPathCompiled = false;
+
+/* Index the IDs of the elements in a referenced object. */
+static void indexTargetIds(struct target_doc *t, xmlNodePtr node)
+{
+	xmlNodePtr cur;
+
+	for (cur = node; cur; cur = cur->next) {
+		xmlChar *id;
+
+		if (cur->type != XML_ELEMENT_NODE) {
+			continue;
+		}
+
+		/* The first element with an ID is the one matched. */
+		if ((id = xmlGetNoNsProp(cur, BAD_CAST "id"))) {
+			xmlHashAddEntry(t->ids, id, cur);
+			xmlFree(id);
+		}
+		/* Only descendants of the X3D root are matched by @DEF. */
+		if (t->defs && cur->parent->type == XML_ELEMENT_NODE && (id = xmlGetNoNsProp(cur, BAD_CAST "DEF"))) {
+			xmlHashAddEntry(t->defs, id, cur);
+			xmlFree(id);
+		}
+
+		indexTargetIds(t, cur->children);
+	}
+}
+
+static void freeTargetDoc(struct target_doc *t)
+{
+	free(t->path);
+	xmlHashFree(t->ids, NULL);
+	xmlHashFree(t->defs, NULL);
+	xmlXPathFreeContext(t->ctx);
+	xmlFreeDoc(t->doc);
+	free(t);
+}
+
+/* Return a parsed referenced object, or NULL if it cannot be read. */
+static struct target_doc *getTargetDoc(const char *fname)
+{
+	struct stat st;
+	struct target_doc *t = NULL;
+	xmlNodePtr root;
+	int i;
+
+	if (stat(fname, &st) != 0) {
+		return NULL;
+	}
+
+	for (i = 0; i < numTargetDocs; ++i) {
+		if (strcmp(targetDocs[i]->path, fname) == 0) {
+			t = targetDocs[i];
+			break;
+		}
+	}
+
+	if (t) {
+		memmove(targetDocs + 1, targetDocs, i * sizeof(struct target_doc *));
+		targetDocs[0] = t;
+
+		if (t->size == st.st_size && t->mtime == st.st_mtime && t->ino == st.st_ino) {
+			return t->doc ? t : NULL;
+		}
+
+		freeTargetDoc(t);
+	} else {
+		if (numTargetDocs == TARGET_DOCS_MAX) {
+			freeTargetDoc(targetDocs[--numTargetDocs]);
+		}
+
+		memmove(targetDocs + 1, targetDocs, numTargetDocs * sizeof(struct target_doc *));
+		++numTargetDocs;
+	}
+
+	t = calloc(1, sizeof(struct target_doc));
+	t->path = strdup(fname);
+	t->size = st.st_size;
+	t->mtime = st.st_mtime;
+	t->ino = st.st_ino;
+	targetDocs[0] = t;
+
+	if (!(t->doc = read_xml_doc(fname))) {
+		return NULL;
+	}
+
+	if (remDelete) {
+		rem_delete_elems(t->doc);
+	}
+
+	root = xmlDocGetRootElement(t->doc);
+
+	t->ids = xmlHashCreate(0);
+	if (xmlStrcmp(root->name, BAD_CAST "X3D") == 0 && !root->ns) {
+		t->defs = xmlHashCreate(0);
+	}
+	indexTargetIds(t, root);
+
+	return t;
+}
+
+/* Free the cache of referenced objects. */
+static void freeTargetDocs(void)
+{
+	int i;
+
+	for (i = 0; i < numTargetDocs; ++i) {
+		freeTargetDoc(targetDocs[i]);
+	}
+
+	numTargetDocs = 0;
+}
+
+/* Find the object for a hotspot in an ICN. */
+static bool findHotspot(struct target_doc *t, const xmlChar *apsid)
 {
-	xmlChar *apsid;
-	xmlXPathContextPtr ctx;
 	xmlXPathObjectPtr obj;
-	xmlNodePtr node;
-	char *s;
-	int err = doc == NULL;
+	bool found;
 
-	apsid = xmlNodeGetContent(ref);
+	/* The default XPath only matches IDs, which are indexed. */
+	if (xmlStrcmp(hotspotXPath, DEFAULT_HOTSPOT_XPATH) == 0) {
+		return xmlHashLookup(t->ids, apsid) || xmlHashLookup(t->defs, apsid);
+	}
 
-	if (doc) {
+	if (!hotspotXPathCompiled) {
+		hotspotXPathComp = xmlXPathCompile(hotspotXPath);
+		hotspotXPathCompiled = true;
+	}
+
+	if (!hotspotXPathComp) {
+		return false;
+	}
+
+	if (!t->ctx) {
 		xmlNodePtr cur;
 
-		ctx = xmlXPathNewContext(doc);
+		t->ctx = xmlXPathNewContext(t->doc);
 
 		/* Register namespaces for the hotspot XPath. */
 		for (cur = hotspotNs->children; cur; cur = cur->next) {
@@ -847,25 +1043,34 @@ static int matchHotspot(xmlNodePtr ref, xmlDocPtr doc, const char *code, const c
 			prefix = xmlGetProp(cur, BAD_CAST "prefix");
 			uri = xmlGetProp(cur, BAD_CAST "uri");
 
-			xmlXPathRegisterNs(ctx, prefix, uri);
+			xmlXPathRegisterNs(t->ctx, prefix, uri);
 
 			xmlFree(prefix);
 			xmlFree(uri);
 		}
+	}
 
-		xmlXPathRegisterVariable(ctx, BAD_CAST "id", xmlXPathNewString(apsid));
-		obj = xmlXPathEvalExpression(hotspotXPath, ctx);
+	xmlXPathRegisterVariable(t->ctx, BAD_CAST "id", xmlXPathNewString(apsid));
+	obj = xmlXPathCompiledEval(hotspotXPathComp, t->ctx);
 
-		if (!obj || xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-			node = NULL;
-		} else {
-			node = obj->nodesetval->nodeTab[0];
-		}
+	found = obj && obj->type == XPATH_NODESET && !xmlXPathNodeSetIsEmpty(obj->nodesetval);
 
-		xmlXPathFreeObject(obj);
-		xmlXPathFreeContext(ctx);
+	xmlXPathFreeObject(obj);
 
-		if (node) {
+	return found;
+}
+
+/* Match each hotspot against the ICN. */
+static int matchHotspot(xmlNodePtr ref, struct target_doc *doc, const char *code, const char *fname, const char *src)
+{
+	xmlChar *apsid;
+	char *s;
+	int err = doc == NULL;
+
+	apsid = xmlNodeGetContent(ref);
+
+	if (doc) {
+		if (findHotspot(doc, apsid)) {
 			if (showMatched && !tagUnmatched) {
 				s = malloc(strlen(fname) + strlen((char *) apsid) + 2);
 				strcpy(s, fname);
@@ -919,27 +1124,21 @@ static int getHotspots(xmlNodePtr ref, const char *src)
 		xmlNodePtr icn;
 		char code[PATH_MAX], fname[PATH_MAX];
 		int i;
-		xmlDocPtr doc;
+		struct target_doc *doc;
 
 		icn = firstXPathNode(ref->doc, ref, BAD_CAST "@infoEntityIdent|@boardno");
 
 		getICNAttr(code, icn);
 
 		if (find_object_fname(fname, directory, code, recursive)) {
-			doc = read_xml_doc(fname);
+			doc = getTargetDoc(fname);
 		} else {
 			doc = NULL;
 		}
 
-		if (remDelete) {
-			rem_delete_elems(doc);
-		}
-
 		for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
 			err += matchHotspot(obj->nodesetval->nodeTab[i], doc, code, doc ? fname : code, src);
 		}
-
-		xmlFreeDoc(doc);
 	}
 
 	xmlXPathFreeObject(obj);
@@ -949,32 +1148,16 @@ static int getHotspots(xmlNodePtr ref, const char *src)
 }
 
 /* Match a single referred fragment in another DM. */
-static int matchFragment(xmlDocPtr doc, xmlNodePtr ref, const char *code, const char *fname, const char *src)
+static int matchFragment(struct target_doc *doc, xmlNodePtr ref, const char *code, const char *fname, const char *src)
 {
 	xmlChar *id;
-	xmlXPathContextPtr ctx;
-	xmlXPathObjectPtr obj;
-	xmlNodePtr node;
 	char *s;
 	int err = doc == NULL;
 
 	id = xmlNodeGetContent(ref);
 
 	if (doc) {
-		ctx = xmlXPathNewContext(doc);
-		xmlXPathRegisterVariable(ctx, BAD_CAST "id", xmlXPathNewString(id));
-		obj = xmlXPathEvalExpression(BAD_CAST "//*[@id=$id]", ctx);
-
-		if (!obj || xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-			node = NULL;
-		} else {
-			node = obj->nodesetval->nodeTab[0];
-		}
-
-		xmlXPathFreeObject(obj);
-		xmlXPathFreeContext(ctx);
-
-		if (node) {
+		if (xmlHashLookup(doc->ids, id)) {
 			if (showMatched && !tagUnmatched) {
 				s = malloc(strlen(fname) + strlen((char *) id) + 2);
 				strcpy(s, fname);
@@ -1015,28 +1198,19 @@ static int getFragment(xmlNodePtr ref, const char *src)
 {
 	xmlNodePtr dmref;
 	char code[PATH_MAX], fname[PATH_MAX];
-	xmlDocPtr doc;
-	int err;
+	struct target_doc *doc;
 
 	dmref = firstXPathNode(ref->doc, ref, BAD_CAST "ancestor::dmRef");
 
 	getDmCode(code, dmref);
 
 	if (find_object_fname(fname, directory, code, recursive)) {
-		doc = read_xml_doc(fname);
+		doc = getTargetDoc(fname);
 	} else {
 		doc = NULL;
 	}
 
-	if (remDelete) {
-		rem_delete_elems(doc);
-	}
-
-	err = matchFragment(doc, ref, code, doc ? fname : code, src);
-
-	xmlFreeDoc(doc);
-
-	return err;
+	return matchFragment(doc, ref, code, doc ? fname : code, src);
 }
 
 /* Get the comment code as a string from a commentRef. */
@@ -1563,6 +1737,7 @@ static int getCsnItem(xmlNodePtr ref, const char *src)
 {
 	xmlNodePtr csnref;
 	char code[PATH_MAX], fname[PATH_MAX];
+	struct target_doc *target;
 	xmlDocPtr doc;
 	int err;
 	xmlChar *csn;
@@ -1573,27 +1748,54 @@ static int getCsnItem(xmlNodePtr ref, const char *src)
 
 	getCsnCode(code, csnref, &csn, &item, &itemVariant);
 
-	if (find_object_fname(fname, directory, code, recursive)) {
-		doc = read_xml_doc(fname);
+	if (find_object_fname(fname, directory, code, recursive) && (target = getTargetDoc(fname))) {
+		doc = target->doc;
 	} else {
 		doc = NULL;
 	}
 
-	if (remDelete) {
-		rem_delete_elems(doc);
-	}
-
 	err = matchCsnItem(doc, csnref, csn, item, itemVariant, code, doc ? fname : code, src);
 
 	xmlFree(csn);
 	xmlFree(item);
 	xmlFree(itemVariant);
 
-	xmlFreeDoc(doc);
-
 	return err;
 }
 
+/* Identification and status sections of referenced objects, keyed by path.
+ *
+ * Only the issue, language, title and issue date of a referenced object are
+ * copied into a reference, and updating references never changes these, so
+ * each object only needs to be read once per run, and only up to the end of
+ * its identification and status section. */
+static xmlHashTablePtr targetCache = NULL;
+
+static void freeTarget(void *payload, const xmlChar *name)
+{
+	xmlFreeDoc((xmlDocPtr) payload);
+}
+
+/* Return the identification and status of a referenced object. */
+static xmlDocPtr readTarget(const char *fname)
+{
+	xmlDocPtr doc;
+
+	if (!targetCache) {
+		targetCache = xmlHashCreate(256);
+	}
+
+	if ((doc = xmlHashLookup(targetCache, BAD_CAST fname))) {
+		return doc;
+	}
+
+	if ((doc = read_ident_and_status(fname))) {
+		xmlHashAddEntry(targetCache, BAD_CAST fname, doc);
+	}
+
+	return doc;
+}
+
 /* Update address items using the matched referenced object. */
 static void updateRef(xmlNodePtr *refptr, const char *src, const char *code, const char *fname)
 {
@@ -1608,7 +1810,7 @@ static void updateRef(xmlNodePtr *refptr, const char *src, const char *code, con
 		xmlNodePtr dmRefAddressItems, dmTitle;
 		xmlChar *techName, *infoName, *infoNameVariant;
 
-		if (!(doc = read_xml_doc(fname))) {
+		if (!(doc = readTarget(fname))) {
 			return;
 		}
 
@@ -1691,13 +1893,12 @@ static void updateRef(xmlNodePtr *refptr, const char *src, const char *code, con
 			xmlAddChild(dmRefAddressItems, issueDate);
 		}
 
-		xmlFreeDoc(doc);
 	} else if (xmlStrcmp(ref->name, BAD_CAST "pmRef") == 0) {
 		xmlDocPtr doc;
 		xmlNodePtr pmRefAddressItems;
 		xmlChar *pmTitle;
 
-		if (!(doc = read_xml_doc(fname))) {
+		if (!(doc = readTarget(fname))) {
 			return;
 		}
 
@@ -1769,13 +1970,12 @@ static void updateRef(xmlNodePtr *refptr, const char *src, const char *code, con
 			xmlAddChild(pmRefAddressItems, issueDate);
 		}
 
-		xmlFreeDoc(doc);
 	} else if (xmlStrcmp(ref->name, BAD_CAST "refdm") == 0) {
 		xmlDocPtr doc;
 		xmlNodePtr oldtitle, newtitle;
 		xmlChar *techname, *infoname;
 
-		if (!(doc = read_xml_doc(fname))) {
+		if (!(doc = readTarget(fname))) {
 			return;
 		}
 
@@ -1840,7 +2040,6 @@ static void updateRef(xmlNodePtr *refptr, const char *src, const char *code, con
 
 		xmlUnlinkNode(oldtitle);
 		xmlFreeNode(oldtitle);
-		xmlFreeDoc(doc);
 	} else if (xmlStrcmp(ref->name, BAD_CAST "infoEntityIdent") == 0) {
 		xmlChar *icn;
 		xmlEntityPtr e;
@@ -2174,39 +2373,40 @@ static bool isUsedTarget(const char *name, int show)
 		(optset(show, SHOW_SMC) && is_smc(name));
 }
 
-/* Search objects in a given directory for references to a target object. */
+/* Filter for the directory walk in findWhereUsed. */
+static bool isUsedTargetFile(const char *name, void *show)
+{
+	return isUsedTarget(name, *((int *) show));
+}
+
+/* Search objects in a given directory for references to a target object.
+ * Objects are searched as soon as they are found, while the rest of the
+ * directory is still being walked. */
 static int findWhereUsed(const char *dpath, const char *ref, int show)
 {
-	DIR *dir;
-	struct dirent *cur;
-	char fpath[PATH_MAX], cpath[PATH_MAX];
+	struct dir_walk *walk;
+	char path[PATH_MAX];
 	int unmatched = 0;
 
-	if (!(dir = opendir(dpath))) {
+	walk = dir_walk_new(recursive, isUsedTargetFile, &show);
+
+	if (!dir_walk_add(walk, dpath)) {
+		dir_walk_free(walk);
 		return 1;
 	}
 
-	if (strcmp(dpath, ".") == 0) {
-		strcpy(fpath, "");
-	} else if (dpath[strlen(dpath) - 1] != '/') {
-		strcpy(fpath, dpath);
-		strcat(fpath, "/");
-	} else {
-		strcpy(fpath, dpath);
+	while (dir_walk_next(walk, path)) {
+		unmatched += listReferences(path, SHOW_WHERE_USED, ref, show);
 	}
 
-	while ((cur = readdir(dir))) {
-		strcpy(cpath, fpath);
-		strcat(cpath, cur->d_name);
-
-		if (recursive && isdir(cpath, true)) {
-			unmatched += findWhereUsed(cpath, ref, show);
-		} else if (isUsedTarget(cur->d_name, show)) {
-			unmatched += listReferences(cpath, SHOW_WHERE_USED, ref, show);
-		}
+	/* Subdirectories which could not be read count against the result,
+	 * like the directory itself. */
+	while (dir_walk_next_error(walk, path)) {
+		fprintf(stderr, E_BAD_DIR, path);
+		++unmatched;
 	}
 
-	closedir(dir);
+	dir_walk_free(walk);
 
 	return unmatched;
 }
@@ -2391,6 +2591,7 @@ static void show_help(void)
 	puts("  -Z, --source                 List source DM or PM.");
 	puts("  -3, --externalpubs <file>    Use custom .externalpubs file.");
 	puts("  -^, --remove-deleted         List refs with elements marked as \"delete\" removed.");
+	puts("  --daemon <socket>            Find matches using an s1kd-daemon listening on <socket>.");
 	puts("  --version                    Show version information.");
 	puts("  <object>                     CSDB object to list references in.");
 	LIBXML2_PARSE_LONGOPT_HELP
@@ -2464,6 +2665,7 @@ int main(int argc, char **argv)
 		{"ipd-sns"       , required_argument, 0, 'b'},
 		{"ipd-dcv"       , required_argument, 0, 'k'},
 		{"remove-deleted", no_argument      , 0, '^'},
+		{"daemon"        , required_argument, 0, 0},
 		LIBXML2_PARSE_LONGOPT_DEFS
 		{0, 0, 0, 0}
 	};
@@ -2481,6 +2683,9 @@ int main(int argc, char **argv)
 				if (strcmp(lopts[loptind].name, "version") == 0) {
 					show_version();
 					return 0;
+				} else if (strcmp(lopts[loptind].name, "daemon") == 0) {
+					free(daemonSocket);
+					daemonSocket = strdup(optarg);
 				}
 				LIBXML2_PARSE_LONGOPT_HANDLE(lopts, loptind)
 				break;
@@ -2699,6 +2904,7 @@ int main(int argc, char **argv)
 	}
 
 	free(directory);
+	free(daemonSocket);
 	xmlFree(hotspotXPath);
 	xmlFreeNode(hotspotNs);
 	free(listedFiles);
@@ -2706,6 +2912,9 @@ int main(int argc, char **argv)
 	free(printFormat);
 	xmlFree(figNumVarFormat);
 	xmlFreeDoc(externalPubs);
+	xmlHashFree(targetCache, freeTarget);
+	freeTargetDocs();
+	xmlXPathFreeCompExpr(hotspotXPathComp);
 	xmlCleanupParser();
 
 	return unmatched > 0 ? EXIT_UNMATCHED_REF : EXIT_SUCCESS;
@@ -13,7 +13,7 @@
 
 /* Program information. */
 #define PROG_NAME "s1kd-repcheck"
-#define VERSION "1.5.0"
+#define VERSION "1.5.1"
 
 /* Message prefixes. */
 #define ERR_PREFIX PROG_NAME ": ERROR: "
@@ -838,6 +838,7 @@ cleanup:
 	free_objects(&opts.cirs);
 	free(opts.search_dir);
 	xmlFreeDoc(report_doc);
+	free_object_info_cache();
 
 	xmlCleanupParser();
 	xsltCleanupGlobals();
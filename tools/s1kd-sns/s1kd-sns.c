@@ -4,6 +4,8 @@
 #include <unistd.h>
 #include <getopt.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <sys/stat.h>
 #include <stdbool.h>
 #include <libxml/tree.h>
@@ -14,58 +16,181 @@
 #include "s1kd_tools.h"
 
 #define PROG_NAME "s1kd-sns"
-#define VERSION "1.7.0"
+#define VERSION "1.8.0"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 
 #define E_ENCODING_ERROR ERR_PREFIX "Error encoding path name.\n"
+#define E_BAD_JOBS ERR_PREFIX "Bad number of jobs: %s\n"
 
 #define EXIT_ENCODING_ERROR 1
 #define EXIT_OS_ERROR 2
 #define EXIT_NO_BREX 3
+#define EXIT_BAD_JOBS 4
 
 #define DEFAULT_SNS_DNAME "SNS"
 
-static int hlink(const char *path, const char *fname)
+/* A directory in the SNS hierarchy. */
+struct sns_dir {
+	char *name;
+	char *path;
+	/* Open descriptor of the directory, or -1 if it has not been opened
+	 * yet or could not be opened. */
+	int fd;
+	bool opened;
+	/* Whether this is the directory the DMs are stored in. */
+	bool is_src;
+	struct sns_dir *children;
+	int count;
+	int max;
+};
+
+/* Protects opening directories when placing DMs with multiple threads. */
+static pthread_mutex_t sns_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void init_sns_dir(struct sns_dir *dir, const struct sns_dir *parent, const char *name, const char *srcdname)
+{
+	char real[PATH_MAX];
+
+	dir->name = strdup(name);
+
+	if (parent) {
+		dir->path = malloc(strlen(parent->path) + strlen(name) + 2);
+		sprintf(dir->path, "%s/%s", parent->path, name);
+	} else {
+		dir->path = strdup(name);
+	}
+
+	dir->fd = -1;
+	dir->opened = false;
+	dir->is_src = strcmp(real_path(dir->path, real), srcdname) == 0;
+	dir->children = NULL;
+	dir->count = 0;
+	dir->max = 0;
+}
+
+static void free_sns_dir(struct sns_dir *dir)
 {
+	int i;
+
+	for (i = 0; i < dir->count; ++i) {
+		free_sns_dir(&dir->children[i]);
+	}
+
+	#ifndef _WIN32
+	if (dir->fd != -1) {
+		close(dir->fd);
+	}
+	#endif
+
+	free(dir->name);
+	free(dir->path);
+	free(dir->children);
+}
+
+/* Add a subdirectory to an SNS directory. */
+static struct sns_dir *add_sns_dir(struct sns_dir *dir, const char *name, const char *srcdname)
+{
+	int i;
+
+	for (i = 0; i < dir->count; ++i) {
+		if (strcmp(dir->children[i].name, name) == 0) {
+			return &dir->children[i];
+		}
+	}
+
+	if (dir->count == dir->max) {
+		dir->max = dir->max ? dir->max * 2 : 16;
+		dir->children = realloc(dir->children, dir->max * sizeof(struct sns_dir));
+	}
+
+	init_sns_dir(&dir->children[dir->count], dir, name, srcdname);
+
+	return &dir->children[dir->count++];
+}
+
+/* Get a directory descriptor and name to refer to a file in an SNS directory.
+ * If the directory cannot be opened (for example, when too many directories
+ * are open already), the path of the file is used instead. */
+static int sns_at(struct sns_dir *dir, const char *fname, char *name)
+{
+	#ifndef _WIN32
+	pthread_mutex_lock(&sns_lock);
+	if (!dir->opened) {
+		dir->fd = open(dir->path, O_RDONLY | O_DIRECTORY);
+		dir->opened = true;
+	}
+	pthread_mutex_unlock(&sns_lock);
+
+	if (dir->fd != -1) {
+		strcpy(name, fname);
+		return dir->fd;
+	}
+	#endif
+
+	if (snprintf(name, PATH_MAX, "%s/%s", dir->path, fname) < 0) {
+		fprintf(stderr, E_ENCODING_ERROR);
+		exit(EXIT_ENCODING_ERROR);
+	}
+
 	#ifdef _WIN32
-		return CreateHardLink(fname, path, 0);
+	return -1;
 	#else
-		return link(path, fname);
+	return AT_FDCWD;
 	#endif
 }
 
-static int slink(const char *path, const char *fname)
+static int hlink(const char *path, struct sns_dir *dir, const char *fname)
 {
+	char name[PATH_MAX];
 	#ifdef _WIN32
-		return CreateSymbolicLink(fname, path, 0);
+		sns_at(dir, fname, name);
+		return CreateHardLink(name, path, 0);
 	#else
-		return symlink(path, fname);
+		return linkat(AT_FDCWD, path, sns_at(dir, fname, name), name, 0);
 	#endif
 }
 
-/* The type of link to use, hard or soft (symbolic). */
-static int (*linkfn)(const char *path, const char *fname) = hlink;
-
-/* Title SNS directories using only the SNS code, not including the SNS title. */
-static bool only_numb = false;
+static int slink(const char *path, struct sns_dir *dir, const char *fname)
+{
+	char name[PATH_MAX];
+	#ifdef _WIN32
+		sns_at(dir, fname, name);
+		return CreateSymbolicLink(name, path, 0);
+	#else
+		return symlinkat(path, sns_at(dir, fname, name), name);
+	#endif
+}
 
-static void change_dir(const char *dir)
+static int cplink(const char *path, struct sns_dir *dir, const char *fname)
 {
-	if (chdir(dir) != 0) {
-		fprintf(stderr, ERR_PREFIX "Cannot change directory to %s: %s\n", dir, strerror(errno));
-		exit(EXIT_OS_ERROR);
+	char name[PATH_MAX];
+
+	if (snprintf(name, PATH_MAX, "%s/%s", dir->path, fname) < 0) {
+		fprintf(stderr, E_ENCODING_ERROR);
+		exit(EXIT_ENCODING_ERROR);
 	}
+
+	return copy(path, name);
 }
 
-static void rename_dir(const char *old, const char *new)
+static int mvlink(const char *path, struct sns_dir *dir, const char *fname)
 {
-	if (rename(old, new) != 0) {
-		fprintf(stderr, ERR_PREFIX "Cannot rename directory %s to %s: %s\n", old, new, strerror(errno));
-		exit(EXIT_OS_ERROR);
-	}
+	char name[PATH_MAX];
+	#ifdef _WIN32
+		sns_at(dir, fname, name);
+		return rename(path, name);
+	#else
+		return renameat(AT_FDCWD, path, sns_at(dir, fname, name), name);
+	#endif
 }
 
+/* The type of link to use, hard or soft (symbolic). */
+static int (*linkfn)(const char *path, struct sns_dir *dir, const char *fname) = hlink;
+
+/* Title SNS directories using only the SNS code, not including the SNS title. */
+static bool only_numb = false;
+
 static void get_current_dir(char *buf, size_t size)
 {
 	if (!getcwd(buf, size)) {
@@ -138,53 +263,109 @@ static void makedir(const char *path)
 	}
 }
 
+/* Create a subdirectory in an SNS directory if it does not exist. */
+static void make_sns_dir(struct sns_dir *dir, const char *fname)
+{
+	char name[PATH_MAX];
+	int fd;
+
+	fd = sns_at(dir, fname, name);
+
+	#ifdef _WIN32
+		if (access(name, F_OK) == -1) {
+			mkdir(name);
+		}
+	#else
+		if (mkdirat(fd, name, S_IRWXU) != 0 && errno != EEXIST) {
+			fprintf(stderr, ERR_PREFIX "Cannot create directory %s/%s: %s\n", dir->path, fname, strerror(errno));
+			exit(EXIT_OS_ERROR);
+		}
+	#endif
+}
+
 /* Create the directory structure for the SNS. */
-static void setup_sns(xmlNodePtr node, const char *snsdname)
+static void setup_sns(xmlNodePtr node, struct sns_dir *dir, const char *srcdname)
 {
 	xmlNodePtr cur;
-	char *content;
-	char code[256];
 
 	for (cur = node->children; cur; cur = cur->next) {
-		if (xmlStrcmp(cur->name, BAD_CAST "snsCode") == 0) {
-			content = (char *) xmlNodeGetContent(cur);
+		xmlNodePtr child;
+		xmlChar *code = NULL, *title = NULL;
+		char name[PATH_MAX];
+
+		if (cur->type != XML_ELEMENT_NODE ||
+		    xmlStrcmp(cur->name, BAD_CAST "snsCode") == 0 ||
+		    xmlStrcmp(cur->name, BAD_CAST "snsTitle") == 0) {
+			continue;
+		}
 
-			strcpy(code, content);
+		for (child = cur->children; child; child = child->next) {
+			if (!code && xmlStrcmp(child->name, BAD_CAST "snsCode") == 0) {
+				code = xmlNodeGetContent(child);
+			} else if (!title && !only_numb && xmlStrcmp(child->name, BAD_CAST "snsTitle") == 0) {
+				title = xmlNodeGetContent(child);
+				cleanstr((char *) title);
+			}
+		}
 
-			xmlFree(content);
+		if (!code) {
+			setup_sns(cur, dir, srcdname);
+		} else if (snprintf(name, PATH_MAX, title ? "%s - %s" : "%s", code, title) < 0) {
+			fprintf(stderr, E_ENCODING_ERROR);
+			exit(EXIT_ENCODING_ERROR);
+		} else {
+			make_sns_dir(dir, name);
+			setup_sns(cur, add_sns_dir(dir, name, srcdname), srcdname);
+		}
 
-			makedir(code);
+		xmlFree(code);
+		xmlFree(title);
+	}
+}
 
-			change_dir(code);
-		} else if (xmlStrcmp(cur->name, BAD_CAST "snsTitle") == 0) {
-			char oldname[PATH_MAX], newname[PATH_MAX];
+/* Read the structure of an existing SNS directory. Only the levels that can
+ * contain SNS directories (system, sub-system, sub-sub-system and assembly)
+ * are read. */
+static void read_sns_dir(struct sns_dir *dir, int level, const char *srcdname)
+{
+	DIR *d;
+	struct dirent *cur;
+	int i;
 
-			if (only_numb) continue;
+	if (level > 3 || !(d = opendir(dir->path))) {
+		return;
+	}
 
-			if (snprintf(oldname, PATH_MAX, "%s", code) < 0) {
-				fprintf(stderr, E_ENCODING_ERROR);
-				exit(EXIT_ENCODING_ERROR);
-			}
+	while ((cur = readdir(d))) {
+		bool isdir;
 
-			content = (char *) xmlNodeGetContent(cur);
-			cleanstr(content);
+		if (strcmp(cur->d_name, ".") == 0 || strcmp(cur->d_name, "..") == 0) {
+			continue;
+		}
 
-			if (snprintf(newname, PATH_MAX, "%s - %s", code, content) < 0) {
-				fprintf(stderr, E_ENCODING_ERROR);
-				exit(EXIT_ENCODING_ERROR);
-			}
+		#ifdef _DIRENT_HAVE_D_TYPE
+		if (cur->d_type != DT_UNKNOWN) {
+			isdir = cur->d_type == DT_DIR;
+		} else
+		#endif
+		{
+			char path[PATH_MAX];
+			struct stat st;
 
-			xmlFree(content);
+			snprintf(path, PATH_MAX, "%s/%s", dir->path, cur->d_name);
+			isdir = stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+		}
 
-			change_dir("..");
-			rename_dir(oldname, newname);
-			change_dir(newname);
-		} else if (cur->type == XML_ELEMENT_NODE) {
-			setup_sns(cur, snsdname);
+		if (isdir) {
+			add_sns_dir(dir, cur->d_name, srcdname);
 		}
 	}
 
-	change_dir("..");
+	closedir(d);
+
+	for (i = 0; i < dir->count; ++i) {
+		read_sns_dir(&dir->children[i], level + 1, srcdname);
+	}
 }
 
 /* Tests if the given file is a data module. */
@@ -237,100 +418,175 @@ static int parse_dmcode(struct dm_code *code, const char *str)
 	return 0;
 }
 
-/* Test if the SNS directory exists for a specified code. */
-static int sns_exists(const char *code, char *dname)
+/* Find the subdirectory of an SNS directory for a specified code. */
+static struct sns_dir *find_sns_dir(struct sns_dir *dir, const char *code)
 {
-	DIR *dir;
-	struct dirent *cur;
-	int exists = 0;
-
-	dir = opendir(".");
+	size_t n = strlen(code);
+	int i;
 
-	while ((cur = readdir(dir))) {
-		if (strncmp(code, cur->d_name, strlen(code)) == 0) {
-			exists = 1;
-			strcpy(dname, cur->d_name);
-			break;
+	for (i = 0; i < dir->count; ++i) {
+		if (strncmp(code, dir->children[i].name, n) == 0) {
+			return &dir->children[i];
 		}
 	}
 
-	closedir(dir);
-
-	return exists;
+	return NULL;
 }
 
+/* A DM to be placed in the SNS directory hierarchy. */
+struct sns_dm {
+	char fname[PATH_MAX];
+	struct sns_dir *dir;
+};
+
 /* Place a link to a DM file in to the proper place in the SNS directory hierarchy. */
-static void placedm(const char *fname, struct dm_code *code, const char *snsdname, const char *srcdname)
+static void placedm(struct sns_dm *dm, const char *srcdname)
 {
-	char path[PATH_MAX], dname[PATH_MAX], orig[PATH_MAX];
-	bool link = true;
-
-	get_current_dir(orig, PATH_MAX);
+	char path[PATH_MAX], name[PATH_MAX];
+	int fd;
 
-	strcpy(path, srcdname);
-	strcat(path, "/");
+	if (snprintf(path, PATH_MAX, "%s/%s", srcdname, dm->fname) < 0) {
+		fprintf(stderr, E_ENCODING_ERROR);
+		exit(EXIT_ENCODING_ERROR);
+	}
 
-	change_dir(snsdname);
+	fd = sns_at(dm->dir, dm->fname, name);
 
-	if (sns_exists(code->system_code, dname)) {
-		change_dir(dname);
-		if (sns_exists(code->sub_system_code, dname)) {
-			change_dir(dname);
-			if (sns_exists(code->sub_sub_system_code, dname)) {
-				change_dir(dname);
-				if (sns_exists(code->assy_code, dname)) {
-					change_dir(dname);
-				}
-			}
+	#ifdef _WIN32
+	if (access(name, F_OK) != -1) {
+		if (dm->dir->is_src) {
+			return;
+		}
+		unlink(name);
+	}
+	#else
+	if (faccessat(fd, name, F_OK, 0) != -1) {
+		if (dm->dir->is_src) {
+			return;
 		}
+		unlinkat(fd, name, 0);
 	}
-	
-	strcat(path, fname);
+	#endif
 
-	if (access(fname, F_OK) != -1) {
-		char d[PATH_MAX];
+	if (linkfn(path, dm->dir, dm->fname) != 0) {
+		fprintf(stderr, ERR_PREFIX "%s: %s => %s\n", strerror(errno), path, dm->fname);
+		exit(EXIT_OS_ERROR);
+	}
+}
 
-		get_current_dir(d, PATH_MAX);
+/* DMs queued to be placed by multiple threads. */
+static struct sns_queue {
+	struct sns_dm *dms;
+	int count;
+	int next;
+	const char *srcdname;
+} sns_queue;
 
-		if (strcmp(d, srcdname) != 0) {
-			unlink(fname);
-		} else {
-			link = false;
+static void *placedm_worker(void *arg)
+{
+	while (1) {
+		int i;
+
+		pthread_mutex_lock(&sns_lock);
+		i = sns_queue.next++;
+		pthread_mutex_unlock(&sns_lock);
+
+		if (i >= sns_queue.count) {
+			break;
 		}
-	}
 
-	if (link && linkfn(path, fname) != 0) {
-		fprintf(stderr, ERR_PREFIX "%s: %s => %s\n", strerror(errno), path, fname);
-		exit(EXIT_OS_ERROR);
+		placedm(&sns_queue.dms[i], sns_queue.srcdname);
 	}
 
-	change_dir(orig);
+	return NULL;
 }
 
 /* Resort DMs in to the SNS directory hierarchy. */
-static void sort_sns(const char *snsdname, const char *srcdname)
+static void sort_sns(struct sns_dir *sns, const char *srcdname, int njobs)
 {
 	DIR *dir;
 	struct dirent *cur;
+	struct sns_dm *dms = NULL;
+	int count = 0, max = 0;
+	int i;
 
-	dir = opendir(srcdname);
+	if (!(dir = opendir(srcdname))) {
+		return;
+	}
 
+	/* Find where each DM goes before placing any, so that moving DMs does
+	 * not change the directory being read. */
 	while ((cur = readdir(dir))) {
 		if (is_dmodule(cur->d_name)) {
 			struct dm_code code;
 
 			if (parse_dmcode(&code, cur->d_name) == 0) {
-				placedm(cur->d_name, &code, snsdname, srcdname);
+				const char *codes[] = {
+					code.system_code,
+					code.sub_system_code,
+					code.sub_sub_system_code,
+					code.assy_code
+				};
+				struct sns_dir *d = sns;
+
+				for (i = 0; i < 4; ++i) {
+					struct sns_dir *sub;
+
+					if (!(sub = find_sns_dir(d, codes[i]))) {
+						break;
+					}
+
+					d = sub;
+				}
+
+				if (count == max) {
+					max = max ? max * 2 : 256;
+					dms = realloc(dms, max * sizeof(struct sns_dm));
+				}
+
+				strcpy(dms[count].fname, cur->d_name);
+				dms[count].dir = d;
+				++count;
 			}
 		}
 
 	}
 
 	closedir(dir);
+
+	if (njobs > count) {
+		njobs = count;
+	}
+
+	if (njobs > 1) {
+		pthread_t *workers;
+
+		sns_queue.dms = dms;
+		sns_queue.count = count;
+		sns_queue.next = 0;
+		sns_queue.srcdname = srcdname;
+
+		workers = malloc(njobs * sizeof(pthread_t));
+
+		for (i = 0; i < njobs; ++i) {
+			pthread_create(&workers[i], NULL, placedm_worker, NULL);
+		}
+		for (i = 0; i < njobs; ++i) {
+			pthread_join(workers[i], NULL);
+		}
+
+		free(workers);
+	} else {
+		for (i = 0; i < count; ++i) {
+			placedm(&dms[i], srcdname);
+		}
+	}
+
+	free(dms);
 }
 
 /* Print or setup the SNS directory structure for a given BREX containing SNS rules. */
-static void print_or_setup_sns(const char *brex_fname, bool printsns, const char *snsdname, const char *srcdname)
+static void print_or_setup_sns(const char *brex_fname, bool printsns, const char *snsdname, const char *srcdname, int njobs)
 {
 	xmlDocPtr brex;
 	xmlXPathContextPtr ctxt;
@@ -352,21 +608,24 @@ static void print_or_setup_sns(const char *brex_fname, bool printsns, const char
 
 		if (printsns) {
 			print_sns(sns_descr, -1);
-		} else if (access(snsdname, F_OK) == -1) {
-			char cwd[PATH_MAX];
-
-			get_current_dir(cwd, PATH_MAX);
-
-			makedir(snsdname);
-			change_dir(snsdname);
-
-			setup_sns(sns_descr, snsdname);
+		} else {
+			struct sns_dir sns;
+
+			/* The SNS directory structure is created if it does
+			 * not exist, and otherwise read once, before placing
+			 * the DMs. */
+			if (access(snsdname, F_OK) == -1) {
+				makedir(snsdname);
+				init_sns_dir(&sns, NULL, snsdname, srcdname);
+				setup_sns(sns_descr, &sns, srcdname);
+			} else {
+				init_sns_dir(&sns, NULL, snsdname, srcdname);
+				read_sns_dir(&sns, 0, srcdname);
+			}
 
-			change_dir(cwd);
-		}
+			sort_sns(&sns, srcdname, njobs);
 
-		if (!printsns) {
-			sort_sns(snsdname, srcdname);
+			free_sns_dir(&sns);
 		}
 	}
 
@@ -378,13 +637,14 @@ static void print_or_setup_sns(const char *brex_fname, bool printsns, const char
 
 static void show_help(void)
 {
-	puts("Usage: " PROG_NAME " [-D <dir>] [-d <dir>] [-cmnpsh?] [<BREX> ...]");
+	puts("Usage: " PROG_NAME " [-D <dir>] [-d <dir>] [-j <n>] [-cmnpsh?] [<BREX> ...]");
 	puts("");
 	puts("Options:");
 	puts("  -c, --copy          Copy files instead of linking.");
 	puts("  -D, --srcdir <dir>  Directory where DMs are stored. Default is current directory.");
 	puts("  -d, --outdir <dir>  Directory to organize DMs in to. Default is \"" DEFAULT_SNS_DNAME "\"");
 	puts("  -h, -?, --help      Show usage message.");
+	puts("  -j, --jobs <n>      Place <n> DMs at a time.");
 	puts("  -m, --move          Move files instead of linking.");
 	puts("  -n, --only-code     Only use the SNS code to name directories.");
 	puts("  -p, --print         Print SNS instead of organizing.");
@@ -406,14 +666,16 @@ int main(int argc, char **argv)
 	bool printsns = false;
 	char *snsdname = NULL;
 	char *srcdname = NULL;
+	int njobs = 1;
 
-	const char *sopts = "cD:d:mnpsh?";
+	const char *sopts = "cD:d:j:mnpsh?";
 	struct option lopts[] = {
 		{"version"  , no_argument      , 0, 0},
 		{"help"     , no_argument      , 0, 'h'},
 		{"copy"     , no_argument      , 0, 'c'},
 		{"srcdir"   , required_argument, 0, 'D'},
 		{"outdir"   , required_argument, 0, 'd'},
+		{"jobs"     , required_argument, 0, 'j'},
 		{"move"     , no_argument      , 0, 'm'},
 		{"only-code", no_argument      , 0, 'n'},
 		{"print"    , no_argument      , 0, 'p'},
@@ -435,11 +697,17 @@ int main(int argc, char **argv)
 				}
 				LIBXML2_PARSE_LONGOPT_HANDLE(lopts, loptind)
 				break;
-			case 'c': linkfn = copy; break;
+			case 'c': linkfn = cplink; break;
 			case 'D': real_path(optarg, srcdname); break;
 			case 'd': snsdname = strdup(optarg); break;
+			case 'j':
+				if ((njobs = atoi(optarg)) < 1) {
+					fprintf(stderr, E_BAD_JOBS, optarg);
+					exit(EXIT_BAD_JOBS);
+				}
+				break;
 			case 's': linkfn = slink; break;
-			case 'm': linkfn = rename; break;
+			case 'm': linkfn = mvlink; break;
 			case 'n': only_numb = true; break;
 			case 'p': printsns = true; break;
 			case 'h':
@@ -453,10 +721,10 @@ int main(int argc, char **argv)
 
 	if (optind < argc) {
 		for (i = optind; i < argc; ++i) {
-			print_or_setup_sns(argv[i], printsns, snsdname, srcdname);
+			print_or_setup_sns(argv[i], printsns, snsdname, srcdname, njobs);
 		}
 	} else {
-		print_or_setup_sns("-", printsns, snsdname, srcdname);
+		print_or_setup_sns("-", printsns, snsdname, srcdname, njobs);
 	}
 
 	free(snsdname);
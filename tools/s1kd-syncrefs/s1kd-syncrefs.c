@@ -4,6 +4,7 @@
 #include <string.h>
 #include <stdbool.h>
 #include <assert.h>
+#include <pthread.h>
 #include <libxml/tree.h>
 #include <libxml/xpath.h>
 #include "s1kd_tools.h"
@@ -14,43 +15,68 @@
 #define EP "2" /* externalPubRef */
 
 #define PROG_NAME "s1kd-syncrefs"
-#define VERSION "1.8.0"
+#define VERSION "1.9.0"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 #define INF_PREFIX PROG_NAME ": INFO: "
 
 #define E_BAD_LIST ERR_PREFIX "Could not read list: %s\n"
 #define E_MAX_REFS ERR_PREFIX "Maximum references reached: %d\n"
+#define E_BAD_JOBS ERR_PREFIX "Bad number of jobs: %s\n"
 #define I_SYNCREFS INF_PREFIX "Synchronizing references in %s...\n"
 #define I_DELREFS  INF_PREFIX "Deleting refs table in %s...\n"
 
 #define EXIT_INVALID_DM 1
 #define EXIT_MAX_REFS 2
-
-static unsigned MAX_REFS = 1;
+#define EXIT_BAD_JOBS 3
 
 struct ref {
-	char code[256];
+	xmlChar *code;
 	xmlNodePtr ref;
 };
 
+/* The unique references found in a data module.
+ *
+ * The set of codes is used to skip duplicate references in constant time.
+ * The codes are owned by the refs array.
+ */
+struct ref_collector {
+	struct ref *refs;
+	int nrefs;
+	int max_refs;
+	xmlHashTablePtr codes;
+};
+
 static bool only_delete = false;
 static enum verbosity { QUIET, NORMAL, VERBOSE } verbosity = NORMAL;
 
-static struct ref *refs;
-static int nrefs;
+static void init_collector(struct ref_collector *c)
+{
+	c->max_refs = 1;
+	c->refs = malloc(c->max_refs * sizeof(struct ref));
+	c->nrefs = 0;
+	c->codes = xmlHashCreate(64);
+}
 
-static bool contains_code(const char *code)
+static void clear_collector(struct ref_collector *c)
 {
 	int i;
 
-	for (i = 0; i < nrefs; ++i) {
-		if (strcmp(refs[i].code, code) == 0) {
-			return true;
-		}
+	for (i = 0; i < c->nrefs; ++i) {
+		xmlFree(c->refs[i].code);
 	}
 
-	return false;
+	c->nrefs = 0;
+
+	xmlHashFree(c->codes, NULL);
+	c->codes = xmlHashCreate(64);
+}
+
+static void free_collector(struct ref_collector *c)
+{
+	clear_collector(c);
+	xmlHashFree(c->codes, NULL);
+	free(c->refs);
 }
 
 static xmlNodePtr find_child(xmlNodePtr parent, const char *child_name)
@@ -85,9 +111,26 @@ static xmlNodePtr first_xpath_node(xmlDocPtr doc, xmlNodePtr node, const char *e
 	return first;
 }
 
-static char *first_xpath_string(xmlDocPtr doc, xmlNodePtr node, const char *expr)
+/* Return part of a code, from either an attribute (Issue 4.0+) or a child
+ * element (Issue 3.0 and lower). */
+static char *code_part(xmlNodePtr code, const char *attr, const char *elem)
 {
-	return (char *) xmlNodeGetContent(first_xpath_node(doc, node, expr));
+	xmlChar *part;
+	xmlNodePtr child;
+
+	if (!code) {
+		return NULL;
+	}
+
+	if ((part = xmlGetProp(code, BAD_CAST attr))) {
+		return (char *) part;
+	}
+
+	if (elem && (child = find_child(code, elem))) {
+		return (char *) xmlNodeGetContent(child);
+	}
+
+	return NULL;
 }
 
 static bool is_ref(xmlNodePtr node)
@@ -100,9 +143,11 @@ static bool is_ref(xmlNodePtr node)
 		xmlStrcmp(node->name, BAD_CAST "externalPubRef") == 0);
 }
 
-static void copy_code(char *dst, xmlNodePtr ref)
+/* Return a normalised code for a reference. */
+static xmlChar *copy_code(xmlNodePtr ref)
 {
 	xmlNodePtr code;
+	xmlChar *dst;
 
 	char *model_ident_code;
 
@@ -124,36 +169,43 @@ static void copy_code(char *dst, xmlNodePtr ref)
 
 		code = first_xpath_node(NULL, ref, ".//dmCode|.//avee");
 
-		model_ident_code     = first_xpath_string(NULL, code, "@modelIdentCode|modelic");
-		system_diff_code     = first_xpath_string(NULL, code, "@systemDiffCode|sdc");
-		system_code          = first_xpath_string(NULL, code, "@systemCode|chapnum");
-		sub_system_code      = first_xpath_string(NULL, code, "@subSystemCode|section");
-		sub_sub_system_code  = first_xpath_string(NULL, code, "@subSubSystemCode|subsect");
-		assy_code            = first_xpath_string(NULL, code, "@assyCode|subject");
-		disassy_code         = first_xpath_string(NULL, code, "@disassyCode|discode");
-		disassy_code_variant = first_xpath_string(NULL, code, "@disassyCodeVariant|discodev");
-		info_code            = first_xpath_string(NULL, code, "@infoCode|incode");
-		info_code_variant    = first_xpath_string(NULL, code, "@infoCodeVariant|incodev");
-		item_location_code   = first_xpath_string(NULL, code, "@itemLocationCode|itemloc");
-		learn_code           = first_xpath_string(NULL, code, "@learnCode");
-		learn_event_code     = first_xpath_string(NULL, code, "@learnEventCode");
+		model_ident_code     = code_part(code, "modelIdentCode", "modelic");
+		system_diff_code     = code_part(code, "systemDiffCode", "sdc");
+		system_code          = code_part(code, "systemCode", "chapnum");
+		sub_system_code      = code_part(code, "subSystemCode", "section");
+		sub_sub_system_code  = code_part(code, "subSubSystemCode", "subsect");
+		assy_code            = code_part(code, "assyCode", "subject");
+		disassy_code         = code_part(code, "disassyCode", "discode");
+		disassy_code_variant = code_part(code, "disassyCodeVariant", "discodev");
+		info_code            = code_part(code, "infoCode", "incode");
+		info_code_variant    = code_part(code, "infoCodeVariant", "incodev");
+		item_location_code   = code_part(code, "itemLocationCode", "itemloc");
+		learn_code           = code_part(code, "learnCode", NULL);
+		learn_event_code     = code_part(code, "learnEventCode", NULL);
 
 		if (learn_code && learn_event_code)
-			sprintf(learn, "-%s%s", learn_code, learn_event_code);
-
-		sprintf(dst, DM"%s-%s-%s-%s%s-%s-%s%s-%s%s-%s%s",
-			model_ident_code,
-			system_diff_code,
-			system_code,
-			sub_system_code,
-			sub_sub_system_code,
-			assy_code,
-			disassy_code,
-			disassy_code_variant,
-			info_code,
-			info_code_variant,
-			item_location_code,
-			learn);
+			snprintf(learn, 6, "-%s%s", learn_code, learn_event_code);
+
+		dst = xmlStrdup(BAD_CAST DM);
+		dst = xmlStrcat(dst, BAD_CAST model_ident_code);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST system_diff_code);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST system_code);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST sub_system_code);
+		dst = xmlStrcat(dst, BAD_CAST sub_sub_system_code);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST assy_code);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST disassy_code);
+		dst = xmlStrcat(dst, BAD_CAST disassy_code_variant);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST info_code);
+		dst = xmlStrcat(dst, BAD_CAST info_code_variant);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST item_location_code);
+		dst = xmlStrcat(dst, BAD_CAST learn);
 
 		xmlFree(model_ident_code);
 		xmlFree(system_diff_code);
@@ -180,11 +232,14 @@ static void copy_code(char *dst, xmlNodePtr ref)
 		pm_number = (char *) xmlGetProp(code, BAD_CAST "pmNumber");
 		pm_volume = (char *) xmlGetProp(code, BAD_CAST "pmVolume");
 
-		sprintf(dst, PM"%s-%s-%s-%s",
-			model_ident_code,
-			pm_issuer,
-			pm_number,
-			pm_volume);
+		dst = xmlStrdup(BAD_CAST PM);
+		dst = xmlStrcat(dst, BAD_CAST model_ident_code);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST pm_issuer);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST pm_number);
+		dst = xmlStrcat(dst, BAD_CAST "-");
+		dst = xmlStrcat(dst, BAD_CAST pm_volume);
 
 		xmlFree(model_ident_code);
 		xmlFree(pm_issuer);
@@ -196,55 +251,61 @@ static void copy_code(char *dst, xmlNodePtr ref)
 		code  = first_xpath_node(NULL, ref, ".//externalPubCode");
 		title = first_xpath_node(NULL, ref, ".//externalPubTitle");
 
+		dst = xmlStrdup(BAD_CAST EP);
+
 		if (code) {
-			char *code_content;
+			xmlChar *code_content;
 
-			code_content = (char *) xmlNodeGetContent(code);
-			sprintf(dst, EP"%s", code_content);
+			code_content = xmlNodeGetContent(code);
+			dst = xmlStrcat(dst, code_content);
 			xmlFree(code_content);
 		} else if (title) {
-			char *title_content;
+			xmlChar *title_content;
 
-			title_content = (char *) xmlNodeGetContent(title);
-			sprintf(dst, EP"%s", title_content);
+			title_content = xmlNodeGetContent(title);
+			dst = xmlStrcat(dst, title_content);
 			xmlFree(title_content);
-		} 
+		}
 	} else {
-		strcpy(dst, "");
+		dst = xmlStrdup(BAD_CAST "");
 	}
+
+	return dst;
 }
 
-static void resize(void)
+static void resize(struct ref_collector *c)
 {
-	if (!(refs = realloc(refs, (MAX_REFS *= 2) * sizeof(struct ref)))) {
+	if (!(c->refs = realloc(c->refs, (c->max_refs *= 2) * sizeof(struct ref)))) {
 		if (verbosity >= NORMAL) {
-			fprintf(stderr, E_MAX_REFS, nrefs);
+			fprintf(stderr, E_MAX_REFS, c->nrefs);
 		}
 		exit(EXIT_MAX_REFS);
 	}
 }
 
-static void find_refs(xmlNodePtr node)
+static void find_refs(struct ref_collector *c, xmlNodePtr node)
 {
 	xmlNodePtr cur;
 
 	if (is_ref(node)) {
-		char code[256];
+		xmlChar *code;
 
-		copy_code(code, node);
+		code = copy_code(node);
 
-		if (!contains_code(code)) {
-			if (nrefs == MAX_REFS) {
-				resize();
+		if (xmlHashAddEntry(c->codes, code, node) == 0) {
+			if (c->nrefs == c->max_refs) {
+				resize(c);
 			}
 
-			strcpy(refs[nrefs].code, code);
-			refs[nrefs].ref = node;
-			++nrefs;
+			c->refs[c->nrefs].code = code;
+			c->refs[c->nrefs].ref = node;
+			++c->nrefs;
+		} else {
+			xmlFree(code);
 		}
 	} else {
 		for (cur = node->children; cur; cur = cur->next) {
-			find_refs(cur);
+			find_refs(c, cur);
 		}
 	}
 }
@@ -254,18 +315,17 @@ static int compare_refs(const void *a, const void *b)
 	struct ref *ref1 = (struct ref *) a;
 	struct ref *ref2 = (struct ref *) b;
 
-	return strcmp(ref1->code, ref2->code);
+	return xmlStrcmp(ref1->code, ref2->code);
 }
 
-static void sync_refs(xmlNodePtr dmodule)
+static void sync_refs(struct ref_collector *c, xmlNodePtr dmodule)
 {
 	int i;
+	struct ref *refs;
 
 	xmlNodePtr content, old_refs, new_refs, searchable, new_node,
 		refgrp = NULL, refdms = NULL, reftp = NULL, rdandrt = NULL;
 
-	nrefs = 0;
-
 	content = find_child(dmodule, "content");
 
 	old_refs = find_child(content, "refs");
@@ -288,12 +348,14 @@ static void sync_refs(xmlNodePtr dmodule)
 		exit(EXIT_INVALID_DM);
 	}
 
-	find_refs(searchable);
+	find_refs(c, searchable);
 
-	if (nrefs < 1) {
+	if (c->nrefs < 1) {
 		return;
 	}
 
+	refs = c->refs;
+
 	new_refs = xmlNewNode(NULL, BAD_CAST "refs");
 
 	xmlAddPrevSibling(content->children, new_refs);
@@ -304,9 +366,9 @@ static void sync_refs(xmlNodePtr dmodule)
 		rdandrt = xmlNewChild(new_refs, NULL, BAD_CAST "rdandrt", NULL);
 	}
 
-	qsort(refs, nrefs, sizeof(struct ref), compare_refs);
+	qsort(refs, c->nrefs, sizeof(struct ref), compare_refs);
 
-	for (i = 0; i < nrefs; ++i) {
+	for (i = 0; i < c->nrefs; ++i) {
 		if (refgrp) {
 			if (xmlStrcmp(refs[i].ref->name, BAD_CAST "refdm") == 0) {
 				new_node = xmlAddChild(refdms, xmlCopyNode(refs[i].ref, 1));
@@ -343,7 +405,8 @@ static void sync_refs(xmlNodePtr dmodule)
 	}
 }
 
-static void sync_refs_file(const char *path, const char *out, bool overwrite)
+/* Synchronize the references in a data module file. */
+static xmlDocPtr sync_refs_doc(struct ref_collector *c, const char *path)
 {
 	xmlDocPtr dm;
 	xmlNodePtr dmodule;
@@ -357,12 +420,47 @@ static void sync_refs_file(const char *path, const char *out, bool overwrite)
 	}
 
 	if (!(dm = read_xml_doc(path))) {
-		return;
+		return NULL;
 	}
 
 	dmodule = xmlDocGetRootElement(dm);
 
-	sync_refs(dmodule);
+	sync_refs(c, dmodule);
+
+	clear_collector(c);
+
+	return dm;
+}
+
+/* Data modules queued to be synchronized concurrently (-j). */
+static struct sync_queue {
+	char (*paths)[PATH_MAX];
+	int count;
+	int max;
+	int next;
+	int next_out;
+	pthread_mutex_t lock;
+	pthread_cond_t turn;
+} *sync_queue = NULL;
+
+static void sync_refs_file(struct ref_collector *c, const char *path, const char *out, bool overwrite)
+{
+	xmlDocPtr dm;
+
+	if (sync_queue) {
+		if (sync_queue->count == sync_queue->max) {
+			sync_queue->max *= 2;
+			sync_queue->paths = realloc(sync_queue->paths, sync_queue->max * PATH_MAX);
+		}
+
+		strcpy(sync_queue->paths[sync_queue->count++], path);
+
+		return;
+	}
+
+	if (!(dm = sync_refs_doc(c, path))) {
+		return;
+	}
 
 	if (overwrite) {
 		save_xml_doc(dm, path);
@@ -373,7 +471,7 @@ static void sync_refs_file(const char *path, const char *out, bool overwrite)
 	xmlFreeDoc(dm);
 }
 
-static void sync_refs_list(const char *path, const char *out, bool overwrite)
+static void sync_refs_list(struct ref_collector *c, const char *path, const char *out, bool overwrite)
 {
 	FILE *f;
 	char line[PATH_MAX];
@@ -391,7 +489,7 @@ static void sync_refs_list(const char *path, const char *out, bool overwrite)
 
 	while (fgets(line, PATH_MAX, f)) {
 		strtok(line, "\t\r\n");
-		sync_refs_file(line, out, overwrite);
+		sync_refs_file(c, line, out, overwrite);
 	}
 
 	if (path) {
@@ -399,14 +497,98 @@ static void sync_refs_list(const char *path, const char *out, bool overwrite)
 	}
 }
 
+/* A thread synchronizing queued data modules, with its own collector. */
+struct sync_worker {
+	pthread_t thread;
+	const char *out;
+	bool overwrite;
+};
+
+static void *sync_worker_run(void *arg)
+{
+	struct sync_worker *w = (struct sync_worker *) arg;
+	struct ref_collector c;
+
+	init_collector(&c);
+
+	while (1) {
+		int i;
+		xmlDocPtr dm;
+
+		pthread_mutex_lock(&sync_queue->lock);
+		i = sync_queue->next++;
+		pthread_mutex_unlock(&sync_queue->lock);
+
+		if (i >= sync_queue->count) {
+			break;
+		}
+
+		dm = sync_refs_doc(&c, sync_queue->paths[i]);
+
+		if (w->overwrite) {
+			if (dm) {
+				save_xml_doc(dm, sync_queue->paths[i]);
+			}
+		} else {
+			/* Output is written in the original order. */
+			pthread_mutex_lock(&sync_queue->lock);
+			while (sync_queue->next_out != i) {
+				pthread_cond_wait(&sync_queue->turn, &sync_queue->lock);
+			}
+			pthread_mutex_unlock(&sync_queue->lock);
+
+			if (dm) {
+				save_xml_doc(dm, w->out);
+			}
+
+			pthread_mutex_lock(&sync_queue->lock);
+			++sync_queue->next_out;
+			pthread_cond_broadcast(&sync_queue->turn);
+			pthread_mutex_unlock(&sync_queue->lock);
+		}
+
+		xmlFreeDoc(dm);
+	}
+
+	free_collector(&c);
+
+	return NULL;
+}
+
+/* Synchronize the queued data modules using multiple threads. */
+static void sync_refs_queue(int njobs, const char *out, bool overwrite)
+{
+	struct sync_worker *workers;
+	int i;
+
+	if (njobs > sync_queue->count) {
+		njobs = sync_queue->count;
+	}
+
+	workers = malloc(njobs * sizeof(struct sync_worker));
+
+	for (i = 0; i < njobs; ++i) {
+		workers[i].out = out;
+		workers[i].overwrite = overwrite;
+		pthread_create(&workers[i].thread, NULL, sync_worker_run, &workers[i]);
+	}
+
+	for (i = 0; i < njobs; ++i) {
+		pthread_join(workers[i].thread, NULL);
+	}
+
+	free(workers);
+}
+
 static void show_help(void)
 {
-	puts("Usage: " PROG_NAME " [-dflqvh?] [-o <out>] [<dms>]");
+	puts("Usage: " PROG_NAME " [-dflqvh?] [-j <n>] [-o <out>] [<dms>]");
 	puts("");
 	puts("Options:");
 	puts("  -d, --delete     Delete the references table.");
 	puts("  -f, --overwrite  Overwrite the data modules automatically.");
 	puts("  -h, -?, --help   Show help/usage message.");
+	puts("  -j, --jobs <n>   Synchronize <n> data modules at a time.");
 	puts("  -l, --list       Treat input as list of CSDB objects.");
 	puts("  -o, --out <out>  Output to <out> instead of stdout.");
 	puts("  -q, --quiet      Quiet mode.");
@@ -430,13 +612,17 @@ int main(int argc, char *argv[])
 
 	bool overwrite = false;
 	bool islist = false;
+	int njobs = 1;
+
+	struct ref_collector c;
 
-	const char *sopts = "dflo:qvh?";
+	const char *sopts = "dfj:lo:qvh?";
 	struct option lopts[] = {
 		{"version"  , no_argument      , 0, 0},
 		{"help"     , no_argument      , 0, 'h'},
 		{"delete"   , no_argument      , 0, 'd'},
 		{"overwrite", no_argument      , 0, 'f'},
+		{"jobs"     , required_argument, 0, 'j'},
 		{"list"     , no_argument      , 0, 'l'},
 		{"out"      , required_argument, 0, 'o'},
 		{"quiet"    , no_argument      , 0, 'q'},
@@ -446,8 +632,6 @@ int main(int argc, char *argv[])
 	};
 	int loptind = 0;
 
-	refs = malloc(MAX_REFS * sizeof(struct ref));
-
 	while ((i = getopt_long(argc, argv, sopts, lopts, &loptind)) != -1) {
 		switch (i) {
 			case 0:
@@ -463,6 +647,14 @@ int main(int argc, char *argv[])
 			case 'f':
 				overwrite = true;
 				break;
+			case 'j':
+				if ((njobs = atoi(optarg)) < 1) {
+					if (verbosity >= NORMAL) {
+						fprintf(stderr, E_BAD_JOBS, optarg);
+					}
+					exit(EXIT_BAD_JOBS);
+				}
+				break;
 			case 'l':
 				islist = true;
 				break;
@@ -482,21 +674,47 @@ int main(int argc, char *argv[])
 		}
 	}
 
+	init_collector(&c);
+
+	/* When using multiple threads, the data modules are first queued, and
+	 * then synchronized concurrently. */
+	if (njobs > 1 && (optind < argc || islist)) {
+		xmlInitParser();
+
+		sync_queue = malloc(sizeof(struct sync_queue));
+		sync_queue->max = 16;
+		sync_queue->paths = malloc(sync_queue->max * PATH_MAX);
+		sync_queue->count = 0;
+		sync_queue->next = 0;
+		sync_queue->next_out = 0;
+		pthread_mutex_init(&sync_queue->lock, NULL);
+		pthread_cond_init(&sync_queue->turn, NULL);
+	}
+
 	if (optind < argc) {
 		for (i = optind; i < argc; ++i) {
 			if (islist) {
-				sync_refs_list(argv[i], out, overwrite);
+				sync_refs_list(&c, argv[i], out, overwrite);
 			} else {
-				sync_refs_file(argv[i], out, overwrite);
+				sync_refs_file(&c, argv[i], out, overwrite);
 			}
 		}
 	} else if (islist) {
-		sync_refs_list(NULL, out, overwrite);
+		sync_refs_list(&c, NULL, out, overwrite);
 	} else {
-		sync_refs_file("-", out, false);
+		sync_refs_file(&c, "-", out, false);
+	}
+
+	if (sync_queue) {
+		sync_refs_queue(njobs, out, overwrite);
+
+		pthread_mutex_destroy(&sync_queue->lock);
+		pthread_cond_destroy(&sync_queue->turn);
+		free(sync_queue->paths);
+		free(sync_queue);
 	}
 
-	free(refs);
+	free_collector(&c);
 
 	xmlCleanupParser();
 
@@ -0,0 +1,7354 @@
+unsigned char uom_xml[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x64,
+  0x65, 0x67, 0x43, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x64,
+  0x65, 0x67, 0x43, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x31, 0x2f, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x31, 0x2f, 0x64, 0x65, 0x67, 0x46, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x52, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x4b, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x4b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63,
+  0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d,
+  0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x34, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x63, 0x6d, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x64, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x64, 0x64, 0x65, 0x67, 0x43, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x64, 0x64, 0x65, 0x67, 0x46, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x4b, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x4b, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x52, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x61, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x61, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x64, 0x65, 0x67, 0x46, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x64, 0x65, 0x67, 0x52, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x6c, 0x6f, 0x7a, 0x55, 0x53, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x66, 0x6c, 0x6f, 0x7a, 0x55, 0x53, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x66, 0x74, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66,
+  0x74, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66,
+  0x74, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x67, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x67, 0x61, 0x6c, 0x55, 0x4b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x47, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x47, 0x48, 0x7a, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x68, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x48, 0x7a, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x69, 0x6e, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x69, 0x6e, 0x34, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e,
+  0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4b, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6b, 0x67, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b,
+  0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x2f, 0x68, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x2f, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6b, 0x6d, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6b, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d,
+  0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6e,
+  0x6f, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6e, 0x6f, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4c, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x4c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x66, 0x74, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x69, 0x6e, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x69, 0x6e, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2f,
+  0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2f,
+  0x66, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6c,
+  0x62, 0x66, 0x2f, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c,
+  0x62, 0x66, 0x2f, 0x69, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c,
+  0x62, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x67, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6d, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x4d, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4d, 0x48,
+  0x7a, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x48,
+  0x7a, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x48, 0x7a, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6d, 0x69, 0x2f, 0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x69, 0x2f, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69,
+  0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x6e, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x4c, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x4c, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x6d, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x4e, 0x2e, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4e, 0x2e, 0x6d,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4e, 0x2f, 0x6d,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4e, 0x2f, 0x6d, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x72, 0x61, 0x64,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x73, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x73, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x74,
+  0x6f, 0x6e, 0x55, 0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x74, 0x6f,
+  0x6e, 0x55, 0x4b, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x74, 0x6f, 0x6e, 0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x74,
+  0x6f, 0x6e, 0x55, 0x53, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x79, 0x64, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x32, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x32, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x28, 0x39, 0x20, 0x64, 0x69, 0x76, 0x20, 0x35,
+  0x29, 0x20, 0x2b, 0x20, 0x33, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x28, 0x39, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x35, 0x29, 0x20, 0x2b, 0x20, 0x34, 0x39, 0x31, 0x2e, 0x36, 0x37, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65,
+  0x67, 0x43, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x4b, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2b, 0x20, 0x32, 0x37, 0x33, 0x2e, 0x31,
+  0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2f,
+  0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x31, 0x2f,
+  0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x28, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d,
+  0x20, 0x33, 0x32, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x35, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x39, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2b, 0x20, 0x34, 0x35, 0x39, 0x2e, 0x36, 0x37, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x46,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x4b, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x28, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x33, 0x32, 0x29, 0x20, 0x2a, 0x20,
+  0x28, 0x35, 0x20, 0x64, 0x69, 0x76, 0x20, 0x39, 0x29, 0x20, 0x2b, 0x20,
+  0x32, 0x37, 0x33, 0x2e, 0x31, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x28, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x34, 0x39, 0x31, 0x2e, 0x36, 0x37,
+  0x29, 0x20, 0x2a, 0x20, 0x28, 0x35, 0x20, 0x64, 0x69, 0x76, 0x20, 0x39,
+  0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2f,
+  0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x31, 0x2f,
+  0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20,
+  0x34, 0x35, 0x39, 0x2e, 0x36, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x4b, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x28, 0x35, 0x20, 0x64, 0x69, 0x76, 0x20, 0x39, 0x29, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x4b, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x43, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x32, 0x37, 0x33, 0x2e, 0x31,
+  0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2f,
+  0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67,
+  0x46, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x28, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x32, 0x37,
+  0x33, 0x2e, 0x31, 0x35, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x39, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x35, 0x29, 0x20, 0x2b, 0x20, 0x33, 0x32, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2f, 0x4b, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x38, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x38, 0x32, 0x2e, 0x38, 0x38,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x30, 0x2e, 0x34, 0x38, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x32, 0x2e, 0x35, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6b, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x31, 0x65, 0x2b, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x63, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x30, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x36, 0x30, 0x39, 0x33, 0x34, 0x2e, 0x34,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x63, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6e, 0x61,
+  0x75, 0x74, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x31, 0x38, 0x35, 0x32, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x79, 0x64, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x39, 0x31, 0x2e, 0x34, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x66, 0x74, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x39, 0x32, 0x39, 0x2e, 0x30, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x69, 0x6e, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x36, 0x2e, 0x34, 0x35, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x31, 0x65, 0x2b, 0x31, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x31, 0x30, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x69, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x32, 0x2e, 0x35, 0x39, 0x65, 0x2b, 0x31, 0x30, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x31, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79,
+  0x64, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x38, 0x33, 0x36, 0x31, 0x2e, 0x32, 0x37, 0x34, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x32, 0x38, 0x33, 0x31, 0x36, 0x2e, 0x38, 0x34, 0x37,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x33,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x36, 0x2e, 0x33, 0x38,
+  0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d,
+  0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x31,
+  0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d,
+  0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63,
+  0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x34, 0x2e, 0x31,
+  0x36, 0x38, 0x65, 0x2b, 0x31, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31,
+  0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x63, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x33,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x37, 0x36,
+  0x34, 0x35, 0x35, 0x34, 0x2e, 0x38, 0x35, 0x38, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x34, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x69, 0x6e, 0x34, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x30, 0x2e, 0x32, 0x34, 0x30, 0x32, 0x35, 0x31, 0x34, 0x37, 0x39,
+  0x39, 0x34, 0x35, 0x33, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x64, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x28, 0x39, 0x20, 0x64, 0x69, 0x76, 0x20, 0x35, 0x29, 0x20,
+  0x2b, 0x20, 0x33, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x64, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x64, 0x64, 0x65, 0x67, 0x4b, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2b,
+  0x20, 0x32, 0x37, 0x33, 0x2e, 0x31, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x28, 0x39, 0x20, 0x64, 0x69, 0x76, 0x20, 0x35,
+  0x29, 0x20, 0x2b, 0x20, 0x34, 0x39, 0x31, 0x2e, 0x36, 0x37, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x46,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x43, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x28, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x33, 0x32, 0x29, 0x20,
+  0x2a, 0x20, 0x28, 0x35, 0x20, 0x64, 0x69, 0x76, 0x20, 0x39, 0x29, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67,
+  0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x4b,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x28,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x33, 0x32, 0x29,
+  0x20, 0x2a, 0x20, 0x28, 0x35, 0x20, 0x64, 0x69, 0x76, 0x20, 0x39, 0x29,
+  0x20, 0x2b, 0x20, 0x32, 0x37, 0x33, 0x2e, 0x31, 0x35, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x46, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2b, 0x20, 0x34, 0x35, 0x39, 0x2e, 0x36, 0x37,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x64, 0x65,
+  0x67, 0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67,
+  0x43, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x32, 0x37, 0x33,
+  0x2e, 0x31, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x64, 0x64, 0x65, 0x67, 0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64,
+  0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x28, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d,
+  0x20, 0x32, 0x37, 0x33, 0x2e, 0x31, 0x35, 0x29, 0x20, 0x2a, 0x20, 0x28,
+  0x39, 0x20, 0x64, 0x69, 0x76, 0x20, 0x35, 0x29, 0x20, 0x2b, 0x20, 0x33,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x64,
+  0x65, 0x67, 0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x64, 0x65,
+  0x67, 0x52, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e,
+  0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x64,
+  0x65, 0x67, 0x52, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x64, 0x65,
+  0x67, 0x43, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x28, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x34,
+  0x39, 0x31, 0x2e, 0x36, 0x37, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x35, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x39, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2d, 0x20, 0x34, 0x35, 0x39, 0x2e, 0x36, 0x37, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x52, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x64, 0x65, 0x67, 0x4b, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x28, 0x35, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x39, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x64, 0x65, 0x67, 0x61, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x72, 0x61,
+  0x64, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x28, 0x24, 0x70,
+  0x69, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x38, 0x30, 0x29, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x28, 0x39, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x35, 0x29, 0x20, 0x2b, 0x20, 0x33, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x28, 0x39, 0x20, 0x64, 0x69, 0x76, 0x20, 0x35, 0x29, 0x20,
+  0x2b, 0x20, 0x34, 0x39, 0x31, 0x2e, 0x36, 0x37, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x4b, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2b, 0x20,
+  0x32, 0x37, 0x33, 0x2e, 0x31, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x28, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2d, 0x20, 0x33, 0x32, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x35, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x39, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2b, 0x20,
+  0x34, 0x35, 0x39, 0x2e, 0x36, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x4b, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x28, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x33,
+  0x32, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x35, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x39, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x37, 0x33, 0x2e, 0x31, 0x35, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x52,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x28, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x34, 0x39, 0x31, 0x2e, 0x36,
+  0x37, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x35, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x39, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64,
+  0x65, 0x67, 0x52, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x65, 0x67,
+  0x46, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d, 0x20, 0x34, 0x35, 0x39,
+  0x2e, 0x36, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4b, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x28, 0x35, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x39, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x63, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31,
+  0x38, 0x32, 0x2e, 0x38, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x61,
+  0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x37, 0x32, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f,
+  0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x35, 0x34, 0x36, 0x2e, 0x38,
+  0x30, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66,
+  0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x38, 0x32,
+  0x38, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66,
+  0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x38,
+  0x38, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66,
+  0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x38, 0x32,
+  0x38, 0x2e, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x31, 0x32, 0x2e, 0x36, 0x38, 0x36,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x61, 0x74,
+  0x68, 0x6f, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x6c, 0x6f, 0x7a, 0x55, 0x53, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x32, 0x38, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x6c, 0x6f, 0x7a,
+  0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4c, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x33, 0x2e, 0x38, 0x31,
+  0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x6c,
+  0x6f, 0x7a, 0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x4c,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x39, 0x2e, 0x35,
+  0x37, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66,
+  0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x33, 0x30, 0x2e, 0x34, 0x38, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x36, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x69, 0x6e, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x32, 0x38, 0x30, 0x2e, 0x38,
+  0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x2e, 0x32, 0x38, 0x31, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x35, 0x32, 0x38, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x33, 0x30,
+  0x34, 0x2e, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74,
+  0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x36, 0x30, 0x37, 0x36, 0x2e, 0x31, 0x31, 0x35, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x79, 0x64, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66,
+  0x74, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x39, 0x32, 0x39, 0x2e, 0x30,
+  0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74,
+  0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x34, 0x34, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x32, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x30, 0x37, 0x36, 0x65, 0x2b, 0x37,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x32,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x2e, 0x37, 0x36, 0x34,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x32,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x32, 0x2e, 0x37, 0x38, 0x38,
+  0x65, 0x2b, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x66, 0x74, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x32,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x39, 0x32, 0x39, 0x30,
+  0x33, 0x2e, 0x30, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x66, 0x74, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64,
+  0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x39,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x33,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x38, 0x33, 0x31, 0x36, 0x2e, 0x38,
+  0x34, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66,
+  0x74, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x37, 0x32, 0x38, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x2e, 0x35, 0x33, 0x31, 0x65,
+  0x2b, 0x31, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x66, 0x74, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x33, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x35, 0x2e,
+  0x33, 0x31, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x66, 0x74, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x33,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x2e,
+  0x34, 0x37, 0x32, 0x65, 0x2b, 0x31, 0x31, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x32, 0x2e, 0x38, 0x33, 0x32, 0x65, 0x2b, 0x37, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x32, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x67, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x67, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x30,
+  0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x67, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x34, 0x35, 0x33, 0x2e, 0x35, 0x39,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x67, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x67, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x67, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x74,
+  0x6f, 0x6e, 0x55, 0x53, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x39, 0x30, 0x37, 0x31, 0x38, 0x34, 0x2e, 0x37, 0x34, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55,
+  0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4c, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x34, 0x2e, 0x35, 0x34, 0x36, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x6c, 0x6f, 0x7a, 0x55, 0x53, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x32, 0x38, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4c, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x33, 0x2e, 0x37, 0x38, 0x35, 0x34, 0x31, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x4c, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x33, 0x37, 0x38, 0x35, 0x2e, 0x34, 0x31, 0x32,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x47, 0x48, 0x7a,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x48, 0x7a, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x31, 0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x47, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x4d, 0x48, 0x7a, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x47, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x48, 0x7a, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x65,
+  0x2b, 0x31, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x6e, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x36, 0x30, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x73, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x33, 0x36, 0x30,
+  0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x48, 0x7a,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x47, 0x48, 0x7a, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x39, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x48, 0x7a, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x4d, 0x48, 0x7a, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x36, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6d, 0x48, 0x7a, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x35, 0x34,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x37, 0x32, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b,
+  0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x33,
+  0x39, 0x33, 0x37, 0x30, 0x2e, 0x30, 0x37, 0x39, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x33, 0x39, 0x2e, 0x33, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x36, 0x33,
+  0x33, 0x36, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x35, 0x2e, 0x34, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x37, 0x32, 0x39, 0x31, 0x33,
+  0x2e, 0x33, 0x38, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x36, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x36, 0x2e, 0x34, 0x35, 0x32, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x66, 0x74, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x34, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x31, 0x2e, 0x35, 0x35, 0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x31, 0x35, 0x35, 0x30, 0x2e, 0x30, 0x30, 0x33, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x34, 0x2e, 0x30, 0x31, 0x34, 0x65,
+  0x2b, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69,
+  0x6e, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x36, 0x34, 0x35, 0x2e, 0x31,
+  0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e,
+  0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x32, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x32, 0x39, 0x36,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x33,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x36, 0x2e, 0x33, 0x38, 0x37, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x37, 0x32, 0x38, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x36, 0x2e, 0x31, 0x30, 0x32, 0x65, 0x2b,
+  0x31, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69,
+  0x6e, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x36, 0x31, 0x30, 0x32,
+  0x33, 0x2e, 0x37, 0x34, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x69, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x32, 0x2e, 0x35, 0x34, 0x34, 0x65, 0x2b, 0x31, 0x34, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x31, 0x36, 0x33, 0x38, 0x37, 0x2e, 0x30, 0x36, 0x34, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x34, 0x36, 0x36, 0x35, 0x36, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x34, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x34, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x30, 0x2e, 0x32, 0x34, 0x30, 0x32,
+  0x35, 0x31, 0x34, 0x37, 0x39, 0x39, 0x34, 0x35, 0x33, 0x38, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4b, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2d, 0x20, 0x32, 0x37, 0x33, 0x2e, 0x31, 0x35, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x64, 0x65, 0x67, 0x46, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x28, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2d,
+  0x20, 0x32, 0x37, 0x33, 0x2e, 0x31, 0x35, 0x29, 0x20, 0x2a, 0x20, 0x28,
+  0x39, 0x20, 0x64, 0x69, 0x76, 0x20, 0x35, 0x29, 0x20, 0x2b, 0x20, 0x33,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4b, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x52, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x38, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x67, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x67, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x30,
+  0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b,
+  0x67, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x32, 0x30, 0x35, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x67, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x67, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x67, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x74, 0x6f, 0x6e, 0x55, 0x4b, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x31, 0x36, 0x2e, 0x30, 0x34,
+  0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x67,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x74, 0x6f, 0x6e, 0x55, 0x53, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x39, 0x30, 0x37,
+  0x2e, 0x31, 0x38, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6b, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x35, 0x34, 0x36, 0x2e,
+  0x38, 0x30, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6b, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x33, 0x32, 0x38, 0x30, 0x2e, 0x38,
+  0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x33, 0x39, 0x33, 0x37, 0x30, 0x2e, 0x30, 0x37,
+  0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x31, 0x2e, 0x36, 0x30, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x65, 0x2b, 0x36,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x38,
+  0x35, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b,
+  0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x30, 0x39, 0x33, 0x2e, 0x36, 0x31,
+  0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d,
+  0x2f, 0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6e, 0x6f, 0x74,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x2e,
+  0x38, 0x35, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6b, 0x6d, 0x2f, 0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69,
+  0x2f, 0x68, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x31, 0x2e, 0x36, 0x30, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63,
+  0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x65,
+  0x2b, 0x31, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6b, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x32,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x30, 0x37,
+  0x36, 0x65, 0x2b, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e,
+  0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x35,
+  0x35, 0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x32,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6b, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x32,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x32, 0x2e,
+  0x35, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b,
+  0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x65, 0x2b, 0x31, 0x32,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x32,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x32, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x31, 0x39, 0x36, 0x65, 0x2b,
+  0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d,
+  0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x65, 0x2b, 0x31, 0x35, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x33, 0x2e, 0x35, 0x33, 0x31, 0x65, 0x2b, 0x31,
+  0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d,
+  0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x36, 0x2e, 0x31, 0x30, 0x32, 0x65,
+  0x2b, 0x31, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6b, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x33, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x65, 0x2b, 0x39, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x34, 0x2e, 0x31, 0x36, 0x38, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x31, 0x65, 0x2b, 0x31, 0x38, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x31, 0x2e, 0x33, 0x30, 0x38, 0x65, 0x2b, 0x39, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6e, 0x6f, 0x74, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x2f, 0x68, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x38, 0x35, 0x32, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6e, 0x6f, 0x74, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x2f, 0x68, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x31, 0x35, 0x31, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4c, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x66, 0x6c, 0x6f, 0x7a, 0x55, 0x53, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x33, 0x33, 0x2e, 0x38, 0x31, 0x34, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4c, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x34, 0x2e, 0x35, 0x34, 0x36, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4c, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x2e, 0x37, 0x38, 0x35, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4c, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6d, 0x4c, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6c, 0x62, 0x66, 0x2e, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6c, 0x62, 0x66, 0x2e, 0x69, 0x6e, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x4e, 0x2e, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x31, 0x2e, 0x33, 0x35, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x69, 0x6e, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x66, 0x74, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x32, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x69, 0x6e,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4e, 0x2e, 0x6d, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x38, 0x2e, 0x38, 0x35, 0x31,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x66,
+  0x2f, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x66,
+  0x2f, 0x69, 0x6e, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6c, 0x62,
+  0x66, 0x2f, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x4e, 0x2f,
+  0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x34, 0x2e,
+  0x35, 0x39, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6c, 0x62, 0x66, 0x2f, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6c, 0x62, 0x66, 0x2f, 0x66, 0x74, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2f, 0x69, 0x6e, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x4e, 0x2f, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x31, 0x37, 0x35, 0x2e, 0x31, 0x32, 0x37, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x67, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x34, 0x35, 0x33, 0x2e, 0x35, 0x39, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6b, 0x67, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x32, 0x2e, 0x32, 0x30, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x67, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x34, 0x35,
+  0x33, 0x35, 0x39, 0x32, 0x2e, 0x33, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x74, 0x6f, 0x6e, 0x55, 0x53, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x32, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x63, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x30,
+  0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x38,
+  0x32, 0x38, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x33, 0x2e, 0x32, 0x38, 0x31, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x33, 0x39, 0x2e, 0x33, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x30,
+  0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x36, 0x30, 0x39, 0x2e, 0x33, 0x34,
+  0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6e,
+  0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x31, 0x38, 0x35, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79,
+  0x64, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x30,
+  0x39, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x30, 0x30, 0x30, 0x30, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x30, 0x2e, 0x37, 0x36, 0x34, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x31, 0x35, 0x35, 0x30, 0x2e, 0x30, 0x30, 0x33, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x69, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x32, 0x2e, 0x35, 0x39, 0x65, 0x2b, 0x36, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6d, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x79, 0x64, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31,
+  0x2e, 0x31, 0x39, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x33,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x65, 0x2b, 0x36,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x33, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x33, 0x35, 0x2e, 0x33, 0x31, 0x35, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x36, 0x31, 0x30, 0x32, 0x33, 0x2e, 0x37, 0x34, 0x34, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x34, 0x2e, 0x31, 0x36, 0x38, 0x65, 0x2b, 0x39, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x79, 0x64, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31,
+  0x2e, 0x33, 0x30, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6d, 0x67, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x67, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x30, 0x30,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x67, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x67, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x36, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x67, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x34, 0x35, 0x33, 0x35, 0x39, 0x32, 0x2e, 0x33, 0x37,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x67, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x74, 0x6f, 0x6e, 0x55, 0x53, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x39, 0x2e, 0x30, 0x32,
+  0x37, 0x65, 0x2b, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x4d, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x47, 0x48,
+  0x7a, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31,
+  0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6d, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x47, 0x48, 0x7a,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x65,
+  0x2b, 0x31, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x4d, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x48, 0x7a, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x65, 0x2b, 0x36, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x48, 0x7a, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x48, 0x7a, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4d, 0x48, 0x7a, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6d, 0x48, 0x7a, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x31, 0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6d, 0x48, 0x7a, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x4d, 0x48, 0x7a, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x31, 0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x36, 0x30, 0x39,
+  0x33, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x69, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f,
+  0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x38, 0x38, 0x30,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x35, 0x32, 0x38, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x69, 0x6e, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x36, 0x33,
+  0x33, 0x36, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6d, 0x69, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x36, 0x30, 0x39, 0x33,
+  0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x36, 0x30, 0x39, 0x2e, 0x33, 0x34, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x31, 0x36, 0x30, 0x39, 0x33, 0x34, 0x34, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x31, 0x35, 0x31, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x31, 0x37, 0x36, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6d, 0x69, 0x2f, 0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6b, 0x6d, 0x2f, 0x68, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x31, 0x2e, 0x36, 0x30, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6d, 0x69, 0x2f, 0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6b, 0x6e, 0x6f, 0x74, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x31, 0x2e, 0x31, 0x35, 0x31, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x32, 0x2e, 0x35, 0x39, 0x65, 0x2b, 0x31, 0x30, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x66, 0x74, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x32, 0x2e, 0x37, 0x38, 0x38, 0x65, 0x2b, 0x37, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x34, 0x2e, 0x30, 0x31, 0x34, 0x65, 0x2b, 0x39, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x32, 0x2e, 0x35, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x32,
+  0x2e, 0x35, 0x39, 0x65, 0x2b, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6d, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x32,
+  0x2e, 0x35, 0x39, 0x65, 0x2b, 0x31, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x79, 0x64, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x33, 0x2e, 0x30, 0x39, 0x38, 0x65, 0x2b, 0x36, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x63, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x34, 0x2e, 0x31, 0x36, 0x38, 0x65, 0x2b, 0x31, 0x35, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x2e, 0x34, 0x37, 0x32, 0x65, 0x2b, 0x31, 0x31,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x33,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x35, 0x34, 0x34, 0x65, 0x2b,
+  0x31, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x69, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x34, 0x2e, 0x31, 0x36, 0x38,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x33,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x34, 0x2e, 0x31, 0x36, 0x38, 0x65, 0x2b, 0x39,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x33,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x34, 0x2e, 0x31, 0x36, 0x38, 0x65, 0x2b,
+  0x31, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x69, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x33, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x35, 0x2e, 0x34, 0x35, 0x32,
+  0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6d, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x68, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x36, 0x30, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x6e, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x73, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x36, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6d, 0x4c, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x6c, 0x6f, 0x7a,
+  0x55, 0x53, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x32, 0x39, 0x2e, 0x35, 0x37, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6d, 0x4c, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x67,
+  0x61, 0x6c, 0x55, 0x53, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x33, 0x37, 0x38, 0x35, 0x2e, 0x34, 0x31, 0x32, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x4c, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x4c, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63,
+  0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31,
+  0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d,
+  0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x38,
+  0x32, 0x38, 0x2e, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6d, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x30, 0x34,
+  0x2e, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x32, 0x35, 0x2e, 0x34, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x36, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6d, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x36,
+  0x30, 0x39, 0x65, 0x2b, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6e, 0x61,
+  0x75, 0x74, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x31, 0x2e, 0x38, 0x35, 0x32, 0x65, 0x2b, 0x36, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x39, 0x31, 0x34, 0x2e, 0x34, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x31, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x66, 0x74, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x39, 0x32, 0x39, 0x30, 0x33, 0x2e, 0x30, 0x34, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x36, 0x34, 0x35, 0x2e, 0x31, 0x36, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x31, 0x32, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x32, 0x2e, 0x35, 0x39, 0x65, 0x2b,
+  0x31, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x32, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x38, 0x33, 0x36,
+  0x31, 0x32, 0x37, 0x2e, 0x33, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x63, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x31, 0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66,
+  0x74, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d,
+  0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20,
+  0x32, 0x2e, 0x38, 0x33, 0x32, 0x65, 0x2b, 0x37, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x31, 0x36, 0x33, 0x38, 0x37, 0x2e, 0x30, 0x36, 0x34,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x33,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x31, 0x38,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x33,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x65, 0x2b, 0x39, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x64, 0x69, 0x76, 0x20, 0x34, 0x2e, 0x31, 0x36, 0x38, 0x65, 0x2b,
+  0x31, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x33, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x37, 0x2e, 0x36,
+  0x34, 0x36, 0x65, 0x2b, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x4e, 0x2e, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c,
+  0x62, 0x66, 0x2e, 0x66, 0x74, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64,
+  0x69, 0x76, 0x20, 0x31, 0x2e, 0x33, 0x35, 0x36, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4e, 0x2e, 0x6d, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x69, 0x6e, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x38, 0x2e, 0x38, 0x35, 0x31, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4e, 0x2f, 0x6d, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2f, 0x66, 0x74, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x34, 0x2e, 0x35, 0x39,
+  0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4e, 0x2f,
+  0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2f, 0x69,
+  0x6e, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31,
+  0x37, 0x35, 0x2e, 0x31, 0x32, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x31, 0x38, 0x35, 0x32, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x66, 0x61, 0x74, 0x68, 0x6f, 0x6d, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x30, 0x31, 0x32, 0x2e, 0x36,
+  0x38, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6e,
+  0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66,
+  0x74, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x36, 0x30, 0x37,
+  0x36, 0x2e, 0x31, 0x31, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x37, 0x32, 0x39, 0x31, 0x33, 0x2e, 0x33, 0x38, 0x36, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x38, 0x35, 0x32, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x2a, 0x20, 0x31, 0x38, 0x35, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x31, 0x2e, 0x31, 0x35, 0x31, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x31, 0x2e, 0x38, 0x35, 0x32, 0x65, 0x2b, 0x36, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d,
+  0x69, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x30, 0x32, 0x35, 0x2e, 0x33, 0x37,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x72, 0x61,
+  0x64, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x61, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x28, 0x31, 0x38, 0x30, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x24, 0x70, 0x69, 0x29, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x73, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x68, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x33,
+  0x36, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x73, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x6e, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x36, 0x30, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x74, 0x6f, 0x6e, 0x55, 0x4b,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x67, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x2a, 0x20, 0x31, 0x30, 0x31, 0x36, 0x2e, 0x30, 0x34, 0x37,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x74, 0x6f, 0x6e,
+  0x55, 0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x74, 0x6f, 0x6e, 0x55,
+  0x53, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x31,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x74, 0x6f,
+  0x6e, 0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x67, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x39, 0x30, 0x37, 0x31, 0x38, 0x34,
+  0x2e, 0x37, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x74, 0x6f, 0x6e, 0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b,
+  0x67, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x39, 0x30, 0x37,
+  0x2e, 0x31, 0x38, 0x35, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x74, 0x6f, 0x6e, 0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6c, 0x62, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x32,
+  0x30, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x74, 0x6f, 0x6e, 0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x67, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x39, 0x2e, 0x30,
+  0x37, 0x32, 0x65, 0x2b, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x74, 0x6f, 0x6e, 0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x74, 0x6f, 0x6e, 0x55, 0x4b, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x31, 0x32, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x63, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x39,
+  0x31, 0x2e, 0x34, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x79, 0x64, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x61, 0x74,
+  0x68, 0x6f, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76,
+  0x20, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79,
+  0x64, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x2a, 0x20, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69,
+  0x6e, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x33, 0x36, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x30, 0x39, 0x33, 0x2e, 0x36, 0x31, 0x33,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x30, 0x39, 0x34, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6d, 0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69,
+  0x76, 0x20, 0x31, 0x37, 0x36, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x6d, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x39, 0x31, 0x34,
+  0x2e, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79,
+  0x64, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6e, 0x61, 0x75, 0x74, 0x6d,
+  0x69, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x32,
+  0x30, 0x32, 0x35, 0x2e, 0x33, 0x37, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x38, 0x33, 0x36, 0x31, 0x2e, 0x32, 0x37, 0x34, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x32, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x66, 0x74, 0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75,
+  0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a,
+  0x20, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79,
+  0x64, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x31, 0x32, 0x39, 0x36, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x32, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x32, 0x22, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x31, 0x39, 0x36, 0x65,
+  0x2b, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79,
+  0x64, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x31, 0x39,
+  0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64,
+  0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x33, 0x2e, 0x30, 0x39,
+  0x38, 0x65, 0x2b, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x79, 0x64, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x6d,
+  0x32, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x38, 0x33, 0x36,
+  0x31, 0x32, 0x37, 0x2e, 0x33, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x63, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61,
+  0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x37,
+  0x36, 0x34, 0x35, 0x35, 0x34, 0x2e, 0x38, 0x35, 0x38, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2a, 0x20, 0x32, 0x37, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e,
+  0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, 0x34, 0x36, 0x36,
+  0x35, 0x36, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79,
+  0x64, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31, 0x2e, 0x33,
+  0x30, 0x38, 0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x31,
+  0x2e, 0x33, 0x30, 0x38, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69,
+  0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x3d, 0x22,
+  0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x64, 0x69, 0x76, 0x20, 0x35,
+  0x2e, 0x34, 0x35, 0x32, 0x65, 0x2b, 0x39, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x3d, 0x22, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20,
+  0x37, 0x2e, 0x36, 0x34, 0x36, 0x65, 0x2b, 0x38, 0x22, 0x2f, 0x3e, 0x0a,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a
+};
+unsigned int uom_xml_len = 21547;
+unsigned char uom_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x75, 0x70, 0x6c, 0x69,
+  0x63, 0x61, 0x74, 0x65, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x75, 0x73, 0x65, 0x72,
+  0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x65,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x22, 0x3e, 0x30, 0x2e, 0x23, 0x23, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x75,
+  0x6f, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3e, 0x31, 0x2e, 0x30,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x70, 0x69, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x22, 0x3e, 0x33, 0x2e, 0x31, 0x34, 0x31, 0x35, 0x39, 0x32,
+  0x36, 0x35, 0x33, 0x35, 0x39, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x40,
+  0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40,
+  0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x20,
+  0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x71,
+  0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75, 0x65,
+  0x7c, 0x71, 0x74, 0x79, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x7c, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x71, 0x75, 0x61, 0x6e,
+  0x74, 0x69, 0x74, 0x79, 0x54, 0x6f, 0x6c, 0x65, 0x72, 0x61, 0x6e, 0x63,
+  0x65, 0x7c, 0x71, 0x74, 0x79, 0x74, 0x6f, 0x6c, 0x65, 0x72, 0x61, 0x6e,
+  0x63, 0x65, 0x7c, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x5b, 0x6e, 0x6f,
+  0x74, 0x28, 0x2a, 0x29, 0x5d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x75, 0x6f, 0x6d, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x40, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x55, 0x6e, 0x69, 0x74, 0x4f, 0x66,
+  0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x7c, 0x40, 0x71, 0x74, 0x79,
+  0x75, 0x6f, 0x6d, 0x7c, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x3a, 0x3a,
+  0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x47, 0x72, 0x6f, 0x75,
+  0x70, 0x2f, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x55,
+  0x6e, 0x69, 0x74, 0x4f, 0x66, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65,
+  0x7c, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x3a, 0x3a, 0x71, 0x74, 0x79,
+  0x67, 0x72, 0x70, 0x2f, 0x40, 0x71, 0x74, 0x79, 0x75, 0x6f, 0x6d, 0x7c,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x2d, 0x6f, 0x72, 0x2d,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x3a, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69,
+  0x74, 0x79, 0x2f, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79,
+  0x54, 0x79, 0x70, 0x65, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2e, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c,
+  0x3a, 0x63, 0x6f, 0x70, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40, 0x2a, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x75, 0x6f, 0x6d,
+  0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77,
+  0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2e, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x40,
+  0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x55, 0x6e, 0x69, 0x74,
+  0x4f, 0x66, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x7c, 0x40, 0x71,
+  0x74, 0x79, 0x75, 0x6f, 0x6d, 0x7c, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74,
+  0x79, 0x54, 0x79, 0x70, 0x65, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69,
+  0x63, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x7b, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x29,
+  0x7d, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22,
+  0x61, 0x74, 0x74, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2e, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x75, 0x6f, 0x6d, 0x2d, 0x66,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x6f, 0x72,
+  0x6d, 0x61, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d,
+  0x22, 0x40, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x3d, 0x22, 0x24, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x24, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d,
+  0x22, 0x24, 0x75, 0x6f, 0x6d, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24,
+  0x75, 0x6f, 0x6d, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x64, 0x65, 0x66, 0x61, 0x75,
+  0x6c, 0x74, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69,
+  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65,
+  0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x24, 0x75, 0x6f, 0x6d,
+  0x20, 0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x66,
+  0x72, 0x6f, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x69, 0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x24, 0x64, 0x75,
+  0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x40, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x21, 0x3d, 0x20, 0x40, 0x74, 0x6f,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x69, 0x6e, 0x73,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e,
+  0x73, 0x31, 0x6b, 0x64, 0x2d, 0x75, 0x6f, 0x6d, 0x5f, 0x43, 0x4f, 0x4e,
+  0x56, 0x45, 0x52, 0x54, 0x45, 0x44, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x40,
+  0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x66, 0x6f,
+  0x72, 0x6d, 0x61, 0x74, 0x2d, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x40, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c, 0x61, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x2c, 0x20, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x24, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x27, 0x29, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68,
+  0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65,
+  0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x61, 0x74, 0x74,
+  0x72, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2e, 0x20, 0x3d, 0x20, 0x27, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x66, 0x72, 0x6f, 0x6d, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x27, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x40, 0x74, 0x6f, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65,
+  0x74, 0x3e, 0x0a
+};
+unsigned int uom_xsl_len = 5247;
+unsigned char uomdisplay_xml[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x75, 0x6f, 0x6d, 0x44, 0x69, 0x73, 0x70, 0x6c,
+  0x61, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x49, 0x22, 0x20,
+  0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x53, 0x65, 0x70, 0x61, 0x72,
+  0x61, 0x74, 0x6f, 0x72, 0x3d, 0x22, 0x2c, 0x22, 0x20, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x69, 0x6e, 0x67, 0x53, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
+  0x6f, 0x72, 0x3d, 0x22, 0x20, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x65, 0x75, 0x72, 0x6f, 0x22, 0x20, 0x64, 0x65, 0x63, 0x69, 0x6d,
+  0x61, 0x6c, 0x53, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3d,
+  0x22, 0x2c, 0x22, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x69, 0x6e, 0x67,
+  0x53, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3d, 0x22, 0x2e,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69, 0x6d, 0x70, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x22, 0x20, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61,
+  0x6c, 0x53, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3d, 0x22,
+  0x2e, 0x22, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x69, 0x6e, 0x67, 0x53,
+  0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3d, 0x22, 0x2c, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x54,
+  0x79, 0x70, 0x65, 0x50, 0x72, 0x65, 0x66, 0x69, 0x78, 0x65, 0x73, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75,
+  0x6d, 0x3e, 0x61, 0x20, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x20,
+  0x6f, 0x66, 0x20, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d,
+  0x75, 0x6d, 0x3e, 0x61, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d,
+  0x20, 0x6f, 0x66, 0x20, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6d, 0x69, 0x6e, 0x69,
+  0x6d, 0x75, 0x6d, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x52,
+  0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6d,
+  0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e,
+  0x20, 0x74, 0x6f, 0x20, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75,
+  0x6d, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x54, 0x79, 0x70, 0x65, 0x50, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x65, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x25, 0x22, 0x3e, 0x25, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x28, 0x64, 0x79,
+  0x6e, 0x65, 0x2f, 0x63, 0x6d, 0x29, 0x34, 0x2f, 0x67, 0x63, 0x6d, 0x33,
+  0x22, 0x3e, 0x20, 0x28, 0x64, 0x79, 0x6e, 0x65, 0x2f, 0x63, 0x6d, 0x29,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x34, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x2f, 0x67, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x28, 0x4e,
+  0x2f, 0x6d, 0x29, 0x34, 0x2f, 0x6b, 0x67, 0x2e, 0x6d, 0x33, 0x22, 0x3e,
+  0x20, 0x28, 0x4e, 0x2f, 0x6d, 0x29, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x34, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6b,
+  0x67, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x61, 0x22, 0x3e, 0x2f, 0x61,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f,
+  0x61, 0x6e, 0x67, 0x73, 0x74, 0x72, 0x6f, 0x6d, 0x22, 0x3e, 0x2f, 0x61,
+  0x6e, 0x67, 0x73, 0x74, 0x72, 0x6f, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x62, 0x61, 0x72, 0x22, 0x3e,
+  0x2f, 0x62, 0x61, 0x72, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x31, 0x2f, 0x62, 0x62, 0x6c, 0x22, 0x3e, 0x2f, 0x62, 0x62,
+  0x6c, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31,
+  0x2f, 0x63, 0x6d, 0x22, 0x3e, 0x2f, 0x63, 0x6d, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x22, 0x3e, 0x2f,
+  0x64, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31,
+  0x2f, 0x64, 0x65, 0x67, 0x43, 0x22, 0x3e, 0x2f, 0xc2, 0xb0, 0x43, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x64,
+  0x65, 0x67, 0x46, 0x22, 0x3e, 0x2f, 0xc2, 0xb0, 0x46, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x64, 0x65, 0x67,
+  0x52, 0x22, 0x3e, 0x2f, 0xc2, 0xb0, 0x52, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x66, 0x74, 0x22, 0x3e, 0x2f,
+  0x66, 0x74, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x31, 0x2f, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x2f, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x31, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x2f, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x31, 0x2f, 0x67, 0x22, 0x3e, 0x2f, 0x67, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x67, 0x61, 0x6c, 0x55, 0x4b,
+  0x22, 0x3e, 0x2f, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x67, 0x61, 0x6c, 0x55,
+  0x53, 0x22, 0x3e, 0x2f, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x48, 0x22, 0x3e,
+  0x20, 0x48, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2d, 0x31, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x68, 0x22, 0x3e, 0x2f, 0x68,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f,
+  0x69, 0x6e, 0x22, 0x3e, 0x2f, 0x69, 0x6e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x4b, 0x22, 0x3e, 0x2f, 0x4b,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f,
+  0x6b, 0x67, 0x22, 0x3e, 0x2f, 0x6b, 0x67, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6b, 0x6d, 0x32, 0x22, 0x3e,
+  0x2f, 0x6b, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6b, 0x50, 0x61, 0x22, 0x3e,
+  0x2f, 0x6b, 0x50, 0x61, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x31, 0x2f, 0x4c, 0x22, 0x3e, 0x2f, 0x4c, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6c, 0x62, 0x66,
+  0x22, 0x3e, 0x2f, 0x6c, 0x62, 0x66, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6c, 0x62, 0x6d, 0x22, 0x3e, 0x2f,
+  0x6c, 0x62, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x31, 0x2f, 0x6d, 0x22, 0x3e, 0x2f, 0x6d, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6d, 0x32, 0x22, 0x3e,
+  0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x2f, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x31, 0x2f, 0x6d, 0x69, 0x22, 0x3e, 0x2f, 0x6d, 0x69, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6d,
+  0x69, 0x32, 0x22, 0x3e, 0x2f, 0x6d, 0x69, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6d,
+  0x69, 0x6e, 0x22, 0x3e, 0x2f, 0x6d, 0x69, 0x6e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6d, 0x6d, 0x22, 0x3e,
+  0x2f, 0x6d, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x31, 0x2f, 0x4e, 0x22, 0x3e, 0x2f, 0x4e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x6e, 0x6d, 0x22, 0x3e,
+  0x2f, 0x6e, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x31, 0x2f, 0x50, 0x61, 0x22, 0x3e, 0x2f, 0x50, 0x61, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x70, 0x50,
+  0x61, 0x22, 0x3e, 0x2f, 0x70, 0x50, 0x61, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x70, 0x73, 0x69, 0x22, 0x3e,
+  0x2f, 0x70, 0x73, 0x69, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x31, 0x2f, 0x73, 0x22, 0x3e, 0x2f, 0x73, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x75, 0x70, 0x73,
+  0x69, 0x22, 0x3e, 0x2f, 0x75, 0x70, 0x73, 0x69, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x75, 0x56, 0x22, 0x3e,
+  0x2f, 0x75, 0x56, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x31, 0x2f, 0x56, 0x22, 0x3e, 0x2f, 0x56, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x2f, 0x77, 0x6b, 0x22, 0x3e,
+  0x2f, 0x77, 0x6b, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x31, 0x2f, 0x79, 0x64, 0x22, 0x3e, 0x2f, 0x79, 0x64, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x30,
+  0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x31, 0x30, 0x30, 0x30, 0x66, 0x74,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x31, 0x30, 0x30, 0x30, 0x66, 0x74, 0x33, 0x2f, 0x62, 0x62,
+  0x6c, 0x22, 0x3e, 0x20, 0x31, 0x30, 0x30, 0x30, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x62, 0x62, 0x6c, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x30, 0x66, 0x74, 0x33, 0x2f,
+  0x64, 0x22, 0x3e, 0x20, 0x31, 0x30, 0x30, 0x30, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x64, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x31, 0x30, 0x30, 0x30, 0x66, 0x74, 0x33, 0x2f, 0x64, 0x2e,
+  0x66, 0x74, 0x22, 0x3e, 0x20, 0x31, 0x30, 0x30, 0x30, 0x66, 0x74, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2f, 0x64, 0x2e, 0x66, 0x74, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x30, 0x66, 0x74,
+  0x33, 0x2f, 0x70, 0x73, 0x69, 0x2e, 0x64, 0x22, 0x3e, 0x20, 0x31, 0x30,
+  0x30, 0x30, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x70, 0x73, 0x69,
+  0x2e, 0x64, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x31, 0x30, 0x30, 0x30, 0x6d, 0x33, 0x2f, 0x64, 0x22, 0x3e, 0x20, 0x31,
+  0x30, 0x30, 0x30, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x64, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x30,
+  0x6d, 0x33, 0x2f, 0x64, 0x2e, 0x6d, 0x22, 0x3e, 0x20, 0x31, 0x30, 0x30,
+  0x30, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x64, 0x2e, 0x6d, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x30,
+  0x6d, 0x33, 0x2f, 0x68, 0x22, 0x3e, 0x20, 0x31, 0x30, 0x30, 0x30, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x2f, 0x68, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x30, 0x6d, 0x33, 0x2f, 0x68,
+  0x2e, 0x6d, 0x22, 0x3e, 0x20, 0x31, 0x30, 0x30, 0x30, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x68, 0x2e, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x31, 0x30, 0x30, 0x30, 0x6d, 0x34, 0x2f, 0x64,
+  0x22, 0x3e, 0x20, 0x31, 0x30, 0x30, 0x30, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x34, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2f, 0x64, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x31, 0x30, 0x4d, 0x67, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x31, 0x30,
+  0x4d, 0x67, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x2e, 0x6d, 0x32, 0x22, 0x3e,
+  0x20, 0x41, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x2f, 0x63, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x41, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x2f, 0x66, 0x74,
+  0x32, 0x22, 0x3e, 0x20, 0x41, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x2f,
+  0x6d, 0x32, 0x22, 0x3e, 0x20, 0x41, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x2f,
+  0x6d, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x41, 0x2f, 0x6d, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x62, 0x2f, 0x63, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x62, 0x2f, 0x63, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x62, 0x61, 0x72, 0x32, 0x22, 0x3e, 0x20, 0x62, 0x61, 0x72,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x62, 0x61, 0x72, 0x32, 0x2f, 0x63, 0x50, 0x22, 0x3e, 0x20,
+  0x62, 0x61, 0x72, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x63, 0x50, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x62, 0x62, 0x6c, 0x2f,
+  0x64, 0x32, 0x22, 0x3e, 0x20, 0x62, 0x62, 0x6c, 0x2f, 0x64, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x62, 0x62, 0x6c, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x62, 0x62,
+  0x6c, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x62, 0x62, 0x6c, 0x2f, 0x68, 0x72,
+  0x32, 0x22, 0x3e, 0x20, 0x62, 0x62, 0x6c, 0x2f, 0x68, 0x72, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x62, 0x62, 0x6c, 0x2f, 0x6b, 0x28, 0x66, 0x74, 0x33, 0x29, 0x22, 0x3e,
+  0x20, 0x62, 0x62, 0x6c, 0x2f, 0x6b, 0x28, 0x66, 0x74, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x29, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x62, 0x62, 0x6c, 0x2f, 0x4d, 0x28, 0x66, 0x74, 0x33, 0x29, 0x22, 0x3e,
+  0x20, 0x62, 0x62, 0x6c, 0x2f, 0x4d, 0x28, 0x66, 0x74, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x29, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x42, 0x74, 0x75, 0x2e, 0x69, 0x6e, 0x2f, 0x68, 0x72, 0x2e, 0x66, 0x74,
+  0x32, 0x2e, 0x46, 0x22, 0x3e, 0x20, 0x42, 0x74, 0x75, 0x2e, 0x69, 0x6e,
+  0x2f, 0x68, 0x72, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2e, 0x46,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x74,
+  0x75, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x42, 0x74, 0x75, 0x2f,
+  0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x42, 0x74, 0x75, 0x2f, 0x68, 0x72, 0x2e, 0x66,
+  0x74, 0x32, 0x22, 0x3e, 0x20, 0x42, 0x74, 0x75, 0x2f, 0x68, 0x72, 0x2e,
+  0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x42, 0x74, 0x75, 0x2f, 0x68, 0x72, 0x2e, 0x66,
+  0x74, 0x32, 0x2e, 0x64, 0x65, 0x67, 0x46, 0x22, 0x3e, 0x20, 0x42, 0x74,
+  0x75, 0x2f, 0x68, 0x72, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x20,
+  0xc2, 0xb0, 0x46, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x42, 0x74, 0x75, 0x2f, 0x68, 0x72, 0x2e, 0x66, 0x74, 0x32, 0x2e,
+  0x64, 0x65, 0x67, 0x52, 0x22, 0x3e, 0x20, 0x42, 0x74, 0x75, 0x2f, 0x68,
+  0x72, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x20, 0xc2, 0xb0, 0x52,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x74,
+  0x75, 0x2f, 0x68, 0x72, 0x2e, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x42,
+  0x74, 0x75, 0x2f, 0x68, 0x72, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x74,
+  0x75, 0x2f, 0x68, 0x72, 0x2e, 0x66, 0x74, 0x33, 0x2e, 0x64, 0x65, 0x67,
+  0x46, 0x22, 0x3e, 0x20, 0x42, 0x74, 0x75, 0x2f, 0x68, 0x72, 0x2e, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x20, 0xc2, 0xb0, 0x46, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x74, 0x75, 0x2f, 0x68,
+  0x72, 0x2e, 0x6d, 0x32, 0x2e, 0x64, 0x65, 0x67, 0x43, 0x22, 0x3e, 0x20,
+  0x42, 0x74, 0x75, 0x2f, 0x68, 0x72, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x20, 0xc2, 0xb0, 0x43, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x42, 0x74, 0x75, 0x2f, 0x73, 0x2e, 0x66, 0x74, 0x32, 0x22,
+  0x3e, 0x20, 0x42, 0x74, 0x75, 0x2f, 0x73, 0x2e, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x42, 0x74, 0x75, 0x2f, 0x73, 0x2e, 0x66, 0x74, 0x32, 0x2e, 0x64, 0x65,
+  0x67, 0x46, 0x22, 0x3e, 0x20, 0x42, 0x74, 0x75, 0x2f, 0x73, 0x2e, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x20, 0xc2, 0xb0, 0x46, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x74, 0x75, 0x2f, 0x73,
+  0x2e, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x42, 0x74, 0x75, 0x2f, 0x73,
+  0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x74, 0x75, 0x2f, 0x73, 0x2e, 0x66,
+  0x74, 0x33, 0x2e, 0x64, 0x65, 0x67, 0x46, 0x22, 0x3e, 0x20, 0x42, 0x74,
+  0x75, 0x2f, 0x73, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x20, 0xc2,
+  0xb0, 0x46, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x43, 0x2f, 0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x43, 0x2f, 0x63, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x43, 0x2f, 0x63, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x43, 0x2f,
+  0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x43, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x43,
+  0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x43, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x43,
+  0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x43, 0x2f, 0x6d, 0x6d, 0x32, 0x22, 0x3e, 0x20,
+  0x43, 0x2f, 0x6d, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x2f, 0x6d, 0x6d, 0x33, 0x22,
+  0x3e, 0x20, 0x43, 0x2f, 0x6d, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x61, 0x6c, 0x2f,
+  0x63, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x63, 0x61, 0x6c, 0x2f, 0x63, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x63, 0x61, 0x6c, 0x2f, 0x68, 0x2e, 0x63, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x63, 0x61, 0x6c, 0x2f, 0x68, 0x2e, 0x63, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x63, 0x61, 0x6c, 0x2f, 0x68, 0x2e, 0x63, 0x6d, 0x32, 0x2e, 0x64, 0x65,
+  0x67, 0x43, 0x22, 0x3e, 0x20, 0x63, 0x61, 0x6c, 0x2f, 0x68, 0x2e, 0x63,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x20, 0xc2, 0xb0, 0x43, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x61, 0x6c, 0x2f, 0x68,
+  0x2e, 0x63, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x63, 0x61, 0x6c, 0x2f, 0x68,
+  0x2e, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x61, 0x6c, 0x2f, 0x6d, 0x6d, 0x33,
+  0x22, 0x3e, 0x20, 0x63, 0x61, 0x6c, 0x2f, 0x6d, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63,
+  0x61, 0x6c, 0x2f, 0x73, 0x2e, 0x63, 0x6d, 0x32, 0x2e, 0x64, 0x65, 0x67,
+  0x43, 0x22, 0x3e, 0x20, 0x63, 0x61, 0x6c, 0x2f, 0x73, 0x2e, 0x63, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x20, 0xc2, 0xb0, 0x43, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x61, 0x6c, 0x2f, 0x73, 0x2e,
+  0x63, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x63, 0x61, 0x6c, 0x2f, 0x73, 0x2e,
+  0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x63, 0x64, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20,
+  0x63, 0x64, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d, 0x2f, 0x73, 0x32, 0x22,
+  0x3e, 0x20, 0x63, 0x6d, 0x2f, 0x73, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x2f, 0x67, 0x22,
+  0x3e, 0x20, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x67, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x2f,
+  0x73, 0x22, 0x3e, 0x20, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d,
+  0x33, 0x22, 0x3e, 0x20, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x2f,
+  0x33, 0x30, 0x6d, 0x69, 0x6e, 0x22, 0x3e, 0x20, 0x63, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x33, 0x30, 0x6d, 0x69, 0x6e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x2f, 0x63, 0x6d,
+  0x33, 0x22, 0x3e, 0x20, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x63,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x2f, 0x67, 0x22, 0x3e, 0x20, 0x63,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x67, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x2f, 0x68, 0x22, 0x3e,
+  0x20, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x68, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x2f, 0x6d,
+  0x33, 0x22, 0x3e, 0x20, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x63, 0x6d, 0x33, 0x2f, 0x6d, 0x69, 0x6e, 0x22, 0x3e, 0x20,
+  0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d, 0x69, 0x6e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x2f,
+  0x73, 0x22, 0x3e, 0x20, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6d,
+  0x34, 0x22, 0x3e, 0x20, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x34, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x2f, 0x66, 0x74,
+  0x33, 0x22, 0x3e, 0x20, 0x64, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x2f,
+  0x6b, 0x28, 0x66, 0x74, 0x33, 0x29, 0x22, 0x3e, 0x20, 0x64, 0x2f, 0x6b,
+  0x28, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x29, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x2f, 0x6d, 0x33, 0x22, 0x3e,
+  0x20, 0x64, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x61, 0x22, 0x3e,
+  0xc2, 0xb0, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x64, 0x65, 0x67, 0x43, 0x22, 0x3e, 0x20, 0xc2, 0xb0, 0x43, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x43,
+  0x2e, 0x6d, 0x32, 0x2e, 0x68, 0x2f, 0x6b, 0x63, 0x61, 0x6c, 0x22, 0x3e,
+  0x20, 0xc2, 0xb0, 0x43, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2e, 0x68,
+  0x2f, 0x6b, 0x63, 0x61, 0x6c, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x46, 0x22, 0x3e, 0x20, 0xc2, 0xb0,
+  0x46, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64,
+  0x65, 0x67, 0x46, 0x2e, 0x66, 0x74, 0x32, 0x2e, 0x68, 0x2f, 0x42, 0x74,
+  0x75, 0x22, 0x3e, 0x20, 0xc2, 0xb0, 0x46, 0x2e, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2e, 0x68, 0x2f, 0x42, 0x74, 0x75, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x52, 0x22, 0x3e,
+  0x20, 0xc2, 0xb0, 0x52, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x64, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x64, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x64, 0x6d, 0x33, 0x2f, 0x31, 0x30, 0x30, 0x6b, 0x6d, 0x22, 0x3e, 0x20,
+  0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x31, 0x30, 0x30, 0x6b, 0x6d,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x6d,
+  0x33, 0x2f, 0x6b, 0x67, 0x22, 0x3e, 0x20, 0x64, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x6b, 0x67, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x64, 0x6d, 0x33, 0x2f, 0x6b, 0x6d, 0x28, 0x31, 0x30, 0x30,
+  0x29, 0x22, 0x3e, 0x20, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6b,
+  0x6d, 0x28, 0x31, 0x30, 0x30, 0x29, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x64, 0x6d, 0x33, 0x2f, 0x6b, 0x57, 0x2e, 0x68,
+  0x22, 0x3e, 0x20, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6b, 0x57,
+  0x2e, 0x68, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x64, 0x6d, 0x33, 0x2f, 0x6d, 0x22, 0x3e, 0x20, 0x64, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x64, 0x6d, 0x33, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x64,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x6d, 0x33,
+  0x2f, 0x4d, 0x4a, 0x22, 0x3e, 0x20, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2f, 0x4d, 0x4a, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x64, 0x6d, 0x33, 0x2f, 0x6d, 0x6f, 0x6c, 0x28, 0x6b, 0x67, 0x29,
+  0x22, 0x3e, 0x20, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d, 0x6f,
+  0x6c, 0x28, 0x6b, 0x67, 0x29, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x64, 0x6d, 0x33, 0x2f, 0x73, 0x22, 0x3e, 0x20, 0x64,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x6d, 0x33, 0x2f, 0x73, 0x32, 0x22,
+  0x3e, 0x20, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x64, 0x6d, 0x33, 0x2f, 0x74, 0x22, 0x3e, 0x20, 0x64, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x74, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x64, 0x79, 0x6e, 0x65, 0x2e, 0x63, 0x6d, 0x32, 0x22, 0x3e,
+  0x20, 0x64, 0x79, 0x6e, 0x65, 0x2e, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x79,
+  0x6e, 0x65, 0x2e, 0x73, 0x2f, 0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x64,
+  0x79, 0x6e, 0x65, 0x2e, 0x73, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x79,
+  0x6e, 0x65, 0x2f, 0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x64, 0x79, 0x6e,
+  0x65, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x65, 0x71, 0x2f, 0x6d, 0x33, 0x22,
+  0x3e, 0x20, 0x65, 0x71, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x65, 0x72, 0x67, 0x2f,
+  0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x65, 0x72, 0x67, 0x2f, 0x63, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x65, 0x72, 0x67, 0x2f, 0x63, 0x6d, 0x33, 0x22, 0x3e, 0x20,
+  0x65, 0x72, 0x67, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x65, 0x72, 0x67, 0x2f,
+  0x6d, 0x33, 0x22, 0x3e, 0x20, 0x65, 0x72, 0x67, 0x2f, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x66, 0x74, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x2f,
+  0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x2f, 0x73, 0x32, 0x22, 0x3e, 0x20,
+  0x66, 0x74, 0x2f, 0x73, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20,
+  0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x32, 0x2f, 0x68, 0x22, 0x3e, 0x20,
+  0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x68, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x32, 0x2f, 0x69, 0x6e,
+  0x33, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x69,
+  0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x66, 0x74, 0x32, 0x2f, 0x73, 0x22, 0x3e, 0x20, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x28, 0x73, 0x74, 0x64, 0x2c, 0x36,
+  0x30, 0x46, 0x29, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x28, 0x73, 0x74, 0x64, 0x2c, 0x36, 0x30, 0x46, 0x29, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x62,
+  0x62, 0x6c, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f,
+  0x62, 0x62, 0x6c, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x66, 0x74, 0x33, 0x2f, 0x64, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2f, 0x64, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x64, 0x2e, 0x66, 0x74, 0x2e,
+  0x70, 0x73, 0x69, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2f, 0x64, 0x2e, 0x66, 0x74, 0x2e, 0x70, 0x73, 0x69, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x64,
+  0x32, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x64,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x66, 0x74, 0x22, 0x3e, 0x20, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x66, 0x74, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x66, 0x74,
+  0x33, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x68, 0x22, 0x3e, 0x20, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x68, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x68, 0x32, 0x22,
+  0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x68, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x66, 0x74, 0x33, 0x2f, 0x6b, 0x67, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2f, 0x6b, 0x67, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x6c, 0x62, 0x6d, 0x22,
+  0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6c, 0x62, 0x6d,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74,
+  0x33, 0x2f, 0x6d, 0x69, 0x6e, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x6d, 0x69, 0x6e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x6d, 0x69, 0x6e, 0x2e,
+  0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2f, 0x6d, 0x69, 0x6e, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x33,
+  0x2f, 0x6d, 0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x6d, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f,
+  0x6d, 0x6f, 0x6c, 0x28, 0x6c, 0x62, 0x6d, 0x29, 0x22, 0x3e, 0x20, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d, 0x6f, 0x6c, 0x28, 0x6c, 0x62,
+  0x6d, 0x29, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x66, 0x74, 0x33, 0x2f, 0x73, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x73, 0x2e, 0x66, 0x74, 0x32, 0x22,
+  0x3e, 0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x2e, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x2f, 0x73, 0x32, 0x22, 0x3e, 0x20,
+  0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74,
+  0x33, 0x2f, 0x73, 0x61, 0x63, 0x6b, 0x39, 0x34, 0x22, 0x3e, 0x20, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x61, 0x63, 0x6b, 0x39, 0x34,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66, 0x74,
+  0x33, 0x2f, 0x73, 0x63, 0x66, 0x28, 0x36, 0x30, 0x46, 0x29, 0x22, 0x3e,
+  0x20, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x63, 0x66, 0x28,
+  0x36, 0x30, 0x46, 0x29, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x67, 0x2e, 0x66, 0x74, 0x2f, 0x63, 0x6d, 0x33, 0x2e, 0x73,
+  0x22, 0x3e, 0x20, 0x67, 0x2e, 0x66, 0x74, 0x2f, 0x63, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2e, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x67, 0x2f, 0x63, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x67, 0x2f,
+  0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x67, 0x2f, 0x63, 0x6d, 0x34, 0x22, 0x3e, 0x20,
+  0x67, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x34, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x2f, 0x64, 0x6d, 0x33, 0x22,
+  0x3e, 0x20, 0x67, 0x2f, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x2f, 0x6d, 0x33,
+  0x22, 0x3e, 0x20, 0x67, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55,
+  0x4b, 0x22, 0x3e, 0x20, 0x67, 0x61, 0x6c, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x2f, 0x66,
+  0x74, 0x33, 0x22, 0x3e, 0x20, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x2f, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x2f, 0x68, 0x72, 0x2e,
+  0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x2f,
+  0x68, 0x72, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x4b,
+  0x2f, 0x68, 0x72, 0x2e, 0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20, 0x67, 0x61,
+  0x6c, 0x55, 0x4b, 0x2f, 0x68, 0x72, 0x2e, 0x69, 0x6e, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67,
+  0x61, 0x6c, 0x55, 0x4b, 0x2f, 0x68, 0x72, 0x32, 0x22, 0x3e, 0x20, 0x67,
+  0x61, 0x6c, 0x55, 0x4b, 0x2f, 0x68, 0x72, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x61, 0x6c,
+  0x55, 0x4b, 0x2f, 0x6d, 0x69, 0x6e, 0x2e, 0x66, 0x74, 0x32, 0x22, 0x3e,
+  0x20, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x2f, 0x6d, 0x69, 0x6e, 0x2e, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x2f, 0x6d, 0x69, 0x6e,
+  0x32, 0x22, 0x3e, 0x20, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x2f, 0x6d, 0x69,
+  0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x22, 0x3e, 0x20, 0x67,
+  0x61, 0x6c, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x67, 0x61, 0x6c, 0x55, 0x53, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20,
+  0x67, 0x61, 0x6c, 0x55, 0x53, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x61,
+  0x6c, 0x55, 0x53, 0x2f, 0x68, 0x72, 0x2e, 0x66, 0x74, 0x32, 0x22, 0x3e,
+  0x20, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x2f, 0x68, 0x72, 0x2e, 0x66, 0x74,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x2f, 0x68, 0x72, 0x2e, 0x69,
+  0x6e, 0x32, 0x22, 0x3e, 0x20, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x2f, 0x68,
+  0x72, 0x2e, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x2f,
+  0x68, 0x72, 0x32, 0x22, 0x3e, 0x20, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x2f,
+  0x68, 0x72, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x53, 0x2f, 0x6d, 0x69,
+  0x6e, 0x2e, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x67, 0x61, 0x6c, 0x55,
+  0x53, 0x2f, 0x6d, 0x69, 0x6e, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x61,
+  0x6c, 0x55, 0x53, 0x2f, 0x6d, 0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20, 0x67,
+  0x61, 0x6c, 0x55, 0x53, 0x2f, 0x6d, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x50,
+  0x61, 0x32, 0x22, 0x3e, 0x20, 0x47, 0x50, 0x61, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x72,
+  0x61, 0x69, 0x6e, 0x2f, 0x31, 0x30, 0x30, 0x66, 0x74, 0x33, 0x22, 0x3e,
+  0x20, 0x67, 0x72, 0x61, 0x69, 0x6e, 0x2f, 0x31, 0x30, 0x30, 0x66, 0x74,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x67, 0x72, 0x61, 0x69, 0x6e, 0x2f, 0x66, 0x74, 0x33, 0x22,
+  0x3e, 0x20, 0x67, 0x72, 0x61, 0x69, 0x6e, 0x2f, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x67, 0x72, 0x61, 0x69, 0x6e, 0x2f, 0x66, 0x74, 0x33, 0x28, 0x31, 0x30,
+  0x30, 0x29, 0x22, 0x3e, 0x20, 0x67, 0x72, 0x61, 0x69, 0x6e, 0x2f, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x28, 0x31, 0x30, 0x30, 0x29, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x73, 0x6d, 0x33,
+  0x22, 0x3e, 0x20, 0x47, 0x73, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x68, 0x2f, 0x66, 0x74,
+  0x33, 0x22, 0x3e, 0x20, 0x68, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x68, 0x2f,
+  0x6d, 0x33, 0x22, 0x3e, 0x20, 0x68, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x68, 0x68,
+  0x70, 0x2f, 0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20, 0x68, 0x68, 0x70, 0x2f,
+  0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x68, 0x70, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e,
+  0x20, 0x68, 0x70, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x68, 0x70, 0x2f, 0x69,
+  0x6e, 0x32, 0x22, 0x3e, 0x20, 0x68, 0x70, 0x2f, 0x69, 0x6e, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69, 0x6e,
+  0x32, 0x2f, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x69, 0x6e, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x2f, 0x69,
+  0x6e, 0x32, 0x22, 0x3e, 0x20, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f,
+  0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x2f, 0x73, 0x22, 0x3e, 0x20,
+  0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x3e, 0x20,
+  0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x2f, 0x66, 0x74, 0x22, 0x3e,
+  0x20, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x66, 0x74, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x69, 0x6e, 0x34, 0x22,
+  0x3e, 0x20, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x34, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x2f, 0x63, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x4a, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x2f, 0x64, 0x6d,
+  0x33, 0x22, 0x3e, 0x20, 0x4a, 0x2f, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x2f,
+  0x6d, 0x32, 0x22, 0x3e, 0x20, 0x4a, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x2f,
+  0x6d, 0x33, 0x22, 0x3e, 0x20, 0x4a, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x2f,
+  0x73, 0x2e, 0x6d, 0x32, 0x2e, 0x64, 0x65, 0x67, 0x43, 0x22, 0x3e, 0x20,
+  0x4a, 0x2f, 0x73, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x20, 0xc2, 0xb0,
+  0x43, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b,
+  0x2e, 0x6d, 0x32, 0x2f, 0x6b, 0x57, 0x22, 0x3e, 0x20, 0x4b, 0x2e, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6b, 0x57, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x2e, 0x6d, 0x32, 0x2f, 0x57, 0x22,
+  0x3e, 0x20, 0x4b, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x57, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x63, 0x61,
+  0x6c, 0x2e, 0x6d, 0x2f, 0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6b, 0x63,
+  0x61, 0x6c, 0x2e, 0x6d, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x63, 0x61,
+  0x6c, 0x2f, 0x63, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6b, 0x63, 0x61, 0x6c,
+  0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x63, 0x61, 0x6c, 0x2f, 0x68, 0x2e,
+  0x6d, 0x32, 0x2e, 0x64, 0x65, 0x67, 0x43, 0x22, 0x3e, 0x20, 0x6b, 0x63,
+  0x61, 0x6c, 0x2f, 0x68, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x20, 0xc2,
+  0xb0, 0x43, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6b, 0x63, 0x61, 0x6c, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6b, 0x63,
+  0x61, 0x6c, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x67, 0x2e, 0x6d, 0x2f, 0x63,
+  0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6b, 0x67, 0x2e, 0x6d, 0x2f, 0x63, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6b, 0x67, 0x2e, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6b, 0x67,
+  0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x67, 0x2f, 0x64, 0x6d, 0x33, 0x22, 0x3e,
+  0x20, 0x6b, 0x67, 0x2f, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x67, 0x2f, 0x64,
+  0x6d, 0x34, 0x22, 0x3e, 0x20, 0x6b, 0x67, 0x2f, 0x64, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x34,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6b, 0x67, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6b, 0x67, 0x2f, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6b, 0x67, 0x2f, 0x6d, 0x32, 0x2e, 0x73, 0x22, 0x3e, 0x20,
+  0x6b, 0x67, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2e, 0x73, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x67, 0x2f, 0x6d,
+  0x33, 0x22, 0x3e, 0x20, 0x6b, 0x67, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x67,
+  0x2f, 0x6d, 0x34, 0x22, 0x3e, 0x20, 0x6b, 0x67, 0x2f, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x34,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6b, 0x67, 0x66, 0x2e, 0x6d, 0x2f, 0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20,
+  0x6b, 0x67, 0x66, 0x2e, 0x6d, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x67,
+  0x66, 0x2e, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6b, 0x67, 0x66, 0x2e, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6b, 0x67, 0x66, 0x2e, 0x73, 0x2f, 0x6d, 0x32, 0x22, 0x3e,
+  0x20, 0x6b, 0x67, 0x66, 0x2e, 0x73, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x67,
+  0x66, 0x2f, 0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6b, 0x67, 0x66, 0x2f,
+  0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x67, 0x66, 0x2f, 0x6d, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x6b, 0x67, 0x66, 0x2f, 0x6d, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x4a,
+  0x2e, 0x6d, 0x2f, 0x68, 0x2e, 0x6d, 0x32, 0x2e, 0x4b, 0x22, 0x3e, 0x20,
+  0x6b, 0x4a, 0x2e, 0x6d, 0x2f, 0x68, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2e, 0x4b, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6b, 0x4a, 0x2f, 0x64, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6b, 0x4a, 0x2f,
+  0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x4a, 0x2f, 0x68, 0x2e, 0x6d, 0x32, 0x2e,
+  0x4b, 0x22, 0x3e, 0x20, 0x6b, 0x4a, 0x2f, 0x68, 0x2e, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2e, 0x4b, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6b, 0x4a, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6b, 0x4a,
+  0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x6d, 0x2f, 0x64, 0x6d, 0x33, 0x22, 0x3e,
+  0x20, 0x6b, 0x6d, 0x2f, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x6b, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22, 0x3e, 0x20,
+  0x6b, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x4e, 0x2e, 0x6d, 0x32, 0x22, 0x3e, 0x20,
+  0x6b, 0x4e, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x4e, 0x2f, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x6b, 0x4e, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x6e, 0x6f, 0x74,
+  0x22, 0x3e, 0x20, 0x6b, 0x6e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6b, 0x50, 0x61, 0x32, 0x22, 0x3e, 0x20, 0x6b, 0x50,
+  0x61, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6b, 0x50, 0x61, 0x32, 0x2f, 0x63, 0x50, 0x22, 0x3e,
+  0x20, 0x6b, 0x50, 0x61, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x63, 0x50, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x50, 0x61,
+  0x32, 0x2f, 0x6b, 0x63, 0x50, 0x22, 0x3e, 0x20, 0x6b, 0x50, 0x61, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2f, 0x6b, 0x63, 0x50, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x70, 0x73, 0x69, 0x32, 0x22, 0x3e,
+  0x20, 0x6b, 0x70, 0x73, 0x69, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x73, 0x6d, 0x33, 0x22,
+  0x3e, 0x20, 0x6b, 0x73, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x73, 0x6d, 0x33, 0x2f,
+  0x64, 0x22, 0x3e, 0x20, 0x6b, 0x73, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f,
+  0x64, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b,
+  0x73, 0x6d, 0x33, 0x2f, 0x73, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6b, 0x73,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x57,
+  0x2e, 0x68, 0x2f, 0x64, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6b, 0x57, 0x2e,
+  0x68, 0x2f, 0x64, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x57, 0x2e, 0x68, 0x2f, 0x6d,
+  0x33, 0x22, 0x3e, 0x20, 0x6b, 0x57, 0x2e, 0x68, 0x2f, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6b, 0x57, 0x2f, 0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6b, 0x57, 0x2f,
+  0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x57, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20,
+  0x6b, 0x57, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x57, 0x2f, 0x6d, 0x32, 0x2e,
+  0x4b, 0x22, 0x3e, 0x20, 0x6b, 0x57, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2e, 0x4b, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6b, 0x57, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6b, 0x57, 0x2f, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6b, 0x57, 0x2f, 0x6d, 0x33, 0x2e, 0x4b, 0x22, 0x3e, 0x20,
+  0x6b, 0x57, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2e, 0x4b, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x2f, 0x6d, 0x33,
+  0x22, 0x3e, 0x20, 0x4c, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x2f, 0x73, 0x32,
+  0x22, 0x3e, 0x20, 0x4c, 0x2f, 0x73, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e,
+  0x66, 0x74, 0x22, 0x3e, 0x20, 0x66, 0x74, 0x2d, 0x6c, 0x62, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e,
+  0x69, 0x6e, 0x22, 0x3e, 0x20, 0x69, 0x6e, 0x2d, 0x6c, 0x62, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e,
+  0x66, 0x74, 0x2f, 0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20, 0x6c, 0x62, 0x66,
+  0x2e, 0x66, 0x74, 0x2f, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e,
+  0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20, 0x6c, 0x62, 0x66, 0x2e, 0x69, 0x6e,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x73, 0x2f, 0x66, 0x74, 0x32, 0x22,
+  0x3e, 0x20, 0x6c, 0x62, 0x66, 0x2e, 0x73, 0x2f, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6c, 0x62, 0x66, 0x2e, 0x73, 0x2f, 0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20,
+  0x6c, 0x62, 0x66, 0x2e, 0x73, 0x2f, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62,
+  0x66, 0x2f, 0x31, 0x30, 0x30, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x6c,
+  0x62, 0x66, 0x2f, 0x31, 0x30, 0x30, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62,
+  0x66, 0x2f, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x6c, 0x62, 0x66, 0x2f,
+  0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2f, 0x66, 0x74, 0x32, 0x28,
+  0x31, 0x30, 0x30, 0x29, 0x22, 0x3e, 0x20, 0x6c, 0x62, 0x66, 0x2f, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x28, 0x31, 0x30, 0x30, 0x29, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2f,
+  0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x6c, 0x62, 0x66, 0x2f, 0x66, 0x74,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2f, 0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20,
+  0x6c, 0x62, 0x66, 0x2f, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x2e,
+  0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x6c, 0x62, 0x6d, 0x2e, 0x66, 0x74,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x2e, 0x66, 0x74, 0x32, 0x2f, 0x73, 0x32,
+  0x22, 0x3e, 0x20, 0x6c, 0x62, 0x6d, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x73, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x2f, 0x31, 0x30, 0x30,
+  0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x6c, 0x62, 0x6d, 0x2f, 0x31, 0x30,
+  0x30, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x2f, 0x66, 0x74, 0x32,
+  0x22, 0x3e, 0x20, 0x6c, 0x62, 0x6d, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c,
+  0x62, 0x6d, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x6c, 0x62, 0x6d,
+  0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x2f, 0x66, 0x74, 0x34,
+  0x22, 0x3e, 0x20, 0x6c, 0x62, 0x6d, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x34, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c,
+  0x62, 0x6d, 0x2f, 0x68, 0x2e, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x6c,
+  0x62, 0x6d, 0x2f, 0x68, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x62, 0x6d,
+  0x2f, 0x69, 0x6e, 0x33, 0x22, 0x3e, 0x20, 0x6c, 0x62, 0x6d, 0x2f, 0x69,
+  0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x2f, 0x73, 0x2e, 0x66, 0x74, 0x32,
+  0x22, 0x3e, 0x20, 0x6c, 0x62, 0x6d, 0x2f, 0x73, 0x2e, 0x66, 0x74, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6c, 0x6d, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6c, 0x6d, 0x2f,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4d, 0x28, 0x66, 0x74, 0x33, 0x29, 0x22, 0x3e, 0x20,
+  0x4d, 0x28, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x29, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x28, 0x66, 0x74, 0x33,
+  0x29, 0x2f, 0x61, 0x63, 0x72, 0x65, 0x2e, 0x66, 0x74, 0x22, 0x3e, 0x20,
+  0x4d, 0x28, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x29, 0x2f, 0x61, 0x63,
+  0x72, 0x65, 0x2e, 0x66, 0x74, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4d, 0x28, 0x66, 0x74, 0x33, 0x29, 0x2f, 0x64, 0x22,
+  0x3e, 0x20, 0x4d, 0x28, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x29, 0x2f,
+  0x64, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d,
+  0x28, 0x6d, 0x33, 0x29, 0x22, 0x3e, 0x20, 0x4d, 0x28, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x29, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4d, 0x28, 0x6d, 0x33, 0x29, 0x2f, 0x64, 0x22, 0x3e, 0x20, 0x4d,
+  0x28, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x29, 0x2f, 0x64, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x2f, 0x6d, 0x33, 0x22,
+  0x3e, 0x20, 0x6d, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x2f, 0x73, 0x32, 0x22,
+  0x3e, 0x20, 0x6d, 0x2f, 0x73, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x3e, 0x20,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x32, 0x2f, 0x63, 0x6d, 0x33, 0x22, 0x3e, 0x20,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x32,
+  0x2f, 0x64, 0x2e, 0x6b, 0x50, 0x61, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x64, 0x2e, 0x6b, 0x50, 0x61, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x32, 0x2f, 0x67, 0x22, 0x3e,
+  0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x67, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x32, 0x2f, 0x68, 0x22, 0x3e,
+  0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x68, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x32, 0x2f, 0x6b, 0x67, 0x22,
+  0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6b, 0x67, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x32, 0x2f, 0x6d,
+  0x32, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x32, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x32, 0x2f, 0x6d, 0x6f, 0x6c,
+  0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d, 0x6f, 0x6c,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x32,
+  0x2f, 0x50, 0x61, 0x2e, 0x73, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x50, 0x61, 0x2e, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x32, 0x2f, 0x73, 0x22, 0x3e, 0x20, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6d, 0x33, 0x28, 0x73, 0x74, 0x64, 0x2c, 0x30, 0x43, 0x29, 0x22, 0x3e,
+  0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x28, 0x73, 0x74, 0x64, 0x2c, 0x30,
+  0x43, 0x29, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6d, 0x33, 0x28, 0x73, 0x74, 0x64, 0x2c, 0x31, 0x35, 0x43, 0x29, 0x22,
+  0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x28, 0x73, 0x74, 0x64, 0x2c,
+  0x31, 0x35, 0x43, 0x29, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x62, 0x61, 0x72, 0x2e, 0x64, 0x22, 0x3e,
+  0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x62, 0x61, 0x72, 0x2e, 0x64,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33,
+  0x2f, 0x62, 0x61, 0x72, 0x2e, 0x68, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x62, 0x61, 0x72, 0x2e, 0x68, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x62, 0x61, 0x72,
+  0x2e, 0x6d, 0x69, 0x6e, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2f, 0x62, 0x61, 0x72, 0x2e, 0x6d, 0x69, 0x6e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x63, 0x50, 0x2e,
+  0x64, 0x2e, 0x6b, 0x50, 0x61, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x63, 0x50, 0x2e, 0x64, 0x2e, 0x6b, 0x50, 0x61, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x63,
+  0x50, 0x2e, 0x50, 0x61, 0x2e, 0x73, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x63, 0x50, 0x2e, 0x50, 0x61, 0x2e, 0x73, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x64,
+  0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x64, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x64,
+  0x2e, 0x6b, 0x50, 0x61, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2f, 0x64, 0x2e, 0x6b, 0x50, 0x61, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x64, 0x2e, 0x6d, 0x22, 0x3e,
+  0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x64, 0x2e, 0x6d, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x64,
+  0x32, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x64, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x33, 0x2f, 0x67, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x67, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x33, 0x2f, 0x68, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x68, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x33, 0x2f, 0x68, 0x2e, 0x6d, 0x22, 0x3e, 0x20, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2f, 0x68, 0x2e, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x68, 0x61, 0x2e, 0x6d,
+  0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x68, 0x61, 0x2e,
+  0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x33, 0x2f, 0x4a, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f,
+  0x4a, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x33, 0x2f, 0x6b, 0x67, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2f, 0x6b, 0x67, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x33, 0x2f, 0x6b, 0x6d, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x6b, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x6b, 0x50, 0x61, 0x2e, 0x64, 0x22,
+  0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6b, 0x50, 0x61, 0x2e,
+  0x64, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x33, 0x2f, 0x6b, 0x50, 0x61, 0x2e, 0x68, 0x22, 0x3e, 0x20, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2f, 0x6b, 0x50, 0x61, 0x2e, 0x68, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x6b, 0x57,
+  0x2e, 0x68, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6b,
+  0x57, 0x2e, 0x68, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x33, 0x2f, 0x6d, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x33, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x6d, 0x33, 0x22,
+  0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x33, 0x2f, 0x6d, 0x69, 0x6e, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x6d, 0x69, 0x6e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x6d, 0x6f, 0x6c, 0x22, 0x3e, 0x20,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d, 0x6f, 0x6c, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x6d, 0x6f,
+  0x6c, 0x28, 0x6b, 0x67, 0x29, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x6d, 0x6f, 0x6c, 0x28, 0x6b, 0x67, 0x29, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x50, 0x61,
+  0x2e, 0x73, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x50,
+  0x61, 0x2e, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x33, 0x2f, 0x50, 0x61, 0x2f, 0x73, 0x22, 0x3e, 0x20, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x2f, 0x50, 0x61, 0x2f, 0x73, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x50, 0x61,
+  0x32, 0x2e, 0x73, 0x32, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x2f, 0x50, 0x61, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2e, 0x73, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x33, 0x2f, 0x70, 0x73, 0x69, 0x2e, 0x64, 0x22, 0x3e, 0x20, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2f, 0x70, 0x73, 0x69, 0x2e, 0x64, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x73, 0x22,
+  0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x73, 0x2e,
+  0x66, 0x74, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73,
+  0x2e, 0x66, 0x74, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x33, 0x2f, 0x73, 0x2e, 0x6d, 0x22, 0x3e, 0x20, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2f, 0x73, 0x2e, 0x6d, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x73, 0x2e, 0x6d, 0x32,
+  0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x2e, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x73, 0x32, 0x22, 0x3e, 0x20, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x73, 0x63,
+  0x6d, 0x28, 0x30, 0x43, 0x29, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x73, 0x63, 0x6d, 0x28, 0x30, 0x43, 0x29, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x73, 0x63,
+  0x6d, 0x28, 0x31, 0x35, 0x43, 0x29, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2f, 0x73, 0x63, 0x6d, 0x28, 0x31, 0x35, 0x43, 0x29, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f,
+  0x74, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x74, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f,
+  0x74, 0x6f, 0x6e, 0x55, 0x4b, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x2f, 0x74, 0x6f, 0x6e, 0x55, 0x4b, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x33, 0x2f, 0x74, 0x6f, 0x6e, 0x55,
+  0x53, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x74, 0x6f,
+  0x6e, 0x55, 0x53, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x34, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x34, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x34, 0x2f,
+  0x73, 0x22, 0x3e, 0x20, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x34, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x41, 0x2f,
+  0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6d, 0x41, 0x2f, 0x63, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x41, 0x2f, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x6d, 0x41,
+  0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x43, 0x2f, 0x6d, 0x32, 0x22, 0x3e,
+  0x20, 0x6d, 0x43, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x44, 0x2e, 0x66, 0x74,
+  0x32, 0x2f, 0x6c, 0x62, 0x66, 0x2e, 0x73, 0x22, 0x3e, 0x20, 0x6d, 0x44,
+  0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6c, 0x62, 0x66, 0x2e,
+  0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x44, 0x2e, 0x69, 0x6e, 0x32, 0x2f, 0x6c, 0x62, 0x66, 0x2e, 0x73, 0x22,
+  0x3e, 0x20, 0x6d, 0x44, 0x2e, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f,
+  0x6c, 0x62, 0x66, 0x2e, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x65, 0x71, 0x2f, 0x63, 0x6d, 0x33, 0x22, 0x3e,
+  0x20, 0x6d, 0x65, 0x71, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x67, 0x2f,
+  0x64, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6d, 0x67, 0x2f, 0x64, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4d, 0x67, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x4d, 0x67, 0x2f,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4d, 0x67, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x4d,
+  0x67, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x67, 0x2f, 0x6d, 0x33, 0x22, 0x3e,
+  0x20, 0x6d, 0x67, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x3e,
+  0x20, 0x6d, 0x69, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22, 0x3e, 0x20, 0x6d,
+  0x69, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x69, 0x6e, 0x61, 0x22, 0x3e, 0xe2, 0x80, 0xb2,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x69,
+  0x55, 0x53, 0x32, 0x22, 0x3e, 0x20, 0x6d, 0x69, 0x55, 0x53, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6d, 0x4a, 0x2f, 0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6d, 0x4a, 0x2f,
+  0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x4a, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20,
+  0x6d, 0x4a, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x4a, 0x2f, 0x6d, 0x33, 0x22,
+  0x3e, 0x20, 0x4d, 0x4a, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x6d, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x2f, 0x6d, 0x6d,
+  0x32, 0x22, 0x3e, 0x20, 0x6d, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x2f, 0x73, 0x22, 0x3e, 0x20, 0x6d,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6d,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x2f, 0x4a, 0x22, 0x3e, 0x20, 0x6d,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x4a, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x4e, 0x2e, 0x6d, 0x32, 0x22, 0x3e,
+  0x20, 0x6d, 0x4e, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x6c, 0x28, 0x6b,
+  0x67, 0x29, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x6d, 0x6f, 0x6c, 0x28,
+  0x6b, 0x67, 0x29, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x6c, 0x28, 0x6c,
+  0x62, 0x6d, 0x29, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x6d, 0x6f,
+  0x6c, 0x28, 0x6c, 0x62, 0x6d, 0x29, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c,
+  0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x6f, 0x6c, 0x28, 0x6c, 0x62, 0x6d, 0x29, 0x2f, 0x68, 0x2e, 0x66, 0x74,
+  0x32, 0x22, 0x3e, 0x20, 0x6d, 0x6f, 0x6c, 0x28, 0x6c, 0x62, 0x6d, 0x29,
+  0x2f, 0x68, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x6c, 0x28, 0x6c,
+  0x62, 0x6d, 0x29, 0x2f, 0x73, 0x2e, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20,
+  0x6d, 0x6f, 0x6c, 0x28, 0x6c, 0x62, 0x6d, 0x29, 0x2f, 0x73, 0x2e, 0x66,
+  0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x6c, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20,
+  0x6d, 0x6f, 0x6c, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x6c, 0x2f, 0x6d,
+  0x32, 0x2e, 0x73, 0x22, 0x3e, 0x20, 0x6d, 0x6f, 0x6c, 0x2f, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x2e, 0x73, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x6c, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20,
+  0x6d, 0x6f, 0x6c, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x73, 0x2f, 0x32, 0x22,
+  0x3e, 0x20, 0x6d, 0x73, 0x2f, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x73, 0x6d, 0x33, 0x22,
+  0x3e, 0x20, 0x4d, 0x73, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x57, 0x2e, 0x68, 0x2f,
+  0x6d, 0x33, 0x22, 0x3e, 0x20, 0x4d, 0x57, 0x2e, 0x68, 0x2f, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6d, 0x57, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x6d, 0x57, 0x2f,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4e, 0x2e, 0x6d, 0x22, 0x3e, 0x20, 0x4e, 0x6d, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x2e, 0x6d,
+  0x32, 0x22, 0x3e, 0x20, 0x4e, 0x2e, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x2e, 0x73,
+  0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x4e, 0x2e, 0x73, 0x2f, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4e, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x4e, 0x2f, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4e, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x4e, 0x2f, 0x6d, 0x3c,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4e, 0x2f, 0x6d, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x4e, 0x2f, 0x6d,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4e, 0x34, 0x2f, 0x6b, 0x67, 0x2e, 0x6d, 0x37, 0x22,
+  0x3e, 0x20, 0x4e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x34, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6b, 0x67, 0x2e, 0x6d,
+  0x37, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x75, 0x74, 0x6d, 0x69, 0x22, 0x3e, 0x20, 0x6e, 0x6d, 0x69, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75,
+  0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61, 0x2e,
+  0x73, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x50, 0x61, 0x2e, 0x73, 0x2f,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x50, 0x61, 0x2e, 0x73, 0x32, 0x2f, 0x6d, 0x33, 0x22,
+  0x3e, 0x20, 0x50, 0x61, 0x2e, 0x73, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x50, 0x61, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x50, 0x61,
+  0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x50, 0x61, 0x32, 0x22, 0x3e, 0x20, 0x50, 0x61,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x70, 0x64, 0x6c, 0x2e, 0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20,
+  0x70, 0x64, 0x6c, 0x2e, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x73, 0x69, 0x32,
+  0x22, 0x3e, 0x20, 0x70, 0x73, 0x69, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x73, 0x69, 0x32,
+  0x2e, 0x64, 0x2f, 0x63, 0x50, 0x2e, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20,
+  0x70, 0x73, 0x69, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2e, 0x64, 0x2f, 0x63, 0x50,
+  0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x73, 0x69, 0x32, 0x2e, 0x64, 0x2f,
+  0x63, 0x70, 0x2e, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x70, 0x73, 0x69,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x2e, 0x64, 0x2f, 0x63, 0x70, 0x2e, 0x66, 0x74,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x70, 0x73, 0x69, 0x32, 0x2e, 0x64, 0x32, 0x2f, 0x63, 0x50,
+  0x2e, 0x66, 0x74, 0x36, 0x22, 0x3e, 0x20, 0x70, 0x73, 0x69, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2e, 0x64, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x63, 0x50, 0x2e,
+  0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x36, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x70, 0x73, 0x69, 0x32, 0x2e, 0x64, 0x32, 0x2f,
+  0x63, 0x70, 0x2e, 0x66, 0x74, 0x36, 0x22, 0x3e, 0x20, 0x70, 0x73, 0x69,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x2e, 0x64, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x63,
+  0x70, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x36, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x73, 0x69, 0x32, 0x2f, 0x63,
+  0x50, 0x22, 0x3e, 0x20, 0x70, 0x73, 0x69, 0x3c, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f,
+  0x63, 0x50, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x72, 0x61, 0x64, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x72, 0x61,
+  0x64, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x72, 0x61, 0x64, 0x2f, 0x6d, 0x33,
+  0x22, 0x3e, 0x20, 0x72, 0x61, 0x64, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x72, 0x61,
+  0x64, 0x2f, 0x73, 0x32, 0x22, 0x3e, 0x20, 0x72, 0x61, 0x64, 0x2f, 0x73,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x73, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x73, 0x2f,
+  0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x73, 0x2f, 0x6d, 0x33, 0x22, 0x3e, 0x20, 0x73,
+  0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x73, 0x63, 0x66, 0x28, 0x36, 0x30, 0x46, 0x29,
+  0x2f, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x73, 0x63, 0x66, 0x28, 0x36,
+  0x30, 0x46, 0x29, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x63, 0x66, 0x28,
+  0x36, 0x30, 0x46, 0x29, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20, 0x73,
+  0x63, 0x66, 0x28, 0x36, 0x30, 0x46, 0x29, 0x2f, 0x66, 0x74, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x63, 0x6d, 0x28, 0x30, 0x43, 0x29, 0x2f, 0x6d, 0x32, 0x22, 0x3e,
+  0x20, 0x73, 0x63, 0x6d, 0x28, 0x30, 0x43, 0x29, 0x2f, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x63, 0x6d, 0x28, 0x30, 0x43, 0x29, 0x2f, 0x6d, 0x33, 0x22, 0x3e,
+  0x20, 0x73, 0x63, 0x6d, 0x28, 0x30, 0x43, 0x29, 0x2f, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x63, 0x6d, 0x28, 0x31, 0x35, 0x43, 0x29, 0x2f, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x73, 0x63, 0x6d, 0x28, 0x31, 0x35, 0x43, 0x29, 0x2f, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x73, 0x63, 0x6d, 0x28, 0x31, 0x35, 0x43, 0x29, 0x2f, 0x6d,
+  0x33, 0x22, 0x3e, 0x20, 0x73, 0x63, 0x6d, 0x28, 0x31, 0x35, 0x43, 0x29,
+  0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x73, 0x6d, 0x33, 0x2f, 0x6b, 0x73, 0x6d, 0x33,
+  0x22, 0x3e, 0x20, 0x73, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x6b, 0x73,
+  0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x73, 0x6d, 0x33, 0x2f, 0x73, 0x6d, 0x33, 0x22, 0x3e,
+  0x20, 0x73, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2f, 0x73, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x74, 0x68, 0x65, 0x72, 0x6d, 0x2f, 0x66, 0x74, 0x33, 0x22, 0x3e, 0x20,
+  0x74, 0x68, 0x65, 0x72, 0x6d, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x6f,
+  0x6e, 0x66, 0x55, 0x4b, 0x2e, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x74,
+  0x6f, 0x6e, 0x66, 0x55, 0x4b, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x6f,
+  0x6e, 0x66, 0x55, 0x4b, 0x2f, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x74,
+  0x6f, 0x6e, 0x66, 0x55, 0x4b, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x6f,
+  0x6e, 0x66, 0x55, 0x53, 0x2e, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x74,
+  0x6f, 0x6e, 0x66, 0x55, 0x53, 0x2e, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x6f,
+  0x6e, 0x66, 0x55, 0x53, 0x2f, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x74,
+  0x6f, 0x6e, 0x66, 0x55, 0x53, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x6f,
+  0x6e, 0x66, 0x55, 0x53, 0x2f, 0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20, 0x74,
+  0x6f, 0x6e, 0x66, 0x55, 0x53, 0x2f, 0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x6f,
+  0x6e, 0x55, 0x53, 0x2f, 0x66, 0x74, 0x32, 0x22, 0x3e, 0x20, 0x74, 0x6f,
+  0x6e, 0x55, 0x53, 0x2f, 0x66, 0x74, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x75, 0x41, 0x2f, 0x63,
+  0x6d, 0x32, 0x22, 0x3e, 0x20, 0x75, 0x41, 0x2f, 0x63, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x75, 0x41, 0x2f, 0x69, 0x6e, 0x32, 0x22, 0x3e, 0x20, 0x75, 0x41, 0x2f,
+  0x69, 0x6e, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x75, 0x63, 0x61, 0x6c, 0x2f, 0x73, 0x2e, 0x63,
+  0x6d, 0x32, 0x22, 0x3e, 0x20, 0x75, 0x63, 0x61, 0x6c, 0x2f, 0x73, 0x2e,
+  0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x75, 0x67, 0x2f, 0x63, 0x6d, 0x33, 0x22, 0x3e,
+  0x20, 0x75, 0x67, 0x2f, 0x63, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72,
+  0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x73, 0x75,
+  0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x75, 0x6d, 0x32, 0x22,
+  0x3e, 0x20, 0x75, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f,
+  0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x75, 0x6d, 0x32, 0x2e, 0x6d, 0x22,
+  0x3e, 0x20, 0x75, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2e, 0x6d, 0x3c, 0x2f,
+  0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f,
+  0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x75, 0x57, 0x2f, 0x6d,
+  0x33, 0x22, 0x3e, 0x20, 0x75, 0x57, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x57, 0x2f,
+  0x63, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x57, 0x2f, 0x63, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x57, 0x2f, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x57, 0x2f, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x57, 0x2f, 0x6d, 0x32, 0x2e, 0x4b, 0x22, 0x3e, 0x20, 0x57, 0x2f, 0x6d,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x2e, 0x4b, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x57, 0x2f, 0x6d, 0x32, 0x2e, 0x73, 0x72, 0x22,
+  0x3e, 0x20, 0x57, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x2e, 0x73, 0x72,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x57, 0x2f,
+  0x6d, 0x33, 0x22, 0x3e, 0x20, 0x57, 0x2f, 0x6d, 0x3c, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33, 0x3c, 0x2f,
+  0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+  0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x57, 0x2f,
+  0x6d, 0x33, 0x2e, 0x4b, 0x22, 0x3e, 0x20, 0x57, 0x2f, 0x6d, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x2e, 0x4b, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x57, 0x2f, 0x6d, 0x6d, 0x32, 0x22, 0x3e, 0x20, 0x57, 0x2f,
+  0x6d, 0x6d, 0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x79, 0x64, 0x32, 0x22, 0x3e, 0x20, 0x79, 0x64,
+  0x3c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x32, 0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x75, 0x6f, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x79, 0x64, 0x33, 0x22, 0x3e, 0x20, 0x79, 0x64, 0x3c, 0x73,
+  0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x33,
+  0x3c, 0x2f, 0x73, 0x75, 0x70, 0x65, 0x72, 0x53, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x3e, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x73, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x21, 0x2d,
+  0x2d, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x46,
+  0x4e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xd8, 0x8b, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x41, 0x46,
+  0x4e, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x41, 0x52, 0x53, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x41,
+  0x52, 0x53, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x41, 0x57, 0x47, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xc6, 0x92, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x41, 0x57, 0x47, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x41, 0x55, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24,
+  0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x20, 0x41, 0x55, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x41, 0x5a, 0x4e, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0xe2, 0x82, 0xbc, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x20, 0x41, 0x5a, 0x4e, 0x3c, 0x2f, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x53, 0x44, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x42, 0x53, 0x44, 0x3c, 0x2f, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x42, 0x44, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x42, 0x42, 0x44, 0x3c, 0x2f,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x59, 0x4e,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x42, 0x72, 0x3c, 0x2f, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x42, 0x59, 0x4e, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x5a,
+  0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x42, 0x5a, 0x24, 0x3c, 0x2f, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x42,
+  0x5a, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x42, 0x4d, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20,
+  0x42, 0x4d, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x42, 0x4f, 0x42, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x62,
+  0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x20, 0x42, 0x4f, 0x42, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x42, 0x41, 0x4d, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x4b, 0x4d, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x42, 0x41, 0x4d, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x57, 0x50, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x50, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x20, 0x42, 0x57, 0x50, 0x3c, 0x2f, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x47, 0x4e, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0xd0, 0xbb, 0xd0, 0xb2, 0x3c, 0x2f, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x42, 0x47, 0x4e,
+  0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42,
+  0x52, 0x4c, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x52, 0x24, 0x3c, 0x2f, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x42,
+  0x52, 0x4c, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x42, 0x4e, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20,
+  0x42, 0x4e, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4b, 0x48, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe1, 0x9f,
+  0x9b, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x20, 0x4b, 0x48, 0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x41, 0x44, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x43, 0x41, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x59, 0x44, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x20, 0x4b, 0x59, 0x44, 0x3c, 0x2f, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x4c, 0x50, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x43, 0x4c, 0x50, 0x3c, 0x2f, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x4e, 0x59, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0xc2, 0xa5, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x43, 0x4e, 0x59, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x4f,
+  0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x43, 0x4f, 0x50,
+  0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43,
+  0x52, 0x43, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82, 0xa1, 0x3c, 0x2f,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20,
+  0x43, 0x52, 0x43, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x48, 0x52, 0x4b, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x6b, 0x6e,
+  0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x20, 0x48, 0x52, 0x4b, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x43, 0x55, 0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0xe2, 0x82, 0xb1, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x20, 0x43, 0x55, 0x50, 0x3c, 0x2f, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x5a, 0x4b, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x4b, 0xc4, 0x8d, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x43, 0x5a, 0x4b, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x44, 0x4b,
+  0x4b, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x6b, 0x72, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x44, 0x4b,
+  0x4b, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x44, 0x4f, 0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x52, 0x44, 0x24, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x44, 0x4f, 0x50, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x58, 0x43, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24,
+  0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x20, 0x58, 0x43, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x45, 0x47, 0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0xc2, 0xa3, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x45, 0x47, 0x50, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x56, 0x43, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x20, 0x53, 0x56, 0x43, 0x3c, 0x2f, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x45, 0x55, 0x52, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0xe2, 0x82, 0xac, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x45, 0x55, 0x52, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x46, 0x4b,
+  0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xc2, 0xa3, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x46, 0x4b,
+  0x50, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x46, 0x4a, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x46,
+  0x4a, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x47, 0x48, 0x53, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xc2, 0xa2, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x47, 0x48, 0x53, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x47, 0x49, 0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xc2,
+  0xa3, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x20, 0x47, 0x49, 0x50, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x54, 0x51, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x51, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x47, 0x54, 0x51, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x47, 0x50, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0xc2, 0xa3, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x47, 0x47, 0x50, 0x3c, 0x2f, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x47, 0x59, 0x44, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x47, 0x59, 0x44, 0x3c, 0x2f,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x4e, 0x4c,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x4c, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x48, 0x4e, 0x4c, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x4b,
+  0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x48, 0x4b, 0x44,
+  0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48,
+  0x55, 0x46, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x46, 0x74, 0x3c, 0x2f, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x48,
+  0x55, 0x46, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x49, 0x53, 0x4b, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x6b, 0x72, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x49, 0x53, 0x4b, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x49, 0x4e, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2,
+  0x82, 0xb9, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x49, 0x4e, 0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49, 0x44, 0x52, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x52, 0x70, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x49, 0x44, 0x52, 0x3c, 0x2f, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49, 0x52, 0x52, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0xef, 0xb7, 0xbc, 0x3c, 0x2f, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x49, 0x52, 0x52,
+  0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49,
+  0x4d, 0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xc2, 0xa3, 0x3c, 0x2f, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x49,
+  0x4d, 0x50, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x49, 0x4c, 0x53, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82, 0xaa,
+  0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x20, 0x49, 0x4c, 0x53, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x4d, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x4a, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x4a, 0x4d, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x50, 0x59, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0xc2, 0xa5, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4a, 0x50, 0x59, 0x3c, 0x2f, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4a, 0x45, 0x50, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0xc2, 0xa3, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4a, 0x45, 0x50, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x5a,
+  0x54, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xd0, 0xbb, 0xd0, 0xb2, 0x3c, 0x2f,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20,
+  0x4b, 0x5a, 0x54, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4b, 0x50, 0x57, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82,
+  0xa9, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x20, 0x4b, 0x50, 0x57, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x52, 0x57, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0xe2, 0x82, 0xa9, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4b, 0x52, 0x57, 0x3c, 0x2f, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4b, 0x47, 0x53, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0xd0, 0xbb, 0xd0, 0xb2, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4b, 0x47,
+  0x53, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4c, 0x41, 0x4b, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82, 0xad, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x4c, 0x41, 0x4b, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x4c, 0x42, 0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xc2,
+  0xa3, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x20, 0x4c, 0x42, 0x50, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x52, 0x44, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x4c, 0x52, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x4b, 0x44, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0xd0, 0xb4, 0xd0, 0xb5, 0xd0, 0xbd, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4d, 0x4b,
+  0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4d, 0x59, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x52, 0x4d, 0x3c, 0x2f,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20,
+  0x4d, 0x59, 0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x4d, 0x55, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82,
+  0xa8, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x20, 0x4d, 0x55, 0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x58, 0x4e, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x4d, 0x58, 0x4e, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x4e, 0x54, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0xe2, 0x82, 0xae, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4d, 0x4e, 0x54, 0x3c, 0x2f,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4d, 0x5a, 0x4e,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x4d, 0x54, 0x3c, 0x2f, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4d, 0x5a, 0x4e,
+  0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e,
+  0x41, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4e, 0x41,
+  0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x4e, 0x50, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82, 0xa8, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x4e, 0x50, 0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x41, 0x4e, 0x47, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xc6,
+  0x92, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x20, 0x41, 0x4e, 0x47, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x5a, 0x44, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x4e, 0x5a, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x49, 0x4f, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x43, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4e, 0x49, 0x4f, 0x3c, 0x2f, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e, 0x47, 0x4e, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82, 0xa6, 0x3c, 0x2f, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4e, 0x47, 0x4e,
+  0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4e,
+  0x4f, 0x4b, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x6b, 0x72, 0x3c, 0x2f, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x4e,
+  0x4f, 0x4b, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4f, 0x4d, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xef, 0xb7, 0xbc,
+  0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x20, 0x4f, 0x4d, 0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x50, 0x4b, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0xe2, 0x82, 0xa8, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x20, 0x50, 0x4b, 0x52, 0x3c, 0x2f, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x41, 0x42, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x42, 0x2f, 0x2e, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x50, 0x41, 0x42, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x59,
+  0x47, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x47, 0x73, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x50, 0x59,
+  0x47, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x50, 0x45, 0x4e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x53, 0x2f, 0x2e, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x50, 0x45, 0x4e, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x50, 0x48, 0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2,
+  0x82, 0xb1, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x50, 0x48, 0x50, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x4c, 0x4e, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x7a, 0xc5, 0x82, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x50, 0x4c, 0x4e, 0x3c, 0x2f,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x51, 0x41, 0x52,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0xef, 0xb7, 0xbc, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x51, 0x41,
+  0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x52, 0x4f, 0x4e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x6c, 0x65, 0x69, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x52, 0x4f, 0x4e, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x52, 0x55, 0x42, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2,
+  0x82, 0xbd, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x52, 0x55, 0x42, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x48, 0x50, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0xc2, 0xa3, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x53, 0x48, 0x50, 0x3c, 0x2f, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x41, 0x52, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0xef, 0xb7, 0xbc, 0x3c, 0x2f, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x53, 0x41, 0x52,
+  0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x52,
+  0x53, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xd0, 0xb4, 0xd0, 0xb8, 0xd0,
+  0xbd, 0x2e, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x52, 0x53, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x43, 0x52, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0xe2, 0x82, 0xa8, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x53, 0x43, 0x52, 0x3c, 0x2f,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x47, 0x44,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x53, 0x47, 0x44, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x42,
+  0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x53, 0x42, 0x44,
+  0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63,
+  0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53,
+  0x4f, 0x53, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x53, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x53, 0x4f,
+  0x53, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x5a, 0x41, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x52, 0x3c, 0x2f, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x5a,
+  0x41, 0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x4c, 0x4b, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82, 0xa8,
+  0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x20, 0x4c, 0x4b, 0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x53, 0x45, 0x4b, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x6b, 0x72, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x53, 0x45, 0x4b, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x43, 0x48, 0x46, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x43, 0x48, 0x46, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x52, 0x44, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x3e, 0x20, 0x53, 0x52, 0x44, 0x3c, 0x2f, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x53, 0x59, 0x50, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0xc2, 0xa3, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x53, 0x59, 0x50, 0x3c, 0x2f,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x57, 0x44,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x4e, 0x54, 0x24, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x54, 0x57,
+  0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x54, 0x48, 0x42, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe0, 0xb8, 0xbf, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x54, 0x48, 0x42, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x54, 0x54, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x54,
+  0x54, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x54, 0x54, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x52, 0x59, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0xe2, 0x82, 0xba, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x54, 0x52, 0x59, 0x3c, 0x2f,
+  0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x54, 0x56, 0x44,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x54, 0x56, 0x44, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x55, 0x41,
+  0x48, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82, 0xb4, 0x3c, 0x2f, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x55,
+  0x41, 0x48, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x47, 0x42, 0x50, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xc2, 0xa3, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x47, 0x42, 0x50, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x55, 0x53, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x24,
+  0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x3e, 0x20, 0x55, 0x53, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x55, 0x59, 0x55, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e,
+  0x24, 0x55, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x55, 0x59, 0x55, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x55, 0x5a, 0x53, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0xd0, 0xbb, 0xd0, 0xb2, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x55, 0x5a, 0x53, 0x3c,
+  0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65,
+  0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x56, 0x45,
+  0x46, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x42, 0x73, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x56, 0x45,
+  0x46, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x56, 0x4e, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xe2, 0x82, 0xab, 0x3c,
+  0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e,
+  0x20, 0x56, 0x4e, 0x44, 0x3c, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69,
+  0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x59, 0x45, 0x52, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0xef,
+  0xb7, 0xbc, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73, 0x74, 0x66,
+  0x69, 0x78, 0x3e, 0x20, 0x59, 0x45, 0x52, 0x3c, 0x2f, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x5a, 0x57, 0x44, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x3e, 0x5a, 0x24, 0x3c, 0x2f, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x6f, 0x73,
+  0x74, 0x66, 0x69, 0x78, 0x3e, 0x20, 0x5a, 0x57, 0x44, 0x3c, 0x2f, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x69,
+  0x65, 0x73, 0x3e, 0x2d, 0x2d, 0x3e, 0x0a, 0x3c, 0x2f, 0x75, 0x6f, 0x6d,
+  0x44, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3e, 0x0a
+};
+unsigned int uomdisplay_xml_len = 38385;
+unsigned char uomdisplay_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c,
+  0x6e, 0x73, 0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70,
+  0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72,
+  0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54,
+  0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x0a, 0x20, 0x20,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30,
+  0x22, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70,
+  0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x3e, 0x53, 0x49, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x75, 0x6f,
+  0x6d, 0x44, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2d, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x22, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x5b, 0x40, 0x6e, 0x61, 0x6d, 0x65,
+  0x20, 0x3d, 0x20, 0x24, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x5d, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73,
+  0x68, 0x65, 0x65, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x65,
+  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3e, 0x31, 0x2e, 0x30, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x64, 0x65, 0x63, 0x69,
+  0x6d, 0x61, 0x6c, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e,
+  0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x2d, 0x66, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x2d, 0x73, 0x65, 0x70, 0x61,
+  0x72, 0x61, 0x74, 0x6f, 0x72, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x24, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65,
+  0x64, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2f, 0x40, 0x64, 0x65,
+  0x63, 0x69, 0x6d, 0x61, 0x6c, 0x53, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
+  0x6f, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x65, 0x70,
+  0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x65, 0x64, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2f, 0x40, 0x67,
+  0x72, 0x6f, 0x75, 0x70, 0x69, 0x6e, 0x67, 0x53, 0x65, 0x70, 0x61, 0x72,
+  0x61, 0x74, 0x6f, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x64, 0x65, 0x63,
+  0x69, 0x6d, 0x61, 0x6c, 0x2d, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
+  0x6f, 0x72, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x24, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x65, 0x64, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2f, 0x40, 0x64,
+  0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x53, 0x65, 0x70, 0x61, 0x72, 0x61,
+  0x74, 0x6f, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69,
+  0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x69,
+  0x6e, 0x67, 0x2d, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x24, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64,
+  0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2f, 0x40, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x69, 0x6e, 0x67, 0x53, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
+  0x6f, 0x72, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64,
+  0x65, 0x28, 0x29, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64,
+  0x65, 0x28, 0x29, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x72, 0x65, 0x70, 0x65,
+  0x61, 0x74, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x70,
+  0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c,
+  0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x73, 0x65,
+  0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e,
+  0x24, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x26, 0x67, 0x74, 0x3b, 0x20,
+  0x30, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x73, 0x74, 0x72, 0x69,
+  0x6e, 0x67, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22,
+  0x3e, 0x24, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x24, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x26, 0x67, 0x74, 0x3b, 0x20,
+  0x31, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x24, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x20, 0x6d, 0x6f, 0x64, 0x20, 0x24, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20,
+  0x3d, 0x20, 0x31, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22,
+  0x3e, 0x24, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e,
+  0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74, 0x68, 0x2d,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+  0x3e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x20, 0x2d, 0x20, 0x31, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x69, 0x74, 0x68, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x67,
+  0x72, 0x6f, 0x75, 0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x69, 0x74, 0x68, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
+  0x6f, 0x72, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x22, 0x3e, 0x24, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x67, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x74, 0x65, 0x2d, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2d,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x22, 0x3e, 0x2e, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61,
+  0x6d, 0x65, 0x22, 0x3e, 0x61, 0x62, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f,
+  0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74,
+  0x65, 0x73, 0x74, 0x22, 0x3e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x2d,
+  0x77, 0x69, 0x74, 0x68, 0x28, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c,
+  0x20, 0x27, 0x2d, 0x27, 0x29, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x73, 0x75, 0x62, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x2d, 0x61, 0x66, 0x74, 0x65, 0x72, 0x28, 0x24,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x27, 0x2d, 0x27, 0x29, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x68, 0x61,
+  0x73, 0x2d, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x22, 0x3e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e,
+  0x73, 0x28, 0x24, 0x61, 0x62, 0x73, 0x2c, 0x20, 0x27, 0x2e, 0x27, 0x29,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x61, 0x6c, 0x6c, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61,
+  0x6d, 0x65, 0x22, 0x3e, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x2d, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74, 0x68, 0x2d,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x30, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74, 0x68, 0x2d,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f,
+  0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x24, 0x68, 0x61, 0x73,
+  0x2d, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x22, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65, 0x6e,
+  0x67, 0x74, 0x68, 0x28, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x2d, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x28, 0x24, 0x61, 0x62,
+  0x73, 0x2c, 0x20, 0x27, 0x2e, 0x27, 0x29, 0x29, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x22, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65,
+  0x6e, 0x67, 0x74, 0x68, 0x28, 0x24, 0x61, 0x62, 0x73, 0x29, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x33, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x73, 0x65, 0x70, 0x61, 0x72,
+  0x61, 0x74, 0x6f, 0x72, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x22, 0x3e, 0x24, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x69, 0x6e, 0x67, 0x2d,
+  0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x69, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x24, 0x68, 0x61, 0x73, 0x2d, 0x64,
+  0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e,
+  0x24, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x2d, 0x73, 0x65, 0x70,
+  0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61, 0x6c,
+  0x6c, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61,
+  0x6d, 0x65, 0x22, 0x3e, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x2d, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74,
+  0x68, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x30, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x70, 0x61,
+  0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x22, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x6c,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x28, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x2d, 0x61, 0x66, 0x74, 0x65, 0x72, 0x28, 0x24, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x27, 0x2e, 0x27, 0x29, 0x29, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+  0x74, 0x2d, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x2d, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+  0x3e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x22, 0x3e, 0x2e, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+  0x22, 0x3e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61,
+  0x6c, 0x6c, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3e, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74,
+  0x65, 0x2d, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2d, 0x66, 0x6f, 0x72,
+  0x6d, 0x61, 0x74, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x69, 0x74, 0x68, 0x2d,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+  0x3e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x24, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x22, 0x3e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d,
+  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x24, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2c, 0x20, 0x24, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2c, 0x20,
+  0x27, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x2d, 0x66, 0x6f, 0x72,
+  0x6d, 0x61, 0x74, 0x27, 0x29, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x77, 0x72,
+  0x61, 0x70, 0x49, 0x6e, 0x74, 0x6f, 0x2f, 0x2a, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x77, 0x72, 0x61, 0x70, 0x49, 0x6e, 0x74, 0x6f,
+  0x2f, 0x2a, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68,
+  0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x61, 0x6c, 0x6c, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x71, 0x75, 0x61, 0x6e, 0x74,
+  0x69, 0x74, 0x79, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x71, 0x75, 0x61,
+  0x6e, 0x74, 0x69, 0x74, 0x79, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68,
+  0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74,
+  0x22, 0x3e, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x47,
+  0x72, 0x6f, 0x75, 0x70, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x27,
+  0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x27, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68,
+  0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e,
+  0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x69,
+  0x62, 0x6c, 0x69, 0x6e, 0x67, 0x3a, 0x3a, 0x71, 0x75, 0x61, 0x6e, 0x74,
+  0x69, 0x74, 0x79, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x54, 0x79, 0x70, 0x65,
+  0x50, 0x72, 0x65, 0x66, 0x69, 0x78, 0x65, 0x73, 0x2f, 0x6d, 0x69, 0x6e,
+  0x69, 0x6d, 0x75, 0x6d, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x77, 0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x54, 0x79, 0x70, 0x65, 0x50, 0x72, 0x65, 0x66, 0x69, 0x78,
+  0x65, 0x73, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74,
+  0x69, 0x74, 0x79, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x54, 0x79, 0x70, 0x65,
+  0x20, 0x3d, 0x20, 0x27, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x27,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65,
+  0x73, 0x74, 0x22, 0x3e, 0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6e,
+  0x67, 0x2d, 0x73, 0x69, 0x62, 0x6c, 0x69, 0x6e, 0x67, 0x3a, 0x3a, 0x71,
+  0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x47, 0x72, 0x6f, 0x75, 0x70,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x67, 0x72, 0x6f, 0x75, 0x70,
+  0x54, 0x79, 0x70, 0x65, 0x50, 0x72, 0x65, 0x66, 0x69, 0x78, 0x65, 0x73,
+  0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x52, 0x61, 0x6e, 0x67,
+  0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d,
+  0x22, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x54, 0x79, 0x70, 0x65, 0x50, 0x72,
+  0x65, 0x66, 0x69, 0x78, 0x65, 0x73, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d,
+  0x75, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x54, 0x79, 0x70, 0x65, 0x50, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x65, 0x73, 0x2f, 0x6e, 0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x66, 0x6f,
+  0x72, 0x2d, 0x65, 0x61, 0x63, 0x68, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e,
+  0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75,
+  0x65, 0x7c, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x54, 0x6f,
+  0x6c, 0x65, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74,
+  0x65, 0x73, 0x74, 0x22, 0x3e, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x28, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x31, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2e, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74,
+  0x69, 0x74, 0x79, 0x55, 0x6e, 0x69, 0x74, 0x4f, 0x66, 0x4d, 0x65, 0x61,
+  0x73, 0x75, 0x72, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x71, 0x75, 0x61,
+  0x6e, 0x74, 0x69, 0x74, 0x79, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61,
+  0x6c, 0x6c, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40, 0x71, 0x75, 0x61,
+  0x6e, 0x74, 0x69, 0x74, 0x79, 0x55, 0x6e, 0x69, 0x74, 0x4f, 0x66, 0x4d,
+  0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x71,
+  0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x54, 0x6f, 0x6c, 0x65, 0x72,
+  0x61, 0x6e, 0x63, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x74, 0x6f, 0x6c,
+  0x65, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61,
+  0x6c, 0x6c, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2d, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40, 0x71, 0x75, 0x61,
+  0x6e, 0x74, 0x69, 0x74, 0x79, 0x55, 0x6e, 0x69, 0x74, 0x4f, 0x66, 0x4d,
+  0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x74, 0x6f,
+  0x6c, 0x65, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x2d, 0x74, 0x79, 0x70, 0x65,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x74, 0x79, 0x70,
+  0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x54, 0x6f, 0x6c, 0x65, 0x72, 0x61,
+  0x6e, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e, 0x24, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x70, 0x6c, 0x75, 0x73, 0x27,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x2b, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e,
+  0x24, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x6d, 0x69, 0x6e,
+  0x75, 0x73, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2d, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+  0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x3e, 0xc2, 0xb1, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x75, 0x6f,
+  0x6d, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x75, 0x6f, 0x6d, 0x73,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e,
+  0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x55, 0x6e, 0x69,
+  0x74, 0x4f, 0x66, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2e, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77,
+  0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65,
+  0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x40, 0x71,
+  0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x54, 0x79, 0x70, 0x65, 0x53,
+  0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x73, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f,
+  0x64, 0x65, 0x22, 0x3e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x22, 0x3e, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74,
+  0x79, 0x54, 0x79, 0x70, 0x65, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69,
+  0x63, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22,
+  0x3e, 0x2e, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x71, 0x75, 0x61, 0x6e,
+  0x74, 0x69, 0x74, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e,
+  0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x54, 0x79, 0x70,
+  0x65, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x73, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c,
+  0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x22, 0x3e, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79,
+  0x54, 0x79, 0x70, 0x65, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x6f, 0x64, 0x65, 0x22, 0x3e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+  0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x22, 0x3e, 0x2a, 0x7c, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29,
+  0x5b, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x2d, 0x73,
+  0x70, 0x61, 0x63, 0x65, 0x28, 0x2e, 0x29, 0x21, 0x3d, 0x27, 0x27, 0x5d,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x69, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74,
+  0x65, 0x73, 0x74, 0x22, 0x3e, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69,
+  0x74, 0x79, 0x54, 0x79, 0x70, 0x65, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66,
+  0x69, 0x63, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x40, 0x71, 0x75, 0x61,
+  0x6e, 0x74, 0x69, 0x74, 0x79, 0x54, 0x79, 0x70, 0x65, 0x53, 0x70, 0x65,
+  0x63, 0x69, 0x66, 0x69, 0x63, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x77, 0x72, 0x61, 0x70,
+  0x49, 0x6e, 0x74, 0x6f, 0x2f, 0x2a, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x6f, 0x70, 0x79, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x40, 0x2a, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x61, 0x6c, 0x6c,
+  0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x3d, 0x22, 0x75, 0x6f, 0x6d, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x40, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x55, 0x6e, 0x69, 0x74, 0x4f, 0x66,
+  0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x6f, 0x70, 0x79, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x2a, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x75, 0x6f, 0x6d, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68,
+  0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x75, 0x6f, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77,
+  0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2e, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2e,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65,
+  0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x75, 0x6f, 0x6d, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c,
+  0x3a, 0x77, 0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74,
+  0x65, 0x73, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x2e, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d,
+  0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40,
+  0x6e, 0x61, 0x6d, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x63, 0x6f, 0x70, 0x79, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x69,
+  0x65, 0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x22, 0x3e, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69,
+  0x74, 0x79, 0x54, 0x79, 0x70, 0x65, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66,
+  0x69, 0x63, 0x73, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d,
+  0x6f, 0x64, 0x65, 0x22, 0x3e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x2d, 0x6f, 0x66, 0x20, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x2a,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70,
+  0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x63, 0x79, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d,
+  0x22, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f,
+  0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x22, 0x3e, 0x40,
+  0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x54, 0x79, 0x70, 0x65,
+  0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x73, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x70,
+  0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f,
+  0x70, 0x79, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x2a, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68,
+  0x6f, 0x6f, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x20,
+  0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x70, 0x6f, 0x73, 0x74,
+  0x66, 0x69, 0x78, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77,
+  0x69, 0x73, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2e, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x77, 0x68, 0x65, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x2d, 0x6f, 0x66, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x22, 0x3e, 0x2e,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x6f, 0x74, 0x68, 0x65,
+  0x72, 0x77, 0x69, 0x73, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x68, 0x6f, 0x6f, 0x73,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79,
+  0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77, 0x68, 0x65, 0x6e,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2e, 0x20, 0x3d, 0x20, 0x27,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x27, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79,
+  0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22,
+  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x28,
+  0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x63, 0x79, 0x22, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x22, 0x70, 0x6f,
+  0x73, 0x74, 0x66, 0x69, 0x78, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x78, 0x73, 0x6c, 0x3a, 0x77,
+  0x68, 0x65, 0x6e, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x73,
+  0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x2e, 0x20,
+  0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66,
+  0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x6e, 0x61,
+  0x6d, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x27, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x63,
+  0x6f, 0x70, 0x79, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x2f, 0x6e,
+  0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68,
+  0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int uomdisplay_xsl_len = 18833;
+unsigned char dupl_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c,
+  0x6e, 0x73, 0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70,
+  0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72,
+  0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54,
+  0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x0a, 0x20, 0x20,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30,
+  0x22, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70,
+  0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x22, 0x3e, 0x20, 0x28, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78,
+  0x22, 0x3e, 0x29, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x70, 0x61, 0x72,
+  0x61, 0x6d, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28,
+  0x29, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64,
+  0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x3d, 0x22, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74,
+  0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c,
+  0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64,
+  0x65, 0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x73, 0x31, 0x6b, 0x64, 0x2d, 0x75, 0x6f, 0x6d,
+  0x5f, 0x44, 0x55, 0x50, 0x4c, 0x49, 0x43, 0x41, 0x54, 0x45, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x24, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3d, 0x22, 0x2e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x2d, 0x6f, 0x66, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x3d, 0x22, 0x24, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x31, 0x6b,
+  0x64, 0x2d, 0x75, 0x6f, 0x6d, 0x5f, 0x44, 0x55, 0x50, 0x4c, 0x49, 0x43,
+  0x41, 0x54, 0x45, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40,
+  0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x55, 0x6e, 0x69, 0x74,
+  0x4f, 0x66, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x73, 0x31, 0x6b, 0x64, 0x2d, 0x75, 0x6f, 0x6d, 0x5f, 0x51, 0x55,
+  0x4f, 0x4d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78,
+  0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e,
+  0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d,
+  0x22, 0x40, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x54, 0x79,
+  0x70, 0x65, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x73, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x73, 0x31, 0x6b, 0x64, 0x2d, 0x75, 0x6f, 0x6d, 0x5f,
+  0x51, 0x54, 0x53, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65,
+  0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int dupl_xsl_len = 969;
+unsigned char undupl_xsl[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c,
+  0x6e, 0x73, 0x3a, 0x78, 0x73, 0x6c, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70,
+  0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72,
+  0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x58, 0x53, 0x4c, 0x2f, 0x54,
+  0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x0a, 0x20, 0x20,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30,
+  0x22, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74,
+  0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c,
+  0x65, 0x63, 0x74, 0x3d, 0x22, 0x40, 0x2a, 0x7c, 0x6e, 0x6f, 0x64, 0x65,
+  0x28, 0x29, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x78, 0x73, 0x6c, 0x3a, 0x63, 0x6f, 0x70, 0x79, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x3d, 0x22, 0x73, 0x31, 0x6b, 0x64, 0x2d, 0x75, 0x6f, 0x6d,
+  0x5f, 0x44, 0x55, 0x50, 0x4c, 0x49, 0x43, 0x41, 0x54, 0x45, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x69, 0x66,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x65,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x3a, 0x3a, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x5b, 0x6e, 0x61, 0x6d, 0x65,
+  0x28, 0x29, 0x20, 0x3d, 0x20, 0x27, 0x73, 0x31, 0x6b, 0x64, 0x2d, 0x75,
+  0x6f, 0x6d, 0x5f, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x54, 0x45, 0x44,
+  0x27, 0x5d, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x78, 0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65,
+  0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3d, 0x22, 0x6e, 0x6f, 0x64, 0x65, 0x28, 0x29, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x69, 0x66, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a,
+  0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61,
+  0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x2d, 0x69, 0x6e, 0x73,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x5b, 0x6e,
+  0x61, 0x6d, 0x65, 0x28, 0x29, 0x20, 0x3d, 0x20, 0x27, 0x73, 0x31, 0x6b,
+  0x64, 0x2d, 0x75, 0x6f, 0x6d, 0x5f, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52,
+  0x54, 0x45, 0x44, 0x27, 0x5d, 0x22, 0x2f, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40, 0x73, 0x31,
+  0x6b, 0x64, 0x2d, 0x75, 0x6f, 0x6d, 0x5f, 0x51, 0x55, 0x4f, 0x4d, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x55,
+  0x6e, 0x69, 0x74, 0x4f, 0x66, 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73,
+  0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d, 0x70,
+  0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c,
+  0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c,
+  0x61, 0x74, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x40,
+  0x73, 0x31, 0x6b, 0x64, 0x2d, 0x75, 0x6f, 0x6d, 0x5f, 0x51, 0x54, 0x53,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78, 0x73, 0x6c, 0x3a,
+  0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x74, 0x79,
+  0x54, 0x79, 0x70, 0x65, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x78,
+  0x73, 0x6c, 0x3a, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x2d, 0x74, 0x65, 0x6d,
+  0x70, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x61, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x78, 0x73,
+  0x6c, 0x3a, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x3e, 0x0a,
+  0x0a, 0x3c, 0x2f, 0x78, 0x73, 0x6c, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x73, 0x68, 0x65, 0x65, 0x74, 0x3e, 0x0a
+};
+unsigned int undupl_xsl_len = 883;
+unsigned char presets_imperial_xml[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x69, 0x6e, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x63, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e,
+  0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d,
+  0x34, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x34, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x46, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x67, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x2f,
+  0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x2f, 0x68, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4c, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x67, 0x61, 0x6c, 0x55, 0x4b, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x66, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x32, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x66, 0x74, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69,
+  0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d,
+  0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x32, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x4e, 0x2e, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6c, 0x62, 0x66, 0x2e, 0x66, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x4e, 0x2f, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6c, 0x62, 0x66, 0x2f, 0x66, 0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x3c,
+  0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a
+};
+unsigned int presets_imperial_xml_len = 594;
+unsigned char presets_SI_xml[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67,
+  0x46, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x66, 0x74, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x66, 0x74,
+  0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x63, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x69, 0x6e, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e,
+  0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x33, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x69, 0x6e, 0x34, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x63, 0x6d, 0x34, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6b, 0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6d, 0x69, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x2f, 0x68, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x2f, 0x68, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6b, 0x6d, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x6b, 0x6d, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6c, 0x62, 0x66, 0x2e, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x4e, 0x2e, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6c, 0x62, 0x66, 0x2e, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x4e, 0x2e, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6c, 0x62, 0x66, 0x2f, 0x66, 0x74, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x4e, 0x2f, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x6c, 0x62, 0x66, 0x2f, 0x69, 0x6e, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22,
+  0x4e, 0x2f, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22,
+  0x74, 0x6f, 0x6e, 0x55, 0x4b, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b,
+  0x67, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x74, 0x6f,
+  0x6e, 0x55, 0x53, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6b, 0x67, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64, 0x22, 0x20,
+  0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x79, 0x64, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d,
+  0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x79, 0x64,
+  0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x33, 0x22, 0x2f, 0x3e,
+  0x0a, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a
+};
+unsigned int presets_SI_xml_len = 764;
+unsigned char presets_US_xml[] = {
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x75,
+  0x6f, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x69, 0x6e, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x63, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e,
+  0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x63, 0x6d,
+  0x34, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x34, 0x22, 0x2f,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x43, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x64, 0x65, 0x67, 0x46, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x67, 0x22, 0x20, 0x74, 0x6f,
+  0x3d, 0x22, 0x6c, 0x62, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x6b, 0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x32,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x32, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x33, 0x22, 0x20, 0x74,
+  0x6f, 0x3d, 0x22, 0x6d, 0x69, 0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x3d, 0x22, 0x6b, 0x6d, 0x2f, 0x68, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x6d, 0x69, 0x2f, 0x68, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x3d, 0x22, 0x4c, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x67, 0x61, 0x6c,
+  0x55, 0x53, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d,
+  0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x22, 0x2f, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x66, 0x74, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x66, 0x74, 0x33,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+  0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x22,
+  0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x3d, 0x22, 0x6d, 0x6d, 0x32, 0x22, 0x20, 0x74, 0x6f, 0x3d,
+  0x22, 0x69, 0x6e, 0x32, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x22, 0x6d, 0x6d, 0x33, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x69, 0x6e,
+  0x33, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4e, 0x2e,
+  0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2e, 0x66,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x63, 0x6f, 0x6e, 0x76,
+  0x65, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x22, 0x4e, 0x2f,
+  0x6d, 0x22, 0x20, 0x74, 0x6f, 0x3d, 0x22, 0x6c, 0x62, 0x66, 0x2f, 0x66,
+  0x74, 0x22, 0x2f, 0x3e, 0x0a, 0x3c, 0x2f, 0x75, 0x6f, 0x6d, 0x3e, 0x0a
+};
+unsigned int presets_US_xml_len = 660;
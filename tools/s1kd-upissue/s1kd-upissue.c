@@ -4,12 +4,14 @@
 #include <getopt.h>
 #include <stdbool.h>
 #include <time.h>
+#include <pthread.h>
 #include <libxml/tree.h>
 #include <libxml/xpath.h>
+#include <libxml/hash.h>
 #include "s1kd_tools.h"
 
 #define PROG_NAME "s1kd-upissue"
-#define VERSION "4.0.0"
+#define VERSION "4.1.3"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 
@@ -19,6 +21,8 @@
 #define E_ISSUE_TOO_LARGE ERR_PREFIX "%s is at the max issue number.\n"
 #define E_INWORK_TOO_LARGE ERR_PREFIX "%s is at the max inwork number.\n"
 #define E_NON_XML_STDIN ERR_PREFIX "Cannot use -m, -N or read from stdin when file does not contain issue info metadata.\n"
+#define E_BAD_JOBS ERR_PREFIX "Bad number of jobs: %s\n"
+#define E_WRITE ERR_PREFIX "Could not write %s.\n"
 
 #define EXIT_NO_FILE 1
 #define EXIT_NO_OVERWRITE 2
@@ -26,10 +30,12 @@
 #define EXIT_BAD_DATE 4
 #define EXIT_ICN_INWORK 5
 #define EXIT_ISSUE_TOO_LARGE 6
+#define EXIT_BAD_JOBS 7
+#define EXIT_WRITE 8
 
 static void show_help(void)
 {
-	puts("Usage: " PROG_NAME " [-04defHilmNqRrsuvw^] [-1 <type>] [-2 <type>] [-c <reason>] [-I <date>] [-t <urt>] [-z <type>] [<file>...]");
+	puts("Usage: " PROG_NAME " [-04defHilmNqRrsTuvw^] [-1 <type>] [-2 <type>] [-c <reason>] [-I <date>] [-j <n>] [-t <urt>] [-z <type>] [<file>...]");
 	putchar('\n');
 	puts("Options:");
 	puts("  -0, --unverified             Set the quality assurance to unverified.");
@@ -44,6 +50,7 @@ static void show_help(void)
 	puts("  -h, -?, --help               Show usage message.");
 	puts("  -I, --date <date>            The issue date to use for the upissued objects.");
 	puts("  -i, --official               Increase issue number instead of inwork.");
+	puts("  -j, --jobs <n>               Upissue <n> objects at a time.");
 	puts("  -l, --list                   Treat input as list of objects.");
 	puts("  -m, --modify                 Modify metadata without upissuing.");
 	puts("  -N, --omit-issue             Omit issue/inwork numbers from filename.");
@@ -51,6 +58,7 @@ static void show_help(void)
 	puts("  -R, --keep-unassoc-marks     Only delete change marks associated with an RFU.");
 	puts("  -r, --(keep|remove)-changes  Keep RFUs and change marks from old issue. In -m mode, remove them.");
 	puts("  -s, --(keep|change)-date     Do not change issue date. In -m mode, change issue date.");
+	puts("  -T, --summary                Print a summary of the upissued objects.");
 	puts("  -t, --type <urt>             Set the updateReasonType of the last RFU.");
 	puts("  -u, --clean-rfus             Remove unassociated RFUs.");
 	puts("  -v, --verbose                Print filename of upissued objects.");
@@ -513,7 +521,97 @@ static char *issdate = NULL;
 static bool remove_marks = false;
 static bool set_unverif = false;
 
-static void upissue(const char *path)
+/* Objects queued to be upissued concurrently (-j). */
+static struct upissue_queue {
+	char (*paths)[PATH_MAX];
+	int count;
+	int max;
+	int next;
+	int next_out;
+	int err;
+	pthread_mutex_t lock;
+	pthread_cond_t turn;
+} *upissue_queue = NULL;
+
+/* Counts for the summary (-T). */
+static struct {
+	int upissued;
+	int failed;
+	int skipped;
+} stats = {0, 0, 0};
+
+/* Number of temporary copies created, used to make their names unique. */
+static int tmp_count = 0;
+static pthread_mutex_t tmp_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Write a new issue to a temporary file next to its final name. If doc is
+ * NULL, the non-XML file src is copied instead. */
+static int write_tmp(xmlDocPtr doc, const char *src, const char *path, char *tmp)
+{
+	int err;
+
+	if (doc) {
+		err = save_xml_doc_tmp(doc, path, tmp) == -1;
+	} else {
+		pthread_mutex_lock(&tmp_lock);
+		snprintf(tmp, PATH_MAX, "%s.%ld.c%d.tmp", path, (long) getpid(), tmp_count++);
+		pthread_mutex_unlock(&tmp_lock);
+
+		if ((err = copy(src, tmp))) {
+			remove(tmp);
+		}
+	}
+
+	if (err) {
+		fprintf(stderr, E_WRITE, path);
+	}
+
+	return err;
+}
+
+/* Rename a temporary file to the final name of a new issue, so that an
+ * interrupted upissue never leaves a partially written object.
+ *
+ * An existing file that is replaced keeps its permissions, and is not
+ * replaced if it is read-only (for example, locked with -w). Symbolic and
+ * hard links to it are kept. */
+static int commit_tmp(const char *tmp, const char *path)
+{
+	if (commit_tmp_file(tmp, path) != 0) {
+		fprintf(stderr, E_WRITE, path);
+		return 1;
+	}
+
+	return 0;
+}
+
+/* Wait for the turn of the n'th queued object (-j) to write its new issue,
+ * so that the results are the same as when upissuing one object at a time.
+ * Returns false if an earlier object could not be upissued, in which case
+ * nothing more is written. */
+static bool wait_turn(int n)
+{
+	bool ok;
+
+	if (n < 0) {
+		return true;
+	}
+
+	pthread_mutex_lock(&upissue_queue->lock);
+	while (upissue_queue->next_out != n) {
+		pthread_cond_wait(&upissue_queue->turn, &upissue_queue->lock);
+	}
+	ok = upissue_queue->err == 0;
+	pthread_mutex_unlock(&upissue_queue->lock);
+
+	return ok;
+}
+
+/* Upissue an object. The filename of the new issue is written to upissued, or
+ * an empty string if no new issue was created. n is the position of the
+ * object in the queue (-j), or -1. Returns 0 if successful, or the exit status
+ * of the error. */
+static int upissue(const char *path, char *upissued, int n)
 {
 	char *issueNumber = NULL;
 	char *inWork = NULL;
@@ -529,12 +627,14 @@ static void upissue(const char *path)
 	char upissued_issueNumber[32];
 	char upissued_inWork[32];
 	char *p, *i = NULL;
+	int err = 0;
 
 	strcpy(dmfile, path);
+	strcpy(upissued, "");
 
 	if (access(dmfile, F_OK) == -1 && strcmp(dmfile, "-") != 0) {
 		fprintf(stderr, ERR_PREFIX "Could not read file %s.\n", dmfile);
-		exit(EXIT_NO_FILE);
+		return EXIT_NO_FILE;
 	}
 
 	dmdoc = read_xml_doc(dmfile);
@@ -547,7 +647,8 @@ static void upissue(const char *path)
 
 	if (!issueInfo && no_issue) {
 		fprintf(stderr, E_NON_XML_STDIN);
-		exit(EXIT_NO_OVERWRITE);
+		xmlFreeDoc(dmdoc);
+		return EXIT_NO_OVERWRITE;
 	}
 
 	/* Apply modifications without actually upissuing. */
@@ -586,15 +687,23 @@ static void upissue(const char *path)
 			del_marks(dmdoc, iss30);
 		}
 
-		if (overwrite) {
-			save_xml_doc(dmdoc, dmfile);
+		if (overwrite && strcmp(dmfile, "-") != 0) {
+			char tmp[PATH_MAX];
+
+			if (write_tmp(dmdoc, NULL, dmfile, tmp) != 0) {
+				err = EXIT_WRITE;
+			} else if (!wait_turn(n)) {
+				remove(tmp);
+			} else if (commit_tmp(tmp, dmfile) != 0) {
+				err = EXIT_WRITE;
+			}
 		} else {
 			save_xml_doc(dmdoc, "-");
 		}
 
 		xmlFreeDoc(dmdoc);
 
-		return;
+		return err;
 	}
 
 	p = strchr(dmfile, '_');
@@ -625,7 +734,8 @@ static void upissue(const char *path)
 
 		if (i > dmfile + strlen(dmfile) - 6) {
 			fprintf(stderr, E_BAD_FILENAME);
-			exit(EXIT_BAD_FILENAME);
+			err = EXIT_BAD_FILENAME;
+			goto done;
 		}
 
 		issueNumber = calloc(4, 1);
@@ -640,7 +750,8 @@ static void upissue(const char *path)
 
 		if (!newissue) {
 			fprintf(stderr, E_ICN_INWORK);
-			exit(EXIT_ICN_INWORK);
+			err = EXIT_ICN_INWORK;
+			goto done;
 		}
 
 		l = strlen(dmfile);
@@ -660,24 +771,28 @@ static void upissue(const char *path)
 
 		if (n == -1 || i > dmfile + l - 6) {
 			fprintf(stderr, E_BAD_FILENAME);
-			exit(EXIT_BAD_FILENAME);
+			err = EXIT_BAD_FILENAME;
+			goto done;
 		}
 
 		issueNumber = calloc(4, 1);
 		strncpy(issueNumber, i, 3);
 	} else {
 		fprintf(stderr, E_BAD_FILENAME);
-		exit(EXIT_BAD_FILENAME);
+		err = EXIT_BAD_FILENAME;
+		goto done;
 	}
 
 	if ((issueNumber_int = atoi(issueNumber)) >= 999) {
 		fprintf(stderr, E_ISSUE_TOO_LARGE, dmfile);
-		exit(EXIT_ISSUE_TOO_LARGE);
+		err = EXIT_ISSUE_TOO_LARGE;
+		goto done;
 	}
 	if (inWork) {
 		if ((inWork_int = atoi(inWork)) >= 99) {
 			fprintf(stderr, E_INWORK_TOO_LARGE, dmfile);
-			exit(EXIT_ISSUE_TOO_LARGE);
+			err = EXIT_ISSUE_TOO_LARGE;
+			goto done;
 		}
 	}
 
@@ -748,44 +863,52 @@ static void upissue(const char *path)
 		}
 	}
 
-	xmlFree(issueNumber);
-	xmlFree(inWork);
+	/* Preserve the filename of the old issue. */
+	strcpy(cpfile, dmfile);
 
-	if (!dmdoc) { /* Preserve non-XML filename for copying */
-		strcpy(cpfile, dmfile);
+	if (!no_issue && p) {
+		memcpy(i, upissued_issueNumber, 3);
+		if (inWork) {
+			memcpy(i + 4, upissued_inWork, 2);
+		}
 	}
 
-	if (!no_issue) {
-		if (!dry_run) {
-			if (remold && dmdoc) { /* Delete previous issue (XML file) */
-				remove(dmfile);
-			} else if (lock) { /* Remove write permission from previous issue. */
-				mkreadonly(dmfile);
-			}
+	if (!dry_run && strcmp(dmfile, "-") == 0) {
+		save_xml_doc(dmdoc, dmfile);
+	} else if (!dry_run) {
+		char tmp[PATH_MAX];
+		/* Whether the new issue replaces the old issue's file. */
+		bool same = strcmp(cpfile, dmfile) == 0;
+
+		if (write_tmp(dmdoc, cpfile, dmfile, tmp) != 0) {
+			err = EXIT_WRITE;
+			goto done;
 		}
 
-		if (p) {
-			memcpy(i, upissued_issueNumber, 3);
-			if (inWork) {
-				memcpy(i + 4, upissued_inWork, 2);
-			}
+		if (!wait_turn(n)) {
+			remove(tmp);
+			goto done;
 		}
-	}
 
-	if (!dry_run) {
-		if (!overwrite && access(dmfile, F_OK) != -1) {
+		if (!overwrite && !(same && remold && dmdoc && !no_issue) && access(dmfile, F_OK) != -1) {
 			fprintf(stderr, ERR_PREFIX "%s already exists.\n", dmfile);
-			exit(EXIT_NO_OVERWRITE);
+			remove(tmp);
+			err = EXIT_NO_OVERWRITE;
+			goto done;
 		}
 
-		if (dmdoc) {
-			save_xml_doc(dmdoc, dmfile);
-		} else { /* Copy non-XML file */
-			copy(cpfile, dmfile);
+		if (commit_tmp(tmp, dmfile) != 0) {
+			err = EXIT_WRITE;
+			goto done;
+		}
 
-			if (remold) { /* Delete previous issue (non-XML file) */
-				remove(cpfile);
-			}
+		/* The previous issue is only locked or deleted once the new
+		 * issue has been written. */
+		if (!no_issue && lock && !(remold && dmdoc)) {
+			mkreadonly(cpfile);
+		}
+		if (remold && !no_issue && !same) {
+			remove(cpfile);
 		}
 
 		/* Lock official issues. */
@@ -794,45 +917,219 @@ static void upissue(const char *path)
 		}
 	}
 
-	if (verbose) {
-		puts(dmfile);
+	strcpy(upissued, dmfile);
+
+done:
+	xmlFree(issueNumber);
+	xmlFree(inWork);
+	xmlFreeDoc(dmdoc);
+
+	return err;
+}
+
+/* Upissue an object, or queue it to be upissued (-j). */
+static int upissue_file(const char *path)
+{
+	char upissued[PATH_MAX];
+	int err;
+
+	if (upissue_queue) {
+		if (upissue_queue->count == upissue_queue->max) {
+			upissue_queue->max *= 2;
+			upissue_queue->paths = realloc(upissue_queue->paths, upissue_queue->max * PATH_MAX);
+		}
+
+		strcpy(upissue_queue->paths[upissue_queue->count++], path);
+
+		return 0;
+	}
+
+	/* Objects after one that could not be upissued are skipped. */
+	if (stats.failed) {
+		++stats.skipped;
+		return 0;
 	}
 
-	if (dmdoc) {
-		xmlFreeDoc(dmdoc);
+	if ((err = upissue(path, upissued, -1)) != 0) {
+		++stats.failed;
+	} else if (strcmp(upissued, "") != 0) {
+		if (verbose) {
+			puts(upissued);
+		}
+		++stats.upissued;
 	}
+
+	return err;
 }
 
-static void upissue_list(const char *path)
+static int upissue_list(const char *path)
 {
 	FILE *f;
 	char line[PATH_MAX];
+	int err = 0;
 
 	if (path) {
 		if (!(f = fopen(path, "r"))) {
 			fprintf(stderr, E_BAD_LIST, path);
-			return;
+			return 0;
 		}
 	} else {
 		f = stdin;
 	}
 
 	while (fgets(line, PATH_MAX, f)) {
+		int e;
+
 		strtok(line, "\t\r\n");
-		upissue(line);
+
+		if ((e = upissue_file(line)) != 0) {
+			err = e;
+		}
 	}
 
 	if (path) {
 		fclose(f);
 	}
+
+	return err;
+}
+
+static void *upissue_worker(void *arg)
+{
+	while (1) {
+		char upissued[PATH_MAX];
+		int i, err;
+
+		pthread_mutex_lock(&upissue_queue->lock);
+		/* Stop taking new objects after an error. */
+		if (upissue_queue->err) {
+			i = upissue_queue->count;
+		} else {
+			i = upissue_queue->next++;
+		}
+		pthread_mutex_unlock(&upissue_queue->lock);
+
+		if (i >= upissue_queue->count) {
+			break;
+		}
+
+		err = upissue(upissue_queue->paths[i], upissued, i);
+
+		/* Filenames are printed in the original order. */
+		pthread_mutex_lock(&upissue_queue->lock);
+		while (upissue_queue->next_out != i) {
+			pthread_cond_wait(&upissue_queue->turn, &upissue_queue->lock);
+		}
+
+		/* Objects after one that could not be upissued are skipped. */
+		if (upissue_queue->err) {
+			++stats.skipped;
+		} else if (err) {
+			++stats.failed;
+			upissue_queue->err = err;
+		} else if (strcmp(upissued, "") != 0) {
+			if (verbose) {
+				puts(upissued);
+			}
+			++stats.upissued;
+		}
+
+		++upissue_queue->next_out;
+		pthread_cond_broadcast(&upissue_queue->turn);
+		pthread_mutex_unlock(&upissue_queue->lock);
+	}
+
+	return NULL;
+}
+
+/* Whether more than one issue of the same object is queued, determined by
+ * comparing the filenames up to the issue number. */
+static bool queued_multiple_issues(void)
+{
+	xmlHashTablePtr seen;
+	bool multiple = false;
+	int i;
+
+	seen = xmlHashCreate(upissue_queue->count);
+
+	for (i = 0; i < upissue_queue->count && !multiple; ++i) {
+		char key[PATH_MAX], *base, *p;
+
+		strcpy(key, upissue_queue->paths[i]);
+
+		if (!(base = strrchr(key, '/'))) {
+			base = key;
+		}
+
+		if ((p = strchr(base, '_'))) {
+			*p = '\0';
+		} else if ((p = strrchr(base, '-'))) {
+			*p = '\0';
+			if ((p = strrchr(base, '-'))) {
+				*p = '\0';
+			}
+		}
+
+		multiple = xmlHashAddEntry(seen, BAD_CAST key, seen) != 0;
+	}
+
+	xmlHashFree(seen, NULL);
+
+	return multiple;
+}
+
+/* Upissue the queued objects using multiple threads. */
+static int upissue_all(int njobs)
+{
+	pthread_t *workers;
+	int i;
+
+	if (njobs > upissue_queue->count) {
+		njobs = upissue_queue->count;
+	}
+
+	/* Each object is read without waiting for the new issues of the
+	 * objects before it to be written, so when one may be the new issue
+	 * of another, they are upissued one at a time. */
+	if (njobs > 1 && queued_multiple_issues()) {
+		njobs = 1;
+	}
+
+	workers = malloc(njobs * sizeof(pthread_t));
+
+	for (i = 0; i < njobs; ++i) {
+		pthread_create(&workers[i], NULL, upissue_worker, NULL);
+	}
+
+	for (i = 0; i < njobs; ++i) {
+		pthread_join(workers[i], NULL);
+	}
+
+	free(workers);
+
+	/* Objects no thread started on after an error are also skipped. */
+	stats.skipped += upissue_queue->count - upissue_queue->next_out;
+
+	return upissue_queue->err;
+}
+
+/* Print a summary of the upissued objects. */
+static void print_stats(void)
+{
+	fprintf(stderr, "Total objects upissued: %d\n", stats.upissued);
+	fprintf(stderr, "Total objects not upissued: %d\n", stats.failed);
+	fprintf(stderr, "Total objects skipped: %d\n", stats.skipped);
 }
 
 int main(int argc, char **argv)
 {
 	int i;
 	bool islist = false;
+	bool show_stats = false;
+	int njobs = 1;
+	int err = 0;
 
-	const char *sopts = "ivsNfrRI:q01:2:4delc:t:Hwmuz:^h?";
+	const char *sopts = "ivsNfrRI:j:q01:2:4delc:Tt:Hwmuz:^h?";
 	struct option lopts[] = {
 		{"version"           , no_argument      , 0, 0},
 		{"help"              , no_argument      , 0, 'h'},
@@ -847,6 +1144,7 @@ int main(int argc, char **argv)
 		{"keep-date"         , no_argument      , 0, 's'},
 		{"change-date"       , no_argument      , 0, 's'},
 		{"official"          , no_argument      , 0, 'i'},
+		{"jobs"              , required_argument, 0, 'j'},
 		{"list"              , no_argument      , 0, 'l'},
 		{"modify"            , no_argument      , 0, 'm'},
 		{"omit-issue"        , no_argument      , 0, 'N'},
@@ -855,6 +1153,7 @@ int main(int argc, char **argv)
 		{"keep-changes"      , no_argument      , 0, 'r'},
 		{"remove-changes"    , no_argument      , 0, 'r'},
 		{"date"              , required_argument, 0, 'I'},
+		{"summary"           , no_argument      , 0, 'T'},
 		{"type"              , required_argument, 0, 't'},
 		{"clean-rfus"        , no_argument      , 0, 'u'},
 		{"highlight"         , no_argument      , 0, 'H'},
@@ -909,6 +1208,12 @@ int main(int argc, char **argv)
 			case 'i':
 				newissue = true;
 				break;
+			case 'j':
+				if ((njobs = atoi(optarg)) < 1) {
+					fprintf(stderr, E_BAD_JOBS, optarg);
+					exit(EXIT_BAD_JOBS);
+				}
+				break;
 			case 'l':
 				islist = true;
 				break;
@@ -932,6 +1237,9 @@ int main(int argc, char **argv)
 			case 's':
 				set_date = false;
 				break;
+			case 'T':
+				show_stats = true;
+				break;
 			case 't':
 				xmlSetProp(rfus->last, BAD_CAST "updateReasonType", BAD_CAST optarg);
 				break;
@@ -963,20 +1271,65 @@ int main(int argc, char **argv)
 		}
 	}
 
+	/* When using multiple threads, the objects are first queued, and then
+	 * upissued concurrently. Modified objects written to stdout (-m
+	 * without -f) are always processed one at a time. */
+	if (njobs > 1 && (optind < argc || islist) && !(only_mod && !overwrite)) {
+		xmlInitParser();
+
+		/* Use the same issue date for all objects. */
+		if (!issdate) {
+			time_t now;
+
+			time(&now);
+			issdate = malloc(11);
+			strftime(issdate, 11, "%Y-%m-%d", localtime(&now));
+		}
+
+		upissue_queue = malloc(sizeof(struct upissue_queue));
+		upissue_queue->max = 16;
+		upissue_queue->paths = malloc(upissue_queue->max * PATH_MAX);
+		upissue_queue->count = 0;
+		upissue_queue->next = 0;
+		upissue_queue->next_out = 0;
+		upissue_queue->err = 0;
+		pthread_mutex_init(&upissue_queue->lock, NULL);
+		pthread_cond_init(&upissue_queue->turn, NULL);
+	}
+
 	if (optind < argc) {
 		for (i = optind; i < argc; i++) {
+			int e;
+
 			if (islist) {
-				upissue_list(argv[i]);
+				e = upissue_list(argv[i]);
 			} else {
-				upissue(argv[i]);
+				e = upissue_file(argv[i]);
+			}
+
+			if (e != 0) {
+				err = e;
 			}
 		}
 	} else if (islist) {
-		upissue_list(NULL);
+		err = upissue_list(NULL);
 	} else {
 		no_issue = true;
 		overwrite = true;
-		upissue("-");
+		err = upissue_file("-");
+	}
+
+	if (upissue_queue) {
+		err = upissue_all(njobs);
+
+		pthread_mutex_destroy(&upissue_queue->lock);
+		pthread_cond_destroy(&upissue_queue->turn);
+		free(upissue_queue->paths);
+		free(upissue_queue);
+	}
+
+	if (show_stats) {
+		print_stats();
 	}
 
 	free(firstver);
@@ -987,5 +1340,5 @@ int main(int argc, char **argv)
 
 	xmlCleanupParser();
 
-	return 0;
+	return err;
 }
@@ -1,13 +1,15 @@
 #include <unistd.h>
 #include <getopt.h>
 #include <string.h>
+#include <stdbool.h>
 #include <libxml/tree.h>
 #include <libxml/xmlschemas.h>
 #include <libxml/debugXML.h>
 #include "s1kd_tools.h"
+#include "s1kd_dirwalk.h"
 
 #define PROG_NAME "s1kd-validate"
-#define VERSION "2.6.1"
+#define VERSION "2.8.0"
 
 #define ERR_PREFIX PROG_NAME ": ERROR: "
 #define SUCCESS_PREFIX PROG_NAME ": SUCCESS: "
@@ -85,7 +87,7 @@ static void suppress_error(void *userData, xmlErrorPtr error)
 {
 }
 
-xmlStructuredErrorFunc schema_errfunc = print_error;
+static xmlStructuredErrorFunc schema_errfunc = print_error;
 
 /* Print the XML tree to stdout if it is valid. */
 static int output_tree = 0;
@@ -130,33 +132,6 @@ static struct s1kd_schema_parser *add_schema_parser(char *url)
 	return parser;
 }
 
-static void show_help(void)
-{
-	puts("Usage: " PROG_NAME " [-d <dir>] [-s <path>] [-x <URI>] [-efloqv^h?] [<object>...]");
-	puts("");
-	puts("Options:");
-	puts("  -d, --schemas <dir>   Search for schemas in <dir> instead of using the URL.");
-	puts("  -e, --ignore-empty    Ignore empty/non-XML documents.");
-	puts("  -f, --filenames       List invalid files.");
-	puts("  -h, -?, --help        Show help/usage message.");
-	puts("  -l, --list            Treat input as list of filenames.");
-	puts("  -o, --output-valid    Output valid CSDB objects to stdout.");
-	puts("  -q, --quiet           Silent (no output).");
-	puts("  -s, --schema <path>   Validate against the given schema.");
-	puts("  -v, --verbose         Verbose output.");
-	puts("  -x, --exclude <URI>   Exclude namespace from validation by URI.");
-	puts("  -^, --remove-deleted  Validate with elements marked as \"delete\" removed.");
-	puts("  --version             Show version information.");
-	puts("  <object>              Any number of CSDB objects to validate.");
-	LIBXML2_PARSE_LONGOPT_HELP
-}
-
-static void show_version(void)
-{
-	printf("%s (s1kd-tools) %s\n", PROG_NAME, VERSION);
-	printf("Using libxml %s\n", xmlParserVersion);
-}
-
 static void add_ignore_ns(xmlNodePtr ignore_ns, const char *arg)
 {
 	xmlNewChild(ignore_ns, NULL, BAD_CAST "ignore", BAD_CAST arg);
@@ -191,10 +166,48 @@ static void strip_ns(xmlDocPtr doc, xmlNodePtr ignore)
 	xmlXPathFreeContext(ctxt);
 }
 
+/* Add an error to a validation report. */
+static void add_report_error(xmlNodePtr report, xmlNodePtr node, long line, const char *message)
+{
+	xmlNodePtr error;
+	xmlChar line_s[32];
+
+	error = xmlNewChild(report, NULL, BAD_CAST "error", NULL);
+
+	if (line > 0) {
+		xmlStrPrintf(line_s, 32, "%ld", line);
+		xmlSetProp(error, BAD_CAST "line", line_s);
+	}
+
+	if (node) {
+		xmlChar *path = xmlGetNodePath(node);
+		xmlSetProp(error, BAD_CAST "path", path);
+		xmlFree(path);
+	}
+
+	xmlNewTextChild(error, NULL, BAD_CAST "message", BAD_CAST message);
+}
+
+/* Report an xs:IDREF with no matching xs:ID. */
+static void bad_idref(const char *fname, xmlNodePtr attr, const char *id, bool print, xmlNodePtr report)
+{
+	if (print) {
+		fprintf(stderr, E_BAD_IDREF, fname, xmlGetLineNo(attr->parent), id);
+	}
+
+	if (report) {
+		char msg[512];
+		snprintf(msg, 512, "No matching ID for '%s'.", id);
+		add_report_error(report, attr->parent, xmlGetLineNo(attr->parent), msg);
+	}
+}
+
 /* Check that certain attributes of type xs:IDREF and xs:IDREFS have a matching
  * xs:ID attribute.
+ *
+ * Errors are printed if print is true, and added to report if it is not NULL.
  */
-static int check_idrefs(xmlDocPtr doc, const char *fname)
+static int check_idrefs(xmlDocPtr doc, const char *fname, bool print, xmlNodePtr report)
 {
 	xmlXPathContextPtr ctx;
 	xmlXPathObjectPtr obj;
@@ -206,15 +219,11 @@ static int check_idrefs(xmlDocPtr doc, const char *fname)
 	obj = xmlXPathEvalExpression(INVALID_ID_XPATH, ctx);
 
 	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
-		if (verbosity > SILENT) {
+		if (print || report) {
 			int i;
 			for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
 				xmlChar *id = xmlNodeGetContent(obj->nodesetval->nodeTab[i]);
-				fprintf(stderr,
-					E_BAD_IDREF,
-					fname,
-					xmlGetLineNo(obj->nodesetval->nodeTab[i]->parent),
-					(char *) id);
+				bad_idref(fname, obj->nodesetval->nodeTab[i], (char *) id, print, report);
 				xmlFree(id);
 			}
 		}
@@ -230,11 +239,11 @@ static int check_idrefs(xmlDocPtr doc, const char *fname)
 	if (!xmlXPathNodeSetIsEmpty(obj->nodesetval)) {
 		int i;
 		for (i = 0; i < obj->nodesetval->nodeNr; ++i) {
-			char *ids, *id = NULL;
+			char *ids, *id = NULL, *end;
 
 			ids = (char *) xmlNodeGetContent(obj->nodesetval->nodeTab[i]);
 
-			while ((id = strtok(id ? NULL : ids, " "))) {
+			while ((id = strtok_r(id ? NULL : ids, " ", &end))) {
 				xmlChar xpath[256];
 				xmlXPathObjectPtr res;
 
@@ -243,14 +252,7 @@ static int check_idrefs(xmlDocPtr doc, const char *fname)
 				res = xmlXPathEvalExpression(xpath, ctx);
 
 				if (xmlXPathNodeSetIsEmpty(res->nodesetval)) {
-					if (verbosity > SILENT) {
-						fprintf(stderr,
-							E_BAD_IDREF,
-							fname,
-							xmlGetLineNo(obj->nodesetval->nodeTab[i]->parent),
-							(char *) id);
-					}
-
+					bad_idref(fname, obj->nodesetval->nodeTab[i], id, print, report);
 					++err;
 				}
 
@@ -276,6 +278,90 @@ static void resize_schema_parsers(void)
 	}
 }
 
+#ifndef LIBS1KD
+/* Socket of an s1kd-daemon to send requests to. */
+static char *daemon_socket = NULL;
+
+/* Validate a file using a running s1kd-daemon.
+ *
+ * Returns -1 if the daemon could not carry out the request, in which case the
+ * file should be validated as normal.
+ */
+static int daemon_validate(const char *fname, const char *schema, enum show_fnames show_fnames, int rem_del)
+{
+	char *args[4];
+	int nargs = 0;
+	char *body;
+	int size;
+	int err;
+	xmlDocPtr report;
+	xmlNodePtr document, cur;
+
+	args[nargs++] = "validate";
+	args[nargs++] = (char *) fname;
+	args[nargs++] = rem_del ? "-^" : "-";
+	if (schema) {
+		args[nargs++] = (char *) schema;
+	}
+
+	if ((err = daemon_request(daemon_socket, args, nargs, &body, &size)) == -1) {
+		return -1;
+	}
+
+	report = read_xml_mem(body, size);
+	free(body);
+
+	if (!report || !(document = xpath_first_node(report, NULL, BAD_CAST "//document"))) {
+		xmlFreeDoc(report);
+		return -1;
+	}
+
+	/* Errors are printed as they would be if the file were validated
+	 * here. */
+	if (verbosity > SILENT) {
+		for (cur = document->children; cur; cur = cur->next) {
+			xmlChar *line, *msg;
+
+			if (xmlStrcmp(cur->name, BAD_CAST "error") != 0) {
+				continue;
+			}
+
+			line = xmlGetProp(cur, BAD_CAST "line");
+			msg = xpath_first_value(report, cur, BAD_CAST "message");
+
+			if (line) {
+				fprintf(stderr, ERR_PREFIX "%s (%s): %s\n", fname, (char *) line, (char *) msg);
+			} else {
+				fprintf(stderr, ERR_PREFIX "%s\n", (char *) msg);
+			}
+
+			xmlFree(line);
+			xmlFree(msg);
+		}
+	}
+
+	if (verbosity >= VERBOSE) {
+		xmlChar *url = xmlGetProp(document, BAD_CAST "schema");
+
+		if (err) {
+			fprintf(stderr, FAILED_PREFIX "%s fails to validate against schema %s\n", fname, (char *) url);
+		} else {
+			fprintf(stderr, SUCCESS_PREFIX "%s validates against schema %s\n", fname, (char *) url);
+		}
+
+		xmlFree(url);
+	}
+
+	if ((show_fnames == SHOW_INVALID && err != 0) || (show_fnames == SHOW_VALID && err == 0)) {
+		printf("%s\n", fname);
+	}
+
+	xmlFreeDoc(report);
+
+	return err;
+}
+#endif
+
 static int validate_file(const char *fname, const char *schema_dir, const char *schema, xmlNodePtr ignore_ns, enum show_fnames show_fnames, int ignore_empty, int rem_del)
 {
 	xmlDocPtr doc;
@@ -285,6 +371,16 @@ static int validate_file(const char *fname, const char *schema_dir, const char *
 	struct s1kd_schema_parser *parser;
 	int err = 0;
 
+#ifndef LIBS1KD
+	/* The daemon only carries out plain validation of files. */
+	if (daemon_socket && strcmp(fname, "-") != 0 && strcmp(schema_dir, "") == 0 && !ignore_ns->children && !output_tree &&
+	    (err = daemon_validate(fname, schema, show_fnames, rem_del)) != -1) {
+		return err;
+	}
+
+	err = 0;
+#endif
+
 	if (!(doc = read_xml_doc(fname))) {
 		return !ignore_empty;
 	}
@@ -312,7 +408,7 @@ static int validate_file(const char *fname, const char *schema_dir, const char *
 	 * are defined in the schema, but at this time libxml2 does not check
 	 * these when validating.
 	 */
-	err += check_idrefs(doc, fname);
+	err += check_idrefs(doc, fname, verbosity > SILENT, NULL);
 
 	dmodule = xmlDocGetRootElement(doc);
 
@@ -428,6 +524,249 @@ static int validate_file_list(const char *fname, char *schema_dir, const char *s
 	return err;
 }
 
+#ifdef LIBS1KD
+typedef enum {
+	S1KD_VALIDATE_REMOVE_DELETED = 1,
+	S1KD_VALIDATE_NORMAL_LOG = 2
+} s1kdValidateOption;
+
+struct _s1kdSchema {
+	char *url;
+	xmlSchemaPtr schema;
+};
+typedef struct _s1kdSchema *s1kdSchemaPtr;
+
+/* Where to send the errors found while validating a document. */
+struct validation_errors {
+	xmlNodePtr report;
+	bool print;
+};
+
+/* Add a schema validation error to the report of a document. */
+static void report_error(void *userData, xmlErrorPtr error)
+{
+	struct validation_errors *errors = userData;
+	char *msg;
+	size_t n;
+
+	msg = strdup(error->message ? error->message : "");
+
+	/* libxml2 messages end with a newline, which is not wanted in the
+	 * report. */
+	if ((n = strlen(msg)) > 0 && msg[n - 1] == '\n') {
+		msg[n - 1] = '\0';
+	}
+
+	add_report_error(errors->report, error->node, error->line, msg);
+
+	free(msg);
+
+	if (errors->print) {
+		print_error(stderr, error);
+	}
+}
+
+s1kdSchemaPtr s1kdNewSchema(const char *url)
+{
+	xmlSchemaParserCtxtPtr ctxt;
+	xmlSchemaPtr schema;
+	s1kdSchemaPtr s;
+
+	if (!(ctxt = xmlSchemaNewParserCtxt(url))) {
+		return NULL;
+	}
+
+	xmlSchemaSetParserStructuredErrors(ctxt, suppress_error, NULL);
+	schema = xmlSchemaParse(ctxt);
+	xmlSchemaFreeParserCtxt(ctxt);
+
+	if (!schema) {
+		return NULL;
+	}
+
+	s = malloc(sizeof(struct _s1kdSchema));
+	s->url = strdup(url);
+	s->schema = schema;
+
+	return s;
+}
+
+void s1kdFreeSchema(s1kdSchemaPtr schema)
+{
+	if (!schema) {
+		return;
+	}
+
+	free(schema->url);
+	xmlSchemaFree(schema->schema);
+	free(schema);
+}
+
+/* Validate a document which belongs to the caller of this function.
+ *
+ * Validation registers the xs:ID attributes of the document and sets their
+ * types, so the document is modified even if it is valid. */
+static int validate_own_doc(xmlDocPtr doc, s1kdSchemaPtr schema, int options, xmlDocPtr *report)
+{
+	int err = 0;
+	xmlDocPtr rep;
+	xmlNodePtr node;
+	s1kdSchemaPtr own = NULL;
+	struct validation_errors errors;
+
+	rep = xmlNewDoc(BAD_CAST "1.0");
+	node = xmlNewNode(NULL, BAD_CAST "validation");
+	xmlDocSetRootElement(rep, node);
+
+	node = xmlNewChild(node, NULL, BAD_CAST "document", NULL);
+	xmlSetProp(node, BAD_CAST "path", doc->URL);
+
+	errors.report = node;
+	errors.print = optset(options, S1KD_VALIDATE_NORMAL_LOG);
+
+	if (optset(options, S1KD_VALIDATE_REMOVE_DELETED)) {
+		rem_delete_elems(doc);
+	}
+
+	err += check_idrefs(doc, doc->URL ? (char *) doc->URL : "-", errors.print, node);
+
+	if (!schema) {
+		xmlChar *url;
+
+		if ((url = xmlGetNsProp(xmlDocGetRootElement(doc), BAD_CAST "noNamespaceSchemaLocation", XSI_URI))) {
+			schema = own = s1kdNewSchema((char *) url);
+			xmlFree(url);
+		}
+	}
+
+	if (schema) {
+		xmlSchemaValidCtxtPtr valid_ctxt;
+
+		xmlSetProp(node, BAD_CAST "schema", BAD_CAST schema->url);
+
+		/* The compiled schema is only read while validating, so each
+		 * call gets its own validation context to share it. */
+		valid_ctxt = xmlSchemaNewValidCtxt(schema->schema);
+		xmlSchemaSetValidStructuredErrors(valid_ctxt, report_error, &errors);
+
+		if (xmlSchemaValidateDoc(valid_ctxt, doc)) {
+			++err;
+		}
+
+		xmlSchemaFreeValidCtxt(valid_ctxt);
+	} else {
+		add_report_error(node, NULL, 0, "No schema.");
+		++err;
+	}
+
+	if (!node->children) {
+		xmlNewChild(node, NULL, BAD_CAST "noErrors", NULL);
+	}
+
+	s1kdFreeSchema(own);
+
+	if (report) {
+		*report = rep;
+	} else {
+		xmlFreeDoc(rep);
+	}
+
+	return err;
+}
+
+int s1kdDocValidate(xmlDocPtr doc, s1kdSchemaPtr schema, int options, xmlDocPtr *report)
+{
+	xmlDocPtr copy;
+	int err;
+
+	/* A copy is validated, so that the caller's document is never
+	 * modified and may be validated by several threads at once. */
+	copy = xmlCopyDoc(doc, 1);
+	err = validate_own_doc(copy, schema, options, report);
+	xmlFreeDoc(copy);
+
+	return err;
+}
+
+int s1kdCtxValidate(const s1kdContext *ctx, const char *object_xml, int object_size, s1kdSchemaPtr schema, int options, char **report_xml, int *report_size)
+{
+	xmlDocPtr doc, rep;
+	int err;
+
+	if (!(doc = read_xml_mem_ctx(ctx, object_xml, object_size))) {
+		return 1;
+	}
+
+	err = validate_own_doc(doc, schema, options, &rep);
+	xmlFreeDoc(doc);
+
+	if (report_xml && report_size) {
+		xmlDocDumpMemory(rep, (xmlChar **) report_xml, report_size);
+	}
+
+	xmlFreeDoc(rep);
+
+	return err;
+}
+
+int s1kdValidate(const char *object_xml, int object_size, s1kdSchemaPtr schema, int options, char **report_xml, int *report_size)
+{
+	return s1kdCtxValidate(NULL, object_xml, object_size, schema, options, report_xml, report_size);
+}
+#else
+/* Validate the objects in a directory and its subdirectories. Each object is
+ * validated as soon as it is found, while the rest are still being searched
+ * for. */
+static int validate_dir(const char *path, const char *schema_dir, const char *schema, xmlNodePtr ignore_ns, enum show_fnames show_fnames, int ignore_empty, int rem_del)
+{
+	struct dir_walk *walk;
+	char fpath[PATH_MAX];
+	int err = 0;
+
+	walk = dir_walk_new(true, is_object_file, NULL);
+
+	if (!dir_walk_add(walk, path)) {
+		dir_walk_free(walk);
+		return !ignore_empty;
+	}
+
+	while (dir_walk_next(walk, fpath)) {
+		err += validate_file(fpath, schema_dir, schema, ignore_ns, show_fnames, ignore_empty, rem_del);
+	}
+
+	dir_walk_free(walk);
+
+	return err;
+}
+
+static void show_help(void)
+{
+	puts("Usage: " PROG_NAME " [-d <dir>] [-s <path>] [-x <URI>] [-efloqv^h?] [<object>...]");
+	puts("");
+	puts("Options:");
+	puts("  -d, --schemas <dir>   Search for schemas in <dir> instead of using the URL.");
+	puts("  --daemon <socket>     Send requests to an s1kd-daemon listening on <socket>.");
+	puts("  -e, --ignore-empty    Ignore empty/non-XML documents.");
+	puts("  -f, --filenames       List invalid files.");
+	puts("  -h, -?, --help        Show help/usage message.");
+	puts("  -l, --list            Treat input as list of filenames.");
+	puts("  -o, --output-valid    Output valid CSDB objects to stdout.");
+	puts("  -q, --quiet           Silent (no output).");
+	puts("  -s, --schema <path>   Validate against the given schema.");
+	puts("  -v, --verbose         Verbose output.");
+	puts("  -x, --exclude <URI>   Exclude namespace from validation by URI.");
+	puts("  -^, --remove-deleted  Validate with elements marked as \"delete\" removed.");
+	puts("  --version             Show version information.");
+	puts("  <object>              Any number of CSDB objects or directories to validate.");
+	LIBXML2_PARSE_LONGOPT_HELP
+}
+
+static void show_version(void)
+{
+	printf("%s (s1kd-tools) %s\n", PROG_NAME, VERSION);
+	printf("Using libxml %s\n", xmlParserVersion);
+}
+
 int main(int argc, char *argv[])
 {
 	int c, i;
@@ -456,6 +795,7 @@ int main(int argc, char *argv[])
 		{"ignore-empty"   , no_argument      , 0, 'e'},
 		{"schema"         , required_argument, 0, 's'},
 		{"remove-deleted" , no_argument      , 0, '^'},
+		{"daemon"         , required_argument, 0, 0},
 		LIBXML2_PARSE_LONGOPT_DEFS
 		{0, 0, 0, 0}
 	};
@@ -471,6 +811,9 @@ int main(int argc, char *argv[])
 				if (strcmp(lopts[loptind].name, "version") == 0) {
 					show_version();
 					return EXIT_SUCCESS;
+				} else if (strcmp(lopts[loptind].name, "daemon") == 0) {
+					free(daemon_socket);
+					daemon_socket = strdup(optarg);
 				}
 				LIBXML2_PARSE_LONGOPT_HANDLE(lopts, loptind)
 				break;
@@ -504,6 +847,8 @@ int main(int argc, char *argv[])
 		for (i = optind; i < argc; ++i) {
 			if (is_list) {
 				err += validate_file_list(argv[i], schema_dir, schema, ignore_ns, show_fnames, ignore_empty, rem_del);
+			} else if (is_dir_arg(argv[i])) {
+				err += validate_dir(argv[i], schema_dir, schema, ignore_ns, show_fnames, ignore_empty, rem_del);
 			} else {
 				err += validate_file(argv[i], schema_dir, schema, ignore_ns, show_fnames, ignore_empty, rem_del);
 			}
@@ -524,7 +869,9 @@ int main(int argc, char *argv[])
 	free(schema_parsers);
 	xmlFreeNode(ignore_ns);
 	free(schema);
+	free(daemon_socket);
 	xmlCleanupParser();
 
 	return err ? EXIT_FAILURE : EXIT_SUCCESS;
 }
+#endif